@@ -0,0 +1,140 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench_counters.h"
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#endif
+
+#include <cstring>
+
+static std::atomic<uint64_t> totalAllocations{0};
+
+void *operator new(std::size_t size) {
+    totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    auto p = std::malloc(size ? size : 1);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace libasm {
+namespace bench {
+
+BenchCounters::BenchCounters() : _perf_fd(-1), _allocations(0), _cache_misses(0), _peak_rss(0) {
+#if defined(__linux__)
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    _perf_fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+BenchCounters::~BenchCounters() {
+#if defined(__linux__)
+    if (_perf_fd >= 0)
+        close(_perf_fd);
+#endif
+}
+
+void BenchCounters::resetPeakRss() {
+#if defined(__linux__)
+    auto clear = fopen("/proc/self/clear_refs", "w");
+    if (clear) {
+        fputs("5", clear);
+        fclose(clear);
+    }
+#endif
+}
+
+uint64_t BenchCounters::readPeakRss() {
+#if defined(__linux__)
+    auto status = fopen("/proc/self/status", "r");
+    if (status) {
+        char line[128];
+        unsigned long long peak = 0;
+        while (fgets(line, sizeof(line), status)) {
+            if (sscanf(line, "VmHWM: %llu kB", &peak) == 1)
+                break;
+        }
+        fclose(status);
+        if (peak)
+            return peak;
+    }
+#endif
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) < 0)
+        return 0;
+    return usage.ru_maxrss;
+}
+
+void BenchCounters::start() {
+    resetPeakRss();
+#if defined(__linux__)
+    if (_perf_fd >= 0) {
+        ioctl(_perf_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(_perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+    _allocations = totalAllocations.load(std::memory_order_relaxed);
+}
+
+void BenchCounters::stop() {
+    _allocations = totalAllocations.load(std::memory_order_relaxed) - _allocations;
+#if defined(__linux__)
+    if (_perf_fd >= 0) {
+        ioctl(_perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(_perf_fd, &_cache_misses, sizeof(_cache_misses)) != sizeof(_cache_misses))
+            _cache_misses = 0;
+    }
+#endif
+    _peak_rss = readPeakRss();
+}
+
+}  // namespace bench
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __BENCH_COUNTERS_H__
+#define __BENCH_COUNTERS_H__
+
+#include <cstdint>
+
+namespace libasm {
+namespace bench {
+
+/**
+ * Counters sampled around a benchmark. Allocations are counted by the
+ * global operator new of this program. Cache misses are counted by a
+ * hardware performance counter, where available. Peak resident set size
+ * is reset at |start| where the kernel allows it, otherwise it is the
+ * peak of the process.
+ */
+class BenchCounters {
+public:
+    BenchCounters();
+    ~BenchCounters();
+
+    void start();
+    void stop();
+
+    uint64_t allocations() const { return _allocations; }
+    bool hasCacheMisses() const { return _perf_fd >= 0; }
+    uint64_t cacheMisses() const { return _cache_misses; }
+    /** peak resident set size in KiB */
+    uint64_t peakRss() const { return _peak_rss; }
+
+private:
+    int _perf_fd;
+    uint64_t _allocations;
+    uint64_t _cache_misses;
+    uint64_t _peak_rss;
+
+    static void resetPeakRss();
+    static uint64_t readPeakRss();
+};
+
+}  // namespace bench
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
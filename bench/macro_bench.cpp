@@ -0,0 +1,315 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "macro_bench.h"
+
+#include "asm_commander.h"
+#include "dis_commander.h"
+#include "json_message.h"
+#include "phase_stats.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+namespace libasm {
+namespace bench {
+
+using namespace libasm::cli;
+
+std::string MacroBench::Result::toJson(const SourceGenerator::Params &params) const {
+    const auto writeStats = [](JsonWriter &json, const char *key, const std::vector<Stat> &stats) {
+        if (stats.empty())
+            return;
+        json.key(key).beginArray();
+        for (const auto &stat : stats) {
+            json.beginObject();
+            json.key("phase").string(stat.name);
+            json.key("count").integer(stat.count);
+            json.key("total_ns").integer(stat.total_ns);
+            json.key("self_ns").integer(stat.self_ns);
+            json.endObject();
+        }
+        json.endArray();
+    };
+    JsonWriter json;
+    json.beginObject();
+    json.key("name").string(cpu + "/" + std::to_string(lines));
+    json.key("cpu").string(cpu);
+    json.key("lines").integer(lines);
+    json.key("label_density").integer(params.labelDensity);
+    json.key("forward_ratio").integer(params.forwardRatio);
+    json.key("include_depth").integer(params.includeDepth);
+    json.key("equates").integer(params.equates);
+    json.key("hex_bytes").integer(bytes);
+    json.key("passes").integer(passes);
+    json.key("gen_ns").integer(gen.elapsed_ns);
+    json.key("asm_ns").integer(assemble.elapsed_ns);
+    json.key("dis_ns").integer(disassemble.elapsed_ns);
+    json.key("asm_peak_rss_kb").integer(assemble.peak_rss);
+    json.key("dis_peak_rss_kb").integer(disassemble.peak_rss);
+    writeStats(json, "asm_stats", assemble.stats);
+    writeStats(json, "dis_stats", disassemble.stats);
+    return json.endObject().str();
+}
+
+MacroBench::MacroBench()
+    : _prog_name(nullptr),
+      _temp_dir(false),
+      _output_name(nullptr),
+      _params{0, 20, 30, 1, 100} {}
+
+MacroBench::~MacroBench() {
+    if (_temp_dir)
+        rmdir(_work_dir.c_str());
+}
+
+static bool parseInt(const char *str, int &value, int max = INT32_MAX) {
+    char *end;
+    const auto val = strtol(str, &end, 10);
+    if (end == str || *end || val < 0 || val > max)
+        return false;
+    value = val;
+    return true;
+}
+
+static bool parseSizes(const char *str, std::vector<int> &sizes) {
+    sizes.clear();
+    for (auto p = str; *p;) {
+        char *end;
+        const auto val = strtol(p, &end, 10);
+        if (end == p || val <= 0 || (*end && *end != ','))
+            return false;
+        sizes.push_back(val);
+        p = *end ? end + 1 : end;
+    }
+    return !sizes.empty();
+}
+
+int MacroBench::parseArgs(int argc, const char **argv) {
+    _prog_name = argv[0];
+    _sizes = {1000, 2000, 4000, 8000};
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        if (*opt != '-') {
+            _cpus.push_back(opt);
+            continue;
+        }
+        if (opt[1] == 0 || opt[2] != 0 || ++i >= argc)
+            return 1;
+        const char *arg = argv[i];
+        switch (opt[1]) {
+        case 'n':
+            if (!parseSizes(arg, _sizes))
+                return 1;
+            break;
+        case 'L':
+            if (!parseInt(arg, _params.labelDensity, 100))
+                return 1;
+            break;
+        case 'F':
+            if (!parseInt(arg, _params.forwardRatio, 100))
+                return 1;
+            break;
+        case 'I':
+            if (!parseInt(arg, _params.includeDepth, SourceGenerator::MAX_INCLUDE_DEPTH))
+                return 1;
+            break;
+        case 'E':
+            if (!parseInt(arg, _params.equates))
+                return 1;
+            break;
+        case 'w':
+            _work_dir = arg;
+            break;
+        case 'o':
+            _output_name = arg;
+            break;
+        default:
+            return 1;
+        }
+    }
+    if (_cpus.empty())
+        _cpus = SourceGenerator::cpus();
+    return 0;
+}
+
+int MacroBench::usage() const {
+    std::string cpus;
+    for (const auto cpu : SourceGenerator::cpus())
+        cpus += std::string(" ") + cpu;
+    fprintf(stderr,
+            "usage: %s [-n <lines>[,<lines>...]] [-L <percent>] [-F <percent>] [-I <depth>]\n"
+            "       [-E <equates>] [-w <dir>] [-o <output>] [<CPU>...]\n"
+            "  -n <lines>  : program sizes; default 1000,2000,4000,8000\n"
+            "  -L <percent>: lines which have a label; default 20\n"
+            "  -F <percent>: label references which refer forward; default 30\n"
+            "  -I <depth>  : nesting depth of include files, up to %d; default 1\n"
+            "  -E <equates>: number of equated constants; default 100\n"
+            "  -w <dir>    : directory to write programs; default temporary\n"
+            "  -o <output> : write results in JSON lines\n"
+            "  <CPU>       :%s\n",
+            _prog_name, SourceGenerator::MAX_INCLUDE_DEPTH, cpus.c_str());
+    return 2;
+}
+
+int MacroBench::run() {
+    if (_work_dir.empty()) {
+        const char *tmp = getenv("TMPDIR");
+        std::string temp = std::string(tmp ? tmp : "/tmp") + "/libasm-bench-XXXXXX";
+        if (mkdtemp(&temp[0]) == nullptr) {
+            fprintf(stderr, "Can't create temporary directory %s\n", temp.c_str());
+            return 1;
+        }
+        _work_dir = temp;
+        _temp_dir = true;
+    }
+    FILE *output = nullptr;
+    if (_output_name) {
+        output = fopen(_output_name, "w");
+        if (output == nullptr) {
+            fprintf(stderr, "Can't open output file %s\n", _output_name);
+            return 1;
+        }
+    }
+    printf("%-8s %7s %7s %6s %9s %9s %9s %9s %9s %9s\n", "cpu", "lines", "hex", "passes",
+            "gen ms", "asm ms", "asm ns/l", "asm KiB", "dis ms", "dis KiB");
+    auto failed = 0;
+    for (const auto cpu : _cpus) {
+        for (const auto lines : _sizes) {
+            Result result;
+            if (benchmark(cpu, lines, result)) {
+                failed++;
+                break;
+            }
+            report(result, output);
+        }
+    }
+    if (output)
+        fclose(output);
+    return failed ? 1 : 0;
+}
+
+int MacroBench::measure(Phase &result, const std::function<int()> &phase) {
+    typedef std::chrono::steady_clock clock;
+    _counters.start();
+    const auto start = clock::now();
+    const auto status = phase();
+    const auto elapsed = clock::now() - start;
+    _counters.stop();
+    result.elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    result.peak_rss = _counters.peakRss();
+    result.stats.clear();
+#if defined(LIBASM_STATS)
+    // Commanders reset statistics at start and keep them unless --stats.
+    for (auto i = 0; i < stats::PHASE_END; i++) {
+        const auto phase = static_cast<stats::Phase>(i);
+        const auto &counter = stats::counter(phase);
+        result.stats.push_back(
+                Stat{stats::name(phase), counter.count, counter.total_ns, counter.self_ns});
+    }
+    stats::reset();
+#endif
+    return status;
+}
+
+template <typename COMMANDER, typename REGISTRY>
+static int runCommander(const REGISTRY &registry, const std::vector<std::string> &args,
+        const std::function<int(COMMANDER &)> &run) {
+    std::vector<const char *> argv;
+    for (const auto &arg : args)
+        argv.push_back(arg.c_str());
+    argv.push_back(nullptr);
+    COMMANDER commander(registry);
+    if (commander.parseArgs(args.size(), argv.data()))
+        return commander.usage();
+    return run(commander);
+}
+
+int MacroBench::benchmark(const char *cpu, int lines, Result &result) {
+    result.cpu = cpu;
+    result.lines = lines;
+    auto params = _params;
+    params.lines = lines;
+    SourceGenerator generator(params);
+    std::vector<std::string> files;
+    const auto name = _work_dir + "/bench";
+    const auto cleanup = [&](int status) {
+        for (const auto &file : files)
+            unlink(file.c_str());
+        return status;
+    };
+    if (measure(result.gen, [&]() { return generator.generate(cpu, _work_dir, "bench", files); })) {
+        fprintf(stderr, "%s: Can't generate program in %s\n", cpu, _work_dir.c_str());
+        return cleanup(1);
+    }
+
+    const auto hex = name + ".hex";
+    files.push_back(hex);
+    _assemblers.restore();
+    const std::vector<std::string> asmArgs{"asm", "-C", cpu, "-o", hex, files.front()};
+    if (measure(result.assemble, [&]() {
+            return runCommander<AsmCommander>(
+                    _assemblers.registry, asmArgs, [&](AsmCommander &commander) {
+                        const auto status = commander.assemble();
+                        result.passes = commander.passes();
+                        return status;
+                    });
+        })) {
+        fprintf(stderr, "%s: Can't assemble %s\n", cpu, files.front().c_str());
+        return cleanup(1);
+    }
+    struct stat st;
+    result.bytes = stat(hex.c_str(), &st) == 0 ? st.st_size : 0;
+
+    const auto dis = name + ".dis";
+    files.push_back(dis);
+    _disassemblers.restore();
+    const std::vector<std::string> disArgs{"dis", "-C", cpu, "-o", dis, hex};
+    if (measure(result.disassemble, [&]() {
+            return runCommander<DisCommander>(_disassemblers.registry, disArgs,
+                    [](DisCommander &commander) { return commander.disassemble(); });
+        })) {
+        fprintf(stderr, "%s: Can't disassemble %s\n", cpu, hex.c_str());
+        return cleanup(1);
+    }
+    return cleanup(0);
+}
+
+void MacroBench::report(const Result &result, FILE *output) const {
+    const auto ms = [](const Phase &phase) { return phase.elapsed_ns / 1e6; };
+    printf("%-8s %7d %7llu %6d %9.2f %9.2f %9.1f %9llu %9.2f %9llu\n", result.cpu.c_str(),
+            result.lines, static_cast<unsigned long long>(result.bytes), result.passes,
+            ms(result.gen), ms(result.assemble), double(result.assemble.elapsed_ns) / result.lines,
+            static_cast<unsigned long long>(result.assemble.peak_rss), ms(result.disassemble),
+            static_cast<unsigned long long>(result.disassemble.peak_rss));
+    fflush(stdout);
+    if (output)
+        fprintf(output, "%s\n", result.toJson(_params).c_str());
+}
+
+}  // namespace bench
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MACRO_BENCH_H__
+#define __MACRO_BENCH_H__
+
+#include "asm_backends.h"
+#include "bench_counters.h"
+#include "dis_backends.h"
+#include "source_generator.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace bench {
+
+/**
+ * End-to-end benchmarks which assemble synthetic programs of growing
+ * size with AsmCommander, then disassemble the output with
+ * DisCommander. Each phase records wall time and peak resident set
+ * size, so that scaling problems with program size show up. When built
+ * with "make STATS=1", assembling and disassembling also record the
+ * per-phase times of phase_stats.h.
+ */
+class MacroBench {
+public:
+    MacroBench();
+    ~MacroBench();
+
+    int parseArgs(int argc, const char **argv);
+    int usage() const;
+    int run();
+
+private:
+    struct Stat {
+        const char *name;
+        uint64_t count;
+        uint64_t total_ns;
+        uint64_t self_ns;
+    };
+    struct Phase {
+        uint64_t elapsed_ns;
+        uint64_t peak_rss;        // KiB
+        std::vector<Stat> stats;  // empty unless LIBASM_STATS
+    };
+    struct Result {
+        std::string cpu;
+        int lines;
+        uint64_t bytes;  // size of the output file
+        int passes;
+        Phase gen;
+        Phase assemble;
+        Phase disassemble;
+
+        std::string toJson(const SourceGenerator::Params &params) const;
+    };
+
+    const char *_prog_name;
+    std::string _work_dir;
+    bool _temp_dir;
+    const char *_output_name;
+    std::vector<int> _sizes;
+    SourceGenerator::Params _params;
+    std::vector<const char *> _cpus;
+
+    cli::AsmBackends _assemblers;
+    cli::DisBackends _disassemblers;
+    BenchCounters _counters;
+
+    int benchmark(const char *cpu, int lines, Result &result);
+    /** run |phase| once, which returns non-zero on error */
+    int measure(Phase &result, const std::function<int()> &phase);
+    void report(const Result &result, FILE *output) const;
+};
+
+}  // namespace bench
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,408 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "micro_bench.h"
+
+#include "asm_driver.h"
+#include "asm_formatter.h"
+#include "bin_decoder.h"
+#include "bin_memory.h"
+#include "dis_driver.h"
+#include "file_reader.h"
+#include "file_sources.h"
+#include "json_message.h"
+#include "text_printer.h"
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+namespace libasm {
+namespace bench {
+
+using namespace libasm::cli;
+using namespace libasm::driver;
+
+class NullPrinter : public TextPrinter {
+public:
+    void println(const char *text) override {}
+    void format(const char *fmt, ...) override {}
+};
+
+static NullPrinter STDNULL;
+
+std::string BenchResult::toJson() const {
+    JsonWriter json;
+    json.beginObject();
+    json.key("name").string(name);
+    json.key("cpu").string(cpu);
+    json.key("unit").string(unit);
+    json.key("ops").integer(ops);
+    json.key("elapsed_ns").integer(elapsed_ns);
+    json.key("allocations").integer(allocations);
+    json.key("cache_misses");
+    if (hasCacheMisses) {
+        json.integer(cacheMisses);
+    } else {
+        json.raw("null");
+    }
+    return json.endObject().str();
+}
+
+bool BenchResult::parse(const char *line) {
+    JsonRequest json;
+    if (json.parse(line))
+        return false;
+    int64_t value;
+    if (json.string("name") == nullptr)
+        return false;
+    name = json.string("name");
+    cpu = json.string("cpu") ? json.string("cpu") : "";
+    unit = json.string("unit") ? json.string("unit") : "";
+    if (!json.integer("ops", value) || value <= 0)
+        return false;
+    ops = value;
+    if (!json.integer("elapsed_ns", value))
+        return false;
+    elapsed_ns = value;
+    allocations = json.integer("allocations", value) ? value : 0;
+    hasCacheMisses = json.integer("cache_misses", value);
+    cacheMisses = hasCacheMisses ? value : 0;
+    return true;
+}
+
+MicroBench::MicroBench()
+    : _prog_name(nullptr),
+      _dir("../test/reference"),
+      _output_name(nullptr),
+      _baseline_name(nullptr),
+      _min_time_ms(200),
+      _threshold(10),
+      _regressions(0) {}
+
+int MicroBench::parseArgs(int argc, const char **argv) {
+    _prog_name = argv[0];
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        if (*opt != '-') {
+            _filters.push_back(opt);
+            continue;
+        }
+        if (opt[1] == 0 || opt[2] != 0 || ++i >= argc)
+            return 1;
+        switch (opt[1]) {
+        case 'd':
+            _dir = argv[i];
+            break;
+        case 'o':
+            _output_name = argv[i];
+            break;
+        case 'b':
+            _baseline_name = argv[i];
+            break;
+        case 't':
+            _min_time_ms = atoi(argv[i]);
+            if (_min_time_ms <= 0)
+                return 1;
+            break;
+        case 'r':
+            _threshold = atoi(argv[i]);
+            if (_threshold <= 0)
+                return 1;
+            break;
+        default:
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int MicroBench::usage() const {
+    fprintf(stderr,
+            "usage: %s [-d <dir>] [-t <msec>] [-o <output>] [-b <baseline> [-r <percent>]] "
+            "[<filter>...]\n"
+            "  -d <dir>    : directory of test_*.asm and binaries; default ../test/reference\n"
+            "  -t <msec>   : minimum time to measure each benchmark; default 200\n"
+            "  -o <output> : write results in JSON lines\n"
+            "  -b <base>   : compare with results written by -o\n"
+            "  -r <percent>: allowed slowdown from baseline; default 10\n"
+            "  <filter>    : run benchmarks whose name contains <filter>\n",
+            _prog_name);
+    return 2;
+}
+
+bool MicroBench::selected(const std::string &name) const {
+    if (_filters.empty())
+        return true;
+    for (const auto filter : _filters) {
+        if (name.find(filter) != std::string::npos)
+            return true;
+    }
+    return false;
+}
+
+static bool endsWith(const std::string &str, const char *suffix) {
+    const auto len = strlen(suffix);
+    return str.size() >= len && str.compare(str.size() - len, len, suffix) == 0;
+}
+
+static bool exists(const std::string &path) {
+    FileReader file(path);
+    return file.open();
+}
+
+/** find a CPU directive in |source| */
+static std::string sourceCpu(const std::string &source) {
+    FileReader file(source);
+    if (!file.open())
+        return "";
+    StrScanner *line;
+    while ((line = file.readLine()) != nullptr) {
+        if (!isspace(**line))
+            continue;  // label or comment
+        line->skipSpaces();
+        auto word = *line;
+        line->trimStart([](char c) { return !isspace(c) && c != ';'; });
+        if (!word.trimEndAt(*line).iequals_P(PSTR("cpu")))
+            continue;
+        line->skipSpaces();
+        const auto cpu = *line;
+        line->trimStart([](char c) { return !isspace(c) && c != ';'; });
+        return std::string(cpu.str(), line->str());
+    }
+    return "";
+}
+
+std::vector<MicroBench::Reference> MicroBench::references() const {
+    std::vector<Reference> refs;
+    auto dir = opendir(_dir);
+    if (dir == nullptr)
+        return refs;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        const std::string file(entry->d_name);
+        if (file.compare(0, 5, "test_") != 0 || !endsWith(file, ".asm"))
+            continue;
+        Reference ref;
+        ref.name = file.substr(0, file.size() - 4);
+        ref.source = std::string(_dir) + "/" + file;
+        ref.cpu = sourceCpu(ref.source);
+        if (ref.cpu.empty())
+            continue;
+        for (const auto ext : {".hex", ".s19", ".s28"}) {
+            const auto binary = std::string(_dir) + "/" + ref.name + ext;
+            if (exists(binary)) {
+                ref.binary = binary;
+                break;
+            }
+        }
+        refs.push_back(ref);
+    }
+    closedir(dir);
+    std::sort(refs.begin(), refs.end(),
+            [](const Reference &a, const Reference &b) { return a.name < b.name; });
+    return refs;
+}
+
+int MicroBench::readBaseline() {
+    FileReader input(_baseline_name);
+    if (!input.open()) {
+        fprintf(stderr, "Can't open baseline file %s\n", _baseline_name);
+        return 1;
+    }
+    StrScanner *line;
+    while ((line = input.readLine()) != nullptr) {
+        line->skipSpaces();
+        if (**line == 0)
+            continue;
+        BenchResult result;
+        if (!result.parse(std::string(line->str(), line->size()).c_str())) {
+            fprintf(stderr, "%s:%d: Invalid benchmark result\n", _baseline_name, input.lineno());
+            return 1;
+        }
+        _baseline[result.name] = result;
+    }
+    return 0;
+}
+
+int MicroBench::run() {
+    if (_baseline_name && readBaseline())
+        return 1;
+    FILE *output = nullptr;
+    if (_output_name) {
+        output = fopen(_output_name, "w");
+        if (output == nullptr) {
+            fprintf(stderr, "Can't open output file %s\n", _output_name);
+            return 1;
+        }
+    }
+    const auto refs = references();
+    if (refs.empty())
+        fprintf(stderr, "No test_*.asm found in %s\n", _dir);
+    printf("%-28s %-10s %12s %10s %10s %10s %8s\n", "benchmark", "cpu", "ops", "ns/op",
+            "allocs/op", "misses/op", "baseline");
+    for (const auto &ref : refs) {
+        if (!ref.binary.empty())
+            benchDisassembler(ref, output);
+        benchRandom(ref, output);
+        benchAssembler(ref, output);
+    }
+    if (output)
+        fclose(output);
+    if (_regressions)
+        fprintf(stderr, "%d benchmark(s) slower than baseline by more than %d%%\n", _regressions,
+                _threshold);
+    return _regressions ? 1 : 0;
+}
+
+BenchResult MicroBench::measure(const std::string &name, const std::string &cpu,
+        const char *unit, const std::function<uint64_t()> &pass) {
+    typedef std::chrono::steady_clock clock;
+    const auto min_time = std::chrono::milliseconds(_min_time_ms);
+    pass();  // warm up
+    BenchResult result{name, cpu, unit, 0, 0, 0, false, 0};
+    _counters.start();
+    const auto start = clock::now();
+    auto elapsed = clock::duration::zero();
+    do {
+        result.ops += pass();
+        elapsed = clock::now() - start;
+    } while (elapsed < min_time);
+    _counters.stop();
+    result.elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    result.allocations = _counters.allocations();
+    result.hasCacheMisses = _counters.hasCacheMisses();
+    result.cacheMisses = _counters.cacheMisses();
+    return result;
+}
+
+void MicroBench::report(const BenchResult &result, FILE *output) {
+    const auto ops = double(result.ops);
+    char misses[20] = "-";
+    if (result.hasCacheMisses)
+        snprintf(misses, sizeof(misses), "%.3f", result.cacheMisses / ops);
+    char delta[20] = "-";
+    const auto base = _baseline.find(result.name);
+    if (base != _baseline.end()) {
+        const auto ratio = result.nsPerOp() / base->second.nsPerOp();
+        snprintf(delta, sizeof(delta), "%+.1f%%", (ratio - 1) * 100);
+        if (ratio > 1 + _threshold / 100.0) {
+            strcat(delta, " !");
+            _regressions++;
+        }
+    }
+    printf("%-28s %-10s %12llu %10.1f %10.3f %10s %s\n", result.name.c_str(), result.cpu.c_str(),
+            static_cast<unsigned long long>(result.ops), result.nsPerOp(),
+            result.allocations / ops, misses, delta);
+    fflush(stdout);
+    if (output)
+        fprintf(output, "%s\n", result.toJson().c_str());
+}
+
+static uint64_t disassemble(Disassembler &dis, const BinMemory &memory) {
+    const auto addrUnit = dis.config().addressUnit();
+    char operands[256];
+    uint64_t insns = 0;
+    for (const auto &block : memory) {
+        auto reader = memory.reader(block.base);
+        const auto end = block.base + block.data.size();
+        for (auto addr = block.base; addr < end; insns++) {
+            reader.setAddress(addr);
+            Insn insn(addr / addrUnit);
+            dis.decode(reader, insn, operands, sizeof(operands));
+            addr += insn.length() ? insn.length() : addrUnit;
+        }
+    }
+    return insns;
+}
+
+void MicroBench::benchDisassembler(const Reference &ref, FILE *output) {
+    const auto name = "dis/" + ref.name;
+    if (!selected(name))
+        return;
+    _disassemblers.restore();
+    DisDriver driver(_disassemblers.registry);
+    auto dis = driver.setCpu(ref.cpu.c_str());
+    if (dis == nullptr) {
+        fprintf(stderr, "%s: unknown CPU %s\n", ref.source.c_str(), ref.cpu.c_str());
+        return;
+    }
+    BinMemory memory;
+    FileReader input(ref.binary);
+    if (!input.open() || BinDecoder::decode(input, memory) < 0) {
+        fprintf(stderr, "%s: Unrecognizable binary format\n", ref.binary.c_str());
+        return;
+    }
+    report(measure(name, ref.cpu, "insn", [&]() { return disassemble(*dis, memory); }), output);
+}
+
+void MicroBench::benchRandom(const Reference &ref, FILE *output) {
+    const auto name = "random/" + ref.name;
+    if (!selected(name))
+        return;
+    _disassemblers.restore();
+    DisDriver driver(_disassemblers.registry);
+    auto dis = driver.setCpu(ref.cpu.c_str());
+    if (dis == nullptr)
+        return;
+    const auto &config = dis->config();
+    const auto addrWidth = config.addressWidth();
+    const uint32_t size = addrWidth < 16 ? (1U << addrWidth) * config.addressUnit() : 0x10000;
+    BinMemory memory;
+    uint32_t seed = 2463534242;  // xorshift32
+    for (uint32_t addr = 0; addr < size; addr++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        memory.writeByte(addr, seed);
+    }
+    report(measure(name, ref.cpu, "insn", [&]() { return disassemble(*dis, memory); }), output);
+}
+
+void MicroBench::benchAssembler(const Reference &ref, FILE *output) {
+    const auto name = "asm/" + ref.name;
+    if (!selected(name))
+        return;
+    _assemblers.restore();
+    FileSources sources;
+    AsmDriver driver(_assemblers.registry, sources);
+    const StrScanner source(ref.source.c_str());
+    const auto pass = [&](bool reportError) -> uint64_t {
+        BinMemory memory;
+        if (sources.open(source))
+            return 0;
+        AsmFormatter formatter(driver, sources, memory);
+        return driver.assemble(sources, memory, formatter, STDNULL, STDNULL, reportError);
+    };
+    if (pass(false) == 0) {
+        fprintf(stderr, "Can't open input file %s\n", ref.source.c_str());
+        return;
+    }
+    report(measure(name, ref.cpu, "line", [&]() { return pass(true); }), output);
+}
+
+}  // namespace bench
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MICRO_BENCH_H__
+#define __MICRO_BENCH_H__
+
+#include "asm_backends.h"
+#include "bench_counters.h"
+#include "dis_backends.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace bench {
+
+/** A result of a benchmark, which is stored in a JSON line. */
+struct BenchResult {
+    std::string name;
+    std::string cpu;
+    std::string unit;
+    uint64_t ops;
+    uint64_t elapsed_ns;
+    uint64_t allocations;
+    bool hasCacheMisses;
+    uint64_t cacheMisses;
+
+    double nsPerOp() const { return ops ? double(elapsed_ns) / ops : 0; }
+    std::string toJson() const;
+    /** parse a JSON line written by |toJson|, returns false on error */
+    bool parse(const char *line);
+};
+
+/**
+ * Micro benchmarks of each assembler and disassembler back end, which
+ * use test/reference/test_*.asm and their binaries.
+ *
+ * - dis/<test>: Disassembler::decode of the binary, ns/insn
+ * - random/<test>: Disassembler::decode of random bytes, ns/insn
+ * - asm/<test>: assemble a pass of the source, ns/line
+ */
+class MicroBench {
+public:
+    MicroBench();
+
+    int parseArgs(int argc, const char **argv);
+    int usage() const;
+    /** returns non-zero if a benchmark regresses from the baseline */
+    int run();
+
+private:
+    struct Reference {
+        std::string name;    // test_<cpu>
+        std::string cpu;     // the CPU of the source
+        std::string source;  // test_<cpu>.asm
+        std::string binary;  // test_<cpu>.{hex,s19,s28}, or empty
+    };
+
+    const char *_prog_name;
+    const char *_dir;
+    const char *_output_name;
+    const char *_baseline_name;
+    int _min_time_ms;
+    int _threshold;
+    std::vector<const char *> _filters;
+
+    cli::AsmBackends _assemblers;
+    cli::DisBackends _disassemblers;
+    BenchCounters _counters;
+    std::map<std::string, BenchResult> _baseline;
+    int _regressions;
+
+    bool selected(const std::string &name) const;
+    std::vector<Reference> references() const;
+    int readBaseline();
+    void benchDisassembler(const Reference &ref, FILE *output);
+    void benchRandom(const Reference &ref, FILE *output);
+    void benchAssembler(const Reference &ref, FILE *output);
+    /** run |pass| repeatedly, which returns number of operations done */
+    BenchResult measure(const std::string &name, const std::string &cpu, const char *unit,
+            const std::function<uint64_t()> &pass);
+    void report(const BenchResult &result, FILE *output);
+};
+
+}  // namespace bench
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,191 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "source_generator.h"
+
+#include <cstring>
+
+namespace libasm {
+namespace bench {
+
+struct SourceGenerator::Template {
+    const char *cpu;
+    const char *jump;  // jump to a label
+    const char *load;  // load an equated constant
+    const char *fillers[4];
+};
+
+enum LineKind : int {
+    JUMP = 0,
+    LOAD = 1,
+    FILLER = 2,
+};
+
+// clang-format off
+static constexpr SourceGenerator::Template TEMPLATES[] = {
+    { "6800",    "jmp %s",   "ldaa #%s",      { "nop", "tab", "inx", "adda #1" } },
+    { "6809",    "jmp %s",   "lda #%s",       { "nop", "tfr a,b", "leax 1,x", "adda #1" } },
+    { "6502",    "jmp %s",   "lda #%s",       { "nop", "tax", "inx", "adc #1" } },
+    { "8051",    "ljmp %s",  "mov a,#%s",     { "nop", "mov r0,a", "inc dptr", "add a,r1" } },
+    { "8080",    "jmp %s",   "mvi a,%s",      { "nop", "mov b,c", "inx h", "add b" } },
+    { "z80",     "jp %s",    "ld a,%s",       { "nop", "ld b,c", "inc hl", "add a,b" } },
+    { "8086",    "jmp %s",   "mov al,%s",     { "nop", "mov ax,bx", "inc si", "add ax,cx" } },
+    { "68000",   "jmp (%s).l", "move.b #%s,d0", { "nop", "move.l d1,d2", "addq.w #1,a0", "add.w d1,d0" } },
+    { "z8002",   "jp %s",    "ldb rl0,#%s",   { "nop", "ld r1,r2", "inc r3,#1", "add r0,r1" } },
+    { "tms9900", "b @%s",    "li r0,%s",      { "clr r4", "mov r1,r2", "inc r3", "a r1,r0" } },
+    { "1802",    "lbr %s",   "ldi %s",        { "nop", "glo 1", "inc 2", "add" } },
+};
+// clang-format on
+
+static const SourceGenerator::Template *searchTemplate(const char *cpu) {
+    for (const auto &temp : TEMPLATES) {
+        if (strcasecmp(temp.cpu, cpu) == 0)
+            return &temp;
+    }
+    return nullptr;
+}
+
+SourceGenerator::SourceGenerator(const Params &params, uint32_t seed)
+    : _params(params), _random(seed ? seed : 1) {}
+
+std::vector<const char *> SourceGenerator::cpus() {
+    std::vector<const char *> list;
+    for (const auto &temp : TEMPLATES)
+        list.push_back(temp.cpu);
+    return list;
+}
+
+uint32_t SourceGenerator::random(uint32_t range) {
+    // xorshift32
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+    return range ? _random % range : 0;
+}
+
+void SourceGenerator::plan(std::vector<Line> &lines) {
+    lines.resize(_params.lines);
+    int labels = 0;
+    for (auto &line : lines)
+        line.label = random(100) < uint32_t(_params.labelDensity) ? labels++ : -1;
+    int defined = 0;
+    for (auto &line : lines) {
+        if (line.label >= 0)
+            defined++;
+        line.kind = random(3);
+        if (line.kind == JUMP && labels) {
+            const auto backward = defined;
+            const auto forward = labels - defined;
+            const auto toForward = random(100) < uint32_t(_params.forwardRatio);
+            if ((toForward && forward) || backward == 0) {
+                line.target = backward + random(forward);
+            } else {
+                line.target = random(backward);
+            }
+        } else if (line.kind == LOAD && _params.equates) {
+            line.target = random(_params.equates);
+        } else {
+            line.kind = FILLER;
+            line.target = random(4);
+        }
+    }
+}
+
+/** print |label| and |insn| of which mnemonic and operand are separated by a space */
+static void printLine(FILE *out, const char *label, const char *insn) {
+    const auto operand = strchr(insn, ' ');
+    if (operand) {
+        fprintf(out, "%-7s %-7.*s %s\n", label, int(operand - insn), insn, operand + 1);
+    } else {
+        fprintf(out, "%-7s %s\n", label, insn);
+    }
+}
+
+void SourceGenerator::print(FILE *out, const Template &temp, const Line &line) {
+    char label[20] = "";
+    if (line.label >= 0)
+        snprintf(label, sizeof(label), "LBL%d:", line.label);
+    char symbol[20];
+    char insn[40];
+    switch (line.kind) {
+    case JUMP:
+        snprintf(symbol, sizeof(symbol), "LBL%d", line.target);
+        snprintf(insn, sizeof(insn), temp.jump, symbol);
+        break;
+    case LOAD:
+        snprintf(symbol, sizeof(symbol), "VAL%d", line.target);
+        snprintf(insn, sizeof(insn), temp.load, symbol);
+        break;
+    default:
+        snprintf(insn, sizeof(insn), "%s", temp.fillers[line.target]);
+        break;
+    }
+    printLine(out, label, insn);
+}
+
+int SourceGenerator::generate(const char *cpu, const std::string &dir, const std::string &name,
+        std::vector<std::string> &files) {
+    const auto temp = searchTemplate(cpu);
+    if (temp == nullptr || _params.includeDepth < 0 || _params.includeDepth > MAX_INCLUDE_DEPTH)
+        return 1;
+    std::vector<Line> lines;
+    plan(lines);
+    const auto nfiles = _params.includeDepth + 1;
+    for (auto n = 0; n < nfiles; n++) {
+        const auto file = n == 0 ? name + ".asm" : name + "_" + std::to_string(n) + ".inc";
+        const auto path = dir + "/" + file;
+        auto out = fopen(path.c_str(), "w");
+        if (out == nullptr)
+            return 1;
+        files.push_back(path);
+        if (n == 0) {
+            fprintf(out, ";;; %d lines, %d%% labels, %d%% forward, %d includes, %d equates\n",
+                    _params.lines, _params.labelDensity, _params.forwardRatio,
+                    _params.includeDepth, _params.equates);
+            fprintf(out, "        cpu     %s\n", temp->cpu);
+            fprintf(out, "        org     4096\n");
+            for (auto i = 0; i < _params.equates; i++) {
+                char label[20], insn[20];
+                snprintf(label, sizeof(label), "VAL%d", i);
+                snprintf(insn, sizeof(insn), "equ %d", (i * 37) % 128);
+                printLine(out, label, insn);
+            }
+        }
+        const auto start = lines.size() * n / nfiles;
+        const auto end = lines.size() * (n + 1) / nfiles;
+        for (auto i = start; i < end; i++)
+            print(out, *temp, lines[i]);
+        if (n + 1 < nfiles) {
+            char insn[80];
+            snprintf(insn, sizeof(insn), "include \"%s_%d.inc\"", name.c_str(), n + 1);
+            printLine(out, "", insn);
+        }
+        if (n == 0)
+            printLine(out, "", "end");
+        fclose(out);
+    }
+    return 0;
+}
+
+}  // namespace bench
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SOURCE_GENERATOR_H__
+#define __SOURCE_GENERATOR_H__
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace bench {
+
+/**
+ * Generate a synthetic assembly program of a CPU, which consists of
+ * jumps to labels, loads of equated constants and filler instructions.
+ */
+class SourceGenerator {
+public:
+    struct Params {
+        int lines;         // number of instruction lines
+        int labelDensity;  // percent of lines which have a label
+        int forwardRatio;  // percent of label references which refer forward
+        int includeDepth;  // nesting depth of include files
+        int equates;       // number of equated constants
+    };
+
+    /** FileSources can open 4 files at once */
+    static constexpr int MAX_INCLUDE_DEPTH = 3;
+
+    SourceGenerator(const Params &params, uint32_t seed = 2463534242);
+
+    /** CPUs which have a template */
+    static std::vector<const char *> cpus();
+
+    /**
+     * Write |dir|/|name|.asm of |cpu| and include files
+     * |dir|/|name|_<n>.inc, and append their paths to |files|. Returns
+     * zero on success.
+     */
+    int generate(const char *cpu, const std::string &dir, const std::string &name,
+            std::vector<std::string> &files);
+
+    /** instructions of a CPU, where %s is replaced with a symbol */
+    struct Template;
+
+private:
+    struct Line {
+        int label;   // label number or -1
+        int kind;    // JUMP, LOAD or FILLER
+        int target;  // label or equate number, or filler index
+    };
+
+    const Params _params;
+    uint32_t _random;
+
+    uint32_t random(uint32_t range);
+    void plan(std::vector<Line> &lines);
+    static void print(FILE *out, const Template &temp, const Line &line);
+};
+
+}  // namespace bench
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
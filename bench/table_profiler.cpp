@@ -0,0 +1,245 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "table_profiler.h"
+
+#include "json_message.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+
+namespace libasm {
+namespace bench {
+
+namespace {
+
+template <typename T>
+void accumulate(std::vector<uint64_t> &sum, const std::vector<T> &values) {
+    if (sum.size() < values.size())
+        sum.resize(values.size());
+    for (size_t i = 0; i < values.size(); i++)
+        sum[i] += values[i];
+}
+
+uint64_t total(const std::vector<uint64_t> &values) {
+    return std::accumulate(values.begin(), values.end(), uint64_t(0));
+}
+
+/** average probes of a linear search which hits entries in |order| */
+double expectedProbes(const std::vector<uint64_t> &hits, const std::vector<size_t> &order) {
+    const auto sum = total(hits);
+    if (sum == 0)
+        return 0;
+    double probes = 0;
+    for (size_t rank = 0; rank < order.size(); rank++)
+        probes += static_cast<double>(rank + 1) * hits[order[rank]];
+    return probes / sum;
+}
+
+}  // namespace
+
+bool TableProfiler::Key::operator<(const Key &other) const {
+    if (cpu != other.cpu)
+        return cpu < other.cpu;
+    if (search != other.search)
+        return search < other.search;
+    return page < other.page;
+}
+
+TableProfiler::TableProfiler() : _prog_name(nullptr), _top(8) {}
+
+int TableProfiler::parseArgs(int argc, const char **argv) {
+    _prog_name = argv[0];
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        if (*opt != '-' || opt[1] == 0) {
+            _inputs.push_back(opt);
+            continue;
+        }
+        if (opt[1] != 't' || opt[2] != 0 || ++i >= argc)
+            return 1;
+        char *end;
+        _top = strtol(argv[i], &end, 10);
+        if (*end || _top <= 0)
+            return 1;
+    }
+    return 0;
+}
+
+int TableProfiler::usage() const {
+    fprintf(stderr,
+            "usage: %s [-t <entries>] [<input>...]\n"
+            "  -t <entries>: number of hot entries to show per page; default 8\n"
+            "  <input>     : output of asm/dis --stats=json built with STATS=1,\n"
+            "                \"-\" or none for standard input\n",
+            _prog_name);
+    return 2;
+}
+
+int TableProfiler::run() {
+    if (_inputs.empty())
+        _inputs.push_back("-");
+    for (const auto name : _inputs) {
+        if (strcmp(name, "-") == 0) {
+            if (read(stdin, "<stdin>"))
+                return 1;
+            continue;
+        }
+        auto input = fopen(name, "r");
+        if (input == nullptr) {
+            fprintf(stderr, "Can't open input file %s\n", name);
+            return 1;
+        }
+        const auto error = read(input, name);
+        fclose(input);
+        if (error)
+            return 1;
+    }
+    if (_profiles.empty()) {
+        fprintf(stderr, "No table profiles found; asm/dis must be built with STATS=1\n");
+        return 1;
+    }
+    const Key *last = nullptr;
+    for (const auto &it : _profiles) {
+        const auto &key = it.first;
+        if (last && (last->cpu != key.cpu || last->search != key.search))
+            printPageOrder(last->cpu, last->search);
+        printPage(key, it.second);
+        last = &key;
+    }
+    printPageOrder(last->cpu, last->search);
+    return 0;
+}
+
+int TableProfiler::read(FILE *input, const char *name) {
+    char *line = nullptr;
+    size_t size = 0;
+    auto lineno = 0;
+    while (getline(&line, &size, input) > 0) {
+        lineno++;
+        if (strstr(line, "\"table\"") == nullptr)
+            continue;  // phase statistics or other outputs
+        cli::JsonRequest json;
+        const auto error = json.parse(line);
+        const auto cpu = json.string("table");
+        const auto search = json.string("search");
+        int64_t page, lookups, misses;
+        const auto probes = json.array("probes");
+        const auto hits = json.array("hits");
+        if (error || cpu == nullptr || search == nullptr || !json.integer("page", page) ||
+                !json.integer("lookups", lookups) || !json.integer("misses", misses) ||
+                probes == nullptr || hits == nullptr) {
+            fprintf(stderr, "%s:%d: %s\n", name, lineno, error ? error : "Not a table profile");
+            free(line);
+            return 1;
+        }
+        auto &profile = _profiles[Key{cpu, search, static_cast<int>(page)}];
+        profile.lookups += lookups;
+        profile.misses += misses;
+        accumulate(profile.probes, *probes);
+        accumulate(profile.hits, *hits);
+    }
+    free(line);
+    return 0;
+}
+
+void TableProfiler::printPage(const Key &key, const Profile &profile) const {
+    uint64_t probes = 0;
+    for (size_t n = 0; n < profile.probes.size(); n++)
+        probes += n * profile.probes[n];
+    printf("%s %s page %d: %llu lookups, %llu misses, %.2f probes/lookup\n", key.cpu.c_str(),
+            key.search.c_str(), key.page, static_cast<unsigned long long>(profile.lookups),
+            static_cast<unsigned long long>(profile.misses),
+            profile.lookups ? static_cast<double>(probes) / profile.lookups : 0.0);
+
+    // Histogram of probes per lookup in power of two buckets.
+    for (size_t low = 0, high = 0; low < profile.probes.size(); low = high + 1) {
+        high = low ? low * 2 - 1 : 0;
+        uint64_t count = 0;
+        for (size_t n = low; n <= high && n < profile.probes.size(); n++)
+            count += profile.probes[n];
+        if (count == 0)
+            continue;
+        printf("  probes %5zu-%-5zu %10llu %6.2f%%\n", low, high,
+                static_cast<unsigned long long>(count), count * 100.0 / profile.lookups);
+    }
+
+    const auto hits = total(profile.hits);
+    if (hits == 0)
+        return;
+    std::vector<size_t> current(profile.hits.size());
+    std::iota(current.begin(), current.end(), 0);
+    auto proposed = current;
+    std::stable_sort(proposed.begin(), proposed.end(),
+            [&](size_t a, size_t b) { return profile.hits[a] > profile.hits[b]; });
+    for (auto rank = 0; rank < _top && rank < static_cast<int>(proposed.size()); rank++) {
+        const auto index = proposed[rank];
+        if (profile.hits[index] == 0)
+            break;
+        printf("  entry %5zu %10llu %6.2f%%\n", index,
+                static_cast<unsigned long long>(profile.hits[index]),
+                profile.hits[index] * 100.0 / hits);
+    }
+    if (key.search != "opcode")
+        return;  // searched by binary search
+    const auto before = expectedProbes(profile.hits, current);
+    const auto after = expectedProbes(profile.hits, proposed);
+    if (after >= before)
+        return;
+    printf("  proposed order: %.2f -> %.2f probes/hit\n   ", before, after);
+    for (size_t rank = 0; rank < proposed.size(); rank++) {
+        if (profile.hits[proposed[rank]] == 0) {
+            printf(" ...");  // the rest stays in the current order
+            break;
+        }
+        printf(" %zu", proposed[rank]);
+    }
+    printf("\n");
+}
+
+void TableProfiler::printPageOrder(const std::string &cpu, const std::string &search) const {
+    std::vector<std::pair<int, uint64_t>> pages;
+    uint64_t sum = 0;
+    for (const auto &it : _profiles) {
+        if (it.first.cpu == cpu && it.first.search == search) {
+            const auto hits = total(it.second.hits);
+            pages.emplace_back(it.first.page, hits);
+            sum += hits;
+        }
+    }
+    if (pages.size() < 2 || sum == 0)
+        return;
+    std::stable_sort(pages.begin(), pages.end(),
+            [](const std::pair<int, uint64_t> &a, const std::pair<int, uint64_t> &b) {
+                return a.second > b.second;
+            });
+    printf("%s %s pages by hits:", cpu.c_str(), search.c_str());
+    for (const auto &page : pages)
+        printf(" %d(%.1f%%)", page.first, page.second * 100.0 / sum);
+    printf("\n");
+}
+
+}  // namespace bench
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
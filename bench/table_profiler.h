@@ -0,0 +1,84 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TABLE_PROFILER_H__
+#define __TABLE_PROFILER_H__
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace bench {
+
+/**
+ * Read instruction table profiles, which asm and dis built with
+ * LIBASM_STATS print by --stats=json, and summarize them per CPU.
+ *
+ * For each page, it shows a histogram of probes per lookup and which
+ * entries hit. For pages searched linearly by opcode, it proposes an
+ * entry order by descending hits along with the expected probes per
+ * lookup before and after. It also proposes a page order by descending
+ * hits. Since the matcher of an entry may accept codes of the entries
+ * following it, a proposed order must be checked against the
+ * disassembler tests before being applied to table_*.cpp.
+ */
+class TableProfiler {
+public:
+    TableProfiler();
+
+    int parseArgs(int argc, const char **argv);
+    int usage() const;
+    int run();
+
+private:
+    struct Key {
+        std::string cpu;
+        std::string search;
+        int page;
+
+        bool operator<(const Key &other) const;
+    };
+    struct Profile {
+        uint64_t lookups;
+        uint64_t misses;
+        std::vector<uint64_t> probes;
+        std::vector<uint64_t> hits;
+    };
+
+    const char *_prog_name;
+    int _top;
+    std::vector<const char *> _inputs;
+    std::map<Key, Profile> _profiles;
+
+    int read(FILE *input, const char *name);
+    void printPage(const Key &key, const Profile &profile) const;
+    void printPageOrder(const std::string &cpu, const std::string &search) const;
+};
+
+}  // namespace bench
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
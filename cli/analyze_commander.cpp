@@ -0,0 +1,295 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "analyze_commander.h"
+
+#include "bin_decoder.h"
+#include "cycles_i8051.h"
+#include "cycles_mc68000.h"
+#include "cycles_mc6809.h"
+#include "cycles_mos6502.h"
+#include "cycles_z80.h"
+#include "file_reader.h"
+#include "flow_graph.h"
+#include "flow_i8051.h"
+#include "flow_mc68000.h"
+#include "flow_mc6809.h"
+#include "flow_mos6502.h"
+#include "flow_z80.h"
+#include "stack_analyzer.h"
+#include "wcet_analyzer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace libasm {
+namespace cli {
+
+using namespace libasm::driver;
+
+namespace {
+
+struct Analyzer {
+    const FlowTracer &tracer;
+    const CycleCounter &counter;
+};
+
+const Analyzer ANALYZERS[] = {
+        {i8051::FLOW, i8051::CYCLES},
+        {mc68000::FLOW, mc68000::CYCLES},
+        {mc6809::FLOW, mc6809::CYCLES},
+        {mos6502::FLOW, mos6502::CYCLES},
+        {z80::FLOW, z80::CYCLES},
+};
+
+const Analyzer *searchAnalyzer(const /*PROGMEM*/ char *cpu_P) {
+    for (const auto &analyzer : ANALYZERS) {
+        if (strcmp_P(cpu_P, analyzer.tracer.cpu_P()) == 0)
+            return &analyzer;
+    }
+    return nullptr;
+}
+
+const char *statusText(WcetStatus status) {
+    switch (status) {
+    case WCET_UNKNOWN_TARGET:
+        return "unknown target";
+    case WCET_UNKNOWN_CYCLES:
+        return "unknown cycles";
+    case WCET_NO_LOOP_BOUND:
+        return "no loop bound";
+    case WCET_RECURSION:
+        return "recursion";
+    default:
+        return "";
+    }
+}
+
+const char *statusText(DepthStatus status) {
+    switch (status) {
+    case DEPTH_UNKNOWN_TARGET:
+        return "unknown target";
+    case DEPTH_UNKNOWN_POINTER:
+        return "stack pointer loaded";
+    case DEPTH_UNBOUNDED:
+        return "stack grows in loop";
+    case DEPTH_RECURSION:
+        return "recursion";
+    default:
+        return "";
+    }
+}
+
+const char *basename(const char *str, char sep_char = '/') {
+    const auto sep = strrchr(str, sep_char);
+    return sep ? sep + 1 : str;
+}
+
+}  // namespace
+
+AnalyzeCommander::AnalyzeCommander(const CpuRegistry<Disassembler> &registry)
+    : _driver(registry) {}
+
+int AnalyzeCommander::analyze() {
+    const auto disassembler = _driver.setCpu(_cpu);
+    if (disassembler == nullptr) {
+        fprintf(stderr, "Unknown target CPU %s\n", _cpu);
+        return 1;
+    }
+    const auto analyzer = searchAnalyzer(disassembler->cpu_P());
+    if (analyzer == nullptr) {
+        fprintf(stderr, "Can't analyze CPU %s\n", _cpu);
+        return 1;
+    }
+    if (_annotation_name && readAnnotations(_annotation_name))
+        return 1;
+
+    BinMemory memory;
+    FileReader input(_input_name);
+    if (!input.open()) {
+        fprintf(stderr, "Can't open input file %s\n", _input_name);
+        return 1;
+    }
+    if (BinDecoder::decode(input, memory) < 0) {
+        fprintf(stderr, "%s:%d: Unrecognizable binary format\n", _input_name, input.lineno());
+        return 1;
+    }
+    input.close();
+
+    FlowGraph graph(*disassembler, analyzer->tracer, analyzer->counter);
+    const auto addrUnit = disassembler->config().addressUnit();
+    if (_entries.empty() && _names.empty() && _interrupts.empty())
+        _entries.push_back(memory.startAddress() / addrUnit);
+    for (const auto entry : _entries)
+        graph.addEntry(entry);
+    for (const auto &it : _names)
+        graph.addEntry(it.first);
+    for (const auto isr : _interrupts)
+        graph.addEntry(isr);
+    graph.build(memory);
+
+    WcetAnalyzer wcet(graph);
+    for (const auto &it : _bounds)
+        wcet.setLoopBound(it.first, it.second);
+    wcet.analyze();
+    StackAnalyzer stack(graph);
+    stack.analyze();
+
+    const int width = (disassembler->config().addressWidth() + 3) / 4;
+    const auto &functions = graph.functions();
+    for (size_t i = 0; i < functions.size(); i++) {
+        const auto &function = functions[i];
+        const auto name = _names.find(function.entry);
+        printf("%0*X %-16s", width, function.entry,
+                name == _names.end() ? "" : name->second.c_str());
+        const auto &cycles = wcet.wcet(i);
+        const auto &depth = stack.depth(i);
+        // An interrupt pushes its frame before entering the handler.
+        const auto frame = _interrupts.count(function.entry) ? analyzer->tracer.interruptFrame() : 0;
+        printf(" wcet %8u stack %5u", cycles.cycles, depth.bytes + frame);
+        if (cycles.status != WCET_OK)
+            printf("  %s at %0*X", statusText(cycles.status), width, cycles.at);
+        if (depth.status != DEPTH_OK)
+            printf("  %s at %0*X", statusText(depth.status), width, depth.at);
+        printf("\n");
+    }
+    return 0;
+}
+
+int AnalyzeCommander::readAnnotations(const char *name) {
+    FileReader input(name);
+    if (!input.open()) {
+        fprintf(stderr, "Can't open annotation file %s\n", name);
+        return 1;
+    }
+    StrScanner *line;
+    while ((line = input.readLine()) != nullptr) {
+        line->skipSpaces();
+        if (**line == 0 || **line == '#')
+            continue;
+        const std::string text(line->str(), line->size());
+        char kind[16], arg[64];
+        unsigned long address, count;
+        const auto fields = sscanf(text.c_str(), "%15s %li %63s", kind, &address, arg);
+        if (fields >= 2 && strcmp(kind, "entry") == 0) {
+            _entries.push_back(address);
+            if (fields == 3)
+                _names[address] = arg;
+        } else if (fields >= 2 && strcmp(kind, "isr") == 0) {
+            _interrupts.insert(address);
+            if (fields == 3)
+                _names[address] = arg;
+        } else if (fields == 3 && strcmp(kind, "loop") == 0 &&
+                   (count = strtoul(arg, nullptr, 0)) != 0) {
+            _bounds[address] = count;
+        } else {
+            fprintf(stderr, "%s:%d: Invalid annotation\n", name, input.lineno());
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int AnalyzeCommander::usage() {
+    fprintf(stderr,
+            "libasm analyzer (version " LIBASM_VERSION_STRING
+            ")\n"
+            "usage: %s -C <CPU> [-a <annotation>] [-e <address>] <input>\n"
+            "  -C <CPU>    : target CPU: MC6809 MOS6502 i8051 Z80 MC68000\n"
+            "  -a <annotation>\n"
+            "              : annotation file which has lines of\n"
+            "                  entry <address> [<name>]\n"
+            "                  isr <address> [<name>]\n"
+            "                  loop <address> <count>\n"
+            "                loop <count> is the maximum times which header at\n"
+            "                <address> of a loop is executed\n"
+            "  -e <address>: entry address of a function, may be repeated\n"
+            "  <input>     : file can be Motorola S-Record or Intel HEX format\n",
+            _prog_name);
+    return 2;
+}
+
+int AnalyzeCommander::parseArgs(int argc, const char **argv) {
+    _prog_name = basename(argv[0]);
+    _input_name = nullptr;
+    _annotation_name = nullptr;
+    _cpu = nullptr;
+    _entries.clear();
+    for (auto i = 1; i < argc; i++) {
+        const auto *opt = argv[i];
+        if (*opt == '-') {
+            switch (*++opt) {
+            case 'C':
+                if (++i >= argc) {
+                    fprintf(stderr, "-C requires CPU name\n");
+                    return 1;
+                }
+                _cpu = argv[i];
+                break;
+            case 'a':
+                if (++i >= argc) {
+                    fprintf(stderr, "-a requires annotation file name\n");
+                    return 1;
+                }
+                _annotation_name = argv[i];
+                break;
+            case 'e': {
+                if (++i >= argc) {
+                    fprintf(stderr, "-e requires entry address\n");
+                    return 1;
+                }
+                char *end;
+                const auto entry = strtoul(argv[i], &end, 0);
+                if (end == argv[i] || *end) {
+                    fprintf(stderr, "invalid address format for -e: %s\n", argv[i]);
+                    return 1;
+                }
+                _entries.push_back(entry);
+                break;
+            }
+            default:
+                fprintf(stderr, "unknown option: %s\n", opt);
+                return 1;
+            }
+        } else {
+            if (_input_name) {
+                fprintf(stderr, "multiple input files specified: %s and %s\n", _input_name, opt);
+                return 1;
+            }
+            _input_name = opt;
+        }
+    }
+    if (_cpu == nullptr) {
+        fprintf(stderr, "No target CPU specified\n");
+        return 1;
+    }
+    if (_input_name == nullptr) {
+        fprintf(stderr, "no input file\n");
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ANALYZE_COMMANDER_H__
+#define __ANALYZE_COMMANDER_H__
+
+#include "bin_memory.h"
+#include "dis_driver.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace cli {
+
+/**
+ * Analyze control flow of a firmware image, and report worst case
+ * execution time and maximum stack depth of each function.
+ */
+class AnalyzeCommander {
+public:
+    AnalyzeCommander(const driver::CpuRegistry<Disassembler> &registry);
+
+    int parseArgs(int argc, const char **argv);
+    int usage();
+    int analyze();
+
+private:
+    driver::DisDriver _driver;
+    // command line arguments
+    const char *_prog_name;
+    const char *_input_name;
+    const char *_annotation_name;
+    const char *_cpu;
+    std::vector<uint32_t> _entries;
+    // annotations
+    std::map<uint32_t, std::string> _names;
+    std::map<uint32_t, uint32_t> _bounds;
+    std::set<uint32_t> _interrupts;
+
+    int readAnnotations(const char *name);
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
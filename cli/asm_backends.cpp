@@ -0,0 +1,117 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asm_backends.h"
+
+#include "asm_cdp1802.h"
+#include "asm_commander.h"
+#include "asm_f3850.h"
+#include "asm_i8048.h"
+#include "asm_i8051.h"
+#include "asm_i8080.h"
+#include "asm_i8086.h"
+#include "asm_i8096.h"
+#include "asm_ins8060.h"
+#include "asm_ins8070.h"
+#include "asm_mc6800.h"
+#include "asm_mc68000.h"
+#include "asm_mc6805.h"
+#include "asm_mc6809.h"
+#include "asm_mn1610.h"
+#include "asm_mos6502.h"
+#include "asm_ns32000.h"
+#include "asm_scn2650.h"
+#include "asm_tlcs90.h"
+#include "asm_tms32010.h"
+#include "asm_tms9900.h"
+#include "asm_z8.h"
+#include "asm_z80.h"
+#include "asm_z8000.h"
+#include "table_cdp1802.h"
+#include "table_f3850.h"
+#include "table_i8048.h"
+#include "table_i8051.h"
+#include "table_i8080.h"
+#include "table_i8086.h"
+#include "table_i8096.h"
+#include "table_ins8060.h"
+#include "table_ins8070.h"
+#include "table_mc6800.h"
+#include "table_mc68000.h"
+#include "table_mc6805.h"
+#include "table_mc6809.h"
+#include "table_mn1610.h"
+#include "table_mos6502.h"
+#include "table_ns32000.h"
+#include "table_scn2650.h"
+#include "table_tlcs90.h"
+#include "table_tms32010.h"
+#include "table_tms9900.h"
+#include "table_z8.h"
+#include "table_z80.h"
+#include "table_z8000.h"
+
+namespace libasm {
+namespace cli {
+
+AsmBackends::AsmBackends() {
+    add<mc6800::AsmMc6800, driver::MotorolaDirective>(mc6800::TABLE, mc6800::CPUS);
+    add<mc6805::AsmMc6805, driver::MotorolaDirective>(mc6805::TABLE, mc6805::CPUS);
+    add<mc6809::AsmMc6809, driver::MotorolaDirective>(mc6809::TABLE, mc6809::CPUS);
+    add<mos6502::AsmMos6502, driver::MostekDirective>(mos6502::TABLE, mos6502::CPUS);
+    add<i8048::AsmI8048, driver::IntelDirective>(i8048::TABLE, i8048::CPUS);
+    add<i8051::AsmI8051, driver::IntelDirective>(i8051::TABLE);
+    add<i8080::AsmI8080, driver::IntelDirective>(i8080::TABLE, i8080::CPUS);
+    add<z80::AsmZ80, driver::Z80Directive>(z80::TABLE, z80::CPUS);
+    add<z8::AsmZ8, driver::IntelDirective>(z8::TABLE, z8::CPUS);
+    add<tlcs90::AsmTlcs90, driver::IntelDirective>(tlcs90::TABLE);
+    add<ins8060::AsmIns8060, driver::NationalDirective>(ins8060::TABLE);
+    add<ins8070::AsmIns8070, driver::NationalDirective>(ins8070::TABLE);
+    add<cdp1802::AsmCdp1802, driver::RcaDirective>(cdp1802::TABLE, cdp1802::CPUS);
+    add<scn2650::AsmScn2650, driver::IntelDirective>(scn2650::TABLE);
+    add<f3850::AsmF3850, driver::FairchildDirective>(f3850::TABLE);
+    add<tms32010::AsmTms32010, driver::IntelDirective>(tms32010::TABLE, tms32010::CPUS);
+    add<i8086::AsmI8086, driver::IntelDirective>(i8086::TABLE, i8086::CPUS);
+    add<i8096::AsmI8096, driver::IntelDirective>(i8096::TABLE);
+    add<mc68000::AsmMc68000, driver::MotorolaDirective>(mc68000::TABLE);
+    add<tms9900::AsmTms9900, driver::IntelDirective>(tms9900::TABLE, tms9900::CPUS);
+    add<z8000::AsmZ8000, driver::IntelDirective>(z8000::TABLE, z8000::CPUS);
+    add<ns32000::AsmNs32000, driver::NationalDirective>(ns32000::TABLE);
+    add<mn1610::AsmMn1610, driver::IntelDirective>(mn1610::TABLE, mn1610::CPUS);
+}
+
+void AsmBackends::restore() {
+    for (auto &backend : _backends)
+        backend->restore();
+}
+
+int AsmBackends::run(int argc, const char **argv, FILE *out, FILE *err) {
+    restore();
+    AsmCommander commander(registry, out, err);
+    if (commander.parseArgs(argc, argv))
+        return commander.usage();
+    return commander.assemble();
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
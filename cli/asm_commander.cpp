@@ -19,12 +19,14 @@
 #include "asm_directive.h"
 #include "asm_formatter.h"
 #include "asm_sources.h"
+#include "cycle_counters.h"
 #include "file_printer.h"
 #include "file_reader.h"
 #include "intel_hex.h"
 #include "moto_srec.h"
 #include "stored_printer.h"
 
+#include <cstdlib>
 #include <cstring>
 
 namespace libasm {
@@ -40,65 +42,30 @@ public:
 
 static NullPrinter STDNULL;
 
-Error AsmCommander::FileSources::open(const StrScanner &name) {
-    if (size() >= max_includes)
-        return TOO_MANY_INCLUDE;
-    const auto *parent = _sources.empty() ? nullptr : &_sources.back();
-    const auto pos = parent ? parent->name().find_last_of('/') : std::string::npos;
-    if (pos == std::string::npos || *name == '/') {
-        _sources.emplace_back(std::string(name.str(), name.size()));
-    } else {
-        std::string path(parent->name().substr(0, pos + 1));
-        path.append(name.str(), name.size());
-        _sources.push_back(path);
-    }
-    if (!_sources.back().open()) {
-        _sources.pop_back();
-        return NO_INCLUDE_FOUND;
-    }
-    return OK;
-}
-
-driver::TextReader *AsmCommander::FileSources::last() {
-    return _sources.empty() ? nullptr : &_sources.back();
-}
-
-driver::TextReader *AsmCommander::FileSources::secondToLast() {
-    if (size() < 2)
-        return nullptr;
-    auto it = _sources.rbegin();
-    return &(*++it);
-}
-
-Error AsmCommander::FileSources::closeCurrent() {
-    auto &reader = _sources.back();
-    reader.close();
-    _sources.pop_back();
-    return OK;
-}
-
-AsmCommander::AsmCommander(AsmDirective **begin, AsmDirective **end)
-    : _sources(), _driver(begin, end, _sources) {}
+AsmCommander::AsmCommander(const CpuRegistry<AsmDirective> &registry, FILE *out, FILE *err)
+    : _sources(), _driver(registry, _sources), _out(out), _err(err), _passes(0) {}
 
 int AsmCommander::assemble() {
     if (_cpu && !_driver.setCpu(_cpu)) {
-        fprintf(stderr, "unknown CPU '%s'\n", _cpu);
+        fprintf(_err, "unknown CPU '%s'\n", _cpu);
         return 4;
     }
 
-    int pass = 0;
+    resetStats();
+    _passes = 1;
     BinMemory memory;
     if (_verbose) {
-        fprintf(stderr, "libasm assembler (version " LIBASM_VERSION_STRING ")\n");
-        fprintf(stderr, "%s: Pass %d\n", _input_name, ++pass);
+        fprintf(_err, "libasm assembler (version " LIBASM_VERSION_STRING ")\n");
+        fprintf(_err, "%s: Pass %d\n", _input_name, _passes);
     }
     (void)assemble(memory, STDNULL, STDNULL, false);
 
     StoredPrinter errorout;
     do {
         BinMemory next;
+        _passes++;
         if (_verbose)
-            fprintf(stderr, "%s: Pass %d\n", _input_name, ++pass);
+            fprintf(_err, "%s: Pass %d\n", _input_name, _passes);
         errorout.clear();
         (void)assemble(next, STDNULL, errorout, true);
         if (memory.equals(next))
@@ -107,12 +74,12 @@ int AsmCommander::assemble() {
     } while (true);
 
     for (size_t lineno = 1; lineno <= errorout.size(); lineno++)
-        fprintf(stderr, "%s\n", errorout.line(lineno));
+        fprintf(_err, "%s\n", errorout.line(lineno));
 
     if (_output_name) {
         FilePrinter output;
-        if (!output.open(_output_name)) {
-            fprintf(stderr, "Can't open output file %s\n", _output_name);
+        if (!output.open(_output_name, _out)) {
+            fprintf(_err, "Can't open output file %s\n", _output_name);
             return 1;
         }
 
@@ -128,41 +95,44 @@ int AsmCommander::assemble() {
                 const uint32_t start = it.base / addrUnit;
                 const size_t size = it.data.size();
                 const uint32_t end = (it.base + size - 1) / addrUnit;
-                fprintf(stderr, "%s: Write %4zu bytes %04x-%04x\n", _output_name, size, start, end);
+                fprintf(_err, "%s: Write %4zu bytes %04x-%04x\n", _output_name, size, start, end);
             }
         }
     }
 
     if (_list_name) {
         FilePrinter listout;
-        if (!listout.open(_list_name)) {
-            fprintf(stderr, "Can't open list file %s\n", _list_name);
+        if (!listout.open(_list_name, _out)) {
+            fprintf(_err, "Can't open list file %s\n", _list_name);
             return 1;
         }
         if (_verbose) {
-            fprintf(stderr, "%s: Opened for listing\n", _list_name);
-            fprintf(stderr, "%s: Pass listing\n", _input_name);
+            fprintf(_err, "%s: Opened for listing\n", _list_name);
+            fprintf(_err, "%s: Pass listing\n", _input_name);
         }
         assemble(memory, listout, STDNULL, true);
     }
 
+    printStats(_err, _stats);
     return 0;
 }
 
 int AsmCommander::assemble(
         BinMemory &memory, TextPrinter &listout, TextPrinter &errorout, bool reportError) {
     if (_sources.open(_input_name)) {
-        fprintf(stderr, "Can't open input file %s\n", _input_name);
+        fprintf(_err, "Can't open input file %s\n", _input_name);
         return 1;
     }
 
     AsmFormatter formatter(_driver, _sources, memory);
     formatter.setUpperHex(_upper_hex);
     formatter.enableLineNumber(_line_number);
+    if (_cycles)
+        addCycleCounters(formatter);
     if (_cpu)
         _driver.setCpu(_cpu);
-    for (auto dir : _driver) {
-        for (auto &opt : _options) {
+    for (auto &opt : _options) {
+        for (auto dir : _driver) {
             dir->assembler().setOption(opt.first.c_str(), opt.second.c_str());
         }
     }
@@ -201,10 +171,11 @@ int AsmCommander::usage() {
     } else {
         list += cpuSep + buf;
     }
-    fprintf(stderr,
+    fprintf(_err,
             "libasm assembler (version " LIBASM_VERSION_STRING
             ")\n"
             "usage: %s [-o <output>] [-l <list>] <input>\n"
+            "       %s -B <jobs> [-j <threads>]\n"
             "  -C <CPU>    : target CPU%s\n"
             "  -o <output> : output file\n"
             "  -l <list>   : list file\n"
@@ -214,24 +185,32 @@ int AsmCommander::usage() {
             "(max 32)\n"
             "  -h          : use lowe case letter for hexadecimal\n"
             "  -n          : output line number to list file\n"
-            "  -v          : print progress verbosely\n",
-            _prog_name, list.c_str());
+            "  -c          : output clock cycles to list file\n"
+            "  -v          : print progress verbosely\n"
+            "  -B <jobs>   : run jobs concurrently, one command line per line\n"
+            "  -j <threads>: number of threads for -B\n",
+            _prog_name, _prog_name, list.c_str());
+    if (statsAvailable()) {
+        fprintf(_err,
+                "  --stats[=json]\n"
+                "              : print time spent in each phase\n");
+    }
     bool longOptions = false;
     for (const auto *dir : _driver)
         longOptions |=
                 (dir->assembler().commonOptions().head() || dir->assembler().options().head());
     if (longOptions) {
-        fprintf(stderr,
+        fprintf(_err,
                 "  --<name>=<vale>\n"
                 "              : extra options (<type> [, <CPU>])\n");
         const auto dir = *_driver.begin();
         for (const auto *opt = dir->assembler().commonOptions().head(); opt; opt = opt->next()) {
-            fprintf(stderr, "  %-16s: %s  (%s)\n", opt->name_P(), opt->description_P(),
+            fprintf(_err, "  %-16s: %s  (%s)\n", opt->name_P(), opt->description_P(),
                     Options::nameof(opt->spec()));
         }
         for (const auto *dir : _driver) {
             for (const auto *opt = dir->assembler().options().head(); opt; opt = opt->next()) {
-                fprintf(stderr, "  %-16s: %s  (%s, %s)\n", opt->name_P(), opt->description_P(),
+                fprintf(_err, "  %-16s: %s  (%s, %s)\n", opt->name_P(), opt->description_P(),
                         Options::nameof(opt->spec()), dir->assembler().cpu_P());
             }
         }
@@ -258,25 +237,29 @@ int AsmCommander::parseArgs(int argc, const char **argv) {
     _output_name = nullptr;
     _list_name = nullptr;
     _cpu = nullptr;
+    _batch_name = nullptr;
+    _threads = 0;
     _encoder = 0;
     _record_bytes = 32;
     _upper_hex = true;
     _line_number = false;
+    _cycles = false;
     _verbose = false;
+    _stats = STATS_NONE;
     for (auto i = 1; i < argc; i++) {
         const auto *opt = argv[i];
         if (*opt == '-') {
             switch (*++opt) {
             case 'o':
                 if (++i >= argc) {
-                    fprintf(stderr, "-o requires output file name\n");
+                    fprintf(_err, "-o requires output file name\n");
                     return 1;
                 }
                 _output_name = argv[i];
                 break;
             case 'l':
                 if (++i >= argc) {
-                    fprintf(stderr, "-l requires listing file name\n");
+                    fprintf(_err, "-l requires listing file name\n");
                     return 1;
                 }
                 _list_name = argv[i];
@@ -288,7 +271,7 @@ int AsmCommander::parseArgs(int argc, const char **argv) {
                     char *end;
                     const auto v = strtoul(opt, &end, 10);
                     if (*end || v > 64) {
-                        fprintf(stderr, "invalid record length: %s\n", argv[i]);
+                        fprintf(_err, "invalid record length: %s\n", argv[i]);
                         return 3;
                     }
                     _record_bytes = v;
@@ -296,7 +279,7 @@ int AsmCommander::parseArgs(int argc, const char **argv) {
                 break;
             case 'C':
                 if (++i >= argc) {
-                    fprintf(stderr, "-C requires CPU name\n");
+                    fprintf(_err, "-C requires CPU name\n");
                     return 1;
                 }
                 _cpu = argv[i];
@@ -304,39 +287,74 @@ int AsmCommander::parseArgs(int argc, const char **argv) {
             case 'h':
                 _upper_hex = false;
                 break;
+            case 'B':
+                if (++i >= argc) {
+                    fprintf(_err, "-B requires batch file name\n");
+                    return 1;
+                }
+                _batch_name = argv[i];
+                break;
+            case 'j':
+                if (++i >= argc) {
+                    fprintf(_err, "-j requires number of threads\n");
+                    return 1;
+                }
+                _threads = atoi(argv[i]);
+                break;
             case 'n':
                 _line_number = true;
                 break;
+            case 'c':
+                _cycles = true;
+                break;
             case 'v':
                 _verbose = true;
                 break;
             case '-':
+                if (parseStatsOption(opt + 1, _stats)) {
+                    if (!statsAvailable()) {
+                        fprintf(_err, "--stats requires libasm built with LIBASM_STATS\n");
+                        return 1;
+                    }
+                    if (_stats == STATS_NONE) {
+                        fprintf(_err, "--stats accepts text or json\n");
+                        return 1;
+                    }
+                    break;
+                }
                 if (parseOptionValue(++opt) == 0)
                     break;
-                fprintf(stderr, "long option requires option=value\n");
+                fprintf(_err, "long option requires option=value\n");
                 return 1;
             default:
-                fprintf(stderr, "unknown option: %s\n", opt);
+                fprintf(_err, "unknown option: %s\n", opt);
                 return 1;
             }
         } else {
             if (_input_name) {
-                fprintf(stderr, "multiple input files specified: %s and %s\n", _input_name, opt);
+                fprintf(_err, "multiple input files specified: %s and %s\n", _input_name, opt);
                 return 1;
             }
             _input_name = opt;
         }
     }
+    if (_batch_name) {
+        if (_input_name) {
+            fprintf(_err, "input file can't be specified with -B\n");
+            return 1;
+        }
+        return 0;
+    }
     if (_input_name == nullptr) {
-        fprintf(stderr, "no input file\n");
+        fprintf(_err, "no input file\n");
         return 1;
     }
     if (_output_name && strcmp(_output_name, _input_name) == 0) {
-        fprintf(stderr, "output file overwrite input file\n");
+        fprintf(_err, "output file overwrite input file\n");
         return 2;
     }
     if (_list_name && strcmp(_list_name, _input_name) == 0) {
-        fprintf(stderr, "listing file overwrite input file\n");
+        fprintf(_err, "listing file overwrite input file\n");
         return 2;
     }
 
@@ -360,7 +378,7 @@ int AsmCommander::parseArgs(int argc, const char **argv) {
             }
         }
         if (!valid) {
-            fprintf(stderr, "unknown option --%s=%s\n", option.first.c_str(),
+            fprintf(_err, "unknown option --%s=%s\n", option.first.c_str(),
                     option.second.c_str());
             return 1;
         }
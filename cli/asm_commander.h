@@ -18,55 +18,55 @@
 #define __ASM_COMMANDER_H__
 
 #include "asm_driver.h"
-#include "asm_sources.h"
 #include "bin_memory.h"
-#include "file_reader.h"
+#include "file_sources.h"
+#include "stats_printer.h"
 #include "text_reader.h"
 
-#include <list>
+#include <cstdio>
+#include <map>
 
 namespace libasm {
 namespace cli {
 
 class AsmCommander {
 public:
-    AsmCommander(driver::AsmDirective **begin, driver::AsmDirective **end);
+    /** messages are printed to |err|, and "/dev/stdout" is |out| */
+    AsmCommander(const driver::CpuRegistry<driver::AsmDirective> &registry, FILE *out = stdout,
+            FILE *err = stderr);
 
     int parseArgs(int argc, const char **argv);
     int usage();
     int assemble();
 
-private:
-    class FileSources : public driver::AsmSources {
-    public:
-        Error open(const StrScanner &name) override;
-        Error closeCurrent() override;
-
-    protected:
-        int size() const override { return _sources.size(); }
-        driver::TextReader *last() override;
-        driver::TextReader *secondToLast() override;
-
-    private:
-        static constexpr int max_includes = 4;
-        std::list<FileReader> _sources;
-    };
+    const char *batchName() const { return _batch_name; }
+    int threads() const { return _threads; }
+    /** number of passes of the last |assemble| until the output converges */
+    int passes() const { return _passes; }
 
+private:
     FileSources _sources;
     driver::AsmDriver _driver;
+    FILE *const _out;
+    FILE *const _err;
     // command line arguments
     const char *_prog_name;
     const char *_input_name;
     const char *_output_name;
     const char *_list_name;
     const char *_cpu;
+    const char *_batch_name;
+    int _threads;
     char _encoder;
     size_t _record_bytes;
     bool _upper_hex;
     ;
     bool _line_number;
+    bool _cycles;
     bool _verbose;
     std::map<std::string, std::string> _options;
+    StatsFormat _stats;
+    int _passes;
 
     static constexpr const char *PROG_PREFIX = "asm";
     driver::AsmDirective *defaultDirective();
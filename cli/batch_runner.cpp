@@ -0,0 +1,114 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "batch_runner.h"
+
+#include "file_reader.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace libasm {
+namespace cli {
+
+BatchRunner::BatchRunner(const char *prog_name, int threads)
+    : _prog_name(prog_name),
+      _threads(threads > 0 ? threads : std::max(std::thread::hardware_concurrency(), 1U)),
+      _printed(0) {}
+
+BatchRunner::Buffer::Buffer() : _buf(nullptr), _size(0) {
+    file = open_memstream(&_buf, &_size);
+}
+
+BatchRunner::Buffer::~Buffer() {
+    if (file)
+        fclose(file);
+    free(_buf);
+}
+
+const std::string &BatchRunner::Buffer::text() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+        _text.assign(_buf, _size);
+    }
+    return _text;
+}
+
+int BatchRunner::readJobs(const char *name) {
+    FileReader input(name);
+    if (!input.open()) {
+        fprintf(stderr, "Can't open batch file %s\n", name);
+        return 1;
+    }
+    _name = name;
+    StrScanner *line;
+    while ((line = input.readLine()) != nullptr) {
+        line->skipSpaces();
+        if (**line == 0 || **line == '#')
+            continue;
+        Job job;
+        job.lineno = input.lineno();
+        job.args.push_back(_prog_name);
+        while (line->skipSpaces().size()) {
+            auto arg = *line;
+            line->trimStart([](char c) { return !isspace(c); });
+            job.args.emplace_back(arg.str(), line->str());
+        }
+        job.status = 0;
+        job.done = false;
+        _jobs.push_back(job);
+    }
+    return 0;
+}
+
+void BatchRunner::finish(size_t index) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _jobs[index].done = true;
+    while (_printed < _jobs.size() && _jobs[_printed].done) {
+        auto &job = _jobs[_printed++];
+        fwrite(job.out.data(), 1, job.out.size(), stdout);
+        fwrite(job.err.data(), 1, job.err.size(), stderr);
+        fflush(stdout);
+        job.out.clear();
+        job.out.shrink_to_fit();
+        job.err.clear();
+        job.err.shrink_to_fit();
+    }
+}
+
+int BatchRunner::report() const {
+    auto failed = 0;
+    for (const auto &job : _jobs) {
+        if (job.status) {
+            fprintf(stderr, "%s:%d: job failed with status %d\n", _name.c_str(), job.lineno,
+                    job.status);
+            failed++;
+        }
+    }
+    return failed;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
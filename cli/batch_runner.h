@@ -0,0 +1,131 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __BATCH_RUNNER_H__
+#define __BATCH_RUNNER_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libasm {
+namespace cli {
+
+/**
+ * Run many command line jobs concurrently in one process.
+ *
+ * A job file has one job per line, which consists of command line
+ * arguments separated by spaces. Empty lines and lines starting with
+ * '#' are ignored. Output of each job is buffered, and printed in the
+ * order of jobs as soon as the preceding jobs have finished.
+ */
+class BatchRunner {
+public:
+    BatchRunner(const char *prog_name, int threads = 0);
+
+    /** read jobs from |name|, returns zero on success */
+    int readJobs(const char *name);
+    size_t size() const { return _jobs.size(); }
+
+    /**
+     * Run all jobs on a thread pool. Each worker thread owns an instance
+     * of |WORKER|, which has |int run(int argc, const char **argv, FILE
+     * *out, FILE *err)|, and runs jobs in turn. Returns the number of
+     * failed jobs.
+     */
+    template <typename WORKER>
+    int run() {
+        std::atomic<size_t> next{0};
+        std::vector<std::thread> pool;
+        _printed = 0;
+        for (size_t i = 0; i < _threads && i < _jobs.size(); i++) {
+            pool.emplace_back([this, &next] {
+                WORKER worker;
+                size_t index;
+                while ((index = next++) < _jobs.size()) {
+                    _jobs[index].run(worker);
+                    finish(index);
+                }
+            });
+        }
+        for (auto &thread : pool)
+            thread.join();
+        return report();
+    }
+
+private:
+    /** Output of a job buffered in memory */
+    struct Buffer {
+        Buffer();
+        ~Buffer();
+        FILE *file;
+        /** close |file| and returns the buffered text */
+        const std::string &text();
+
+    private:
+        char *_buf;
+        size_t _size;
+        std::string _text;
+    };
+
+    struct Job {
+        int lineno;
+        std::vector<std::string> args;
+        int status;
+        bool done;
+        std::string out;
+        std::string err;
+
+        template <typename WORKER>
+        void run(WORKER &worker) {
+            std::vector<const char *> argv;
+            for (const auto &arg : args)
+                argv.push_back(arg.c_str());
+            argv.push_back(nullptr);
+            Buffer outBuf, errBuf;
+            status = worker.run(args.size(), argv.data(), outBuf.file, errBuf.file);
+            out = outBuf.text();
+            err = errBuf.text();
+        }
+    };
+
+    const std::string _prog_name;
+    const size_t _threads;
+    std::string _name;
+    std::vector<Job> _jobs;
+    std::mutex _mutex;
+    size_t _printed;
+
+    /** mark |index| job done, and print output of finished jobs in order */
+    void finish(size_t index);
+    int report() const;
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CYCLE_COUNTERS_H__
+#define __CYCLE_COUNTERS_H__
+
+#include "cycles_i8051.h"
+#include "cycles_mc68000.h"
+#include "cycles_mc6809.h"
+#include "cycles_mos6502.h"
+#include "cycles_z80.h"
+#include "list_formatter.h"
+
+namespace libasm {
+namespace cli {
+
+/** Register all cycle counters to |formatter|. */
+inline void addCycleCounters(driver::ListFormatter &formatter) {
+    formatter.addCycleCounter(i8051::CYCLES);
+    formatter.addCycleCounter(mc68000::CYCLES);
+    formatter.addCycleCounter(mc6809::CYCLES);
+    formatter.addCycleCounter(mos6502::CYCLES);
+    formatter.addCycleCounter(z80::CYCLES);
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dis_backends.h"
+
+#include "dis_cdp1802.h"
+#include "dis_commander.h"
+#include "dis_f3850.h"
+#include "dis_i8048.h"
+#include "dis_i8051.h"
+#include "dis_i8080.h"
+#include "dis_i8086.h"
+#include "dis_i8096.h"
+#include "dis_ins8060.h"
+#include "dis_ins8070.h"
+#include "dis_mc6800.h"
+#include "dis_mc68000.h"
+#include "dis_mc6805.h"
+#include "dis_mc6809.h"
+#include "dis_mn1610.h"
+#include "dis_mos6502.h"
+#include "dis_ns32000.h"
+#include "dis_scn2650.h"
+#include "dis_tlcs90.h"
+#include "dis_tms32010.h"
+#include "dis_tms9900.h"
+#include "dis_z8.h"
+#include "dis_z80.h"
+#include "dis_z8000.h"
+#include "table_cdp1802.h"
+#include "table_f3850.h"
+#include "table_i8048.h"
+#include "table_i8051.h"
+#include "table_i8080.h"
+#include "table_i8086.h"
+#include "table_i8096.h"
+#include "table_ins8060.h"
+#include "table_ins8070.h"
+#include "table_mc6800.h"
+#include "table_mc68000.h"
+#include "table_mc6805.h"
+#include "table_mc6809.h"
+#include "table_mn1610.h"
+#include "table_mos6502.h"
+#include "table_ns32000.h"
+#include "table_scn2650.h"
+#include "table_tlcs90.h"
+#include "table_tms32010.h"
+#include "table_tms9900.h"
+#include "table_z8.h"
+#include "table_z80.h"
+#include "table_z8000.h"
+
+namespace libasm {
+namespace cli {
+
+DisBackends::DisBackends() {
+    add<mc6800::DisMc6800>(mc6800::TABLE, mc6800::CPUS);
+    add<mc6805::DisMc6805>(mc6805::TABLE, mc6805::CPUS);
+    add<mc6809::DisMc6809>(mc6809::TABLE, mc6809::CPUS);
+    add<mos6502::DisMos6502>(mos6502::TABLE, mos6502::CPUS);
+    add<i8048::DisI8048>(i8048::TABLE, i8048::CPUS);
+    add<i8051::DisI8051>(i8051::TABLE);
+    add<i8080::DisI8080>(i8080::TABLE, i8080::CPUS);
+    add<z80::DisZ80>(z80::TABLE, z80::CPUS);
+    add<z8::DisZ8>(z8::TABLE, z8::CPUS);
+    add<tlcs90::DisTlcs90>(tlcs90::TABLE);
+    add<ins8060::DisIns8060>(ins8060::TABLE);
+    add<ins8070::DisIns8070>(ins8070::TABLE);
+    add<cdp1802::DisCdp1802>(cdp1802::TABLE, cdp1802::CPUS);
+    add<scn2650::DisScn2650>(scn2650::TABLE);
+    add<f3850::DisF3850>(f3850::TABLE);
+    add<tms32010::DisTms32010>(tms32010::TABLE, tms32010::CPUS);
+    add<i8086::DisI8086>(i8086::TABLE, i8086::CPUS);
+    add<i8096::DisI8096>(i8096::TABLE);
+    add<mc68000::DisMc68000>(mc68000::TABLE);
+    add<tms9900::DisTms9900>(tms9900::TABLE, tms9900::CPUS);
+    add<z8000::DisZ8000>(z8000::TABLE, z8000::CPUS);
+    add<ns32000::DisNs32000>(ns32000::TABLE);
+    add<mn1610::DisMn1610>(mn1610::TABLE, mn1610::CPUS);
+}
+
+void DisBackends::restore() {
+    for (auto &backend : _backends)
+        backend->restore();
+}
+
+int DisBackends::run(int argc, const char **argv, FILE *out, FILE *err) {
+    restore();
+    DisCommander commander(registry, out, err);
+    if (commander.parseArgs(argc, argv))
+        return commander.usage();
+    return commander.disassemble();
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DIS_BACKENDS_H__
+#define __DIS_BACKENDS_H__
+
+#include "cpu_registry.h"
+#include "dis_base.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace cli {
+
+/** A disassembler which is constructed on first use. */
+struct DisBackend : driver::CpuBackend<Disassembler> {
+    /** restore the default CPU and options, if constructed */
+    virtual void restore() = 0;
+};
+
+template <typename DIS, typename CPUTYPE>
+class LazyDis : public DisBackend {
+public:
+    LazyDis(const InsnTable<CPUTYPE> &table, const /*PROGMEM*/ CPUTYPE *cpus = nullptr,
+            const /*PROGMEM*/ CPUTYPE *cpusEnd = nullptr)
+        : _table(table), _cpus(cpus), _cpusEnd(cpusEnd) {}
+
+    const /*PROGMEM*/ char *listCpu_P() const override { return _table.listCpu_P(); }
+    bool accepts(const char *cpu) override {
+        return driver::acceptsCpu(_table, cpu, _cpus, _cpusEnd);
+    }
+    Disassembler &instance() override {
+        if (!_disassembler) {
+            _disassembler.reset(new DIS());
+            _defaultCpu = base().cpu_P();
+        }
+        return base();
+    }
+    Disassembler *constructed() override { return _disassembler.get(); }
+    void restore() override {
+        if (_disassembler) {
+            base().setCpu(_defaultCpu.c_str());
+            base().reset();
+        }
+    }
+
+private:
+    const InsnTable<CPUTYPE> &_table;
+    const /*PROGMEM*/ CPUTYPE *_cpus;
+    const /*PROGMEM*/ CPUTYPE *_cpusEnd;
+    std::unique_ptr<DIS> _disassembler;
+    std::string _defaultCpu;
+
+    Disassembler &base() { return *_disassembler; }
+};
+
+/** A registry of all disassemblers; one instance per thread. */
+struct DisBackends {
+    DisBackends();
+
+    driver::CpuRegistry<Disassembler> registry;
+
+    /** Restore the default CPU and options of all constructed back ends. */
+    void restore();
+
+    /**
+     * Run a batch job which prints to |out| and |err|; CPU and options may
+     * be changed by a previous job.
+     */
+    int run(int argc, const char **argv, FILE *out, FILE *err);
+
+private:
+    std::vector<std::shared_ptr<DisBackend>> _backends;
+
+    template <typename DIS, typename CPUTYPE>
+    void add(const InsnTable<CPUTYPE> &table) {
+        add(std::make_shared<LazyDis<DIS, CPUTYPE>>(table));
+    }
+
+    /** add a back end of variants |cpus| selected at compile time */
+    template <typename DIS, typename CPUTYPE, size_t N>
+    void add(const InsnTable<CPUTYPE> &table, const /*PROGMEM*/ CPUTYPE (&cpus)[N]) {
+        add(std::make_shared<LazyDis<DIS, CPUTYPE>>(table, cpus, cpus + N));
+    }
+
+    void add(const std::shared_ptr<DisBackend> &backend) {
+        _backends.push_back(backend);
+        registry.add(backend);
+    }
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -17,94 +17,275 @@
 #include "dis_commander.h"
 
 #include "bin_decoder.h"
+#include "dis_backends.h"
+#include "cycle_counters.h"
 #include "dis_formatter.h"
+#include "dis_stream.h"
 #include "file_printer.h"
 #include "file_reader.h"
+#include "signature_db.h"
+#include "trace_disassembler.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace libasm {
 namespace cli {
 
 using namespace libasm::driver;
 
-DisCommander::DisCommander(Disassembler **begin, Disassembler **end) : _driver(begin, end) {}
+namespace {
+
+/** Read-only memory mapping of a signature database file. */
+struct MappedDb {
+    MappedDb() : base(MAP_FAILED), size(0) {}
+    ~MappedDb() {
+        if (base != MAP_FAILED)
+            munmap(base, size);
+    }
+
+    bool map(const char *name) {
+        const auto fd = ::open(name, O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            size = st.st_size;
+            base = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);
+        return base != MAP_FAILED && db.attach(base, size);
+    }
+
+    void *base;
+    size_t size;
+    SignatureDb db;
+};
+
+/** Feed each decoded record to |DisStream| and drop it from memory. */
+struct StreamFeeder : BinDecoder::Listener {
+    StreamFeeder(DisStream &stream) : stream(stream) {}
+
+    void record(BinMemory &memory) override {
+        for (const auto &it : memory)
+            stream.feed(it.base, it.data.data(), it.data.size());
+        BinMemory empty;
+        memory.swap(empty);
+    }
+
+    DisStream &stream;
+};
+
+struct FileSource : TraceSource {
+    FileSource(FILE *file) : file(file) {}
+    size_t read(uint8_t *buffer, size_t size) override { return fread(buffer, 1, size, file); }
+    FILE *file;
+};
+
+}  // namespace
+
+DisCommander::DisCommander(const CpuRegistry<Disassembler> &registry, FILE *out, FILE *err)
+    : _driver(registry), _out(out), _err(err) {}
 
 int DisCommander::disassemble() {
     if (_verbose)
-        fprintf(stderr, "libasm disassembler (version " LIBASM_VERSION_STRING ")\n");
+        fprintf(_err, "libasm disassembler (version " LIBASM_VERSION_STRING ")\n");
     if (defaultDisassembler() == nullptr && _cpu == nullptr) {
-        fprintf(stderr, "No target CPU specified\n");
+        fprintf(_err, "No target CPU specified\n");
         return 1;
     }
     if (_driver.setCpu(_cpu) == nullptr) {
-        fprintf(stderr, "Unknown target CPU %s\n", _cpu);
+        fprintf(_err, "Unknown target CPU %s\n", _cpu);
         return 1;
     }
+    if (_trace)
+        return disassembleTrace();
 
+    resetStats();
     BinMemory memory;
-    FileReader input(_input_name);
-    if (!input.open()) {
-        fprintf(stderr, "Can't open input file %s\n", _input_name);
-        return 1;
-    }
-    if (readBinary(input, memory) < 0)
-        return 1;
-    input.close();
-
-    const auto addrUnit = static_cast<uint8_t>(_driver.current()->config().addressUnit());
-    const auto mem_start = memory.startAddress() / addrUnit;
-    const auto mem_end = memory.endAddress() / addrUnit;
-    if (_dis_start > mem_end || _dis_end < mem_start) {
-        fprintf(stderr, "Input file has address range: 0x%04X,0x%04X\n", mem_start, mem_end);
-        fprintf(stderr, "-A range has no intersection: 0x%04X,0x%04X\n", _dis_start, _dis_end);
-        return 1;
+    if (!_stream) {
+        if (readInput(memory) < 0)
+            return 1;
+        const auto addrUnit = static_cast<uint8_t>(_driver.current()->config().addressUnit());
+        const auto mem_start = memory.startAddress() / addrUnit;
+        const auto mem_end = memory.endAddress() / addrUnit;
+        if (_dis_start > mem_end || _dis_end < mem_start) {
+            fprintf(_err, "Input file has address range: 0x%04X,0x%04X\n", mem_start,
+                    mem_end);
+            fprintf(_err, "-A range has no intersection: 0x%04X,0x%04X\n", _dis_start,
+                    _dis_end);
+            return 1;
+        }
     }
 
     auto &disassembler = *_driver.current();
     DisFormatter listing(disassembler, _input_name);
     listing.setUpperHex(_upper_hex);
     listing.setUppercase(_uppercase);
+    if (_cycles)
+        addCycleCounters(listing);
     for (auto &opt : _options) {
         disassembler.setOption(opt.first.c_str(), opt.second.c_str());
     }
+    MappedDb sigdb;
+    SignatureMatcher matcher(disassembler, sigdb.db);
+    if (_sigdb_name) {
+        if (!sigdb.map(_sigdb_name)) {
+            fprintf(_err, "Can't read signature database %s\n", _sigdb_name);
+            return 1;
+        }
+        const auto found = matcher.match(memory);
+        if (_verbose)
+            fprintf(_err, "%s: Recognized %zu routines\n", _sigdb_name, found);
+        listing.setSymbolTable(&matcher);
+    }
 
     FilePrinter output;
     if (_output_name) {
-        if (!output.open(_output_name)) {
-            fprintf(stderr, "Can't open output file %s\n", _output_name);
+        if (!output.open(_output_name, _out)) {
+            fprintf(_err, "Can't open output file %s\n", _output_name);
             return 1;
         }
         if (_verbose)
-            fprintf(stderr, "%s: Opened for output\n", output.name().c_str());
+            fprintf(_err, "%s: Opened for output\n", output.name().c_str());
         output.println(listing.getContent());
     }
     FilePrinter listout;
     if (_list_name) {
-        if (!listout.open(_list_name)) {
-            fprintf(stderr, "Can't open list file %s\n", _list_name);
+        if (!listout.open(_list_name, _out)) {
+            fprintf(_err, "Can't open list file %s\n", _list_name);
             return 1;
         }
         if (_verbose)
-            fprintf(stderr, "%s: Opened for listing\n", listout.name().c_str());
+            fprintf(_err, "%s: Opened for listing\n", listout.name().c_str());
         listout.println(listing.getLine());
     }
 
     listing.setCpu(_cpu);
-    _driver.disassemble(
-            memory, _dis_start, _dis_end, listing, output, listout, FilePrinter::STDERR);
+    FilePrinter errorout("/dev/stderr", _err);
+    if (_stream) {
+        DisStream stream(disassembler, listing, output, listout, errorout, _dis_start, _dis_end);
+        StreamFeeder feeder(stream);
+        const auto size = readInput(memory, &feeder);
+        stream.flush();
+        if (size < 0)
+            return 1;
+    } else {
+        _driver.disassemble(memory, _dis_start, _dis_end, listing, output, listout, errorout);
+    }
+
+    printStats(_err, _stats);
+    return 0;
+}
+
+int DisCommander::disassembleTrace() {
+    resetStats();
+    // Each thread decodes with its own disassembler set up alike.
+    const auto cpu = _driver.current()->cpu_P();
+    const size_t threads =
+            _threads > 0 ? _threads : std::max(std::thread::hardware_concurrency(), 1U);
+    std::vector<std::unique_ptr<DisBackends>> backends;
+    std::vector<Disassembler *> disassemblers{_driver.current()};
+    for (size_t i = 1; i < threads; i++) {
+        backends.emplace_back(new DisBackends());
+        disassemblers.push_back(&(*backends.back()->registry.search(cpu))->instance());
+    }
+    for (auto dis : disassemblers) {
+        dis->setCpu(cpu);
+        dis->setUpperHex(_upper_hex);
+        for (auto &opt : _options)
+            dis->setOption(opt.first.c_str(), opt.second.c_str());
+    }
 
+    const auto name = strcmp(_input_name, "-") == 0 ? "/dev/stdin" : _input_name;
+    const auto input = fopen(name, "rb");
+    if (input == nullptr) {
+        fprintf(_err, "Can't open input file %s\n", _input_name);
+        return 1;
+    }
+    FilePrinter output;
+    const auto output_name = _output_name ? _output_name : "/dev/stdout";
+    if (!output.open(output_name, _out)) {
+        fprintf(_err, "Can't open output file %s\n", output_name);
+        fclose(input);
+        return 1;
+    }
+    FileSource source(input);
+    TraceDisassembler tracer(disassemblers, _uppercase);
+    const auto records = _trace_count ? tracer.count(source, output) : tracer.trace(source, output);
+    fclose(input);
+    if (_verbose) {
+        fprintf(_err, "%s: %lld records, %zu decoded, %zu cached, %zu threads\n", _input_name,
+                static_cast<long long>(records < 0 ? -records - 1 : records), tracer.misses(),
+                tracer.hits(), disassemblers.size());
+    }
+    if (records < 0) {
+        fprintf(_err, "%s: Trace ends in the middle of a record\n", _input_name);
+        return 1;
+    }
+    printStats(_err, _stats);
     return 0;
 }
 
-int DisCommander::readBinary(FileReader &input, BinMemory &memory) {
+int DisCommander::readInput(BinMemory &memory, BinDecoder::Listener *listener) {
+    // "-" reads standard input, which may be an unbounded pipe with -s
+    const auto name = strcmp(_input_name, "-") == 0 ? "/dev/stdin" : _input_name;
+    if (_raw) {
+        const auto input = fopen(name, "rb");
+        if (input == nullptr) {
+            fprintf(_err, "Can't open input file %s\n", _input_name);
+            return -1;
+        }
+        const auto size = readRaw(input, memory, listener);
+        fclose(input);
+        return size;
+    }
+    FileReader input(name);
+    if (!input.open()) {
+        fprintf(_err, "Can't open input file %s\n", _input_name);
+        return -1;
+    }
+    const auto size = readBinary(input, memory, listener);
+    input.close();
+    return size;
+}
+
+int DisCommander::readRaw(FILE *input, BinMemory &memory, BinDecoder::Listener *listener) {
+    const auto addrUnit = static_cast<uint8_t>(_driver.current()->config().addressUnit());
+    auto addr = _raw_origin * addrUnit;
+    uint8_t buffer[256];
+    size_t len;
+    int size = 0;
+    while ((len = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        for (size_t i = 0; i < len; i++)
+            memory.writeByte(addr++, buffer[i]);
+        size += len;
+        if (listener)
+            listener->record(memory);
+    }
+    if (_verbose && size)
+        fprintf(_err, "%s: Read %4d bytes 0x%04X-0x%04X\n", _input_name, size, _raw_origin,
+                (addr - 1) / addrUnit);
+    return size;
+}
+
+int DisCommander::readBinary(
+        FileReader &input, BinMemory &memory, BinDecoder::Listener *listener) {
     const auto filename = input.name().c_str();
     const auto addrUnit = static_cast<uint8_t>(_driver.current()->config().addressUnit());
-    const auto size = BinDecoder::decode(input, memory);
+    const auto size = BinDecoder::decode(input, memory, listener);
     if (size < 0) {
-        fprintf(stderr, "%s:%d: Unrecognizable binary format\n", filename, input.lineno());
+        fprintf(_err, "%s:%d: Unrecognizable binary format\n", filename, input.lineno());
         return size;
     }
     if (_verbose) {
@@ -112,7 +293,7 @@ int DisCommander::readBinary(FileReader &input, BinMemory &memory) {
             const uint32_t start = it.base / addrUnit;
             const size_t size = it.data.size();
             const uint32_t end = (it.base + size - 1) / addrUnit;
-            fprintf(stderr, "%s: Read %4zu bytes 0x%04X-0x%04X\n", filename, size, start, end);
+            fprintf(_err, "%s: Read %4zu bytes 0x%04X-0x%04X\n", filename, size, start, end);
         }
     }
     return size;
@@ -151,36 +332,51 @@ int DisCommander::usage() {
     } else {
         list += cpuSep + buf;
     }
-    fprintf(stderr,
+    fprintf(_err,
             "libasm disassembler (version " LIBASM_VERSION_STRING
             ")\n"
             "usage: %s%s [-o <output>] [-l <list>] <input>\n"
+            "       %s -B <jobs> [-j <threads>]\n"
             "  -C <CPU>    : target CPU%s\n"
             "  -o <output> : output file\n"
             "  -l <list>   : list file\n"
-            "  <input>     : file can be Motorola S-Record or Intel HEX format\n"
+            "  <input>     : file can be Motorola S-Record or Intel HEX format,\n"
+            "                or - for standard input\n"
+            "  -b <origin> : input is raw binary loaded at origin address\n"
+            "  -s          : disassemble input as it arrives with bounded memory\n"
+            "  -t          : input is binary emulator trace, print each instruction\n"
+            "  -T          : input is binary emulator trace, print execution counts\n"
             "  -A start[,end]\n"
             "              : disassemble start address and optional end address\n"
             "  -r          : use program counter relative notation\n"
             "  -h          : use lower case letter for hexadecimal\n"
             "  -u          : use upper case letter for output\n"
-            "  -v          : print progress verbosely\n",
-            _prog_name, cpuOption, list.c_str());
+            "  -c          : output clock cycles to list file\n"
+            "  -S <sigdb>  : name routines recognized by signature database\n"
+            "  -v          : print progress verbosely\n"
+            "  -B <jobs>   : run jobs concurrently, one command line per line\n"
+            "  -j <threads>: number of threads for -B, -t and -T\n",
+            _prog_name, cpuOption, _prog_name, list.c_str());
+    if (statsAvailable()) {
+        fprintf(_err,
+                "  --stats[=json]\n"
+                "              : print time spent in each phase\n");
+    }
     bool longOptions = false;
     for (const auto *dis : _driver)
         longOptions |= (dis->commonOptions().head() || dis->options().head());
     if (longOptions) {
-        fprintf(stderr,
+        fprintf(_err,
                 "  --<name>=<vale>\n"
                 "              : extra options (<type> [, <CPU>])\n");
         const auto dis = *_driver.begin();
         for (const auto *opt = dis->commonOptions().head(); opt; opt = opt->next()) {
-            fprintf(stderr, "  %-16s: %s  (%s)\n", opt->name_P(), opt->description_P(),
+            fprintf(_err, "  %-16s: %s  (%s)\n", opt->name_P(), opt->description_P(),
                     Options::nameof(opt->spec()));
         }
         for (const auto *dis : _driver) {
             for (const auto *opt = dis->options().head(); opt; opt = opt->next()) {
-                fprintf(stderr, "  %-16s: %s  (%s, %s)\n", opt->name_P(), opt->description_P(),
+                fprintf(_err, "  %-16s: %s  (%s, %s)\n", opt->name_P(), opt->description_P(),
                         Options::nameof(opt->spec()), dis->cpu_P());
             }
         }
@@ -207,32 +403,42 @@ int DisCommander::parseArgs(int argc, const char **argv) {
     _output_name = nullptr;
     _list_name = nullptr;
     _cpu = nullptr;
+    _sigdb_name = nullptr;
+    _batch_name = nullptr;
+    _threads = 0;
+    _stream = false;
+    _trace = false;
+    _trace_count = false;
+    _raw = false;
+    _raw_origin = 0;
     _upper_hex = true;
     _uppercase = false;
+    _cycles = false;
     _verbose = false;
+    _stats = STATS_NONE;
     _dis_start = 0;
     _dis_end = UINT32_MAX;
     for (auto i = 1; i < argc; i++) {
         const auto *opt = argv[i];
-        if (*opt == '-') {
+        if (*opt == '-' && opt[1]) {
             switch (*++opt) {
             case 'o':
                 if (++i >= argc) {
-                    fprintf(stderr, "-o requires output file name\n");
+                    fprintf(_err, "-o requires output file name\n");
                     return 1;
                 }
                 _output_name = argv[i];
                 break;
             case 'l':
                 if (++i >= argc) {
-                    fprintf(stderr, "-l requires listing file name\n");
+                    fprintf(_err, "-l requires listing file name\n");
                     return 1;
                 }
                 _list_name = argv[i];
                 break;
             case 'C': {
                 if (++i >= argc) {
-                    fprintf(stderr, "-C requires CPU name\n");
+                    fprintf(_err, "-C requires CPU name\n");
                     return 1;
                 }
                 _cpu = argv[i];
@@ -247,26 +453,72 @@ int DisCommander::parseArgs(int argc, const char **argv) {
             case 'u':
                 _uppercase = true;
                 break;
+            case 'c':
+                _cycles = true;
+                break;
+            case 'S':
+                if (++i >= argc) {
+                    fprintf(_err, "-S requires signature database file name\n");
+                    return 1;
+                }
+                _sigdb_name = argv[i];
+                break;
+            case 'B':
+                if (++i >= argc) {
+                    fprintf(_err, "-B requires batch file name\n");
+                    return 1;
+                }
+                _batch_name = argv[i];
+                break;
+            case 'j':
+                if (++i >= argc) {
+                    fprintf(_err, "-j requires number of threads\n");
+                    return 1;
+                }
+                _threads = atoi(argv[i]);
+                break;
             case 'v':
                 _verbose = true;
                 break;
+            case 's':
+                _stream = true;
+                break;
+            case 't':
+            case 'T':
+                _trace = true;
+                _trace_count = (*opt == 'T');
+                break;
+            case 'b':
+                if (++i >= argc) {
+                    fprintf(_err, "-b requires origin address\n");
+                    return 1;
+                } else {
+                    char *end;
+                    _raw_origin = strtoul(argv[i], &end, 0);
+                    if (end == argv[i] || *end) {
+                        fprintf(_err, "invalid address format for -b: %s\n", argv[i]);
+                        return 1;
+                    }
+                    _raw = true;
+                }
+                break;
             case 'A':
                 if (++i >= argc) {
-                    fprintf(stderr, "-A requires start[,end] address\n");
+                    fprintf(_err, "-A requires start[,end] address\n");
                     return 1;
                 } else {
                     char *end_start;
                     _dis_start = strtoul(argv[i], &end_start, 0);
                     if (end_start == argv[i]) {
                     format_error:
-                        fprintf(stderr, "invalid address format for -A: %s\n", argv[i]);
+                        fprintf(_err, "invalid address format for -A: %s\n", argv[i]);
                         return 1;
                     }
                     if (*end_start == 0)
                         break;
                     if (*end_start++ != ',') {
                     form_error:
-                        fprintf(stderr, "address must be start[,end] form: %s\n", argv[i]);
+                        fprintf(_err, "address must be start[,end] form: %s\n", argv[i]);
                         return 1;
                     }
                     char *end_end;
@@ -276,38 +528,64 @@ int DisCommander::parseArgs(int argc, const char **argv) {
                     if (*end_end)
                         goto form_error;
                     if (_dis_end < _dis_start) {
-                        fprintf(stderr, "end address must be less than start: %s\n", argv[i]);
+                        fprintf(_err, "end address must be less than start: %s\n", argv[i]);
                         return 1;
                     }
                 }
                 break;
             case '-':
+                if (parseStatsOption(opt + 1, _stats)) {
+                    if (!statsAvailable()) {
+                        fprintf(_err, "--stats requires libasm built with LIBASM_STATS\n");
+                        return 1;
+                    }
+                    if (_stats == STATS_NONE) {
+                        fprintf(_err, "--stats accepts text or json\n");
+                        return 1;
+                    }
+                    break;
+                }
                 if (parseOptionValue(++opt) == 0)
                     break;
-                fprintf(stderr, "long option requires option=value\n");
+                fprintf(_err, "long option requires option=value\n");
                 return 1;
             default:
-                fprintf(stderr, "unknown option: %s\n", opt);
+                fprintf(_err, "unknown option: %s\n", opt);
                 return 1;
             }
         } else {
             if (_input_name) {
-                fprintf(stderr, "multiple input files specified: %s and %s\n", _input_name, opt);
+                fprintf(_err, "multiple input files specified: %s and %s\n", _input_name, opt);
                 return 1;
             }
             _input_name = opt;
         }
     }
+    if (_batch_name) {
+        if (_input_name) {
+            fprintf(_err, "input file can't be specified with -B\n");
+            return 1;
+        }
+        return 0;
+    }
     if (_input_name == nullptr) {
-        fprintf(stderr, "no input file\n");
+        fprintf(_err, "no input file\n");
+        return 1;
+    }
+    if (_trace && (_stream || _raw || _sigdb_name || _list_name)) {
+        fprintf(_err, "-s, -b, -S and -l can't be used with -t or -T\n");
+        return 1;
+    }
+    if (_stream && _sigdb_name) {
+        fprintf(_err, "-S can't be used with -s\n");
         return 1;
     }
     if (_output_name && strcmp(_output_name, _input_name) == 0) {
-        fprintf(stderr, "output file overwrite input file\n");
+        fprintf(_err, "output file overwrite input file\n");
         return 2;
     }
     if (_list_name && strcmp(_list_name, _input_name) == 0) {
-        fprintf(stderr, "listing file overwrite input file\n");
+        fprintf(_err, "listing file overwrite input file\n");
         return 2;
     }
     for (auto &option : _options) {
@@ -329,7 +607,7 @@ int DisCommander::parseArgs(int argc, const char **argv) {
             }
         }
         if (!valid) {
-            fprintf(stderr, "unknown option --%s=%s\n", option.first.c_str(),
+            fprintf(_err, "unknown option --%s=%s\n", option.first.c_str(),
                     option.second.c_str());
             return 1;
         }
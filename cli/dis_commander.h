@@ -17,11 +17,14 @@
 #ifndef __DIS_COMMANDER_H__
 #define __DIS_COMMANDER_H__
 
+#include "bin_decoder.h"
 #include "bin_memory.h"
 #include "dis_base.h"
 #include "dis_driver.h"
 #include "file_reader.h"
+#include "stats_printer.h"
 
+#include <cstdio>
 #include <map>
 
 namespace libasm {
@@ -29,30 +32,51 @@ namespace cli {
 
 class DisCommander {
 public:
-    DisCommander(Disassembler **begin, Disassembler **end);
+    /** messages are printed to |err|, and "/dev/stdout" is |out| */
+    DisCommander(const driver::CpuRegistry<Disassembler> &registry, FILE *out = stdout,
+            FILE *err = stderr);
 
     int parseArgs(int argc, const char **argv);
     int usage();
     int disassemble();
 
+    const char *batchName() const { return _batch_name; }
+    int threads() const { return _threads; }
+
 private:
     driver::DisDriver _driver;
+    FILE *const _out;
+    FILE *const _err;
     // command line arguments
     const char *_prog_name;
     const char *_input_name;
     const char *_output_name;
     const char *_list_name;
     const char *_cpu;
+    const char *_sigdb_name;
+    const char *_batch_name;
+    int _threads;
+    bool _stream;
+    bool _trace;
+    bool _trace_count;
+    bool _raw;
+    uint32_t _raw_origin;
     bool _upper_hex;
     bool _uppercase;
+    bool _cycles;
     bool _verbose;
     uint32_t _dis_start;
     uint32_t _dis_end;
     std::map<std::string, std::string> _options;
+    StatsFormat _stats;
 
     static constexpr const char *PROG_PREFIX = "dis";
     Disassembler *defaultDisassembler();
-    int readBinary(FileReader &input, driver::BinMemory &memory);
+    int disassembleTrace();
+    int readInput(driver::BinMemory &memory, driver::BinDecoder::Listener *listener = nullptr);
+    int readBinary(FileReader &input, driver::BinMemory &memory,
+            driver::BinDecoder::Listener *listener);
+    int readRaw(FILE *input, driver::BinMemory &memory, driver::BinDecoder::Listener *listener);
     int parseOptionValue(const char *option);
 };
 
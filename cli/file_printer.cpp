@@ -16,33 +16,36 @@
 
 #include "file_printer.h"
 
+#include "phase_stats.h"
+
 #include <cstdarg>
 
 namespace libasm {
 namespace cli {
 
-FilePrinter FilePrinter::STDERR{"/dev/stderr", stderr};
-
-FilePrinter::FilePrinter() : _name(), _file(nullptr) {}
+FilePrinter::FilePrinter() : _name(), _file(nullptr), _close(false) {}
 
 FilePrinter::~FilePrinter() {
-    if (_file)
-        fclose(_file);
+    close();
 }
 
-bool FilePrinter::open(const std::string &name) {
-    _file = fopen(name.c_str(), "w");
+bool FilePrinter::open(const std::string &name, FILE *out) {
+    close();
+    _close = name != "/dev/stdout";
+    _file = _close ? fopen(name.c_str(), "w") : out;
     if (_file)
         _name = name;
     return _file != nullptr;
 }
 
 void FilePrinter::close() {
-    if (_file)
+    if (_file && _close)
         fclose(_file);
+    _file = nullptr;
 }
 
 void FilePrinter::println(const char *text) {
+    LIBASM_STATS_SCOPE(FILE_IO);
     if (_file == nullptr)
         return;
     fprintf(_file, "%s\n", text);
@@ -50,6 +53,7 @@ void FilePrinter::println(const char *text) {
 }
 
 void FilePrinter::format(const char *fmt, ...) {
+    LIBASM_STATS_SCOPE(FILE_IO);
     if (_file == nullptr)
         return;
     va_list args;
@@ -28,20 +28,20 @@ namespace cli {
 class FilePrinter : public libasm::driver::TextPrinter {
 public:
     FilePrinter();
+    /** print to |file| which is opened as |name|; |file| isn't closed */
+    FilePrinter(const char *name, FILE *file) : _name(name), _file(file), _close(false) {}
     ~FilePrinter();
     const std::string &name() const { return _name; }
-    bool open(const std::string &name);
+    /** open |name| for writing; "/dev/stdout" is |out|, which may be buffered by a batch job */
+    bool open(const std::string &name, FILE *out = stdout);
     void close();
     void println(const char *text) override;
     void format(const char *fmt, ...) override;
 
-    static FilePrinter STDERR;
-
 private:
     std::string _name;
     FILE *_file;
-
-    FilePrinter(const char *name, FILE *file) : _name(name), _file(file) {}
+    bool _close;
 };
 
 }  // namespace cli
@@ -16,6 +16,8 @@
 
 #include "file_reader.h"
 
+#include "phase_stats.h"
+
 #include <cstdlib>
 #include <cstring>
 
@@ -40,9 +42,15 @@ static int getLine(char *&lineptr, size_t &n, FILE *input) {
 }
 
 FileReader::FileReader(const std::string &name)
-    : _name(name), _file(nullptr), _lineno(0), _line_len(80) {
-    _line = static_cast<char *>(malloc(_line_len));
-}
+    : _name(name), _mapped(), _file(nullptr), _lineno(0), _line_len(0), _line(nullptr) {}
+
+FileReader::FileReader(const std::shared_ptr<MappedFile> &mapped)
+    : _name(mapped->name()),
+      _mapped(mapped),
+      _file(nullptr),
+      _lineno(0),
+      _line_len(0),
+      _line(nullptr) {}
 
 FileReader::~FileReader() {
     close();
@@ -50,6 +58,16 @@ FileReader::~FileReader() {
 }
 
 StrScanner *FileReader::readLine() {
+    LIBASM_STATS_SCOPE(FILE_IO);
+    if (_mapped) {
+        if (static_cast<size_t>(_lineno) >= _mapped->lines()) {
+            close();
+            return nullptr;
+        }
+        _line_scan = StrScanner(_mapped->line(_lineno), _mapped->lineEnd(_lineno));
+        ++_lineno;
+        return &_line_scan;
+    }
     if (_file == nullptr || getLine(_line, _line_len, _file) < 0) {
         close();
         return nullptr;
@@ -60,6 +78,18 @@ StrScanner *FileReader::readLine() {
 }
 
 bool FileReader::open() {
+    if (!_mapped) {
+        auto mapped = std::make_shared<MappedFile>(_name);
+        if (mapped->map())
+            _mapped = mapped;
+    }
+    if (_mapped)
+        return _mapped->mapped();
+    // Fall back to stdio, i.e. for a pipe.
+    if (_line == nullptr) {
+        _line_len = 80;
+        _line = static_cast<char *>(malloc(_line_len));
+    }
     _file = fopen(_name.c_str(), "r");
     return _file != nullptr;
 }
@@ -68,6 +98,7 @@ void FileReader::close() {
     if (_file)
         fclose(_file);
     _file = nullptr;
+    _mapped.reset();
 }
 
 }  // namespace cli
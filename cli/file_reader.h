@@ -17,9 +17,11 @@
 #ifndef __FILE_READER_H__
 #define __FILE_READER_H__
 
+#include "mapped_file.h"
 #include "text_reader.h"
 
 #include <cstdio>
+#include <memory>
 
 namespace libasm {
 namespace cli {
@@ -27,7 +29,13 @@ namespace cli {
 class FileReader : public driver::TextReader {
 public:
     FileReader(const std::string &name);
+    /** read lines from |mapped| file which may be shared with other readers */
+    FileReader(const std::shared_ptr<MappedFile> &mapped);
     ~FileReader();
+
+    FileReader(const FileReader &) = delete;
+    FileReader &operator=(const FileReader &) = delete;
+
     const std::string &name() const override { return _name; }
     int lineno() const override { return _lineno; }
     StrScanner *readLine() override;
@@ -36,6 +44,7 @@ public:
 
 private:
     const std::string _name;
+    std::shared_ptr<MappedFile> _mapped;
     FILE *_file;
     int _lineno;
     size_t _line_len;
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "file_sources.h"
+
+namespace libasm {
+namespace cli {
+
+Error FileSources::open(const StrScanner &name) {
+    if (size() >= max_includes)
+        return TOO_MANY_INCLUDE;
+    const auto *parent = _sources.empty() ? nullptr : &_sources.back();
+    const auto pos = parent ? parent->name().find_last_of('/') : std::string::npos;
+    std::string path;
+    if (pos == std::string::npos || *name == '/') {
+        path.assign(name.str(), name.size());
+    } else {
+        path.assign(parent->name().substr(0, pos + 1));
+        path.append(name.str(), name.size());
+    }
+    const auto mapped = map(path);
+    if (mapped) {
+        _sources.emplace_back(mapped);
+    } else {
+        _sources.emplace_back(path);
+    }
+    if (!_sources.back().open()) {
+        _sources.pop_back();
+        return NO_INCLUDE_FOUND;
+    }
+    return OK;
+}
+
+std::shared_ptr<MappedFile> FileSources::map(const std::string &path) {
+    const auto it = _mapped.find(path);
+    if (it != _mapped.end())
+        return it->second;
+    auto mapped = std::make_shared<MappedFile>(path);
+    if (!mapped->map())
+        return nullptr;
+    _mapped.emplace(path, mapped);
+    return mapped;
+}
+
+driver::TextReader *FileSources::last() {
+    return _sources.empty() ? nullptr : &_sources.back();
+}
+
+driver::TextReader *FileSources::secondToLast() {
+    if (size() < 2)
+        return nullptr;
+    auto it = _sources.rbegin();
+    return &(*++it);
+}
+
+Error FileSources::closeCurrent() {
+    auto &reader = _sources.back();
+    reader.close();
+    _sources.pop_back();
+    return OK;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
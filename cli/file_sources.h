@@ -0,0 +1,65 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FILE_SOURCES_H__
+#define __FILE_SOURCES_H__
+
+#include "asm_sources.h"
+#include "file_reader.h"
+#include "mapped_file.h"
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace libasm {
+namespace cli {
+
+/** Source files and include files of an assembly. */
+class FileSources : public driver::AsmSources {
+public:
+    Error open(const StrScanner &name) override;
+    Error closeCurrent() override;
+
+    /** forget mapped files, which may have been modified since */
+    void clear() { _mapped.clear(); }
+
+protected:
+    int size() const override { return _sources.size(); }
+    driver::TextReader *last() override;
+    driver::TextReader *secondToLast() override;
+
+private:
+    static constexpr int max_includes = 4;
+    std::list<FileReader> _sources;
+    /** mapped files are kept alive for all passes */
+    std::map<std::string, std::shared_ptr<MappedFile>> _mapped;
+
+    std::shared_ptr<MappedFile> map(const std::string &path);
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,302 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "json_message.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace libasm {
+namespace cli {
+
+static const char *skipSpaces(const char *p) {
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+        p++;
+    return p;
+}
+
+static void appendUtf8(std::string &text, uint32_t c) {
+    if (c < 0x80) {
+        text += static_cast<char>(c);
+    } else if (c < 0x800) {
+        text += static_cast<char>(0xC0 | (c >> 6));
+        text += static_cast<char>(0x80 | (c & 0x3F));
+    } else {
+        text += static_cast<char>(0xE0 | (c >> 12));
+        text += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (c & 0x3F));
+    }
+}
+
+const char *JsonRequest::parseString(const char *&p, std::string &text) {
+    if (*p++ != '"')
+        return "string expected";
+    text.clear();
+    while (*p != '"') {
+        if (*p == 0)
+            return "unterminated string";
+        if (*p != '\\') {
+            text += *p++;
+            continue;
+        }
+        p++;
+        switch (*p++) {
+        case '"':
+            text += '"';
+            break;
+        case '\\':
+            text += '\\';
+            break;
+        case '/':
+            text += '/';
+            break;
+        case 'b':
+            text += '\b';
+            break;
+        case 'f':
+            text += '\f';
+            break;
+        case 'n':
+            text += '\n';
+            break;
+        case 'r':
+            text += '\r';
+            break;
+        case 't':
+            text += '\t';
+            break;
+        case 'u': {
+            uint32_t c = 0;
+            for (auto i = 0; i < 4; i++, p++) {
+                if (!isxdigit(*p))
+                    return "illegal unicode escape";
+                c = (c << 4) | (isdigit(*p) ? *p - '0' : (toupper(*p) - 'A' + 10));
+            }
+            appendUtf8(text, c);
+            break;
+        }
+        default:
+            return "illegal escape";
+        }
+    }
+    p++;
+    return nullptr;
+}
+
+const char *JsonRequest::parseInteger(const char *&p, int64_t &value) {
+    char *end;
+    errno = 0;
+    value = strtoll(p, &end, 10);
+    if (end == p || errno)
+        return "integer expected";
+    if (*end == '.' || *end == 'e' || *end == 'E')
+        return "integer expected";
+    p = end;
+    return nullptr;
+}
+
+const char *JsonRequest::parseValue(const char *&p, Value &value) {
+    const auto start = p;
+    const char *error = nullptr;
+    if (*p == '"') {
+        value.type = STRING;
+        error = parseString(p, value.text);
+    } else if (*p == '[') {
+        value.type = ARRAY;
+        p = skipSpaces(p + 1);
+        while (error == nullptr && *p != ']') {
+            if (value.array.size()) {
+                if (*p++ != ',')
+                    return "',' expected";
+                p = skipSpaces(p);
+            }
+            int64_t element;
+            error = parseInteger(p, element);
+            value.array.push_back(element);
+            p = skipSpaces(p);
+        }
+        if (error)
+            return error;
+        p++;
+    } else if (strncmp(p, "true", 4) == 0 || strncmp(p, "false", 5) == 0) {
+        value.type = BOOLEAN;
+        value.integer = (*p == 't');
+        p += value.integer ? 4 : 5;
+    } else if (strncmp(p, "null", 4) == 0) {
+        value.type = NUL;
+        p += 4;
+    } else if (*p == '{') {
+        return "nested object is not supported";
+    } else {
+        value.type = INTEGER;
+        error = parseInteger(p, value.integer);
+    }
+    if (error == nullptr)
+        value.raw.assign(start, p);
+    return error;
+}
+
+const char *JsonRequest::parse(const char *line) {
+    _values.clear();
+    auto p = skipSpaces(line);
+    if (*p++ != '{')
+        return "'{' expected";
+    p = skipSpaces(p);
+    while (*p != '}') {
+        if (_values.size()) {
+            if (*p++ != ',')
+                return "',' expected";
+            p = skipSpaces(p);
+        }
+        std::string key;
+        auto error = parseString(p, key);
+        if (error)
+            return error;
+        p = skipSpaces(p);
+        if (*p++ != ':')
+            return "':' expected";
+        p = skipSpaces(p);
+        Value value;
+        error = parseValue(p, value);
+        if (error)
+            return error;
+        _values[key] = std::move(value);
+        p = skipSpaces(p);
+    }
+    if (*skipSpaces(p + 1))
+        return "garbage after object";
+    return nullptr;
+}
+
+const JsonRequest::Value *JsonRequest::find(const char *key, Type type) const {
+    const auto it = _values.find(key);
+    if (it == _values.end() || it->second.type != type)
+        return nullptr;
+    return &it->second;
+}
+
+const char *JsonRequest::string(const char *key) const {
+    const auto value = find(key, STRING);
+    return value ? value->text.c_str() : nullptr;
+}
+
+bool JsonRequest::integer(const char *key, int64_t &integer) const {
+    const auto value = find(key, INTEGER);
+    if (value)
+        integer = value->integer;
+    return value;
+}
+
+bool JsonRequest::boolean(const char *key, bool &boolean) const {
+    const auto value = find(key, BOOLEAN);
+    if (value)
+        boolean = value->integer;
+    return value;
+}
+
+const std::vector<int64_t> *JsonRequest::array(const char *key) const {
+    const auto value = find(key, ARRAY);
+    return value ? &value->array : nullptr;
+}
+
+std::string JsonRequest::raw(const char *key) const {
+    const auto it = _values.find(key);
+    return it == _values.end() ? std::string() : it->second.raw;
+}
+
+void JsonWriter::separate() {
+    if (_comma)
+        _out += ',';
+}
+
+JsonWriter &JsonWriter::open(char c) {
+    separate();
+    _out += c;
+    _comma = false;
+    return *this;
+}
+
+JsonWriter &JsonWriter::close(char c) {
+    _out += c;
+    _comma = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::key(const char *name) {
+    string(name);
+    _out += ':';
+    _comma = false;
+    return *this;
+}
+
+JsonWriter &JsonWriter::string(const char *text) {
+    separate();
+    _out += '"';
+    for (auto p = text; *p; p++) {
+        const auto c = static_cast<uint8_t>(*p);
+        if (c == '"' || c == '\\') {
+            _out += '\\';
+            _out += c;
+        } else if (c == '\n') {
+            _out += "\\n";
+        } else if (c == '\t') {
+            _out += "\\t";
+        } else if (c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            _out += buf;
+        } else {
+            _out += c;
+        }
+    }
+    _out += '"';
+    _comma = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::integer(int64_t value) {
+    separate();
+    _out += std::to_string(value);
+    _comma = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::boolean(bool value) {
+    separate();
+    _out += value ? "true" : "false";
+    _comma = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::raw(const std::string &text) {
+    separate();
+    _out += text;
+    _comma = true;
+    return *this;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
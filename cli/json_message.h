@@ -0,0 +1,110 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __JSON_MESSAGE_H__
+#define __JSON_MESSAGE_H__
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace cli {
+
+/**
+ * A flat JSON object in one line. Values are limited to strings,
+ * integers, booleans, null and arrays of integers.
+ */
+class JsonRequest {
+public:
+    /** parse |line|, returns nullptr on success, otherwise error message */
+    const char *parse(const char *line);
+
+    bool has(const char *key) const { return _values.find(key) != _values.end(); }
+    /** returns nullptr if |key| doesn't exist or isn't a string */
+    const char *string(const char *key) const;
+    /** returns false if |key| doesn't exist or isn't an integer */
+    bool integer(const char *key, int64_t &value) const;
+    /** returns false if |key| doesn't exist or isn't a boolean */
+    bool boolean(const char *key, bool &value) const;
+    /** returns nullptr if |key| doesn't exist or isn't an array */
+    const std::vector<int64_t> *array(const char *key) const;
+    /** JSON text of the value of |key|, or empty */
+    std::string raw(const char *key) const;
+
+private:
+    enum Type : uint8_t {
+        STRING,
+        INTEGER,
+        BOOLEAN,
+        NUL,
+        ARRAY,
+    };
+    struct Value {
+        Type type;
+        std::string text;  // STRING
+        int64_t integer;   // INTEGER, BOOLEAN
+        std::vector<int64_t> array;
+        std::string raw;
+    };
+    std::map<std::string, Value, std::less<>> _values;
+
+    const Value *find(const char *key, Type type) const;
+    static const char *parseString(const char *&p, std::string &text);
+    static const char *parseInteger(const char *&p, int64_t &value);
+    static const char *parseValue(const char *&p, Value &value);
+};
+
+/** Build a JSON text in one line. */
+class JsonWriter {
+public:
+    JsonWriter() : _comma(false) {}
+
+    JsonWriter &beginObject() { return open('{'); }
+    JsonWriter &endObject() { return close('}'); }
+    JsonWriter &beginArray() { return open('['); }
+    JsonWriter &endArray() { return close(']'); }
+    JsonWriter &key(const char *name);
+    JsonWriter &string(const char *text);
+    JsonWriter &string(const std::string &text) { return string(text.c_str()); }
+    JsonWriter &integer(int64_t value);
+    JsonWriter &boolean(bool value);
+    /** append |text| which must be valid JSON */
+    JsonWriter &raw(const std::string &text);
+
+    const std::string &str() const { return _out; }
+
+private:
+    std::string _out;
+    bool _comma;
+
+    JsonWriter &open(char c);
+    JsonWriter &close(char c);
+    void separate();
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
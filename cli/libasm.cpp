@@ -0,0 +1,180 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libasm.h"
+
+#include "array_memory.h"
+#include "asm_backends.h"
+#include "decode_cache.h"
+#include "dis_backends.h"
+#include "str_buffer.h"
+
+#include <cstring>
+
+using namespace libasm;
+using namespace libasm::cli;
+using namespace libasm::driver;
+
+struct libasm_assembler {
+    AsmBackends backends;
+    Assembler *assembler;
+};
+
+struct libasm_disassembler {
+    DisBackends backends;
+    Disassembler *disassembler;
+    DecodeCache cache;
+};
+
+/** Write |name| and |operands| to |text|, truncated to LIBASM_MAX_TEXT. */
+static void setText(char (&text)[LIBASM_MAX_TEXT], const char *name, const char *operands) {
+    StrBuffer out(text, sizeof(text));
+    out.text(name);
+    if (*operands)
+        out.letter(' ').text(operands);
+}
+
+const char *libasm_error_text(uint16_t error) {
+    return ErrorReporter::errorText_P(static_cast<Error>(error));
+}
+
+libasm_assembler *libasm_asm_create(const char *cpu) {
+    auto handle = new libasm_assembler;
+    const auto backend = handle->backends.registry.search(cpu);
+    if (backend == nullptr) {
+        delete handle;
+        return nullptr;
+    }
+    handle->assembler = &(*backend)->instance().assembler();
+    handle->assembler->setCpu(cpu);
+    return handle;
+}
+
+void libasm_asm_destroy(libasm_assembler *assembler) {
+    delete assembler;
+}
+
+const char *libasm_asm_cpu(const libasm_assembler *assembler) {
+    return assembler->assembler->cpu_P();
+}
+
+uint16_t libasm_asm_set_option(libasm_assembler *assembler, const char *name, const char *value) {
+    return assembler->assembler->setOption(name, value);
+}
+
+size_t libasm_encode_lines(libasm_assembler *assembler, uint32_t address,
+        const char *const *lines, size_t count, libasm_encoded *results) {
+    auto &a = *assembler->assembler;
+    const auto unit = a.config().addressUnit();
+    size_t errors = 0;
+    for (size_t i = 0; i < count; i++) {
+        const auto line = lines[i];
+        auto &result = results[i];
+        a.setCurrentLocation(address);
+        Insn insn(address);
+        const auto error = a.encode(line, insn);
+        result.address = insn.address();
+        result.error = error;
+        result.error_at = 0;
+        if (error && a.errorAt() >= line && a.errorAt() <= line + strlen(line))
+            result.error_at = a.errorAt() - line;
+        result.length = insn.length();
+        memcpy(result.bytes, insn.bytes(), insn.length());
+        if (error) {
+            errors++;
+        } else if (insn.length() == 0) {
+            address = a.currentLocation();  // set location or allocate memory space
+        } else {
+            address = insn.address() + insn.length() / unit;
+        }
+    }
+    return errors;
+}
+
+libasm_disassembler *libasm_dis_create(const char *cpu) {
+    auto handle = new libasm_disassembler;
+    const auto backend = handle->backends.registry.search(cpu);
+    if (backend == nullptr) {
+        delete handle;
+        return nullptr;
+    }
+    handle->disassembler = &(*backend)->instance();
+    handle->disassembler->setCpu(cpu);
+    return handle;
+}
+
+void libasm_dis_destroy(libasm_disassembler *disassembler) {
+    delete disassembler;
+}
+
+const char *libasm_dis_cpu(const libasm_disassembler *disassembler) {
+    return disassembler->disassembler->cpu_P();
+}
+
+uint16_t libasm_dis_set_option(
+        libasm_disassembler *disassembler, const char *name, const char *value) {
+    disassembler->cache.clear();
+    return disassembler->disassembler->setOption(name, value);
+}
+
+size_t libasm_decode_range(libasm_disassembler *disassembler, uint32_t address,
+        const uint8_t *bytes, size_t size, libasm_decoded *results, size_t max) {
+    auto &d = *disassembler->disassembler;
+    const auto unit = d.config().addressUnit();
+    const ArrayMemory memory(address * unit, bytes, size);
+    const auto end = memory.origin() + size;
+    auto reader = memory.iterator();
+    size_t n = 0;
+    while (n < max && reader.hasNext()) {
+        auto &result = results[n++];
+        Insn insn(reader.address() / unit);
+        char operands[256] = "";  // as large as DecodeCache
+        auto error = d.decode(reader, insn, operands, sizeof(operands));
+        if (reader.address() > end)
+            error = NO_MEMORY;
+        result.address = insn.address();
+        result.error = error;
+        result.length = insn.length();
+        setText(result.text, insn.name(), operands);
+        if (insn.length() == 0 || error == NO_MEMORY)
+            break;
+    }
+    return n;
+}
+
+uint16_t libasm_decode_cached(libasm_disassembler *disassembler, uint32_t address,
+        const uint8_t *bytes, size_t size, libasm_decoded *result) {
+    auto &d = *disassembler->disassembler;
+    const ArrayMemory memory(address * d.config().addressUnit(), bytes, size);
+    auto reader = memory.iterator();
+    const auto &entry = disassembler->cache.decode(d, reader, address);
+    result->address = entry.addr;
+    result->error = entry.error;
+    result->length = entry.length();
+    setText(result->text, entry.name.c_str(), entry.operands.c_str());
+    return entry.error;
+}
+
+void libasm_dis_invalidate(libasm_disassembler *disassembler, uint32_t address, size_t size) {
+    disassembler->cache.invalidate(address, size);
+}
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LIBASM_H__
+#define __LIBASM_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * C API of libasm.so for foreign function interfaces.
+ *
+ * Handles are created by a CPU name, and are independent of each other;
+ * a handle must be used by one thread at a time. Lines and bytes are
+ * passed in blocks, so that the cost of calling through FFI is paid per
+ * block rather than per instruction. An error is a libasm::Error code,
+ * where zero is OK, and libasm_error_text() describes it.
+ */
+
+#if defined(__GNUC__)
+#define LIBASM_API __attribute__((visibility("default")))
+#else
+#define LIBASM_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** maximum number of bytes of an instruction */
+#define LIBASM_MAX_CODE 64
+/** maximum length of disassembled text, including terminating NUL */
+#define LIBASM_MAX_TEXT 96
+
+typedef struct libasm_assembler libasm_assembler;
+typedef struct libasm_disassembler libasm_disassembler;
+
+/** Result of assembling a line. */
+typedef struct {
+    uint32_t address;                /* address of the line */
+    uint16_t error;                  /* error code */
+    uint16_t error_at;               /* offset of error in the line */
+    uint8_t length;                  /* number of bytes */
+    uint8_t bytes[LIBASM_MAX_CODE];  /* instruction bytes */
+} libasm_encoded;
+
+/** Result of disassembling an instruction. */
+typedef struct {
+    uint32_t address;             /* address of the instruction */
+    uint16_t error;               /* error code */
+    uint8_t length;               /* number of bytes consumed */
+    char text[LIBASM_MAX_TEXT];   /* name and operands */
+} libasm_decoded;
+
+/** returns a description of |error| */
+LIBASM_API const char *libasm_error_text(uint16_t error);
+
+/** returns an assembler of |cpu|, or NULL if |cpu| is unknown */
+LIBASM_API libasm_assembler *libasm_asm_create(const char *cpu);
+LIBASM_API void libasm_asm_destroy(libasm_assembler *assembler);
+/** returns the CPU name of |assembler| */
+LIBASM_API const char *libasm_asm_cpu(const libasm_assembler *assembler);
+/** set option |name| to |value|, returns an error code */
+LIBASM_API uint16_t libasm_asm_set_option(
+        libasm_assembler *assembler, const char *name, const char *value);
+
+/**
+ * Assemble |count| |lines| from |address| into |results|, which has
+ * |count| elements. A line is an instruction or a directive without
+ * label; symbols are not available. Each line is placed after the
+ * previous one. Returns the number of lines which have an error.
+ */
+LIBASM_API size_t libasm_encode_lines(libasm_assembler *assembler, uint32_t address,
+        const char *const *lines, size_t count, libasm_encoded *results);
+
+/** returns a disassembler of |cpu|, or NULL if |cpu| is unknown */
+LIBASM_API libasm_disassembler *libasm_dis_create(const char *cpu);
+LIBASM_API void libasm_dis_destroy(libasm_disassembler *disassembler);
+/** returns the CPU name of |disassembler| */
+LIBASM_API const char *libasm_dis_cpu(const libasm_disassembler *disassembler);
+/** set option |name| to |value|, returns an error code */
+LIBASM_API uint16_t libasm_dis_set_option(
+        libasm_disassembler *disassembler, const char *name, const char *value);
+
+/**
+ * Disassemble |size| |bytes| located at |address| into |results|, which
+ * has |max| elements. An instruction which runs past |bytes| has
+ * NO_MEMORY error and ends the range. Returns the number of results.
+ */
+LIBASM_API size_t libasm_decode_range(libasm_disassembler *disassembler, uint32_t address,
+        const uint8_t *bytes, size_t size, libasm_decoded *results, size_t max);
+
+/**
+ * Disassemble an instruction at |address| into |result| through a cache
+ * of |disassembler|, for debuggers which redisplay the same code. |bytes|
+ * has |size| bytes at |address|, and is read only when the instruction
+ * is not cached. Memory writes must be notified by
+ * libasm_dis_invalidate(). Returns the error code of |result|.
+ */
+LIBASM_API uint16_t libasm_decode_cached(libasm_disassembler *disassembler, uint32_t address,
+        const uint8_t *bytes, size_t size, libasm_decoded *result);
+
+/**
+ * Notify that |size| bytes are written at byte address |address|, which
+ * drops cached instructions overlapping them.
+ */
+LIBASM_API void libasm_dis_invalidate(
+        libasm_disassembler *disassembler, uint32_t address, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+namespace libasm {
+namespace cli {
+
+MappedFile::MappedFile(const std::string &name)
+    : _name(name), _base(nullptr), _size(0), _capacity(0) {}
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+bool MappedFile::map() {
+    if (mapped())
+        return true;
+    const auto fd = ::open(_name.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size >= UINT32_MAX) {
+        ::close(fd);
+        return false;
+    }
+    _size = st.st_size;
+    // Reserve at least one zero-filled byte beyond the end of file.
+    const size_t page = sysconf(_SC_PAGESIZE);
+    _capacity = (_size / page + 1) * page;
+    auto base = mmap(nullptr, _capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base != MAP_FAILED && _size) {
+        if (mmap(base, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) ==
+                MAP_FAILED) {
+            munmap(base, _capacity);
+            base = MAP_FAILED;
+        }
+    }
+    ::close(fd);
+    if (base == MAP_FAILED)
+        return false;
+    _base = static_cast<char *>(base);
+    indexLines();
+    return true;
+}
+
+void MappedFile::unmap() {
+    if (_base)
+        munmap(_base, _capacity);
+    _base = nullptr;
+    _eols.clear();
+}
+
+void MappedFile::indexLines() {
+    const auto end = _base + _size;
+    auto p = _base;
+    while (p < end) {
+        auto eol = static_cast<char *>(memchr(p, '\n', end - p));
+        if (eol == nullptr)
+            eol = end;  // the last line without newline
+        *eol = 0;
+        _eols.push_back(eol - _base);
+        p = eol + 1;
+    }
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
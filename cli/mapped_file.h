@@ -0,0 +1,78 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace cli {
+
+/**
+ * Private, writable memory mapping of a whole text file.
+ *
+ * Every line terminator is replaced with NUL when mapped, so that each
+ * line can be handed out as a C-string pointing directly into the
+ * mapping. A zero page is always mapped just after the file contents,
+ * so that the last line is NUL terminated even without a newline.
+ */
+class MappedFile {
+public:
+    MappedFile(const std::string &name);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const std::string &name() const { return _name; }
+    /** map a file; returns false if the file can't be mapped, i.e. a pipe */
+    bool map();
+    bool mapped() const { return _base != nullptr; }
+    void unmap();
+
+    /** number of lines in the file */
+    size_t lines() const { return _eols.size(); }
+    /** the |index|-th line (0 origin), NUL terminated */
+    const char *line(size_t index) const { return _base + (index ? _eols[index - 1] + 1 : 0); }
+    /** end of the |index|-th line */
+    const char *lineEnd(size_t index) const { return _base + _eols[index]; }
+
+private:
+    const std::string _name;
+    char *_base;
+    size_t _size;
+    size_t _capacity;
+    /** offsets of line terminators */
+    std::vector<uint32_t> _eols;
+
+    void indexLines();
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "search_commander.h"
+
+#include "bin_decoder.h"
+#include "file_reader.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace libasm {
+namespace cli {
+
+using namespace libasm::driver;
+
+namespace {
+
+const char *basename(const char *str, char sep_char = '/') {
+    const auto sep = strrchr(str, sep_char);
+    return sep ? sep + 1 : str;
+}
+
+}  // namespace
+
+int SearchCommander::search() {
+    const auto asmBackend = _asm.registry.search(_cpu);
+    const auto disBackend = _dis.registry.search(_cpu);
+    if (asmBackend == nullptr || disBackend == nullptr) {
+        fprintf(stderr, "Unknown target CPU %s\n", _cpu);
+        return 1;
+    }
+    auto &assembler = (*asmBackend)->instance().assembler();
+    assembler.setCpu(_cpu);
+    auto &disassembler = (*disBackend)->instance();
+    disassembler.setCpu(_cpu);
+
+    PatternMatcher matcher;
+    if (readPatterns(assembler, matcher))
+        return 1;
+
+    BinMemory memory;
+    FileReader input(_input_name);
+    if (!input.open()) {
+        fprintf(stderr, "Can't open input file %s\n", _input_name);
+        return 1;
+    }
+    if (BinDecoder::decode(input, memory) < 0) {
+        fprintf(stderr, "%s:%d: Unrecognizable binary format\n", _input_name, input.lineno());
+        return 1;
+    }
+    input.close();
+
+    for (const auto &hit : matcher.search(memory))
+        printHit(disassembler, memory, hit, matcher.signature(hit.index));
+    return 0;
+}
+
+void SearchCommander::printHit(Disassembler &disassembler, const BinMemory &memory,
+        const PatternMatcher::Hit &hit, const Signature &signature) {
+    const auto unit = disassembler.config().addressUnit();
+    const int width = (disassembler.config().addressWidth() + 3) / 4;
+    printf("%0*X %s\n", width, hit.address / unit, signature.name.c_str());
+    const auto end = hit.address + signature.bytes.size();
+    auto reader = memory.reader(hit.address);
+    while (reader.address() < end) {
+        Insn insn(reader.address() / unit);
+        char operands[80];
+        operands[0] = 0;
+        disassembler.decode(reader, insn, operands, sizeof(operands));
+        if (insn.length() == 0)
+            break;
+        if (*operands) {
+            printf("  %0*X %-8s %s\n", width, insn.address(), insn.name(), operands);
+        } else {
+            printf("  %0*X %s\n", width, insn.address(), insn.name());
+        }
+    }
+}
+
+int SearchCommander::readPatterns(Assembler &assembler, PatternMatcher &matcher) {
+    FileReader input(_pattern_name);
+    if (!input.open()) {
+        fprintf(stderr, "Can't open pattern file %s\n", _pattern_name);
+        return 1;
+    }
+    PatternCompiler compiler(assembler);
+    std::vector<Signature> signatures;
+    std::string name;
+    std::vector<std::string> lines;
+    std::vector<int> linenos;
+    auto compile = [&]() {
+        if (name.empty())
+            return 0;
+        size_t index;
+        const auto error = compiler.compile(name, lines, signatures, index);
+        if (error) {
+            fprintf(stderr, "%s:%d: %s: %s\n", _pattern_name,
+                    index < linenos.size() ? linenos[index] : input.lineno(),
+                    ErrorReporter::errorText_P(error), lines.empty() ? "" : lines[index].c_str());
+            return 1;
+        }
+        lines.clear();
+        linenos.clear();
+        return 0;
+    };
+    StrScanner *line;
+    while ((line = input.readLine()) != nullptr) {
+        line->skipSpaces();
+        if (**line == 0 || **line == ';')
+            continue;
+        if (**line == '[') {
+            if (compile())
+                return 1;
+            const auto close = strchr(line->str(), ']');
+            name.assign(line->str() + 1, close ? close : line->str() + line->size());
+        } else if (name.empty()) {
+            fprintf(stderr, "%s:%d: Missing pattern name\n", _pattern_name, input.lineno());
+            return 1;
+        } else {
+            lines.emplace_back(line->str(), line->size());
+            linenos.push_back(input.lineno());
+        }
+    }
+    if (compile())
+        return 1;
+    for (const auto &signature : signatures)
+        matcher.add(signature);
+    return 0;
+}
+
+int SearchCommander::usage() {
+    fprintf(stderr,
+            "libasm pattern search (version " LIBASM_VERSION_STRING
+            ")\n"
+            "usage: %s -C <CPU> -p <pattern> <input>\n"
+            "  -C <CPU>    : target CPU\n"
+            "  -p <pattern>: pattern file which has patterns of\n"
+            "                  [<name>]\n"
+            "                  <instruction>...\n"
+            "                where ? in an operand matches any number\n"
+            "  <input>     : file can be Motorola S-Record or Intel HEX format\n",
+            _prog_name);
+    return 2;
+}
+
+int SearchCommander::parseArgs(int argc, const char **argv) {
+    _prog_name = basename(argv[0]);
+    _input_name = nullptr;
+    _pattern_name = nullptr;
+    _cpu = nullptr;
+    for (auto i = 1; i < argc; i++) {
+        const auto *opt = argv[i];
+        if (*opt == '-') {
+            switch (*++opt) {
+            case 'C':
+                if (++i >= argc) {
+                    fprintf(stderr, "-C requires CPU name\n");
+                    return 1;
+                }
+                _cpu = argv[i];
+                break;
+            case 'p':
+                if (++i >= argc) {
+                    fprintf(stderr, "-p requires pattern file name\n");
+                    return 1;
+                }
+                _pattern_name = argv[i];
+                break;
+            default:
+                fprintf(stderr, "unknown option: %s\n", opt);
+                return 1;
+            }
+        } else {
+            if (_input_name) {
+                fprintf(stderr, "multiple input files specified: %s and %s\n", _input_name, opt);
+                return 1;
+            }
+            _input_name = opt;
+        }
+    }
+    if (_cpu == nullptr) {
+        fprintf(stderr, "No target CPU specified\n");
+        return 1;
+    }
+    if (_pattern_name == nullptr) {
+        fprintf(stderr, "No pattern file specified\n");
+        return 1;
+    }
+    if (_input_name == nullptr) {
+        fprintf(stderr, "no input file\n");
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
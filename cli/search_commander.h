@@ -0,0 +1,61 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SEARCH_COMMANDER_H__
+#define __SEARCH_COMMANDER_H__
+
+#include "asm_backends.h"
+#include "dis_backends.h"
+#include "pattern_search.h"
+
+namespace libasm {
+namespace cli {
+
+/**
+ * Search instruction patterns with wildcard operands in a memory image,
+ * and print each hit with its disassembly.
+ */
+class SearchCommander {
+public:
+    int parseArgs(int argc, const char **argv);
+    int usage();
+    int search();
+
+private:
+    AsmBackends _asm;
+    DisBackends _dis;
+    // command line arguments
+    const char *_prog_name;
+    const char *_input_name;
+    const char *_pattern_name;
+    const char *_cpu;
+
+    int readPatterns(Assembler &assembler, driver::PatternMatcher &matcher);
+    void printHit(Disassembler &disassembler, const driver::BinMemory &memory,
+            const driver::PatternMatcher::Hit &hit, const driver::Signature &signature);
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "server_session.h"
+#include "version.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace libasm::cli;
+
+namespace {
+
+/** Idle sessions kept warm for the next connection. */
+class SessionPool {
+public:
+    std::unique_ptr<ServerSession> acquire() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_idle.empty())
+            return std::unique_ptr<ServerSession>(new ServerSession());
+        auto session = std::move(_idle.back());
+        _idle.pop_back();
+        return session;
+    }
+
+    void release(std::unique_ptr<ServerSession> session) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _idle.push_back(std::move(session));
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<ServerSession>> _idle;
+};
+
+/** Answer requests from |in|, one per line, until end of file. */
+void serve(FILE *in, FILE *out, ServerSession &session) {
+    char *line = nullptr;
+    size_t size = 0;
+    ssize_t len;
+    while ((len = getline(&line, &size, in)) >= 0) {
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+            line[--len] = 0;
+        if (len == 0)
+            continue;
+        const auto response = session.handle(line);
+        fputs(response.c_str(), out);
+        fputc('\n', out);
+        if (fflush(out) != 0)
+            break;
+    }
+    free(line);
+}
+
+int listenOn(const char *path) {
+    struct sockaddr_un addr;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket path is too long: %s\n", path);
+        return -1;
+    }
+    const auto fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0 ||
+            listen(fd, SOMAXCONN) < 0) {
+        fprintf(stderr, "Can't listen on %s: %s\n", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int serveSocket(const char *path) {
+    const auto fd = listenOn(path);
+    if (fd < 0)
+        return 1;
+    SessionPool pool;
+    pool.release(pool.acquire());
+    while (true) {
+        const auto conn = accept(fd, nullptr, nullptr);
+        if (conn < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("accept");
+            break;
+        }
+        std::thread([&pool, conn] {
+            auto in = fdopen(conn, "r");
+            auto out = fdopen(dup(conn), "w");
+            if (in && out) {
+                auto session = pool.acquire();
+                serve(in, out, *session);
+                pool.release(std::move(session));
+            }
+            if (out)
+                fclose(out);
+            if (in)
+                fclose(in);
+        }).detach();
+    }
+    close(fd);
+    unlink(path);
+    return 1;
+}
+
+int usage(const char *prog_name) {
+    fprintf(stderr,
+            "libasm server (version " LIBASM_VERSION_STRING
+            ")\n"
+            "usage: %s [-S <socket>]\n"
+            "  -S <socket> : listen on UNIX domain socket, otherwise stdin/stdout\n"
+            "requests and responses are JSON objects, one per line:\n"
+            "  {\"op\":\"assemble-line\", \"cpu\":<CPU>, \"address\":<n>, \"line\":<text>}\n"
+            "  {\"op\":\"assemble-file\", \"cpu\":<CPU>, \"path\":<file>, \"listing\":true}\n"
+            "  {\"op\":\"disassemble-bytes\", \"cpu\":<CPU>, \"address\":<n>, \"bytes\":[<n>...]}\n",
+            prog_name);
+    return 2;
+}
+
+}  // namespace
+
+int main(int argc, const char **argv) {
+    const char *socket_name = nullptr;
+    for (auto i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-S") == 0 && i + 1 < argc) {
+            socket_name = argv[++i];
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    signal(SIGPIPE, SIG_IGN);
+    if (socket_name)
+        return serveSocket(socket_name);
+    ServerSession session;
+    serve(stdin, stdout, session);
+    return 0;
+}
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
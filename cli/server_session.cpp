@@ -0,0 +1,256 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "server_session.h"
+
+#include "array_memory.h"
+#include "asm_directive.h"
+#include "asm_formatter.h"
+#include "stored_printer.h"
+
+#include <cstring>
+
+namespace libasm {
+namespace cli {
+
+using namespace libasm::driver;
+
+namespace {
+
+class NullPrinter : public TextPrinter {
+public:
+    void println(const char *text) override {}
+    void format(const char *fmt, ...) override {}
+};
+
+NullPrinter STDNULL;
+
+void writeBytes(JsonWriter &response, const uint8_t *bytes, size_t size) {
+    response.beginArray();
+    for (size_t i = 0; i < size; i++)
+        response.integer(bytes[i]);
+    response.endArray();
+}
+
+std::string joinLines(const StoredPrinter &printer) {
+    std::string text;
+    for (size_t lineno = 1; lineno <= printer.size(); lineno++)
+        text.append(printer.line(lineno)).append("\n");
+    return text;
+}
+
+}  // namespace
+
+StrScanner *ServerSession::LineSources::readLine() {
+    if (_lineno != 0)
+        return nullptr;
+    _lineno++;
+    _scan = StrScanner(_text.c_str());
+    return &_scan;
+}
+
+ServerSession::ServerSession()
+    : _fileDriver(_asm.registry, _fileSources),
+      _lineDriver(_asm.registry, _lineSources),
+      _disDriver(_dis.registry) {}
+
+std::string ServerSession::handle(const char *line) {
+    JsonRequest request;
+    JsonWriter response;
+    response.beginObject();
+    auto error = request.parse(line);
+    if (request.has("id"))
+        response.key("id").raw(request.raw("id"));
+    if (error == nullptr) {
+        const auto op = request.string("op");
+        if (op == nullptr) {
+            error = "no op";
+        } else if (strcmp(op, "assemble-line") == 0) {
+            error = assembleLine(request, response);
+        } else if (strcmp(op, "assemble-file") == 0) {
+            error = assembleFile(request, response);
+        } else if (strcmp(op, "disassemble-bytes") == 0) {
+            error = disassembleBytes(request, response);
+        } else {
+            error = "unknown op";
+        }
+    }
+    if (error)
+        response.key("ok").boolean(false).key("error").string(error);
+    return response.endObject().str();
+}
+
+const char *ServerSession::assembleLine(const JsonRequest &request, JsonWriter &response) {
+    const auto text = request.string("line");
+    if (text == nullptr)
+        return "no line";
+    int64_t address = 0;
+    request.integer("address", address);
+    const auto cpu = request.string("cpu");
+    _asm.restore();
+    if (cpu && _lineDriver.setCpu(cpu) == nullptr)
+        return "unknown CPU";
+    _lineDriver.clearSymbols();
+    _lineDriver.setOrigin(address);
+
+    BinMemory memory;
+    AsmFormatter formatter(_lineDriver, _lineSources, memory);
+    _lineSources.set(text);
+    formatter.assemble(*_lineSources.readLine(), /* reportError */ true);
+    const auto isError = formatter.isError();
+    std::string error;
+    if (isError && formatter.hasNextLine())
+        error = formatter.getLine();
+    std::string listing;
+    while (formatter.hasNextLine())
+        listing.append(formatter.getLine()).append("\n");
+    _lineSources.closeCurrent();
+
+    const auto unit = _lineDriver.current()->assembler().config().addressUnit();
+    response.key("ok").boolean(!isError);
+    if (isError)
+        response.key("error").string(error);
+    response.key("address").integer(memory.begin() == memory.end()
+                                            ? address
+                                            : memory.startAddress() / unit);
+    response.key("bytes").beginArray();
+    for (const auto &block : memory) {
+        for (auto byte : block.data)
+            response.integer(byte);
+    }
+    response.endArray();
+    response.key("next").integer(_lineDriver.origin());
+    response.key("listing").string(listing);
+    return nullptr;
+}
+
+const char *ServerSession::assembleFile(const JsonRequest &request, JsonWriter &response) {
+    const auto path = request.string("path");
+    if (path == nullptr)
+        return "no path";
+    const auto cpu = request.string("cpu");
+    _asm.restore();
+    if (cpu && _fileDriver.setCpu(cpu) == nullptr)
+        return "unknown CPU";
+    _fileSources.clear();
+    _fileDriver.clearSymbols();
+
+    BinMemory memory;
+    if (assemble(path, cpu, memory, STDNULL, STDNULL, false) < 0)
+        return "can't open input file";
+    StoredPrinter errorout;
+    do {
+        BinMemory next;
+        errorout.clear();
+        (void)assemble(path, cpu, next, STDNULL, errorout, true);
+        if (memory.equals(next))
+            break;
+        memory.swap(next);
+    } while (true);
+
+    response.key("ok").boolean(errorout.size() == 0);
+    response.key("errors").beginArray();
+    for (size_t lineno = 1; lineno <= errorout.size(); lineno++)
+        response.string(errorout.line(lineno));
+    response.endArray();
+    const auto unit = _fileDriver.current()->assembler().config().addressUnit();
+    response.key("blocks").beginArray();
+    for (const auto &block : memory) {
+        response.beginObject().key("address").integer(block.base / unit).key("bytes");
+        writeBytes(response, block.data.data(), block.data.size());
+        response.endObject();
+    }
+    response.endArray();
+    bool listing = false;
+    if (request.boolean("listing", listing) && listing) {
+        StoredPrinter listout;
+        assemble(path, cpu, memory, listout, STDNULL, true);
+        response.key("listing").string(joinLines(listout));
+    }
+    _fileSources.clear();
+    return nullptr;
+}
+
+int ServerSession::assemble(const char *path, const char *cpu, BinMemory &memory,
+        TextPrinter &listout, TextPrinter &errorout, bool reportError) {
+    if (_fileSources.open(path))
+        return -1;
+    AsmFormatter formatter(_fileDriver, _fileSources, memory);
+    formatter.setUpperHex(true);
+    if (cpu)
+        _fileDriver.setCpu(cpu);
+    return _fileDriver.assemble(_fileSources, memory, formatter, listout, errorout, reportError);
+}
+
+const char *ServerSession::disassembleBytes(const JsonRequest &request, JsonWriter &response) {
+    const auto values = request.array("bytes");
+    if (values == nullptr)
+        return "no bytes";
+    std::vector<uint8_t> bytes;
+    for (const auto value : *values) {
+        if (value < 0 || value > UINT8_MAX)
+            return "byte out of range";
+        bytes.push_back(value);
+    }
+    int64_t address = 0;
+    request.integer("address", address);
+    const auto cpu = request.string("cpu");
+    _dis.restore();
+    if (cpu && _disDriver.setCpu(cpu) == nullptr)
+        return "unknown CPU";
+
+    auto &disassembler = *_disDriver.current();
+    disassembler.setUpperHex(true);
+    disassembler.setUppercase(false);
+    const auto unit = disassembler.config().addressUnit();
+    const ArrayMemory memory(address * unit, bytes.data(), bytes.size());
+    auto reader = memory.iterator();
+    auto ok = true;
+    response.key("lines").beginArray();
+    while (reader.hasNext()) {
+        Insn insn(reader.address() / unit);
+        char operands[80] = "";
+        disassembler.decode(reader, insn, operands, sizeof(operands));
+        response.beginObject().key("address").integer(insn.address()).key("bytes");
+        writeBytes(response, insn.bytes(), insn.length());
+        if (insn.length() && *insn.name()) {
+            std::string text(insn.name());
+            if (*operands)
+                text.append(" ").append(operands);
+            response.key("text").string(text);
+        }
+        if (disassembler.getError()) {
+            ok = false;
+            response.key("error").string(disassembler.errorText_P());
+        }
+        response.endObject();
+        if (insn.length() == 0)
+            break;
+    }
+    response.endArray();
+    response.key("ok").boolean(ok);
+    return nullptr;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
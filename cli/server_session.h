@@ -0,0 +1,116 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SERVER_SESSION_H__
+#define __SERVER_SESSION_H__
+
+#include "asm_backends.h"
+#include "asm_driver.h"
+#include "asm_sources.h"
+#include "bin_memory.h"
+#include "dis_backends.h"
+#include "dis_driver.h"
+#include "file_sources.h"
+#include "json_message.h"
+#include "text_printer.h"
+
+#include <string>
+
+namespace libasm {
+namespace cli {
+
+/**
+ * Handle requests of the server protocol. All back ends and drivers are
+ * constructed once and kept warm for all requests of a session; a
+ * session must be used by one thread at a time.
+ *
+ * Each request and response is a JSON object in one line. A "line" is a
+ * source line, so that an instruction must follow a label or spaces.
+ *   {"op":"assemble-line", "cpu":"6809", "address":4096, "line":" lda #1"}
+ *   {"op":"assemble-file", "cpu":"6809", "path":"a.asm", "listing":true}
+ *   {"op":"disassemble-bytes", "cpu":"6809", "address":4096, "bytes":[134,1]}
+ * An optional "id" of a request is echoed back in its response. A
+ * response has "ok" and, when it is false, "error".
+ */
+class ServerSession {
+public:
+    ServerSession();
+
+    ServerSession(const ServerSession &) = delete;
+    ServerSession &operator=(const ServerSession &) = delete;
+
+    /** returns a response to a request |line|, without newline */
+    std::string handle(const char *line);
+
+private:
+    /** A source of one line for assemble-line. */
+    class LineSources : public driver::AsmSources, driver::TextReader {
+    public:
+        LineSources() : _name("line"), _lineno(-1) {}
+
+        void set(const char *line) {
+            _text = line;
+            _lineno = 0;
+        }
+
+        Error open(const StrScanner &name) override { return NO_INCLUDE_FOUND; }
+        Error closeCurrent() override {
+            _lineno = -1;
+            return OK;
+        }
+
+        const std::string &name() const override { return _name; }
+        int lineno() const override { return _lineno; }
+        StrScanner *readLine() override;
+
+    protected:
+        int size() const override { return _lineno < 0 ? 0 : 1; }
+        driver::TextReader *last() override { return size() ? this : nullptr; }
+        driver::TextReader *secondToLast() override { return nullptr; }
+
+    private:
+        const std::string _name;
+        std::string _text;
+        int _lineno;
+        StrScanner _scan;
+    };
+
+    AsmBackends _asm;
+    DisBackends _dis;
+    FileSources _fileSources;
+    LineSources _lineSources;
+    driver::AsmDriver _fileDriver;
+    driver::AsmDriver _lineDriver;
+    driver::DisDriver _disDriver;
+
+    const char *assembleLine(const JsonRequest &request, JsonWriter &response);
+    const char *assembleFile(const JsonRequest &request, JsonWriter &response);
+    const char *disassembleBytes(const JsonRequest &request, JsonWriter &response);
+    int assemble(const char *path, const char *cpu, driver::BinMemory &memory,
+            driver::TextPrinter &listout, driver::TextPrinter &errorout, bool reportError);
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,231 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sigdb_commander.h"
+
+#include "bin_decoder.h"
+#include "file_reader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace libasm {
+namespace cli {
+
+using namespace libasm::driver;
+
+namespace {
+
+const char *basename(const char *str, char sep_char = '/') {
+    const auto sep = strrchr(str, sep_char);
+    return sep ? sep + 1 : str;
+}
+
+}  // namespace
+
+int SigdbCommander::build() {
+    const auto disBackend = _dis.registry.search(_cpu);
+    if (disBackend == nullptr) {
+        fprintf(stderr, "Unknown target CPU %s\n", _cpu);
+        return 1;
+    }
+    auto &disassembler = (*disBackend)->instance();
+    disassembler.setCpu(_cpu);
+
+    BinMemory memory;
+    FileReader input(_input_name);
+    if (!input.open()) {
+        fprintf(stderr, "Can't open input file %s\n", _input_name);
+        return 1;
+    }
+    if (BinDecoder::decode(input, memory) < 0) {
+        fprintf(stderr, "%s:%d: Unrecognizable binary format\n", _input_name, input.lineno());
+        return 1;
+    }
+    input.close();
+
+    std::vector<std::pair<SignatureDb::Entry, std::string>> routines;
+    if (readRoutines(disassembler, memory, routines))
+        return 1;
+
+    const auto image = SignatureDb::build(routines);
+    auto output = fopen(_output_name, "wb");
+    if (output == nullptr) {
+        fprintf(stderr, "Can't open output file %s\n", _output_name);
+        return 1;
+    }
+    const auto written = fwrite(image.data(), 1, image.size(), output);
+    if (fclose(output) != 0 || written != image.size()) {
+        fprintf(stderr, "Can't write output file %s\n", _output_name);
+        return 1;
+    }
+    return 0;
+}
+
+int SigdbCommander::readRoutines(Disassembler &disassembler, const BinMemory &memory,
+        std::vector<std::pair<SignatureDb::Entry, std::string>> &routines) {
+    FileReader input(_names_name);
+    if (!input.open()) {
+        fprintf(stderr, "Can't open names file %s\n", _names_name);
+        return 1;
+    }
+    struct Routine {
+        int lineno;
+        uint32_t addr;
+        std::string name;
+        uint32_t length;  // zero for default
+    };
+    std::vector<Routine> names;
+    StrScanner *line;
+    while ((line = input.readLine()) != nullptr) {
+        line->skipSpaces();
+        if (**line == 0 || **line == '#')
+            continue;
+        const std::string text(line->str(), line->size());
+        char *p;
+        const auto addr = strtoul(text.c_str(), &p, 0);
+        while (isspace(*p))
+            p++;
+        const auto name = p;
+        while (*p && !isspace(*p))
+            p++;
+        if (p == text.c_str() || p == name) {
+            fprintf(stderr, "%s:%d: Expected <address> <name> [<length>]\n", _names_name,
+                    input.lineno());
+            return 1;
+        }
+        names.push_back(Routine{input.lineno(), static_cast<uint32_t>(addr), std::string(name, p),
+                static_cast<uint32_t>(*p ? strtoul(p, nullptr, 0) : 0)});
+    }
+    std::sort(names.begin(), names.end(),
+            [](const Routine &a, const Routine &b) { return a.addr < b.addr; });
+
+    const auto unit = static_cast<uint32_t>(disassembler.config().addressUnit());
+    SignatureHasher hasher(disassembler, memory);
+    for (size_t i = 0; i < names.size(); i++) {
+        const auto &routine = names[i];
+        uint32_t maxLength = routine.length;
+        if (maxLength == 0) {
+            // By default, a routine ends before the next one.
+            maxLength = DEFAULT_LENGTH;
+            if (i + 1 < names.size() && names[i + 1].addr > routine.addr)
+                maxLength = std::min(maxLength, (names[i + 1].addr - routine.addr) * unit);
+        }
+        SignatureDb::Entry entry{};
+        hasher.hash(routine.addr * unit, std::min<uint32_t>(maxLength, UINT16_MAX), [&entry](uint16_t length, uint64_t hash) {
+            entry.length = length;
+            entry.hash = hash;
+        });
+        if (entry.length == 0) {
+            fprintf(stderr, "%s:%d: No instruction at 0x%04X: %s\n", _names_name, routine.lineno,
+                    routine.addr, routine.name.c_str());
+            return 1;
+        }
+        routines.emplace_back(entry, routine.name);
+    }
+    return 0;
+}
+
+int SigdbCommander::usage() {
+    fprintf(stderr,
+            "libasm signature database builder (version " LIBASM_VERSION_STRING
+            ")\n"
+            "usage: %s -C <CPU> -n <names> -o <database> <input>\n"
+            "  -C <CPU>     : target CPU\n"
+            "  -n <names>   : names file which has routines of\n"
+            "                   <address> <name> [<length>]\n"
+            "                 where <length> bytes, up to the next routine or %u\n"
+            "                 by default, are hashed in whole instructions\n"
+            "  -o <database>: output signature database for dis -S\n"
+            "  <input>      : file can be Motorola S-Record or Intel HEX format\n",
+            _prog_name, DEFAULT_LENGTH);
+    return 2;
+}
+
+int SigdbCommander::parseArgs(int argc, const char **argv) {
+    _prog_name = basename(argv[0]);
+    _input_name = nullptr;
+    _names_name = nullptr;
+    _output_name = nullptr;
+    _cpu = nullptr;
+    for (auto i = 1; i < argc; i++) {
+        const auto *opt = argv[i];
+        if (*opt == '-') {
+            switch (*++opt) {
+            case 'C':
+                if (++i >= argc) {
+                    fprintf(stderr, "-C requires CPU name\n");
+                    return 1;
+                }
+                _cpu = argv[i];
+                break;
+            case 'n':
+                if (++i >= argc) {
+                    fprintf(stderr, "-n requires names file name\n");
+                    return 1;
+                }
+                _names_name = argv[i];
+                break;
+            case 'o':
+                if (++i >= argc) {
+                    fprintf(stderr, "-o requires database file name\n");
+                    return 1;
+                }
+                _output_name = argv[i];
+                break;
+            default:
+                fprintf(stderr, "unknown option: %s\n", opt);
+                return 1;
+            }
+        } else {
+            if (_input_name) {
+                fprintf(stderr, "multiple input files specified: %s and %s\n", _input_name, opt);
+                return 1;
+            }
+            _input_name = opt;
+        }
+    }
+    if (_cpu == nullptr) {
+        fprintf(stderr, "No target CPU specified\n");
+        return 1;
+    }
+    if (_names_name == nullptr) {
+        fprintf(stderr, "No names file specified\n");
+        return 1;
+    }
+    if (_output_name == nullptr) {
+        fprintf(stderr, "No database file specified\n");
+        return 1;
+    }
+    if (_input_name == nullptr) {
+        fprintf(stderr, "no input file\n");
+        return 1;
+    }
+    return 0;
+}
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
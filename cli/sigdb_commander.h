@@ -0,0 +1,65 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SIGDB_COMMANDER_H__
+#define __SIGDB_COMMANDER_H__
+
+#include "dis_backends.h"
+#include "signature_db.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libasm {
+namespace cli {
+
+/**
+ * Build a signature database of library routines from a memory image
+ * and a list of routine addresses, to be recognized by "dis -S".
+ */
+class SigdbCommander {
+public:
+    int parseArgs(int argc, const char **argv);
+    int usage();
+    int build();
+
+private:
+    DisBackends _dis;
+    // command line arguments
+    const char *_prog_name;
+    const char *_input_name;
+    const char *_names_name;
+    const char *_output_name;
+    const char *_cpu;
+
+    static constexpr uint16_t DEFAULT_LENGTH = 32;
+
+    int readRoutines(Disassembler &disassembler, const driver::BinMemory &memory,
+            std::vector<std::pair<driver::SignatureDb::Entry, std::string>> &routines);
+};
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stats_printer.h"
+
+#include "json_message.h"
+#include "phase_stats.h"
+#include "table_stats.h"
+
+#include <cstring>
+
+namespace libasm {
+namespace cli {
+
+bool parseStatsOption(const char *option, StatsFormat &format) {
+    if (strncmp(option, "stats", 5) != 0)
+        return false;
+    const auto value = option + 5;
+    if (*value == 0 || strcmp(value, "=text") == 0) {
+        format = STATS_TEXT;
+    } else if (strcmp(value, "=json") == 0) {
+        format = STATS_JSON;
+    } else if (*value == '=') {
+        format = STATS_NONE;  // unknown format
+    } else {
+        return false;  // other option
+    }
+    return true;
+}
+
+#if defined(LIBASM_STATS)
+
+bool statsAvailable() {
+    return true;
+}
+
+void resetStats() {
+    stats::reset();
+    stats::resetTables();
+}
+
+static void printTables(FILE *out, StatsFormat format) {
+    for (const auto &it : stats::tableProfiles()) {
+        const auto &key = it.first;
+        const auto &profile = it.second;
+        uint64_t probes = 0;
+        for (size_t n = 0; n < profile.probes.size(); n++)
+            probes += n * profile.probes[n];
+        if (format == STATS_JSON) {
+            JsonWriter json;
+            json.beginObject();
+            json.key("table").string(key.cpu.c_str());
+            json.key("search").string(stats::name(key.search));
+            json.key("page").integer(key.page);
+            json.key("lookups").integer(profile.lookups);
+            json.key("misses").integer(profile.misses);
+            json.key("probes").beginArray();
+            for (const auto count : profile.probes)
+                json.integer(count);
+            json.endArray();
+            json.key("hits").beginArray();
+            for (const auto count : profile.hits)
+                json.integer(count);
+            json.endArray();
+            json.endObject();
+            fprintf(out, "%s\n", json.str().c_str());
+        } else {
+            fprintf(out, "%-10s %-6s %4u %10llu %10llu %12.2f\n", key.cpu.c_str(),
+                    stats::name(key.search), key.page,
+                    static_cast<unsigned long long>(profile.lookups),
+                    static_cast<unsigned long long>(profile.misses),
+                    static_cast<double>(probes) / profile.lookups);
+        }
+    }
+}
+
+void printStats(FILE *out, StatsFormat format) {
+    if (format == STATS_NONE)
+        return;
+    if (format == STATS_JSON) {
+        JsonWriter json;
+        json.beginObject().key("stats").beginArray();
+        for (auto i = 0; i < stats::PHASE_END; i++) {
+            const auto phase = static_cast<stats::Phase>(i);
+            const auto &counter = stats::counter(phase);
+            json.beginObject();
+            json.key("phase").string(stats::name(phase));
+            json.key("count").integer(counter.count);
+            json.key("total_ns").integer(counter.total_ns);
+            json.key("self_ns").integer(counter.self_ns);
+            json.endObject();
+        }
+        json.endArray().endObject();
+        fprintf(out, "%s\n", json.str().c_str());
+        printTables(out, format);
+    } else if (format == STATS_TEXT) {
+        fprintf(out, "%-22s %10s %12s %12s\n", "phase", "count", "total ms", "self ms");
+        for (auto i = 0; i < stats::PHASE_END; i++) {
+            const auto phase = static_cast<stats::Phase>(i);
+            const auto &counter = stats::counter(phase);
+            fprintf(out, "%-22s %10llu %12.3f %12.3f\n", stats::name(phase),
+                    static_cast<unsigned long long>(counter.count), counter.total_ns / 1e6,
+                    counter.self_ns / 1e6);
+        }
+        if (!stats::tableProfiles().empty()) {
+            fprintf(out, "%-10s %-6s %4s %10s %10s %12s\n", "table", "search", "page", "lookups",
+                    "misses", "probes/look");
+        }
+        printTables(out, format);
+    }
+    resetStats();
+}
+
+#else
+
+bool statsAvailable() {
+    return false;
+}
+
+void resetStats() {}
+
+void printStats(FILE *out, StatsFormat format) {}
+
+#endif
+
+}  // namespace cli
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __STATS_PRINTER_H__
+#define __STATS_PRINTER_H__
+
+#include <cstdio>
+
+namespace libasm {
+namespace cli {
+
+/** Output format of --stats. */
+enum StatsFormat : char {
+    STATS_NONE = 0,
+    STATS_TEXT = 't',
+    STATS_JSON = 'j',
+};
+
+/**
+ * Parse |option| after "--", which is "stats" or "stats=<text|json>".
+ * Returns false if |option| isn't a stats option, otherwise sets |format|.
+ */
+bool parseStatsOption(const char *option, StatsFormat &format);
+
+/** true if instrumentation is compiled in with LIBASM_STATS */
+bool statsAvailable();
+
+/**
+ * Print per-phase statistics and instruction table profiles of this
+ * thread to |out| and clear them. In JSON format, each table page
+ * follows the stats line as a line of its own, which can be fed to
+ * bench/table_profile. STATS_NONE prints nothing and keeps them.
+ */
+void printStats(FILE *out, StatsFormat format);
+
+/** clear per-phase statistics and table profiles of this thread */
+void resetStats();
+
+}  // namespace cli
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
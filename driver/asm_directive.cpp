@@ -19,6 +19,7 @@
 #include "asm_driver.h"
 #include "intel_hex.h"
 #include "moto_srec.h"
+#include "phase_stats.h"
 #include "str_scanner.h"
 
 #include <algorithm>
@@ -179,6 +180,7 @@ void AsmDirective::disablePseudo(const char *name) {
 
 Error AsmDirective::processPseudo(
         const StrScanner &name, StrScanner &scan, AsmFormatter &list, AsmDriver &driver) {
+    LIBASM_STATS_SCOPE(DIRECTIVE);
     auto it = _pseudos.find(std::string(name.str(), name.size()));
     if (it == _pseudos.end())
         return UNKNOWN_DIRECTIVE;
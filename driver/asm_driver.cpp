@@ -18,6 +18,7 @@
 
 #include "asm_directive.h"
 #include "asm_sources.h"
+#include "phase_stats.h"
 
 #include <algorithm>
 #include <cstring>
@@ -25,6 +26,21 @@
 namespace libasm {
 namespace driver {
 
+namespace {
+/** A directive constructed in advance. */
+class AsmInstance : public CpuBackend<AsmDirective> {
+public:
+    AsmInstance(AsmDirective *dir) : _dir(dir) {}
+    const /*PROGMEM*/ char *listCpu_P() const override { return _dir->assembler().listCpu_P(); }
+    bool accepts(const char *cpu) override { return _dir->assembler().setCpu(cpu); }
+    AsmDirective &instance() override { return *_dir; }
+    AsmDirective *constructed() override { return _dir; }
+
+private:
+    AsmDirective *const _dir;
+};
+}  // namespace
+
 static void appendTo(const std::string &cpu, std::list<std::string> &list) {
     if (std::find(list.begin(), list.end(), cpu) == list.end())
         list.push_back(cpu);
@@ -46,8 +62,8 @@ static void filter(const char *text, std::list<std::string> &list) {
 
 std::list<std::string> AsmDriver::listCpu() const {
     std::list<std::string> list;
-    for (auto dir : _directives) {
-        const /* PROGMEM */ char *list_P = dir->assembler().listCpu_P();
+    for (const auto &backend : _directives.backends()) {
+        const /* PROGMEM */ char *list_P = backend->listCpu_P();
         char cpuList[strlen_P(list_P) + 1];
         strcpy_P(cpuList, list_P);
         filter(cpuList, list);
@@ -56,22 +72,26 @@ std::list<std::string> AsmDriver::listCpu() const {
 }
 
 AsmDirective *AsmDriver::setCpu(const char *cpu) {
-    for (auto dir : _directives) {
-        if (dir->assembler().setCpu(cpu))
-            return switchDirective(dir);
-    }
-    return nullptr;
+    const auto backend = _directives.search(cpu);
+    if (backend == nullptr)
+        return nullptr;
+    auto &dir = (*backend)->instance();
+    if (!dir.assembler().setCpu(cpu))
+        return nullptr;
+    return switchDirective(&dir);
 }
 
 AsmDirective *AsmDriver::restrictCpu(const char *cpu) {
     const /* PROGMEM */ char *cpu_P = current()->assembler().cpu_P();
     auto *z80 = AsmDirective::is8080(cpu_P) ? setCpu("Z80") : nullptr;
+    const auto zilog = z80 ? *_directives.search("Z80") : nullptr;
     auto *dir = setCpu(cpu);
     if (dir) {
-        _directives.clear();
-        _directives.push_back(dir);
-        if (z80)
-            _directives.push_back(z80);
+        CpuRegistry<AsmDirective> restricted;
+        restricted.add(*_directives.search(cpu));
+        if (zilog)
+            restricted.add(zilog);
+        _directives = restricted;
     }
     return dir;
 }
@@ -83,16 +103,29 @@ AsmDirective *AsmDriver::switchDirective(AsmDirective *dir) {
 
 AsmDriver::AsmDriver(
         AsmDirective **begin, AsmDirective **end, AsmSources &sources, SymbolMode symbolMode)
-    : _directives(begin, end), _current(nullptr), _sources(sources), _functions() {
-    switchDirective(_directives.front());
+    : _directives(), _current(nullptr), _sources(sources), _functions() {
+    for (auto it = begin; it != end; it++)
+        _directives.add(std::make_shared<AsmInstance>(*it));
+    switchDirective(&_directives.front().instance());
+    _origin = 0;
+    _symbolMode = symbolMode;
+}
+
+AsmDriver::AsmDriver(
+        const CpuRegistry<AsmDirective> &registry, AsmSources &sources, SymbolMode symbolMode)
+    : _directives(registry), _current(nullptr), _sources(sources), _functions() {
+    switchDirective(&_directives.front().instance());
     _origin = 0;
     _symbolMode = symbolMode;
 }
 
 int AsmDriver::assemble(AsmSources &sources, BinMemory &memory, AsmFormatter &formatter,
         TextPrinter &listout, TextPrinter &errorout, bool reportError) {
-    for (auto dir : _directives) {
-        dir->assembler().reset();
+    LIBASM_STATS_SCOPE(PASS);
+    for (const auto &backend : _directives.backends()) {
+        auto dir = backend->constructed();
+        if (dir)
+            dir->assembler().reset();
     }
     _functions.reset();
     setOrigin(0);
@@ -138,6 +171,13 @@ Error AsmDriver::internLineSymbol(uint32_t value) {
     return err;
 }
 
+void AsmDriver::clearSymbols() {
+    _lineSymbol = nullptr;
+    _symbols.clear();
+    _variables.clear();
+    _functions.reset();
+}
+
 bool AsmDriver::hasSymbol(const StrScanner &symbol) const {
     if (_lineSymbol && _lineSymbol->iequals(symbol))
         return true;
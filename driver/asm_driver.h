@@ -17,6 +17,7 @@
 #ifndef __ASM_DRIVER_H__
 #define __ASM_DRIVER_H__
 
+#include "cpu_registry.h"
 #include "error_reporter.h"
 #include "function_store.h"
 #include "str_scanner.h"
@@ -46,6 +47,9 @@ class AsmDriver : public SymbolTable {
 public:
     AsmDriver(AsmDirective **begin, AsmDirective **end, AsmSources &sources,
             SymbolMode symbolMode = REPORT_UNDEFINED);
+    /** directives in |registry| are constructed when their CPU is selected */
+    AsmDriver(const CpuRegistry<AsmDirective> &registry, AsmSources &sources,
+            SymbolMode symbolMode = REPORT_UNDEFINED);
 
     AsmDirective *restrictCpu(const char *cpu);
     AsmDirective *setCpu(const char *cpu);
@@ -68,6 +72,8 @@ public:
     }
 
     Error internSymbol(uint32_t value, const StrScanner &symbol, bool variable = false);
+    /** forget all symbols, variables and functions to start a new source */
+    void clearSymbols();
     bool symbolInTable(const StrScanner &symbol) const;
     void setLineSymbol(const StrScanner &symbol);
     Error internLineSymbol(uint32_t value);
@@ -79,11 +85,12 @@ public:
     }
     Error openSource(const StrScanner &filename);
 
-    auto begin() const { return _directives.cbegin(); }
-    auto end() const { return _directives.cend(); }
+    /** iterating directives constructs all of them */
+    auto begin() const { return _directives.begin(); }
+    auto end() const { return _directives.end(); }
 
 private:
-    std::list<AsmDirective *> _directives;
+    CpuRegistry<AsmDirective> _directives;
     AsmDirective *_current;
     AsmSources &_sources;
     FunctionStore _functions;
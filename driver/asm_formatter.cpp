@@ -22,6 +22,7 @@
 #include "asm_driver.h"
 #include "asm_sources.h"
 #include "bin_memory.h"
+#include "phase_stats.h"
 
 namespace libasm {
 namespace driver {
@@ -37,6 +38,7 @@ void AsmFormatter::reset() {
 }
 
 Error AsmFormatter::assemble(const StrScanner &li, bool reportError) {
+    LIBASM_STATS_SCOPE(LEXING);
     auto &assembler = _driver.current()->assembler();
     auto &parser = assembler.parser();
 
@@ -47,6 +49,7 @@ Error AsmFormatter::assemble(const StrScanner &li, bool reportError) {
     _length = 0;
     _line_value.clear();
     _line_symbol = StrScanner::EMPTY;
+    resetCycles();
     setStartAddress(_driver.origin());
     assembler.setCurrentLocation(_driver.origin());
 
@@ -84,6 +87,7 @@ Error AsmFormatter::assemble(const StrScanner &li, bool reportError) {
                     _line_value.clear();
                     return _errorAt.setError(_line_symbol, error);
                 }
+                resetTotalCycles();
             }
             return OK;
         }
@@ -96,6 +100,7 @@ Error AsmFormatter::assemble(const StrScanner &li, bool reportError) {
         const auto error = _driver.internLineSymbol(startAddress());
         if (error)
             return _errorAt.setError(_line_symbol, error);
+        resetTotalCycles();
     }
 
     if (parser.endOfLine(scan))
@@ -120,6 +125,8 @@ Error AsmFormatter::assemble(const StrScanner &li, bool reportError) {
                 _length++;
             }
             _driver.setOrigin(startAddress() + _insn.length() / unit);
+            if (cyclesEnabled() && !assembler.isPseudo(_insn))
+                countCycles();
         }
         return OK;
     }
@@ -135,6 +142,7 @@ bool AsmFormatter::hasNextLine() const {
 }
 
 const char *AsmFormatter::getLine() {
+    LIBASM_STATS_SCOPE(FORMATTING);
     resetOut();
     if (isError() && !_errorLine) {
         // TODO: In file included from...
@@ -166,6 +174,8 @@ const char *AsmFormatter::getLine() {
         }
         if (_nextLine == 0 && _line.size()) {
             formatTab(pos + bytesColumnWidth() + 1);
+            if (cyclesEnabled())
+                formatCycles();
             _out.text(_line);
         }
         _nextLine += formatted;
@@ -22,7 +22,7 @@
 namespace libasm {
 namespace driver {
 
-int BinDecoder::decode(TextReader &in, BinMemory &memory) {
+int BinDecoder::decode(TextReader &in, BinMemory &memory, Listener *listener) {
     StrScanner *line;
     BinDecoder *decoder = nullptr;
     int size = 0;
@@ -44,6 +44,8 @@ int BinDecoder::decode(TextReader &in, BinMemory &memory) {
         if (len < 0)
             return len;
         size += len;
+        if (listener && len)
+            listener->record(memory);
     }
     return size;
 }
@@ -28,11 +28,18 @@ namespace driver {
 
 class BinDecoder {
 public:
+    /** Receives |memory| each time a record is decoded into it. */
+    struct Listener {
+        virtual void record(BinMemory &memory) = 0;
+    };
+
     /**
-     * Decode text format binary into |memory|.
+     * Decode text format binary into |memory|. When |listener| is given,
+     * it is called after each record, and may consume and clear |memory|
+     * so that unbounded input can be streamed.
      * @return: number of read bytes or negative if error.
      */
-    static int decode(TextReader &in, BinMemory &memory);
+    static int decode(TextReader &in, BinMemory &memory, Listener *listener = nullptr);
 
 protected:
     virtual void reset() {}
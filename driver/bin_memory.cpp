@@ -16,6 +16,8 @@
 
 #include "bin_memory.h"
 
+#include "phase_stats.h"
+
 #include <cstdlib>
 #include <cstring>
 
@@ -24,32 +26,26 @@ namespace driver {
 
 BinMemory::BinMemory() {
     invalidateWriteCache();
-    invalidateReadCache();
 }
 
 void BinMemory::invalidateWriteCache() {
     _writeCache = _blocks.end();
 }
 
-void BinMemory::invalidateReadCache() const {
-    _readCache = _blocks.end();
+BinMemory::Cache BinMemory::find(uint32_t addr) const {
+    auto cache = _blocks.upper_bound(Block(addr));
+    if (cache == _blocks.begin())
+        return _blocks.end();
+    --cache;
+    return insideOf(cache, addr) ? cache : _blocks.end();
 }
 
 bool BinMemory::hasByte(uint32_t addr) const {
-    if (insideOf(_readCache, addr))
-        return true;
-    invalidateReadCache();
-
-    for (auto cache = _blocks.begin(); cache != _blocks.end(); cache++) {
-        if (insideOf(cache, addr)) {
-            _readCache = cache;
-            return true;
-        }
-    }
-    return false;
+    return find(addr) != _blocks.end();
 }
 
 void BinMemory::writeByte(uint32_t addr, uint8_t val) {
+    LIBASM_STATS_SCOPE(MEMORY_WRITE);
     // Shortcut for most possible case, appending byte to cached cache.
     if (atEndOf(_writeCache, addr)) {
         appendTo(_writeCache, addr, val);
@@ -77,20 +73,22 @@ void BinMemory::writeByte(uint32_t addr, uint8_t val) {
 }
 
 uint8_t BinMemory::readByte(uint32_t addr) const {
-    if (insideOf(_readCache, addr))
-        return readFrom(_readCache, addr);
-    invalidateReadCache();
+    const auto cache = find(addr);
+    return cache == _blocks.end() ? 0 : readFrom(cache, addr);
+}
 
-    for (auto cache = _blocks.begin(); cache != _blocks.end(); cache++) {
-        if (insideOf(cache, addr)) {
-            _readCache = cache;
-            return readFrom(cache, addr);
-        }
-    }
-    return 0;
+bool BinMemory::ByteIterator::hasNext() const {
+    if (!_memory.insideOf(_cache, address()))
+        _cache = _memory.find(address());
+    return _cache != _memory._blocks.end();
+}
+
+uint8_t BinMemory::ByteIterator::nextByte() {
+    return hasNext() ? _memory.readFrom(_cache, address()) : 0;
 }
 
 bool BinMemory::equals(const BinMemory &other) const {
+    LIBASM_STATS_SCOPE(CONVERGENCE);
     auto a = _blocks.begin();
     auto b = other._blocks.begin();
     while (a != _blocks.end() && b != other._blocks.end()) {
@@ -110,9 +108,7 @@ bool BinMemory::equals(const BinMemory &other) const {
 
 void BinMemory::swap(BinMemory &other) {
     _blocks.swap(other._blocks);
-    invalidateReadCache();
     invalidateWriteCache();
-    other.invalidateReadCache();
     other.invalidateWriteCache();
 }
 
@@ -127,15 +123,15 @@ uint32_t BinMemory::endAddress() const {
     return cache->base + cache->data.size() - 1;
 }
 
-bool BinMemory::insideOf(Cache &cache, uint32_t addr) const {
+bool BinMemory::insideOf(const Cache &cache, uint32_t addr) const {
     return cache != _blocks.end() && addr >= cache->base && addr < cache->base + cache->data.size();
 }
 
-bool BinMemory::atEndOf(Cache &cache, uint32_t addr) const {
+bool BinMemory::atEndOf(const Cache &cache, uint32_t addr) const {
     return cache != _blocks.end() && addr == cache->base + cache->data.size();
 }
 
-uint8_t BinMemory::readFrom(Cache &cache, uint32_t addr) const {
+uint8_t BinMemory::readFrom(const Cache &cache, uint32_t addr) const {
     return cache->data.at(addr - cache->base);
 }
 
@@ -166,7 +162,6 @@ void BinMemory::aggregate(Cache &hint) {
         prev->data.reserve(prev->data.size() + next->data.size());
         prev->data.insert(prev->data.end(), std::make_move_iterator(next->data.begin()),
                 std::make_move_iterator(next->data.end()));
-        invalidateReadCache();
         invalidateWriteCache();
     }
 }
@@ -26,6 +26,15 @@ namespace libasm {
 namespace driver {
 
 class BinMemory {
+    struct Block {
+        const uint32_t base;
+        mutable std::vector<uint8_t> data;
+
+        Block(uint32_t addr) : base(addr), data() {}
+        bool operator<(const Block &o) const { return base < o.base; }
+    };
+    typedef std::set<Block>::iterator Cache;
+
 public:
     BinMemory();
 
@@ -39,18 +48,21 @@ public:
     uint32_t startAddress() const;
     uint32_t endAddress() const;
 
-    // byte iterator
+    // byte iterator; each iterator has its own read cache so that a const |BinMemory| can be read
+    // concurrently.
     class ByteIterator : public DisMemory {
     public:
-        bool hasNext() const override { return _memory.hasByte(address()); }
+        bool hasNext() const override;
         void setAddress(uint32_t addr) { DisMemory::resetAddress(addr); }
 
     private:
         friend class BinMemory;
-        ByteIterator(const BinMemory &memory, uint32_t addr) : DisMemory(addr), _memory(memory) {}
-        uint8_t nextByte() override { return _memory.readByte(address()); }
+        ByteIterator(const BinMemory &memory, uint32_t addr)
+            : DisMemory(addr), _memory(memory), _cache(memory._blocks.end()) {}
+        uint8_t nextByte() override;
 
         const BinMemory &_memory;
+        mutable Cache _cache;
     };
 
     auto reader(uint32_t addr) const { return ByteIterator(*this, addr); }
@@ -62,25 +74,15 @@ public:
     auto end() const { return _blocks.end(); }
 
 private:
-    struct Block {
-        const uint32_t base;
-        mutable std::vector<uint8_t> data;
-
-        Block(uint32_t addr) : base(addr), data() {}
-        bool operator<(const Block &o) const { return base < o.base; }
-    };
-
     // Memory block set in ascending order of start address.
     std::set<Block> _blocks;
-    typedef std::set<Block>::iterator Cache;
     Cache _writeCache;
-    mutable Cache _readCache;
 
     void invalidateWriteCache();
-    void invalidateReadCache() const;
-    bool insideOf(Cache &cache, uint32_t addr) const;
-    bool atEndOf(Cache &cache, uint32_t addr) const;
-    uint8_t readFrom(Cache &cache, uint32_t addr) const;
+    Cache find(uint32_t addr) const;
+    bool insideOf(const Cache &cache, uint32_t addr) const;
+    bool atEndOf(const Cache &cache, uint32_t addr) const;
+    uint8_t readFrom(const Cache &cache, uint32_t addr) const;
     void appendTo(Cache &cache, uint32_t addr, uint8_t val);
     void replaceAt(Cache &cache, uint32_t addr, uint8_t val);
     void createBlock(uint32_t addr, uint8_t val);
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CPU_REGISTRY_H__
+#define __CPU_REGISTRY_H__
+
+#include "config_base.h"
+#include "option_base.h"
+#include "str_scanner.h"
+
+#include <cctype>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/** A back end of type |T| in |CpuRegistry|, which may be constructed on first use. */
+template <typename T>
+struct CpuBackend {
+    virtual ~CpuBackend() {}
+    /** comma separated list of supported CPU names */
+    virtual const /*PROGMEM*/ char *listCpu_P() const = 0;
+    /** returns true if |cpu| is supported; this doesn't construct a back end */
+    virtual bool accepts(const char *cpu) = 0;
+    /** returns the back end, which is constructed on first call */
+    virtual T &instance() = 0;
+    /** returns the back end if it has been constructed, otherwise nullptr */
+    virtual T *constructed() = 0;
+};
+
+/**
+ * returns true if |table| has |cpu| which is one of selected variants |cpus| until |cpusEnd|,
+ * in the same manner as |ConfigImpl::setCpuName|
+ */
+template <typename CPUTYPE>
+bool acceptsCpu(const InsnTable<CPUTYPE> &table, const char *cpu,
+        const /*PROGMEM*/ CPUTYPE *cpus = nullptr, const /*PROGMEM*/ CPUTYPE *cpusEnd = nullptr) {
+    StrScanner scan(cpu);
+    auto name = OptionBase::readSymbol(scan.skipSpaces());
+    CPUTYPE cpuType;
+    return table.searchCpuName(name, cpuType) == OK && cpuSelected_P(cpus, cpusEnd, cpuType);
+}
+
+/**
+ * Ordered list of back ends of type |T|. A CPU name is resolved through
+ * a hash index; only a name seen first is resolved by asking each back
+ * end in order.
+ */
+template <typename T>
+class CpuRegistry {
+public:
+    typedef std::shared_ptr<CpuBackend<T>> Backend;
+
+    void add(const Backend &backend) { _backends.push_back(backend); }
+    bool empty() const { return _backends.empty(); }
+    CpuBackend<T> &front() const { return *_backends.front(); }
+
+    /** returns the first back end which supports |cpu|, or nullptr */
+    const Backend *search(const char *cpu) {
+        auto key = lowercase(cpu);
+        const auto it = _index.find(key);
+        if (it != _index.end())
+            return &_backends[it->second];
+        for (size_t i = 0; i < _backends.size(); i++) {
+            if (_backends[i]->accepts(cpu)) {
+                _index.emplace(std::move(key), i);
+                return &_backends[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /** iterate all back ends in order; this constructs all of them */
+    class Iterator {
+    public:
+        T *operator*() const { return &(*_it)->instance(); }
+        Iterator &operator++() {
+            ++_it;
+            return *this;
+        }
+        bool operator!=(const Iterator &other) const { return _it != other._it; }
+
+    private:
+        friend class CpuRegistry;
+        typedef typename std::vector<Backend>::const_iterator Base;
+        Iterator(Base it) : _it(it) {}
+        Base _it;
+    };
+
+    Iterator begin() const { return Iterator(_backends.cbegin()); }
+    Iterator end() const { return Iterator(_backends.cend()); }
+
+    /** list of back ends without constructing them */
+    const std::vector<Backend> &backends() const { return _backends; }
+
+private:
+    std::vector<Backend> _backends;
+    std::unordered_map<std::string, size_t> _index;
+
+    static std::string lowercase(const char *text) {
+        std::string key(text);
+        for (auto &c : key)
+            c = tolower(c);
+        return key;
+    }
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "decode_cache.h"
+
+namespace libasm {
+namespace driver {
+
+DecodeCache::DecodeCache(size_t capacity)
+    : _capacity(capacity), _buckets(BUCKETS), _hits(0), _misses(0) {}
+
+DecodeCache::Cpu &DecodeCache::cpuOf(const Disassembler &dis) {
+    const auto cpu = dis.cpu_P();
+    for (auto &c : _cpus) {
+        if (c.cpu == cpu)
+            return c;
+    }
+    _cpus.push_back(Cpu{cpu, static_cast<uint8_t>(dis.config().addressUnit()), 1});
+    return _cpus.back();
+}
+
+const DecodeCache::Entry &DecodeCache::decode(
+        Disassembler &dis, DisMemory &memory, uint32_t addr, SymbolTable *symtab) {
+    auto &cpu = cpuOf(dis);
+    const Key key{cpu.cpu, addr};
+    const auto it = _entries.find(key);
+    if (it != _entries.end()) {
+        _hits++;
+        return it->second;
+    }
+    _misses++;
+
+    Insn insn(addr);
+    char operands[256] = "";
+    Entry entry;
+    entry.addr = addr;
+    entry.error = dis.decode(memory, insn, operands, sizeof(operands), symtab);
+    entry.bytes.assign(insn.bytes(), insn.bytes() + insn.length());
+    entry.name = insn.name();
+    entry.operands = operands;
+    if (entry.error == NO_MEMORY) {
+        _uncached = std::move(entry);
+        return _uncached;
+    }
+
+    if (_entries.size() >= _capacity)
+        clear();
+    const auto units = unitsOf(entry, cpu);
+    if (units > cpu.maxUnits)
+        cpu.maxUnits = units;
+    _buckets[bucketOf(addr)]++;
+    return _entries.emplace(key, std::move(entry)).first->second;
+}
+
+uint32_t DecodeCache::unitsOf(const Entry &entry, const Cpu &cpu) {
+    const uint32_t units = (entry.length() + cpu.addrUnit - 1) / cpu.addrUnit;
+    return units ? units : 1;
+}
+
+bool DecodeCache::maybeCached(uint32_t first, uint32_t last) const {
+    const auto from = first >> BUCKET_BITS;
+    const auto to = last >> BUCKET_BITS;
+    if (to - from >= BUCKETS)
+        return true;
+    for (auto b = from; b <= to; b++) {
+        if (_buckets[b % BUCKETS])
+            return true;
+    }
+    return false;
+}
+
+DecodeCache::Map::iterator DecodeCache::erase(Map::iterator it) {
+    _buckets[bucketOf(it->first.addr)]--;
+    return _entries.erase(it);
+}
+
+void DecodeCache::invalidate(uint32_t addr, uint32_t size) {
+    if (_entries.empty() || size == 0)
+        return;
+    for (const auto &cpu : _cpus) {
+        const auto first = addr / cpu.addrUnit;
+        const auto last = (addr + size - 1) / cpu.addrUnit;
+        // An instruction which starts |maxUnits - 1| before |first| may cover it.
+        const auto start = first >= cpu.maxUnits ? first - cpu.maxUnits + 1 : 0;
+        if (!maybeCached(start, last))
+            continue;
+        if (last - start >= _entries.size()) {
+            // Scanning all entries is cheaper than looking up every address.
+            for (auto it = _entries.begin(); it != _entries.end();) {
+                const auto a = it->first.addr;
+                if (it->first.cpu == cpu.cpu && a <= last && a + unitsOf(it->second, cpu) > first) {
+                    it = erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            continue;
+        }
+        for (auto a = start; a <= last; a++) {
+            const auto it = _entries.find(Key{cpu.cpu, a});
+            if (it != _entries.end() && a + unitsOf(it->second, cpu) > first)
+                erase(it);
+        }
+    }
+}
+
+void DecodeCache::clear() {
+    _entries.clear();
+    _buckets.assign(BUCKETS, 0);
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
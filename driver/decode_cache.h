@@ -0,0 +1,119 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DECODE_CACHE_H__
+#define __DECODE_CACHE_H__
+
+#include "dis_base.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/**
+ * A cache of decoded instructions in front of |Disassembler::decode|,
+ * keyed by CPU and address, for debuggers which redisplay the same code
+ * again and again. Memory writes must be notified by |invalidate|, which
+ * drops every instruction overlapping written bytes, including one which
+ * starts before them. Options and symbols of disassemblers are not part
+ * of the key; call |clear| when they are changed.
+ */
+class DecodeCache {
+public:
+    struct Entry {
+        uint32_t addr;  // in address unit of CPU
+        Error error;
+        std::vector<uint8_t> bytes;
+        std::string name;
+        std::string operands;
+
+        uint8_t length() const { return bytes.size(); }
+    };
+
+    /** the whole cache is dropped when it holds |capacity| instructions */
+    DecodeCache(size_t capacity = 0x10000);
+
+    /**
+     * Returns an instruction at |addr| decoded by |dis| from |memory|, as
+     * |DisFormatter::disassemble| does. |memory| is read only when the
+     * instruction is not cached. An instruction which runs out of
+     * |memory| is not cached.
+     */
+    const Entry &decode(
+            Disassembler &dis, DisMemory &memory, uint32_t addr, SymbolTable *symtab = nullptr);
+
+    /** memory write hook; |size| bytes are written at byte address |addr| */
+    void invalidate(uint32_t addr, uint32_t size = 1);
+    void clear();
+
+    size_t size() const { return _entries.size(); }
+    size_t hits() const { return _hits; }
+    size_t misses() const { return _misses; }
+
+private:
+    struct Key {
+        const /*PROGMEM*/ char *cpu;
+        uint32_t addr;
+
+        bool operator==(const Key &other) const { return cpu == other.cpu && addr == other.addr; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return std::hash<const void *>()(key.cpu) ^ (key.addr * UINT32_C(0x9E3779B1));
+        }
+    };
+    struct Cpu {
+        const /*PROGMEM*/ char *cpu;
+        uint8_t addrUnit;
+        uint32_t maxUnits;  // longest cached instruction in address units
+    };
+
+    static constexpr uint32_t BUCKET_BITS = 6;
+    static constexpr size_t BUCKETS = 4096;
+
+    typedef std::unordered_map<Key, Entry, KeyHash> Map;
+
+    const size_t _capacity;
+    Map _entries;
+    std::vector<Cpu> _cpus;
+    /** number of cached instructions which start in a bucket of addresses */
+    std::vector<uint32_t> _buckets;
+    Entry _uncached;
+    size_t _hits;
+    size_t _misses;
+
+    Cpu &cpuOf(const Disassembler &dis);
+    static size_t bucketOf(uint32_t addr) { return (addr >> BUCKET_BITS) % BUCKETS; }
+    static uint32_t unitsOf(const Entry &entry, const Cpu &cpu);
+    bool maybeCached(uint32_t first, uint32_t last) const;
+    Map::iterator erase(Map::iterator it);
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
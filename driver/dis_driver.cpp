@@ -18,6 +18,7 @@
 
 #include "bin_memory.h"
 #include "dis_formatter.h"
+#include "phase_stats.h"
 #include "text_printer.h"
 
 #include <algorithm>
@@ -28,8 +29,29 @@
 namespace libasm {
 namespace driver {
 
+namespace {
+/** A disassembler constructed in advance. */
+class DisInstance : public CpuBackend<Disassembler> {
+public:
+    DisInstance(Disassembler *dis) : _dis(dis) {}
+    const /*PROGMEM*/ char *listCpu_P() const override { return _dis->listCpu_P(); }
+    bool accepts(const char *cpu) override { return _dis->setCpu(cpu); }
+    Disassembler &instance() override { return *_dis; }
+    Disassembler *constructed() override { return _dis; }
+
+private:
+    Disassembler *const _dis;
+};
+}  // namespace
+
 DisDriver::DisDriver(Disassembler **begin, Disassembler **end)
-    : _disassemblers(begin, end), _current(*begin) {}
+    : _disassemblers(), _current(*begin) {
+    for (auto it = begin; it != end; it++)
+        _disassemblers.add(std::make_shared<DisInstance>(*it));
+}
+
+DisDriver::DisDriver(const CpuRegistry<Disassembler> &registry)
+    : _disassemblers(registry), _current(&_disassemblers.front().instance()) {}
 
 static void appendTo(const std::string &cpu, std::list<std::string> &list) {
     if (std::find(list.begin(), list.end(), cpu) == list.end())
@@ -53,24 +75,27 @@ static void filter(const char *text, std::list<std::string> &list) {
 Disassembler *DisDriver::restrictCpu(const char *cpu) {
     auto dis = setCpu(cpu);
     if (dis) {
-        _disassemblers.clear();
-        _disassemblers.push_back(dis);
+        CpuRegistry<Disassembler> restricted;
+        restricted.add(*_disassemblers.search(cpu));
+        _disassemblers = restricted;
     }
     return dis;
 }
 
 Disassembler *DisDriver::setCpu(const char *cpu) {
-    for (auto dis : _disassemblers) {
-        if (dis->setCpu(cpu))
-            return _current = dis;
-    }
-    return nullptr;
+    const auto backend = _disassemblers.search(cpu);
+    if (backend == nullptr)
+        return nullptr;
+    auto &dis = (*backend)->instance();
+    if (!dis.setCpu(cpu))
+        return nullptr;
+    return _current = &dis;
 }
 
 std::list<std::string> DisDriver::listCpu() const {
     std::list<std::string> list;
-    for (auto dis : _disassemblers) {
-        const /* PROGMEM */ char *list_P = dis->listCpu_P();
+    for (const auto &backend : _disassemblers.backends()) {
+        const /* PROGMEM */ char *list_P = backend->listCpu_P();
         char listCpu[strlen_P(list_P) + 1];
         strcpy_P(listCpu, list_P);
         filter(listCpu, list);
@@ -80,6 +105,7 @@ std::list<std::string> DisDriver::listCpu() const {
 
 void DisDriver::disassemble(const BinMemory &memory, uint32_t dis_start, uint32_t dis_end,
         DisFormatter &formatter, TextPrinter &output, TextPrinter &listout, TextPrinter &errorout) {
+    LIBASM_STATS_SCOPE(PASS);
     const auto addrUnit = current()->config().addressUnit();
     for (const auto &it : memory) {
         auto mem_base = it.base;
@@ -17,6 +17,7 @@
 #ifndef __DIS_DRIVER_H__
 #define __DIS_DRIVER_H__
 
+#include "cpu_registry.h"
 #include "dis_base.h"
 
 #include <list>
@@ -32,6 +33,8 @@ class DisFormatter;
 class DisDriver {
 public:
     DisDriver(Disassembler **begin, Disassembler **end);
+    /** disassemblers in |registry| are constructed when their CPU is selected */
+    DisDriver(const CpuRegistry<Disassembler> &registry);
 
     Disassembler *restrictCpu(const char *cpu);
     Disassembler *setCpu(const char *cpu);
@@ -42,11 +45,12 @@ public:
             DisFormatter &formatter, TextPrinter &output, TextPrinter &listout,
             TextPrinter &errorout);
 
-    auto begin() const { return _disassemblers.cbegin(); }
-    auto end() const { return _disassemblers.cend(); }
+    /** iterating disassemblers constructs all of them */
+    auto begin() const { return _disassemblers.begin(); }
+    auto end() const { return _disassemblers.end(); }
 
 private:
-    std::list<Disassembler *> _disassemblers;
+    CpuRegistry<Disassembler> _disassemblers;
     Disassembler *_current;
 };
 
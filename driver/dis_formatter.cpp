@@ -16,6 +16,7 @@
 
 #include "dis_formatter.h"
 
+#include "phase_stats.h"
 #include "str_buffer.h"
 
 namespace libasm {
@@ -26,7 +27,10 @@ DisFormatter::DisFormatter(Disassembler &disassembler, const char *input_name)
       _disassembler(disassembler),
       _input_name(input_name),
       _insn(0),
-      _uppercase(false) {
+      _uppercase(false),
+      _symtab(nullptr) {
+    _operands[0] = 0;
+    reset();
     _disassembler.setUpperHex(true);
     _disassembler.setUppercase(false);
 }
@@ -46,12 +50,21 @@ void DisFormatter::reset() {
     /* There is at least one line even when generated byte is zero. */
     _nextContent = _nextLine = -1;
     _errorContent = _errorLine = false;
+    _label = nullptr;
+    _labelContent = _labelLine = false;
+    resetCycles();
 }
 
 Error DisFormatter::disassemble(DisMemory &memory, uint32_t addr) {
     reset();
     _insn.reset(addr);
-    return _disassembler.decode(memory, _insn, _operands, sizeof(_operands));
+    const auto error = _disassembler.decode(
+            memory, _insn, _operands, sizeof(_operands), _symtab);
+    if (_symtab && error == OK)
+        _label = _symtab->lookupValue(addr);
+    if (cyclesEnabled() && error == OK)
+        countCycles();
+    return error;
 }
 
 Error DisFormatter::setCpu(const char *cpu) {
@@ -78,6 +91,7 @@ Error DisFormatter::setOrigin(uint32_t origin) {
     if (err)
         return err;
     _insn.reset(origin);
+    resetTotalCycles();
     LowercaseBuffer lower(_insn.clearNameBuffer());
     UppercaseBuffer upper(lower);
     auto name = _uppercase ? upper.ptr() : lower.ptr();
@@ -90,7 +104,7 @@ Error DisFormatter::setOrigin(uint32_t origin) {
 }
 
 bool DisFormatter::hasNextContent() const {
-    return _nextContent < generatedSize();
+    return (_label && !_labelContent) || _nextContent < generatedSize();
 }
 
 static int max(int a, int b) {
@@ -98,6 +112,7 @@ static int max(int a, int b) {
 }
 
 const char *DisFormatter::getContent() {
+    LIBASM_STATS_SCOPE(FORMATTING);
     resetOut();
     if (isError()) {
         if (!_errorContent) {
@@ -112,6 +127,9 @@ const char *DisFormatter::getContent() {
             formatAddress(startAddress() + _nextContent);
             _nextContent += formatBytes(_nextContent);
         }
+    } else if (_label && !_labelContent) {
+        _labelContent = true;
+        _out.text(_label).letter(':');
     } else {
         _out.text("      ");
         const auto pos = outLength();
@@ -127,10 +145,11 @@ const char *DisFormatter::getContent() {
 }
 
 bool DisFormatter::hasNextLine() const {
-    return _nextLine < generatedSize();
+    return (_label && !_labelLine) || _nextLine < generatedSize();
 }
 
 const char *DisFormatter::getLine() {
+    LIBASM_STATS_SCOPE(FORMATTING);
     resetOut();
     if (isError() && !_errorLine) {
         _errorLine = true;
@@ -139,6 +158,11 @@ const char *DisFormatter::getLine() {
                 _out, startAddress(), config().addressWidth(), _upperHex, false);
         _out.text(": error: ").text_P(_disassembler.errorText_P());
         _nextLine = 0;
+    } else if (_label && !_labelLine) {
+        _labelLine = true;
+        formatAddress(startAddress());
+        formatTab(outLength() + bytesColumnWidth() + 1);
+        _out.text("  ").text(_label).letter(':');
     } else {
         if (_nextLine < 0)
             _nextLine = 0;
@@ -147,6 +171,8 @@ const char *DisFormatter::getLine() {
         const auto formatted = formatBytes(_nextLine);
         if (_nextLine == 0 && *_insn.name()) {
             formatTab(pos + bytesColumnWidth() + 1);
+            if (cyclesEnabled())
+                formatCycles();
             _out.text("        ");
             pos = outLength();
             _out.text(_insn.name());
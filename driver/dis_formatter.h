@@ -20,6 +20,7 @@
 #include "config_base.h"
 #include "dis_base.h"
 #include "list_formatter.h"
+#include "symbol_table.h"
 
 #include <cstdint>
 
@@ -36,6 +37,8 @@ public:
     Error disassemble(DisMemory &memory, uint32_t addr);
     Error setCpu(const char *cpu);
     Error setOrigin(uint32_t origin);
+    /** Label instructions and operands with |symtab|, which may be nullptr. */
+    void setSymbolTable(SymbolTable *symtab) { _symtab = symtab; }
 
     bool isError() const { return _disassembler.getError() != OK; }
     int byteLength() const { return generatedSize(); }
@@ -50,11 +53,15 @@ protected:
     const char *_input_name;
     Insn _insn;
     bool _uppercase;
+    SymbolTable *_symtab;
+    const char *_label;
 
     int _nextContent;
     bool _errorContent;
+    bool _labelContent;
     int _nextLine;
     bool _errorLine;
+    bool _labelLine;
 
     char _operands[256];
 
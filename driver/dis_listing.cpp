@@ -0,0 +1,154 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dis_listing.h"
+
+namespace libasm {
+namespace driver {
+
+std::vector<DisListing::Block> DisListing::layout(const BinMemory &memory) const {
+    // Clip memory blocks by [_start, _end] as DisDriver::disassemble does.
+    const auto addrUnit = _disassembler.config().addressUnit();
+    std::vector<Block> blocks;
+    for (const auto &it : memory) {
+        auto mem_base = it.base;
+        auto mem_size = it.data.size();
+        auto start = mem_base / addrUnit;
+        const auto end = start + (mem_size - 1) / addrUnit;
+        if (start > _end || end < _start)
+            continue;
+        if (start < _start) {
+            mem_base = _start * addrUnit;
+            mem_size -= (_start - start) * addrUnit;
+        }
+        if (end > _end)
+            mem_size -= (end - _end) * addrUnit;
+        blocks.emplace_back();
+        blocks.back().base = mem_base;
+        blocks.back().size = mem_size;
+    }
+    return blocks;
+}
+
+bool DisListing::sameLayout(const BinMemory &memory) const {
+    const auto blocks = layout(memory);
+    if (blocks.size() != _blocks.size())
+        return false;
+    for (size_t i = 0; i < blocks.size(); i++) {
+        if (blocks[i].base != _blocks[i].base || blocks[i].size != _blocks[i].size)
+            return false;
+    }
+    return true;
+}
+
+const DisListing::Line &DisListing::decode(DisMemory &reader, Block &block, uint32_t addr) {
+    const auto addrUnit = _disassembler.config().addressUnit();
+    _formatter.disassemble(reader, addr / addrUnit);
+    auto &line = block.insns[addr];
+    line.length = _formatter.byteLength();
+    line.error = _formatter.isError();
+    line.lines.clear();
+    while (_formatter.hasNextLine())
+        line.lines.emplace_back(_formatter.getLine());
+    line.contents.clear();
+    while (_formatter.hasNextContent())
+        line.contents.emplace_back(_formatter.getContent());
+    return line;
+}
+
+void DisListing::disassemble(const BinMemory &memory, uint32_t dis_start, uint32_t dis_end) {
+    _start = dis_start;
+    _end = dis_end;
+    _blocks = layout(memory);
+    const auto addrUnit = _disassembler.config().addressUnit();
+    for (auto &block : _blocks) {
+        _formatter.setOrigin(block.base / addrUnit);
+        block.content = _formatter.getContent();
+        block.line = _formatter.getLine();
+        auto reader = memory.reader(block.base);
+        for (auto addr = block.base; addr < block.end();) {
+            const auto length = decode(reader, block, addr).length;
+            if (length == 0)
+                break;
+            addr += length;
+        }
+    }
+}
+
+size_t DisListing::patch(const BinMemory &memory, uint32_t addr, uint32_t size) {
+    if (!sameLayout(memory)) {
+        disassemble(memory, _start, _end);
+        return this->size();
+    }
+    size_t decoded = 0;
+    const auto patchEnd = addr + size;
+    for (auto &block : _blocks) {
+        if (block.end() <= addr || patchEnd <= block.base || block.insns.empty())
+            continue;
+        auto &insns = block.insns;
+        // The last boundary at or before the patch.
+        auto it = insns.upper_bound(addr < block.base ? block.base : addr);
+        auto pos = (--it)->first;
+        auto reader = memory.reader(pos);
+        while (pos < block.end()) {
+            // Re-synchronized with an old boundary after the patch.
+            if (pos >= patchEnd && insns.find(pos) != insns.end())
+                break;
+            const auto length = decode(reader, block, pos).length;
+            decoded++;
+            if (length == 0)
+                break;
+            // Drop old boundaries inside of the new instruction.
+            insns.erase(insns.upper_bound(pos), insns.lower_bound(pos + length));
+            pos += length;
+        }
+    }
+    return decoded;
+}
+
+void DisListing::print(TextPrinter &output, TextPrinter &listout, TextPrinter &errorout) const {
+    for (const auto &block : _blocks) {
+        output.println(block.content.c_str());
+        listout.println(block.line.c_str());
+        for (const auto &it : block.insns) {
+            const auto &line = it.second;
+            for (const auto &text : line.lines) {
+                listout.println(text.c_str());
+                if (line.error)
+                    errorout.println(text.c_str());
+            }
+            for (const auto &text : line.contents)
+                output.println(text.c_str());
+        }
+    }
+}
+
+size_t DisListing::size() const {
+    size_t n = 0;
+    for (const auto &block : _blocks)
+        n += block.insns.size();
+    return n;
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DIS_LISTING_H__
+#define __DIS_LISTING_H__
+
+#include "bin_memory.h"
+#include "dis_formatter.h"
+#include "text_printer.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/**
+ * A disassembled listing of a memory image which is kept with its
+ * instruction boundaries, so that it can be updated incrementally after
+ * bytes are patched. Only instructions from the last boundary at or
+ * before the patch are disassembled again, until they re-synchronize
+ * with the old boundaries. Printed text is the same as what
+ * |DisDriver::disassemble| prints.
+ */
+class DisListing {
+public:
+    /** |formatter| disassembles with |disassembler| */
+    DisListing(const Disassembler &disassembler, DisFormatter &formatter)
+        : _disassembler(disassembler), _formatter(formatter), _start(0), _end(0) {}
+
+    /** disassemble |memory| from |dis_start| to |dis_end| inclusive */
+    void disassemble(const BinMemory &memory, uint32_t dis_start, uint32_t dis_end);
+
+    /**
+     * Update the listing after |size| bytes at byte address |addr| of
+     * |memory| are patched. When the patch adds or removes memory, the
+     * whole |memory| is disassembled again. Returns the number of
+     * instructions disassembled.
+     */
+    size_t patch(const BinMemory &memory, uint32_t addr, uint32_t size = 1);
+
+    void print(TextPrinter &output, TextPrinter &listout, TextPrinter &errorout) const;
+
+    /** number of instructions in the listing */
+    size_t size() const;
+
+private:
+    struct Line {
+        uint32_t length;
+        bool error;
+        std::vector<std::string> contents;
+        std::vector<std::string> lines;
+    };
+    struct Block {
+        uint32_t base;  // byte address
+        uint32_t size;  // bytes to disassemble
+        std::string content;
+        std::string line;
+        std::map<uint32_t, Line> insns;  // keyed by byte address
+
+        uint32_t end() const { return base + size; }
+    };
+
+    const Disassembler &_disassembler;
+    DisFormatter &_formatter;
+    uint32_t _start;
+    uint32_t _end;
+    std::vector<Block> _blocks;
+
+    std::vector<Block> layout(const BinMemory &memory) const;
+    bool sameLayout(const BinMemory &memory) const;
+    const Line &decode(DisMemory &reader, Block &block, uint32_t addr);
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dis_stream.h"
+
+#include "phase_stats.h"
+
+namespace libasm {
+namespace driver {
+
+DisStream::DisStream(const Disassembler &disassembler, DisFormatter &formatter,
+        TextPrinter &output, TextPrinter &listout, TextPrinter &errorout, uint32_t dis_start,
+        uint32_t dis_end)
+    : _formatter(formatter),
+      _output(output),
+      _listout(listout),
+      _errorout(errorout),
+      _addrUnit(disassembler.config().addressUnit()),
+      _dis_start(dis_start),
+      _dis_end(dis_end),
+      _memory(disassembler.config().codeMax()),
+      _running(false) {}
+
+uint8_t DisStream::RingMemory::nextByte() {
+    const auto val = _buffer[_head];
+    _head = (_head + 1) % _buffer.size();
+    _size--;
+    return val;
+}
+
+bool DisStream::inRange(uint32_t addr) const {
+    const auto unit = addr / _addrUnit;
+    return unit >= _dis_start && unit <= _dis_end;
+}
+
+void DisStream::feed(uint32_t addr, const uint8_t *data, size_t size) {
+    LIBASM_STATS_SCOPE(PASS);
+    for (size_t i = 0; i < size; i++, addr++) {
+        if (_running && addr != _memory.next())
+            flush();
+        if (!_running) {
+            if (!inRange(addr))
+                continue;
+            _memory.restart(addr);
+            _running = true;
+            _formatter.setOrigin(addr / _addrUnit);
+            _output.println(_formatter.getContent());
+            _listout.println(_formatter.getLine());
+        }
+        // bytes past |dis_end| are only read by the last instruction
+        _memory.push(data[i]);
+        if (_memory.full())
+            disassemble();
+    }
+}
+
+void DisStream::flush() {
+    LIBASM_STATS_SCOPE(PASS);
+    while (_running && _memory.size())
+        disassemble();
+    _running = false;
+}
+
+void DisStream::disassemble() {
+    const auto addr = _memory.address();
+    if (!inRange(addr)) {
+        _memory.restart(_memory.next());
+        _running = false;
+        return;
+    }
+    _formatter.disassemble(_memory, addr / _addrUnit);
+    if (_memory.address() == addr)
+        _memory.readByte();
+    while (_formatter.hasNextLine()) {
+        const char *line = _formatter.getLine();
+        _listout.println(line);
+        if (_formatter.isError())
+            _errorout.println(line);
+    }
+    while (_formatter.hasNextContent())
+        _output.println(_formatter.getContent());
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DIS_STREAM_H__
+#define __DIS_STREAM_H__
+
+#include "dis_base.h"
+#include "dis_formatter.h"
+#include "text_printer.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/**
+ * Disassemble bytes which arrive piece by piece, such as records read
+ * from a pipe, with bounded memory. Bytes are kept in a ring buffer as
+ * large as the longest instruction, and an instruction is printed as
+ * soon as the buffer is full, when a discontiguous address arrives, or
+ * at |flush|. Printed text is the same as what |DisDriver::disassemble|
+ * prints for the same bytes loaded in memory.
+ */
+class DisStream {
+public:
+    /** |formatter| disassembles with |disassembler| */
+    DisStream(const Disassembler &disassembler, DisFormatter &formatter, TextPrinter &output,
+            TextPrinter &listout, TextPrinter &errorout, uint32_t dis_start = 0,
+            uint32_t dis_end = UINT32_MAX);
+
+    /** feed |size| bytes of |data| at byte address |addr| */
+    void feed(uint32_t addr, const uint8_t *data, size_t size);
+    /** disassemble all buffered bytes; call at the end of stream */
+    void flush();
+
+    /** number of bytes the ring buffer can hold */
+    size_t capacity() const { return _memory.capacity(); }
+
+private:
+    class RingMemory : public DisMemory {
+    public:
+        RingMemory(size_t capacity) : DisMemory(0), _buffer(capacity), _head(0), _size(0) {}
+        bool hasNext() const override { return _size > 0; }
+        size_t size() const { return _size; }
+        size_t capacity() const { return _buffer.size(); }
+        bool full() const { return _size == _buffer.size(); }
+        /** byte address of the next byte to be pushed */
+        uint32_t next() const { return address() + _size; }
+        void push(uint8_t val) { _buffer[(_head + _size++) % _buffer.size()] = val; }
+        void restart(uint32_t addr) {
+            resetAddress(addr);
+            _head = _size = 0;
+        }
+
+    protected:
+        uint8_t nextByte() override;
+
+    private:
+        std::vector<uint8_t> _buffer;
+        size_t _head;
+        size_t _size;
+    };
+
+    DisFormatter &_formatter;
+    TextPrinter &_output;
+    TextPrinter &_listout;
+    TextPrinter &_errorout;
+    const uint32_t _addrUnit;
+    const uint32_t _dis_start;
+    const uint32_t _dis_end;
+    RingMemory _memory;
+    bool _running;
+
+    bool inRange(uint32_t addr) const;
+    void disassemble();
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow_graph.h"
+
+#include <algorithm>
+
+namespace libasm {
+namespace driver {
+
+FlowGraph::FlowGraph(
+        Disassembler &disassembler, const FlowTracer &tracer, const CycleCounter &counter)
+    : _disassembler(disassembler), _tracer(tracer), _counter(counter), _unit(1) {}
+
+void FlowGraph::addEntry(uint32_t entry) {
+    _entries.push_back(entry);
+}
+
+void FlowGraph::build(const BinMemory &memory) {
+    _unit = _disassembler.config().addressUnit();
+    trace(memory);
+    split();
+    link();
+}
+
+void FlowGraph::trace(const BinMemory &memory) {
+    const auto base = memory.startAddress() / _unit;
+    const auto size = memory.endAddress() / _unit - base + 1;
+    // Addresses which are decoded already, including operands.
+    std::vector<bool> visited(size);
+    std::vector<uint32_t> work(_entries);
+    auto reader = memory.reader(0);
+    libasm::Insn insn(0);
+    char operands[80];
+    while (!work.empty()) {
+        auto address = work.back();
+        work.pop_back();
+        _leaders.push_back(address);
+        while (address >= base && address - base < size && !visited[address - base]) {
+            reader.setAddress(address * _unit);
+            insn.reset(address);
+            if (_disassembler.decode(reader, insn, operands, sizeof(operands)) != OK)
+                break;
+            const auto next = address + insn.length() / _unit;
+            for (auto a = address; a < next && a - base < size; a++)
+                visited[a - base] = true;
+            const auto flow = _tracer.trace(insn.bytes(), insn.length(), address);
+            _insns.push_back(Insn{address, insn.length(), flow,
+                    _counter.count(insn.bytes(), insn.length())});
+            if (flow.type == FLOW_NEXT) {
+                address = next;
+                continue;
+            }
+            _leaders.push_back(next);
+            if (flow.known) {
+                if (flow.type == FLOW_CALL)
+                    _entries.push_back(flow.target);
+                work.push_back(flow.target);
+            }
+            if (flow.type != FLOW_CALL && !flow.conditional)
+                break;
+            address = next;
+        }
+    }
+}
+
+void FlowGraph::split() {
+    std::sort(_insns.begin(), _insns.end(),
+            [](const Insn &a, const Insn &b) { return a.address < b.address; });
+    std::sort(_leaders.begin(), _leaders.end());
+    _leaders.erase(std::unique(_leaders.begin(), _leaders.end()), _leaders.end());
+    _blocks.clear();
+    for (uint32_t i = 0; i < _insns.size(); i++) {
+        const auto &insn = _insns[i];
+        auto start = _blocks.empty();
+        if (!start) {
+            const auto &prev = _insns[i - 1];
+            start = prev.flow.type != FLOW_NEXT || prev.address + prev.length / _unit != insn.address ||
+                    std::binary_search(_leaders.begin(), _leaders.end(), insn.address);
+        }
+        if (start)
+            _blocks.push_back(Block{i, i, NONE, NONE, NONE});
+        _blocks.back().end = i + 1;
+    }
+}
+
+void FlowGraph::link() {
+    std::sort(_entries.begin(), _entries.end());
+    _entries.erase(std::unique(_entries.begin(), _entries.end()), _entries.end());
+    _functions.clear();
+    for (const auto entry : _entries)
+        _functions.push_back(Function{entry, blockAt(entry)});
+    for (auto &block : _blocks) {
+        const auto &last = _insns[block.end - 1];
+        const auto &flow = last.flow;
+        if (flow.type == FLOW_NEXT || flow.type == FLOW_CALL || flow.conditional)
+            block.next = blockAt(last.address + last.length / _unit);
+        if (flow.type == FLOW_JUMP && flow.known)
+            block.jump = blockAt(flow.target);
+        if (flow.type == FLOW_CALL && flow.known)
+            block.callee = functionAt(flow.target);
+    }
+}
+
+int32_t FlowGraph::blockAt(uint32_t address) const {
+    const auto it = std::lower_bound(_blocks.begin(), _blocks.end(), address,
+            [this](const Block &block, uint32_t addr) { return _insns[block.first].address < addr; });
+    if (it == _blocks.end() || _insns[it->first].address != address)
+        return NONE;
+    return it - _blocks.begin();
+}
+
+int32_t FlowGraph::functionAt(uint32_t address) const {
+    const auto it = std::lower_bound(_functions.begin(), _functions.end(), address,
+            [](const Function &func, uint32_t addr) { return func.entry < addr; });
+    if (it == _functions.end() || it->entry != address)
+        return NONE;
+    return it - _functions.begin();
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FLOW_GRAPH_H__
+#define __FLOW_GRAPH_H__
+
+#include "bin_memory.h"
+#include "cycles_base.h"
+#include "dis_base.h"
+#include "flow_base.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/**
+ * Basic blocks and call graph of instructions reachable from entry
+ * points in a memory image.
+ */
+class FlowGraph {
+public:
+    FlowGraph(Disassembler &disassembler, const FlowTracer &tracer, const CycleCounter &counter);
+
+    /** Add |entry| address of a function. */
+    void addEntry(uint32_t entry);
+    /** Trace instructions in |memory| from entries and build basic blocks. */
+    void build(const BinMemory &memory);
+
+    struct Insn {
+        uint32_t address;
+        uint8_t length;
+        Flow flow;
+        Cycles cycles;
+    };
+
+    static constexpr int32_t NONE = -1;
+
+    struct Block {
+        uint32_t first;    // index of the first instruction
+        uint32_t end;      // index next to the last instruction
+        int32_t next;      // block which follows, or NONE
+        int32_t jump;      // block which is jumped to, or NONE
+        int32_t callee;    // function which is called, or NONE
+    };
+
+    struct Function {
+        uint32_t entry;
+        int32_t block;  // entry block, or NONE when |entry| can't be decoded
+    };
+
+    const std::vector<Insn> &insns() const { return _insns; }
+    const std::vector<Block> &blocks() const { return _blocks; }
+    const std::vector<Function> &functions() const { return _functions; }
+    /** returns block which starts at |address|, or NONE */
+    int32_t blockAt(uint32_t address) const;
+    /** returns function whose entry is |address|, or NONE */
+    int32_t functionAt(uint32_t address) const;
+
+private:
+    Disassembler &_disassembler;
+    const FlowTracer &_tracer;
+    const CycleCounter &_counter;
+    uint8_t _unit;
+    std::vector<uint32_t> _entries;
+    std::vector<uint32_t> _leaders;
+    std::vector<Insn> _insns;
+    std::vector<Block> _blocks;
+    std::vector<Function> _functions;
+
+    void trace(const BinMemory &memory);
+    void split();
+    void link();
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -19,7 +19,8 @@
 namespace libasm {
 namespace driver {
 
-static IntelHex INSTANCE;
+// Encoder and decoder have states; one instance per thread.
+static thread_local IntelHex INSTANCE;
 
 BinDecoder &IntelHex::decoder() {
     return INSTANCE;
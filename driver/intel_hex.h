@@ -25,6 +25,7 @@ namespace driver {
 
 class IntelHex : public BinDecoder, public BinEncoder {
 public:
+    // Instances owned by the calling thread.
     static BinDecoder &decoder();
     static BinEncoder &encoder();
 
@@ -22,8 +22,11 @@ namespace libasm {
 namespace driver {
 
 ListFormatter::ListFormatter()
-    : _formatter(), _out(_out_buffer, sizeof(_out_buffer)), _upperHex(true) {
-}
+    : _formatter(),
+      _out(_out_buffer, sizeof(_out_buffer)),
+      _upperHex(true),
+      _counter(nullptr),
+      _counterCpu(nullptr) {}
 
 void ListFormatter::setUpperHex(bool enable) {
     _upperHex = enable;
@@ -109,6 +112,54 @@ void ListFormatter::formatTab(int tabPosition, int delta) {
     }
 }
 
+void ListFormatter::countCycles() {
+    const auto cpu = config().cpu_P();
+    if (cpu != _counterCpu) {
+        _counterCpu = cpu;
+        _counter = nullptr;
+        for (const auto counter : _counters) {
+            if (strcmp_P(cpu, counter->cpu_P()) == 0)
+                _counter = counter;
+        }
+    }
+    resetCycles();
+    const auto length = generatedSize();
+    if (_counter == nullptr || length == 0)
+        return;
+    uint8_t bytes[16];
+    const auto size = length < int(sizeof(bytes)) ? length : int(sizeof(bytes));
+    for (auto i = 0; i < size; i++)
+        bytes[i] = getByte(i);
+    _cycles = _counter->count(bytes, size);
+    if (_cycles.known())
+        _totalCycles += _cycles;
+}
+
+static void formatRange(StrBuffer &out, const ValueFormatter &formatter, const Cycles &cycles) {
+    formatter.formatDec(out, cycles.min, 32);
+    if (cycles.max != cycles.min) {
+        out.letter('-');
+        formatter.formatDec(out, cycles.max, 32);
+    }
+}
+
+void ListFormatter::formatCycles() {
+    // Cycles of the line and the running total, both right aligned.
+    const auto pos = outLength();
+    if (_cycles.known()) {
+        char buffer[20];
+        StrBuffer cycles(buffer, sizeof(buffer));
+        formatRange(cycles, _formatter, _cycles);
+        formatTab(pos + 6 - (cycles.mark() - buffer), 1);
+        _out.text(buffer);
+        cycles.reset(buffer, sizeof(buffer));
+        formatRange(cycles, _formatter, _totalCycles);
+        formatTab(pos + cyclesColumnWidth() - 1 - (cycles.mark() - buffer), 1);
+        _out.text(buffer);
+    }
+    formatTab(pos + cyclesColumnWidth(), 1);
+}
+
 }  // namespace driver
 }  // namespace libasm
 
@@ -18,10 +18,12 @@
 #define __CLI_LISTING_H__
 
 #include "config_base.h"
+#include "cycles_base.h"
 #include "str_buffer.h"
 #include "value_formatter.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace libasm {
 namespace driver {
@@ -29,6 +31,8 @@ namespace driver {
 class ListFormatter {
 public:
     virtual void setUpperHex(bool enable);
+    /** Annotate instructions with clock cycles when |counter| matches the current CPU. */
+    void addCycleCounter(const CycleCounter &counter) { _counters.push_back(&counter); }
 
     bool hasNextContent() const;
     const char *getContent();
@@ -42,6 +46,11 @@ protected:
     StrBuffer _out;
     bool _upperHex;
     char _out_buffer[256];
+    std::vector<const CycleCounter *> _counters;
+    const CycleCounter *_counter;
+    const /*PROGMEM*/ char *_counterCpu;
+    Cycles _cycles;
+    Cycles _totalCycles;
 
     void resetOut() { _out.reset(_out_buffer, sizeof(_out_buffer)); }
     int outLength() const { return _out.mark() - _out_buffer; }
@@ -58,6 +67,14 @@ protected:
     int bytesColumnWidth() const { return 19; }
     int formatBytes(int base);
     void formatTab(int tabPosition, int delta = 4);
+
+    bool cyclesEnabled() const { return !_counters.empty(); }
+    /** Count cycles of generated bytes and add them to the running total. */
+    void countCycles();
+    void resetCycles() { _cycles = Cycles(); }
+    void resetTotalCycles() { _totalCycles = Cycles(); }
+    int cyclesColumnWidth() const { return 16; }
+    void formatCycles();
 };
 
 }  // namespace driver
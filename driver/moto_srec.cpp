@@ -19,7 +19,8 @@
 namespace libasm {
 namespace driver {
 
-static MotoSrec INSTANCE;
+// Encoder and decoder have states; one instance per thread.
+static thread_local MotoSrec INSTANCE;
 
 BinDecoder &MotoSrec::decoder() {
     return INSTANCE;
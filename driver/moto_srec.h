@@ -25,6 +25,7 @@ namespace driver {
 
 class MotoSrec : public BinDecoder, public BinEncoder {
 public:
+    // Instances owned by the calling thread.
     static BinDecoder &decoder();
     static BinEncoder &encoder();
 
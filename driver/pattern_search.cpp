@@ -0,0 +1,205 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pattern_search.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace libasm {
+namespace driver {
+
+namespace {
+
+/** Patterns are assembled at this address, so that branch targets around it are encodable. */
+constexpr uint32_t ORIGIN = 0x1000;
+
+/**
+ * Values which a wildcard takes first; each of them may select a different form. A negative
+ * value covers the sign bit of a signed displacement.
+ */
+constexpr uint32_t BASES[] = {
+        0x10,
+        0x70,
+        ORIGIN + 0x10,
+        ORIGIN - 0x10,
+        0x5500,
+        0x123456,
+        static_cast<uint32_t>(-0x10),
+};
+
+/** Upper limit of signatures of a pattern, which is a product of forms of its lines. */
+constexpr size_t MAX_SIGNATURES = 64;
+
+}  // namespace
+
+PatternCompiler::PatternCompiler(Assembler &assembler) : _assembler(assembler) {}
+
+Error PatternCompiler::encode(const std::string &line, const std::vector<size_t> &holes,
+        const std::vector<uint32_t> &values, std::vector<uint8_t> &bytes) {
+    std::string text;
+    size_t start = 0;
+    for (size_t i = 0; i < holes.size(); i++) {
+        char value[16];
+        snprintf(value, sizeof(value), "%d", static_cast<int32_t>(values[i]));
+        text.append(line, start, holes[i] - start).append(value);
+        start = holes[i] + 1;
+    }
+    text.append(line, start, std::string::npos);
+
+    _assembler.setCurrentLocation(ORIGIN);
+    Insn insn(ORIGIN);
+    const auto error = _assembler.encode(text.c_str(), insn);
+    if (error == OK && insn.length() == 0)
+        return UNKNOWN_INSTRUCTION;
+    bytes.assign(insn.bytes(), insn.bytes() + insn.length());
+    return error;
+}
+
+Error PatternCompiler::compileLine(const std::string &line, std::vector<Variant> &variants) {
+    std::vector<size_t> holes;
+    for (size_t i = 0; i < line.size(); i++) {
+        if (line[i] == '?')
+            holes.push_back(i);
+    }
+
+    // Bits which differ among encodings of the same length are wildcard.
+    std::vector<uint8_t> bytes;
+    auto accept = [&variants, &bytes]() {
+        for (auto &v : variants) {
+            if (v.bytes.size() == bytes.size()) {
+                for (size_t i = 0; i < bytes.size(); i++)
+                    v.mask[i] &= ~(v.bytes[i] ^ bytes[i]);
+                return;
+            }
+        }
+        variants.push_back(Variant{bytes, std::vector<uint8_t>(bytes.size(), 0xFF)});
+    };
+
+    auto firstError = OK;
+    std::vector<uint32_t> values(holes.size());
+    for (const auto base : BASES) {
+        std::fill(values.begin(), values.end(), base);
+        const auto error = encode(line, holes, values, bytes);
+        if (error) {
+            if (firstError == OK)
+                firstError = error;
+        } else {
+            accept();
+            // Flip each bit of each wildcard.
+            for (size_t h = 0; h < holes.size(); h++) {
+                for (auto bit = 0; bit < 32; bit++) {
+                    values[h] = base ^ (UINT32_C(1) << bit);
+                    if (encode(line, holes, values, bytes) == OK)
+                        accept();
+                }
+                values[h] = base;
+            }
+        }
+        if (holes.empty())
+            break;
+    }
+    for (auto &v : variants) {
+        for (size_t i = 0; i < v.bytes.size(); i++)
+            v.bytes[i] &= v.mask[i];
+    }
+    return variants.empty() ? firstError : OK;
+}
+
+Error PatternCompiler::compile(const std::string &name, const std::vector<std::string> &lines,
+        std::vector<Signature> &signatures, size_t &lineno) {
+    std::vector<Signature> products{Signature{name, {}, {}}};
+    for (lineno = 0; lineno < lines.size(); lineno++) {
+        std::vector<Variant> variants;
+        const auto error = compileLine(lines[lineno], variants);
+        if (error)
+            return error;
+        if (products.size() * variants.size() > MAX_SIGNATURES)
+            return TOO_COMPLEX_EXPRESSION;
+        std::vector<Signature> next;
+        for (const auto &p : products) {
+            for (const auto &v : variants) {
+                next.push_back(p);
+                auto &s = next.back();
+                s.bytes.insert(s.bytes.end(), v.bytes.begin(), v.bytes.end());
+                s.mask.insert(s.mask.end(), v.mask.begin(), v.mask.end());
+            }
+        }
+        products.swap(next);
+    }
+    signatures.insert(signatures.end(), products.begin(), products.end());
+    return OK;
+}
+
+PatternMatcher::PatternMatcher() : _buckets(256) {}
+
+void PatternMatcher::add(const Signature &signature) {
+    const uint32_t index = _signatures.size();
+    _signatures.push_back(signature);
+    const auto &mask = signature.mask;
+    const auto it = std::find(mask.begin(), mask.end(), 0xFF);
+    const uint8_t anchor = it - mask.begin();
+    _anchors.push_back(anchor);
+    if (it == mask.end()) {
+        _wildcards.push_back(index);
+    } else {
+        _buckets[signature.bytes[anchor]].push_back(index);
+    }
+}
+
+bool PatternMatcher::matches(
+        const Signature &signature, const std::vector<uint8_t> &data, size_t start) const {
+    const auto size = signature.bytes.size();
+    if (start + size > data.size())
+        return false;
+    for (size_t i = 0; i < size; i++) {
+        if ((data[start + i] & signature.mask[i]) != signature.bytes[i])
+            return false;
+    }
+    return true;
+}
+
+std::vector<PatternMatcher::Hit> PatternMatcher::search(const BinMemory &memory) const {
+    std::vector<Hit> hits;
+    for (const auto &block : memory) {
+        const auto &data = block.data;
+        const auto begin = hits.size();
+        for (size_t i = 0; i < data.size(); i++) {
+            for (const auto index : _buckets[data[i]]) {
+                const auto anchor = _anchors[index];
+                if (i >= anchor && matches(_signatures[index], data, i - anchor))
+                    hits.push_back(Hit{static_cast<uint32_t>(block.base + i - anchor), index});
+            }
+            for (const auto index : _wildcards) {
+                if (matches(_signatures[index], data, i))
+                    hits.push_back(Hit{static_cast<uint32_t>(block.base + i), index});
+            }
+        }
+        std::stable_sort(hits.begin() + begin, hits.end(),
+                [](const Hit &a, const Hit &b) { return a.address < b.address; });
+    }
+    return hits;
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PATTERN_SEARCH_H__
+#define __PATTERN_SEARCH_H__
+
+#include "asm_base.h"
+#include "bin_memory.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/**
+ * Byte signature of an instruction pattern. A byte matches when its bits
+ * set in |mask| are equal to |bytes|.
+ */
+struct Signature {
+    std::string name;
+    std::vector<uint8_t> bytes;
+    std::vector<uint8_t> mask;
+};
+
+/**
+ * Compile instruction patterns in assembler syntax into signatures. A
+ * "?" stands for any numeric operand, such as an address, an immediate
+ * or a branch target. An operand which may be encoded in several forms,
+ * such as direct page and extended addressing, yields a signature for
+ * each form.
+ */
+class PatternCompiler {
+public:
+    PatternCompiler(Assembler &assembler);
+
+    /**
+     * Compile |lines| of pattern |name| and add signatures to |signatures|.
+     * Returns OK, or an error and its |lineno| in |lines|.
+     */
+    Error compile(const std::string &name, const std::vector<std::string> &lines,
+            std::vector<Signature> &signatures, size_t &lineno);
+
+private:
+    Assembler &_assembler;
+
+    struct Variant {
+        std::vector<uint8_t> bytes;
+        std::vector<uint8_t> mask;
+    };
+    Error compileLine(const std::string &line, std::vector<Variant> &variants);
+    Error encode(const std::string &line, const std::vector<size_t> &holes,
+            const std::vector<uint32_t> &values, std::vector<uint8_t> &bytes);
+};
+
+/**
+ * Search many signatures in a memory image at once. Each signature is
+ * indexed by one byte which has no wildcard bit, so that most of the
+ * signatures are never compared at most of the addresses.
+ */
+class PatternMatcher {
+public:
+    PatternMatcher();
+
+    void add(const Signature &signature);
+    size_t size() const { return _signatures.size(); }
+    const Signature &signature(size_t index) const { return _signatures[index]; }
+
+    struct Hit {
+        uint32_t address;  // byte address of the first byte
+        uint32_t index;    // index of signature
+    };
+    /** returns hits in |memory| in ascending order of address */
+    std::vector<Hit> search(const BinMemory &memory) const;
+
+private:
+    std::vector<Signature> _signatures;
+    std::vector<uint8_t> _anchors;  // offset of anchor byte of each signature
+    std::vector<std::vector<uint32_t>> _buckets;  // signatures by anchor byte value
+    std::vector<uint32_t> _wildcards;  // signatures which have no anchor byte
+
+    bool matches(const Signature &signature, const std::vector<uint8_t> &data, size_t start) const;
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
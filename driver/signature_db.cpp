@@ -0,0 +1,239 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "signature_db.h"
+
+#include "array_memory.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace libasm {
+namespace driver {
+
+namespace {
+
+constexpr char MAGIC[8] = {'L', 'I', 'B', 'A', 'S', 'M', 'S', 'G'};
+constexpr uint32_t MAX_BITS = 20;
+
+bool isWord(char c) {
+    return isalnum(c) || c == '_';
+}
+
+/**
+ * Replace numbers in |operands| with "#", leaving registers and punctuations.
+ * A number starts a token, so that digits of registers, such as D0 or RR4,
+ * are kept.
+ */
+std::string skeleton(const char *operands) {
+    std::string text;
+    for (auto p = operands; *p;) {
+        const auto top = p == operands || !isWord(p[-1]);
+        if (top && (isdigit(*p) || (*p == '$' && isxdigit(p[1])))) {
+            text += '#';
+            for (p++; isalnum(*p);)
+                p++;
+        } else {
+            text += *p++;
+        }
+    }
+    return text;
+}
+
+uint32_t bucketOf(uint64_t hash, uint32_t bits) {
+    return bits ? hash >> (64 - bits) : 0;
+}
+
+/** Entries follow the index, aligned for 64-bit hash. */
+size_t entriesOffset(uint32_t bits) {
+    const auto end = sizeof(SignatureDb::Header) + ((UINT32_C(1) << bits) + 1) * sizeof(uint32_t);
+    return (end + 7) & ~7;
+}
+
+}  // namespace
+
+SignatureHasher::SignatureHasher(Disassembler &disassembler, const BinMemory &memory)
+    : _disassembler(disassembler), _memory(memory) {}
+
+const SignatureHasher::Masked &SignatureHasher::insnAt(uint32_t addr) {
+    const auto it = _cache.find(addr);
+    if (it != _cache.end())
+        return it->second;
+    auto &masked = _cache[addr];
+    const auto unit = _disassembler.config().addressUnit();
+    auto reader = _memory.reader(addr);
+    Insn insn(addr / unit);
+    char operands[80];
+    if (_disassembler.decode(reader, insn, operands, sizeof(operands)) || insn.length() == 0)
+        return masked;
+    const std::string name(insn.name());
+    const auto shape = skeleton(operands);
+    masked.bytes.assign(insn.bytes(), insn.bytes() + insn.length());
+    masked.mask.assign(insn.length(), 0xFF);
+    auto flipped = masked.bytes;
+    for (size_t i = 0; i < flipped.size(); i++) {
+        for (auto bit = 0; bit < 8; bit++) {
+            flipped[i] ^= 1 << bit;
+            const ArrayMemory memory(addr, flipped.data(), flipped.size());
+            auto flippedReader = memory.iterator();
+            Insn other(addr / unit);
+            char otherOperands[80];
+            if (_disassembler.decode(flippedReader, other, otherOperands, sizeof(otherOperands)) ==
+                            OK &&
+                    other.length() == insn.length() && name == other.name() &&
+                    shape == skeleton(otherOperands))
+                masked.mask[i] &= ~(1 << bit);
+            flipped[i] ^= 1 << bit;
+        }
+        masked.bytes[i] &= masked.mask[i];
+    }
+    return masked;
+}
+
+SignatureDb::SignatureDb()
+    : _header(nullptr), _index(nullptr), _entries(nullptr), _names(nullptr) {}
+
+bool SignatureDb::attach(const void *base, size_t size) {
+    const auto top = static_cast<const char *>(base);
+    const auto header = static_cast<const Header *>(base);
+    if (size < sizeof(Header) || memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+            header->size != size || header->bits > MAX_BITS)
+        return false;
+    const auto index = sizeof(Header);
+    const auto entries = entriesOffset(header->bits);
+    if (entries + header->count * sizeof(Entry) != header->names || header->names > size)
+        return false;
+    const auto indexes = reinterpret_cast<const uint32_t *>(top + index);
+    const auto buckets = UINT32_C(1) << header->bits;
+    for (uint32_t i = 0; i <= buckets; i++) {
+        if (indexes[i] > header->count || (i > 0 && indexes[i] < indexes[i - 1]))
+            return false;
+    }
+    const auto namesSize = size - header->names;
+    const auto list = reinterpret_cast<const Entry *>(top + entries);
+    for (uint32_t i = 0; i < header->count; i++) {
+        if (list[i].name >= namesSize)
+            return false;
+    }
+    if (namesSize && top[size - 1] != 0)
+        return false;
+    _header = header;
+    _index = indexes;
+    _entries = list;
+    _names = top + header->names;
+    _lengths.clear();
+    for (uint32_t i = 0; i < header->count; i++)
+        _lengths.push_back(_entries[i].length);
+    std::sort(_lengths.begin(), _lengths.end());
+    _lengths.erase(std::unique(_lengths.begin(), _lengths.end()), _lengths.end());
+    return true;
+}
+
+const char *SignatureDb::lookup(uint64_t hash, uint16_t length) const {
+    if (_header == nullptr)
+        return nullptr;
+    const auto bucket = bucketOf(hash, _header->bits);
+    const auto end = _entries + _index[bucket + 1];
+    for (auto e = std::lower_bound(_entries + _index[bucket], end, hash,
+                 [](const Entry &e, uint64_t hash) { return e.hash < hash; });
+            e < end && e->hash == hash; e++) {
+        if (e->length == length)
+            return _names + e->name;
+    }
+    return nullptr;
+}
+
+std::vector<uint8_t> SignatureDb::build(std::vector<std::pair<Entry, std::string>> routines) {
+    std::sort(routines.begin(), routines.end(),
+            [](const std::pair<Entry, std::string> &a, const std::pair<Entry, std::string> &b) {
+                return a.first.hash < b.first.hash;
+            });
+    Header header;
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.count = routines.size();
+    header.bits = 0;
+    while (header.bits < MAX_BITS && (UINT32_C(1) << header.bits) < header.count)
+        header.bits++;
+    std::vector<uint32_t> index((1 << header.bits) + 1, 0);
+    std::vector<Entry> entries;
+    std::string names;
+    for (auto &routine : routines) {
+        index[bucketOf(routine.first.hash, header.bits) + 1]++;
+        routine.first.name = names.size();
+        routine.first.reserved = 0;
+        entries.push_back(routine.first);
+        names.append(routine.second).push_back(0);
+    }
+    for (size_t i = 1; i < index.size(); i++)
+        index[i] += index[i - 1];
+    header.names = entriesOffset(header.bits) + entries.size() * sizeof(Entry);
+    header.size = header.names + names.size();
+
+    std::vector<uint8_t> image;
+    auto append = [&image](const void *p, size_t n) {
+        const auto bytes = static_cast<const uint8_t *>(p);
+        image.insert(image.end(), bytes, bytes + n);
+    };
+    append(&header, sizeof(header));
+    append(index.data(), index.size() * sizeof(uint32_t));
+    image.resize(entriesOffset(header.bits), 0);
+    append(entries.data(), entries.size() * sizeof(Entry));
+    append(names.data(), names.size());
+    return image;
+}
+
+SignatureMatcher::SignatureMatcher(Disassembler &disassembler, const SignatureDb &db)
+    : _disassembler(disassembler), _db(db) {}
+
+size_t SignatureMatcher::match(const BinMemory &memory) {
+    _symbols.clear();
+    const auto &lengths = _db.lengths();
+    if (lengths.empty())
+        return 0;
+    const auto unit = _disassembler.config().addressUnit();
+    SignatureHasher hasher(_disassembler, memory);
+    for (const auto &block : memory) {
+        const auto end = block.base + block.data.size();
+        for (auto addr = block.base; addr < end;) {
+            const char *name = nullptr;
+            const auto length = hasher.hash(addr, lengths.back(), [&](uint16_t n, uint64_t hash) {
+                if (name == nullptr && std::binary_search(lengths.begin(), lengths.end(), n))
+                    name = _db.lookup(hash, n);
+            });
+            if (name)
+                _symbols.emplace(addr / unit, name);
+            addr += length ? length : static_cast<uint32_t>(unit);
+        }
+    }
+    _disassembler.resetError();
+    return _symbols.size();
+}
+
+const char *SignatureMatcher::lookupValue(uint32_t address) const {
+    const auto it = _symbols.find(address);
+    return it == _symbols.end() ? nullptr : it->second;
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
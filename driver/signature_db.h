@@ -0,0 +1,168 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SIGNATURE_DB_H__
+#define __SIGNATURE_DB_H__
+
+#include "bin_memory.h"
+#include "dis_base.h"
+#include "symbol_table.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/**
+ * Hash instruction sequences of a memory image so that they are equal
+ * wherever the sequence is located. A bit of an instruction is masked when
+ * flipping it changes only numbers in operands, such as an address, an
+ * immediate or a displacement; a ROM image has no relocation records.
+ */
+class SignatureHasher {
+public:
+    SignatureHasher(Disassembler &disassembler, const BinMemory &memory);
+
+    /**
+     * Hash instructions from byte address |addr| and call |visit(length, hash)| at each
+     * instruction boundary until |maxLength| bytes. Returns byte length of the first
+     * instruction, or zero when it can't be decoded.
+     */
+    template <typename VISIT>
+    uint8_t hash(uint32_t addr, uint16_t maxLength, VISIT visit) {
+        uint64_t hash = FNV_BASIS;
+        uint16_t length = 0;
+        uint8_t first = 0;
+        while (length < maxLength) {
+            const auto &insn = insnAt(addr + length);
+            if (insn.bytes.empty())
+                break;
+            if (first == 0)
+                first = insn.bytes.size();
+            for (size_t i = 0; i < insn.bytes.size(); i++) {
+                hash = (hash ^ insn.bytes[i]) * FNV_PRIME;
+                hash = (hash ^ insn.mask[i]) * FNV_PRIME;
+            }
+            length += insn.bytes.size();
+            if (length <= maxLength)
+                visit(length, hash);
+        }
+        return first;
+    }
+
+private:
+    static constexpr uint64_t FNV_BASIS = UINT64_C(0xcbf29ce484222325);
+    static constexpr uint64_t FNV_PRIME = UINT64_C(0x100000001b3);
+
+    Disassembler &_disassembler;
+    const BinMemory &_memory;
+    struct Masked {
+        std::vector<uint8_t> bytes;  // masked bytes; empty when undecodable
+        std::vector<uint8_t> mask;
+    };
+    std::unordered_map<uint32_t, Masked> _cache;
+
+    const Masked &insnAt(uint32_t addr);
+};
+
+/**
+ * Signature database file, which is mapped into memory as is. Integers are
+ * in host byte order.
+ *
+ *   Header
+ *   uint32_t index[(1 << bits) + 1]  first entry of each bucket of hash top |bits|
+ *   Entry entries[count]             sorted by hash, 8 bytes aligned
+ *   char names[]                     NUL terminated names
+ */
+class SignatureDb {
+public:
+    struct Header {
+        char magic[8];
+        uint32_t count;
+        uint32_t bits;
+        uint32_t names;  // offset of names from the top of file
+        uint32_t size;   // size of file
+    };
+    struct Entry {
+        uint64_t hash;
+        uint32_t name;    // offset of name in names
+        uint16_t length;  // byte length of hashed instructions
+        uint16_t reserved;
+    };
+
+    SignatureDb();
+
+    /**
+     * Attach to a file image at |base| of |size|; returns false when it isn't a
+     * database, or its index, entries or names are out of range.
+     */
+    bool attach(const void *base, size_t size);
+    uint32_t size() const { return _header ? _header->count : 0; }
+    /** distinct lengths of entries in ascending order */
+    const std::vector<uint16_t> &lengths() const { return _lengths; }
+    /** returns name of routine which has |hash| of |length| bytes, or nullptr */
+    const char *lookup(uint64_t hash, uint16_t length) const;
+
+    /** returns file image of database of |routines| */
+    static std::vector<uint8_t> build(std::vector<std::pair<Entry, std::string>> routines);
+
+private:
+    const Header *_header;
+    const uint32_t *_index;
+    const Entry *_entries;
+    const char *_names;
+    std::vector<uint16_t> _lengths;
+};
+
+/**
+ * Recognize routines of a |SignatureDb| at instruction boundaries of a
+ * linear sweep of a memory image, and name them as symbols.
+ */
+class SignatureMatcher final : public SymbolTable {
+public:
+    SignatureMatcher(Disassembler &disassembler, const SignatureDb &db);
+
+    /** returns the number of routines recognized in |memory| */
+    size_t match(const BinMemory &memory);
+    const std::map<uint32_t, const char *> &symbols() const { return _symbols; }
+
+    // SymbolTable
+    const char *lookupValue(uint32_t address) const override;
+    bool hasSymbol(const StrScanner &) const override { return false; }
+    uint32_t lookupSymbol(const StrScanner &) const override { return 0; }
+    const void *lookupFunction(const StrScanner &) const override { return nullptr; }
+
+private:
+    Disassembler &_disassembler;
+    const SignatureDb &_db;
+    std::map<uint32_t, const char *> _symbols;
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
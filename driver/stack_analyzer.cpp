@@ -0,0 +1,129 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stack_analyzer.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace libasm {
+namespace driver {
+
+namespace {
+
+constexpr uint8_t NEW = 0;
+constexpr uint8_t ACTIVE = 1;
+constexpr uint8_t DONE = 2;
+
+void setStatus(StackAnalyzer::Depth &depth, DepthStatus status, uint32_t at) {
+    if (depth.status == DEPTH_OK) {
+        depth.status = status;
+        depth.at = at;
+    }
+}
+
+}  // namespace
+
+StackAnalyzer::StackAnalyzer(const FlowGraph &graph) : _graph(graph) {}
+
+void StackAnalyzer::analyze() {
+    const auto size = _graph.functions().size();
+    _depths.assign(size, Depth{0, DEPTH_OK, 0});
+    _states.assign(size, NEW);
+    for (size_t func = 0; func < size; func++) {
+        if (_states[func] == NEW)
+            analyze(func);
+    }
+}
+
+void StackAnalyzer::analyze(int32_t func) {
+    const auto &insns = _graph.insns();
+    const auto &blocks = _graph.blocks();
+    auto &depth = _depths[func];
+    _states[func] = ACTIVE;
+    const auto entry = _graph.functions()[func].block;
+    if (entry == FlowGraph::NONE) {
+        setStatus(depth, DEPTH_UNKNOWN_TARGET, _graph.functions()[func].entry);
+        _states[func] = DONE;
+        return;
+    }
+
+    // Propagate the deepest depth at the entry of each block. A depth which keeps
+    // growing after every block has been updated as many times as blocks exist
+    // means the stack grows in a loop.
+    std::unordered_map<int32_t, int32_t> depths{{entry, 0}};
+    std::unordered_map<int32_t, uint32_t> updates;
+    std::vector<int32_t> work{entry};
+    int64_t peak = 0;
+    while (!work.empty()) {
+        const auto b = work.back();
+        work.pop_back();
+        const auto &block = blocks[b];
+        int32_t d = depths[b];
+        for (auto n = block.first; n < block.end; n++) {
+            const auto &flow = insns[n].flow;
+            if (flow.type == FLOW_CALL) {
+                int64_t callee = 0;
+                if (block.callee == FlowGraph::NONE) {
+                    setStatus(depth, DEPTH_UNKNOWN_TARGET, insns[n].address);
+                } else if (_states[block.callee] == ACTIVE) {
+                    setStatus(depth, DEPTH_RECURSION, insns[n].address);
+                } else {
+                    if (_states[block.callee] == NEW)
+                        analyze(block.callee);
+                    const auto &result = _depths[block.callee];
+                    callee = result.bytes;
+                    setStatus(depth, result.status, result.at);
+                }
+                peak = std::max(peak, d + flow.stack + callee);
+            } else if (flow.type == FLOW_RETURN) {
+                // Popping return frame ends this path, a conditional return continues.
+            } else if (flow.stack == STACK_UNKNOWN) {
+                if (d != 0)
+                    setStatus(depth, DEPTH_UNKNOWN_POINTER, insns[n].address);
+                d = 0;
+            } else {
+                d += flow.stack;
+                peak = std::max<int64_t>(peak, d);
+            }
+        }
+        for (const auto s : {block.next, block.jump}) {
+            if (s == FlowGraph::NONE)
+                continue;
+            const auto it = depths.find(s);
+            if (it != depths.end() && it->second >= d)
+                continue;
+            if (++updates[s] > blocks.size()) {
+                setStatus(depth, DEPTH_UNBOUNDED, insns[blocks[s].first].address);
+                continue;
+            }
+            depths[s] = d;
+            work.push_back(s);
+        }
+    }
+    depth.bytes = std::min<int64_t>(peak, UINT32_MAX);
+    _states[func] = DONE;
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
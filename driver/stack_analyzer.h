@@ -0,0 +1,75 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __STACK_ANALYZER_H__
+#define __STACK_ANALYZER_H__
+
+#include "flow_graph.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+enum DepthStatus : uint8_t {
+    DEPTH_OK = 0,
+    DEPTH_UNKNOWN_TARGET = 1,   // call target is unknown or can't be decoded
+    DEPTH_UNKNOWN_POINTER = 2,  // stack pointer is loaded while stack is in use
+    DEPTH_UNBOUNDED = 3,        // stack grows in a loop
+    DEPTH_RECURSION = 4,        // function calls itself
+};
+
+/**
+ * Static maximum stack depth of functions in a |FlowGraph|.
+ *
+ * Depth is counted in bytes from the stack pointer at the entry of a
+ * function, and includes return frames pushed by calls and the depth of
+ * their callees. Loading the stack pointer starts a new stack.
+ */
+class StackAnalyzer {
+public:
+    StackAnalyzer(const FlowGraph &graph);
+
+    void analyze();
+
+    struct Depth {
+        uint32_t bytes;      // maximum depth including callees
+        DepthStatus status;  // why |bytes| may not be the upper bound
+        uint32_t at;         // address where |status| is detected
+    };
+    /** returns maximum depth of |function| index of |FlowGraph| */
+    const Depth &depth(int32_t function) const { return _depths[function]; }
+
+private:
+    const FlowGraph &_graph;
+    std::vector<Depth> _depths;
+    std::vector<uint8_t> _states;
+
+    void analyze(int32_t function);
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
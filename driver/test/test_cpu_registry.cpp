@@ -0,0 +1,135 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asm_directive.h"
+#include "asm_driver.h"
+#include "asm_mc6809.h"
+#include "asm_z80.h"
+#include "cpu_registry.h"
+#include "table_mc6809.h"
+#include "table_z80.h"
+#include "test_driver_helper.h"
+#include "test_sources.h"
+
+#include <memory>
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+template <typename ASM, typename DIRECTIVE, typename CPUTYPE>
+struct CountedAsm : CpuBackend<AsmDirective> {
+    CountedAsm(const InsnTable<CPUTYPE> &table, const CPUTYPE *cpus = nullptr,
+            const CPUTYPE *cpusEnd = nullptr)
+        : _table(table), _cpus(cpus), _cpusEnd(cpusEnd), constructs(0) {}
+
+    const /*PROGMEM*/ char *listCpu_P() const override { return _table.listCpu_P(); }
+    bool accepts(const char *cpu) override { return acceptsCpu(_table, cpu, _cpus, _cpusEnd); }
+    AsmDirective &instance() override {
+        if (!_directive) {
+            constructs++;
+            _assembler.reset(new ASM());
+            _directive.reset(new DIRECTIVE(*_assembler));
+        }
+        return *_directive;
+    }
+    AsmDirective *constructed() override { return _directive.get(); }
+
+    const InsnTable<CPUTYPE> &_table;
+    const CPUTYPE *_cpus;
+    const CPUTYPE *_cpusEnd;
+    std::unique_ptr<ASM> _assembler;
+    std::unique_ptr<DIRECTIVE> _directive;
+    int constructs;
+};
+
+typedef CountedAsm<mc6809::AsmMc6809, MotorolaDirective, mc6809::CpuType> Mc6809Backend;
+typedef CountedAsm<z80::AsmZ80, Z80Directive, z80::CpuType> Z80Backend;
+
+static std::shared_ptr<Mc6809Backend> backend6809;
+static std::shared_ptr<Z80Backend> backendZ80;
+static CpuRegistry<AsmDirective> registry;
+
+void set_up() {
+    backend6809 = std::make_shared<Mc6809Backend>(mc6809::TABLE);
+    backendZ80 = std::make_shared<Z80Backend>(z80::TABLE);
+    registry = CpuRegistry<AsmDirective>();
+    registry.add(backend6809);
+    registry.add(backendZ80);
+}
+
+void tear_down() {}
+
+void test_search() {
+    const auto found = registry.search("z80");
+    TRUE("z80", found != nullptr);
+    TRUE("z80", found->get() == backendZ80.get());
+    TRUE("Z80", registry.search("Z80")->get() == backendZ80.get());
+    TRUE("6309", registry.search("6309")->get() == backend6809.get());
+    TRUE("unknown", registry.search("6502") == nullptr);
+    EQ("mc6809", 0, backend6809->constructs);
+    EQ("z80", 0, backendZ80->constructs);
+}
+
+void test_search_selected() {
+    static constexpr z80::CpuType Z80_ONLY[] = {z80::Z80};
+    const auto z80only = std::make_shared<Z80Backend>(z80::TABLE, ARRAY_RANGE(Z80_ONLY));
+    CpuRegistry<AsmDirective> selected;
+    selected.add(backend6809);
+    selected.add(z80only);
+    TRUE("z80", selected.search("z80")->get() == z80only.get());
+    TRUE("8080", selected.search("8080") == nullptr);
+    TRUE("8085", selected.search("8085") == nullptr);
+    TRUE("6309", selected.search("6309")->get() == backend6809.get());
+    EQ("z80", 0, z80only->constructs);
+}
+
+void test_driver_constructs_on_demand() {
+    TestSources sources;
+    AsmDriver driver(registry, sources);
+    EQ("default", 1, backend6809->constructs);
+    EQ("not yet", 0, backendZ80->constructs);
+    TRUE("list", driver.listCpu().size() > 2);
+    EQ("list", 0, backendZ80->constructs);
+
+    TRUE("switch", driver.setCpu("z80") != nullptr);
+    EQ("z80", 1, backendZ80->constructs);
+    EQ("z80 cpu", "Z80", driver.current()->assembler().cpu_P());
+
+    TRUE("back", driver.setCpu("6809") != nullptr);
+    TRUE("again", driver.setCpu("Z80") != nullptr);
+    EQ("once 6809", 1, backend6809->constructs);
+    EQ("once z80", 1, backendZ80->constructs);
+
+    TRUE("unknown", driver.setCpu("8086") == nullptr);
+}
+
+void run_tests() {
+    RUN_TEST(test_search);
+    RUN_TEST(test_search_selected);
+    RUN_TEST(test_driver_constructs_on_demand);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
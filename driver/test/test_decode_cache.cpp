@@ -0,0 +1,137 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bin_memory.h"
+#include "decode_cache.h"
+#include "dis_mc6809.h"
+#include "dis_z80.h"
+#include "test_driver_helper.h"
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+static const DecodeCache::Entry &decode(
+        DecodeCache &cache, Disassembler &dis, const BinMemory &memory, uint32_t addr) {
+    auto reader = memory.reader(addr);
+    return cache.decode(dis, reader, addr);
+}
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_hit() {
+    z80::DisZ80 dis;
+    BinMemory memory;
+    write(memory, 0x1000, {0x21, 0x34, 0x12, 0x00, 0xC3, 0x00, 0x10});  // LD HL; NOP; JP
+    DecodeCache cache;
+
+    auto &ld = decode(cache, dis, memory, 0x1000);
+    EQ("ld", OK, ld.error);
+    EQ("ld", "LD", ld.name.c_str());
+    EQ("ld", "HL, 1234H", ld.operands.c_str());
+    EQ("ld", 3, ld.length());
+    EQ("ld", 0x21, ld.bytes[0]);
+    EQ("miss", 1, cache.misses());
+    TRUE("hit", &ld == &decode(cache, dis, memory, 0x1000));
+    EQ("hit", 1, cache.hits());
+    EQ("size", 1, cache.size());
+
+    // Not cached when instruction runs out of memory.
+    EQ("djnz", NO_MEMORY, decode(cache, dis, memory, 0x1006).error);
+    EQ("djnz", 1, cache.size());
+}
+
+void test_invalidate() {
+    z80::DisZ80 dis;
+    BinMemory memory;
+    write(memory, 0x1000, {0x21, 0x34, 0x12, 0x00, 0xC3, 0x00, 0x10});  // LD HL; NOP; JP
+    DecodeCache cache;
+    decode(cache, dis, memory, 0x1000);
+    decode(cache, dis, memory, 0x1003);
+    decode(cache, dis, memory, 0x1004);
+    EQ("size", 3, cache.size());
+
+    cache.invalidate(0x0FFF);
+    cache.invalidate(0x1007, 0x100);
+    EQ("outside", 3, cache.size());
+
+    // Self modifying code patches an operand of LD, which straddles it.
+    memory.writeByte(0x1002, 0x56);
+    cache.invalidate(0x1002);
+    EQ("straddle", 2, cache.size());
+    EQ("patched", "HL, 5634H", decode(cache, dis, memory, 0x1000).operands.c_str());
+    EQ("patched", 4, cache.misses());
+
+    memory.writeByte(0x1003, 0x76);
+    cache.invalidate(0x1003);
+    EQ("halt", "HALT", decode(cache, dis, memory, 0x1003).name.c_str());
+    EQ("ld kept", 3, cache.size());
+
+    cache.invalidate(0x0FF0, 0x20);
+    EQ("range", 0, cache.size());
+}
+
+void test_cpus() {
+    z80::DisZ80 z80;
+    mc6809::DisMc6809 mc6809;
+    BinMemory memory;
+    write(memory, 0x1000, {0x86, 0x12, 0x00});  // Z80: ADD A,(HL); LD (DE),A; 6809: LDA #$12
+    DecodeCache cache;
+
+    EQ("z80", "ADD", decode(cache, z80, memory, 0x1000).name.c_str());
+    EQ("6809", "LDA", decode(cache, mc6809, memory, 0x1000).name.c_str());
+    EQ("z80", "LD", decode(cache, z80, memory, 0x1001).name.c_str());
+    EQ("size", 3, cache.size());
+
+    // A write to the operand of LDA doesn't drop ADD, but does LDA and LD.
+    cache.invalidate(0x1001);
+    EQ("size", 1, cache.size());
+    EQ("z80", "ADD", decode(cache, z80, memory, 0x1000).name.c_str());
+    EQ("hits", 1, cache.hits());
+}
+
+void test_capacity() {
+    z80::DisZ80 dis;
+    BinMemory memory;
+    for (uint32_t addr = 0; addr < 0x100; addr++)
+        memory.writeByte(addr, 0x00);  // NOP
+    DecodeCache cache(16);
+    for (uint32_t addr = 0; addr < 0x100; addr++)
+        decode(cache, dis, memory, addr);
+    TRUE("capacity", cache.size() <= 16);
+    EQ("last", 0xFF, decode(cache, dis, memory, 0xFF).addr);
+    EQ("hits", 1, cache.hits());
+}
+
+void run_tests() {
+    RUN_TEST(test_hit);
+    RUN_TEST(test_invalidate);
+    RUN_TEST(test_cpus);
+    RUN_TEST(test_capacity);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
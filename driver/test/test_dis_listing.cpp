@@ -0,0 +1,133 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bin_memory.h"
+#include "dis_driver.h"
+#include "dis_formatter.h"
+#include "dis_listing.h"
+#include "dis_z80.h"
+#include "stored_printer.h"
+#include "test_driver_helper.h"
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+static void image(BinMemory &memory) {
+    write(memory, 0x1000, {0x21, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01});
+    write(memory, 0x1009, {0xCD, 0x00, 0x20, 0xED, 0xB0, 0xC9});
+    write(memory, 0x2000, {0x00, 0x00, 0xC9});
+}
+
+static z80::DisZ80 dis;
+static Disassembler *disp = &dis;
+
+/** Check |listing| prints the same as disassembling |memory| from scratch. */
+static void same(const char *msg, const DisListing &listing, const BinMemory &memory) {
+    DisFormatter formatter(dis, "test.bin");
+    DisDriver driver(&disp, &disp + 1);
+    StoredPrinter output, listout, errorout;
+    driver.disassemble(memory, 0, UINT32_MAX, formatter, output, listout, errorout);
+    StoredPrinter out, list, err;
+    listing.print(out, list, err);
+    EQ(msg, output.size(), out.size());
+    for (size_t i = 1; i <= output.size() && i <= out.size(); i++)
+        EQ(msg, output.line(i), out.line(i));
+    EQ(msg, listout.size(), list.size());
+    for (size_t i = 1; i <= listout.size() && i <= list.size(); i++)
+        EQ(msg, listout.line(i), list.line(i));
+    EQ(msg, errorout.size(), err.size());
+}
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_disassemble() {
+    BinMemory memory;
+    image(memory);
+    DisFormatter formatter(dis, "test.bin");
+    DisListing listing(dis, formatter);
+    listing.disassemble(memory, 0, UINT32_MAX);
+    EQ("size", 12, listing.size());
+    same("full", listing, memory);
+}
+
+void test_patch() {
+    BinMemory memory;
+    image(memory);
+    DisFormatter formatter(dis, "test.bin");
+    DisListing listing(dis, formatter);
+    listing.disassemble(memory, 0, UINT32_MAX);
+
+    // Patch an operand; only LD HL,nn is disassembled again.
+    memory.writeByte(0x1002, 0x56);
+    EQ("operand", 1, listing.patch(memory, 0x1002));
+    same("operand", listing, memory);
+
+    // NOP becomes LD BC,nn which swallows two NOPs.
+    memory.writeByte(0x1003, 0x01);
+    EQ("longer", 1, listing.patch(memory, 0x1003));
+    EQ("longer", 10, listing.size());
+    same("longer", listing, memory);
+
+    // LD A,n becomes NOP, and its operand becomes LD BC,nn until RET.
+    memory.writeByte(0x1007, 0x00);
+    EQ("shorter", 4, listing.patch(memory, 0x1007));
+    EQ("shorter", 11, listing.size());
+    same("shorter", listing, memory);
+
+    // A patch range over two blocks.
+    memory.writeByte(0x100E, 0x00);
+    memory.writeByte(0x2000, 0xC9);
+    EQ("blocks", 2, listing.patch(memory, 0x100E, 0x2001 - 0x100E));
+    same("blocks", listing, memory);
+
+    // Illegal instruction is re-synchronized too.
+    memory.writeByte(0x100C, 0xED);
+    memory.writeByte(0x100D, 0xFF);
+    TRUE("illegal", listing.patch(memory, 0x100C, 2) >= 1);
+    same("illegal", listing, memory);
+}
+
+void test_layout_changed() {
+    BinMemory memory;
+    image(memory);
+    DisFormatter formatter(dis, "test.bin");
+    DisListing listing(dis, formatter);
+    listing.disassemble(memory, 0, UINT32_MAX);
+
+    write(memory, 0x2003, {0x00, 0x00});
+    EQ("whole", 14, listing.patch(memory, 0x2003, 2));
+    same("whole", listing, memory);
+}
+
+void run_tests() {
+    RUN_TEST(test_disassemble);
+    RUN_TEST(test_patch);
+    RUN_TEST(test_layout_changed);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bin_memory.h"
+#include "dis_driver.h"
+#include "dis_formatter.h"
+#include "dis_stream.h"
+#include "dis_tms32010.h"
+#include "dis_z80.h"
+#include "stored_printer.h"
+#include "test_driver_helper.h"
+
+#include <algorithm>
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+/** Feed |memory| to |stream| by |chunk| bytes. */
+static void feed(DisStream &stream, const BinMemory &memory, size_t chunk) {
+    for (const auto &it : memory) {
+        for (size_t i = 0; i < it.data.size(); i += chunk) {
+            const auto size = std::min(chunk, it.data.size() - i);
+            stream.feed(it.base + i, it.data.data() + i, size);
+        }
+    }
+    stream.flush();
+}
+
+/** Check streaming |memory| prints the same as disassembling it in memory. */
+static void same(const char *msg, Disassembler &dis, const BinMemory &memory, size_t chunk,
+        uint32_t dis_start = 0, uint32_t dis_end = UINT32_MAX) {
+    Disassembler *disp = &dis;
+    DisDriver driver(&disp, &disp + 1);
+    DisFormatter formatter(dis, "test.bin");
+    StoredPrinter output, listout, errorout;
+    driver.disassemble(memory, dis_start, dis_end, formatter, output, listout, errorout);
+    DisFormatter streamer(dis, "test.bin");
+    StoredPrinter out, list, err;
+    DisStream stream(dis, streamer, out, list, err, dis_start, dis_end);
+    feed(stream, memory, chunk);
+    EQ(msg, output.size(), out.size());
+    for (size_t i = 1; i <= output.size() && i <= out.size(); i++)
+        EQ(msg, output.line(i), out.line(i));
+    EQ(msg, listout.size(), list.size());
+    for (size_t i = 1; i <= listout.size() && i <= list.size(); i++)
+        EQ(msg, listout.line(i), list.line(i));
+    EQ(msg, errorout.size(), err.size());
+    for (size_t i = 1; i <= errorout.size() && i <= err.size(); i++)
+        EQ(msg, errorout.line(i), err.line(i));
+}
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_z80() {
+    z80::DisZ80 dis;
+    BinMemory memory;
+    write(memory, 0x1000, {0x21, 0x34, 0x12, 0x00, 0x3E, 0x01, 0xDD, 0xCB, 0x05, 0xC6});
+    write(memory, 0x100A, {0xCD, 0x00, 0x20, 0xED, 0xB0, 0xED, 0xFF, 0xC9});
+    write(memory, 0x2000, {0x00, 0x00, 0xC9, 0xFD, 0x21, 0x34});  // truncated LD IY,nn
+
+    DisFormatter formatter(dis, "test.bin");
+    StoredPrinter output, listout, errorout;
+    DisStream stream(dis, formatter, output, listout, errorout);
+    EQ("capacity", 4, stream.capacity());
+
+    for (const auto chunk : {1, 2, 3, 5, 16})
+        same("chunk", dis, memory, chunk);
+    same("start", dis, memory, 3, 0x1004);
+    same("end", dis, memory, 3, 0, 0x1006);
+    same("range", dis, memory, 2, 0x1006, 0x2001);
+}
+
+void test_tms32010() {
+    tms32010::DisTms32010 dis;
+    BinMemory memory;
+    write(memory, 0x0200, {0x7F, 0x8B, 0xF9, 0x00, 0x01, 0x23, 0x20, 0x01});
+    write(memory, 0x0400, {0xF4, 0x00, 0x03, 0x00, 0xF9, 0x00});  // truncated B
+
+    for (const auto chunk : {1, 2, 3, 8})
+        same("chunk", dis, memory, chunk);
+    same("range", dis, memory, 1, 0x102, 0x200);
+}
+
+void run_tests() {
+    RUN_TEST(test_z80);
+    RUN_TEST(test_tms32010);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
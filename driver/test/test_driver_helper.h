@@ -17,12 +17,21 @@
 #ifndef __TEST_DRIVER_HELPER_H__
 #define __TEST_DRIVER_HELPER_H__
 
+#include "bin_memory.h"
 #include "test_asserter.h"
 
+#include <initializer_list>
+
 namespace libasm {
 namespace driver {
 namespace test {
 
+/** write |bytes| into |memory| from |addr| */
+inline void write(BinMemory &memory, uint32_t addr, const std::initializer_list<uint8_t> &bytes) {
+    for (const auto val : bytes)
+        memory.writeByte(addr++, val);
+}
+
 void run_tests();
 
 extern libasm::test::TestAsserter asserter;
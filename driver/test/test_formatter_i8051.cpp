@@ -15,6 +15,7 @@
  */
 
 #include "asm_i8051.h"
+#include "cycles_i8051.h"
 #include "dis_i8051.h"
 #include "test_formatter_helper.h"
 
@@ -62,9 +63,29 @@ void test_dis_i8051() {
             0xb0, 0xb1, 0xa5);
 }
 
+void test_cycles_i8051() {
+    PREP_ASM(i8051::AsmI8051, IntelDirective);
+    listing.addCycleCounter(i8051::CYCLES);
+
+    ASM("i8051",
+            "        cpu   8051\n"
+            "        org   0\n"
+            "loop:   mov   a, #1\n"
+            "        djnz  r7, loop\n"
+            "        mul   ab\n"
+            "        lcall loop\n",
+            "          0 :                                            cpu   8051\n"
+            "          0 :                                            org   0\n"
+            "          0 : 74 01                   1        1 loop:   mov   a, #1\n"
+            "          2 : DF FC                   2        3         djnz  r7, loop\n"
+            "          4 : A4                      4        7         mul   ab\n"
+            "          5 : 12 00 00                2        9         lcall loop\n");
+}
+
 void run_tests() {
     RUN_TEST(test_asm_i8051);
     RUN_TEST(test_dis_i8051);
+    RUN_TEST(test_cycles_i8051);
 }
 
 }  // namespace test
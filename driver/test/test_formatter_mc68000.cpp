@@ -15,6 +15,7 @@
  */
 
 #include "asm_mc68000.h"
+#include "cycles_mc68000.h"
 #include "dis_mc68000.h"
 #include "test_formatter_helper.h"
 
@@ -94,9 +95,37 @@ void test_dis_mc68000() {
     EQ("org", OPERAND_NOT_ALIGNED, listing.setOrigin(0xABCDEF));
 }
 
+void test_cycles_mc68000() {
+    PREP_ASM(mc68000::AsmMc68000, MotorolaDirective);
+    listing.addCycleCounter(mc68000::CYCLES);
+
+    ASM("mc68000",
+            "        cpu   68000\n"
+            "        org   $1000\n"
+            "start:  move.l d0, d1\n"
+            "        move.w (a0)+, -(a1)\n"
+            "        add.l  #1, d0\n"
+            "        lsl.w  #3, d2\n"
+            "        movem.l d0-d7, -(a7)\n"
+            "        bne    start\n"
+            "        divu   d1, d2\n"
+            "        rts\n",
+            "          0 :                                            cpu   68000\n"
+            "       1000 :                                            org   $1000\n"
+            "       1000 : 2200                    4        4 start:  move.l d0, d1\n"
+            "       1002 : 3318                   12       16         move.w (a0)+, -(a1)\n"
+            "       1004 : D0BC 0000 0001         16       32         add.l  #1, d0\n"
+            "       100A : E74A                   12       44         lsl.w  #3, d2\n"
+            "       100C : 48E7 FF00              72      116         movem.l d0-d7, -(a7)\n"
+            "       1010 : 66EE                 8-10  124-126         bne    start\n"
+            "       1012 : 84C1                  140  264-266         divu   d1, d2\n"
+            "       1014 : 4E75                   16  280-282         rts\n");
+}
+
 void run_tests() {
     RUN_TEST(test_asm_mc68000);
     RUN_TEST(test_dis_mc68000);
+    RUN_TEST(test_cycles_mc68000);
 }
 
 }  // namespace test
@@ -15,6 +15,7 @@
  */
 
 #include "asm_mc6809.h"
+#include "cycles_mc6809.h"
 #include "dis_mc6809.h"
 #include "test_formatter_helper.h"
 
@@ -85,9 +86,33 @@ void test_dis_mc6809() {
             0x10, 0xA3, 0xB9, 0x12, 0x34, 0x01, 0xA6, 0x87);
 }
 
+void test_cycles_mc6809() {
+    PREP_ASM(mc6809::AsmMc6809, MotorolaDirective);
+    listing.addCycleCounter(mc6809::CYCLES);
+
+    ASM("mc6809",
+            "        cpu   6809\n"
+            "        org   $1000\n"
+            "loop:   lda   ,x+\n"
+            "        ldd   [$10,y]\n"
+            "        pshs  a,b,x\n"
+            "        lbne  loop\n"
+            "        swi2\n"
+            "        rti\n",
+            "          0 :                                            cpu   6809\n"
+            "       1000 :                                            org   $1000\n"
+            "       1000 : A6 80                   6        6 loop:   lda   ,x+\n"
+            "       1002 : EC B8 10                9       15         ldd   [$10,y]\n"
+            "       1005 : 34 16                   9       24         pshs  a,b,x\n"
+            "       1007 : 10 26 FF F5           5-6    29-30         lbne  loop\n"
+            "       100B : 10 3F                  20    49-50         swi2\n"
+            "       100D : 3B                   6-15    55-65         rti\n");
+}
+
 void run_tests() {
     RUN_TEST(test_asm_mc6809);
     RUN_TEST(test_dis_mc6809);
+    RUN_TEST(test_cycles_mc6809);
 }
 
 }  // namespace test
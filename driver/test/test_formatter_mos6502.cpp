@@ -15,6 +15,7 @@
  */
 
 #include "asm_mos6502.h"
+#include "cycles_mos6502.h"
 #include "dis_mos6502.h"
 #include "test_formatter_helper.h"
 
@@ -106,11 +107,33 @@ void test_dis_w65816() {
             0xef, 0xf0, 0xf1, 0xf2, 0x69, 0x34, 0x12, 0x82, 0xFF, 0x7F);
 }
 
+void test_cycles_mos6502() {
+    PREP_ASM(mos6502::AsmMos6502, MostekDirective);
+    listing.addCycleCounter(mos6502::CYCLES);
+
+    ASM("mos6502",
+            "        cpu   6502\n"
+            "        org   $1000\n"
+            "loop:   lda   $2000,x\n"
+            "        sta   ($10),y\n"
+            "        bne   loop\n"
+            "        jsr   loop\n"
+            "        rts\n",
+            "          0 :                                            cpu   6502\n"
+            "       1000 :                                            org   $1000\n"
+            "       1000 : BD 00 20              4-5      4-5 loop:   lda   $2000,x\n"
+            "       1003 : 91 10                   6    10-11         sta   ($10),y\n"
+            "       1005 : D0 F9                 2-4    12-15         bne   loop\n"
+            "       1007 : 20 00 10                6    18-21         jsr   loop\n"
+            "       100A : 60                      6    24-27         rts\n");
+}
+
 void run_tests() {
     RUN_TEST(test_asm_mos6502);
     RUN_TEST(test_asm_w65816);
     RUN_TEST(test_dis_mos6502);
     RUN_TEST(test_dis_w65816);
+    RUN_TEST(test_cycles_mos6502);
 }
 
 }  // namespace test
@@ -15,6 +15,7 @@
  */
 
 #include "asm_z80.h"
+#include "cycles_z80.h"
 #include "dis_z80.h"
 #include "test_formatter_helper.h"
 
@@ -74,9 +75,56 @@ void test_dis_z80() {
             0xfd, 0xcb, 0x80, 0x86, 0xdd, 0xcb, 0x00, 0xef);
 }
 
+void test_cycles_z80() {
+    PREP_ASM(z80::AsmZ80, Z80Directive);
+    listing.addCycleCounter(z80::CYCLES);
+
+    ASM("z80",
+            "        cpu   z80\n"
+            "        org   1000H\n"
+            "delay:  ld    b, 10\n"
+            "loop:   nop\n"
+            "        djnz  loop\n"
+            "        ret   nz\n"
+            "        ld    (ix+5), a\n"
+            "        db    1, 2, 3\n"
+            "main:   call  delay\n"
+            "        ldir\n",
+            "          0 :                                            cpu   z80\n"
+            "       1000 :                                            org   1000H\n"
+            "       1000 : 06 0A                   7        7 delay:  ld    b, 10\n"
+            "       1002 : 00                      4        4 loop:   nop\n"
+            "       1003 : 10 FD                8-13    12-17         djnz  loop\n"
+            "       1005 : C0                   5-11    17-28         ret   nz\n"
+            "       1006 : DD 77 05               19    36-47         ld    (ix+5), a\n"
+            "       1009 : 01 02 03                                   db    1, 2, 3\n"
+            "       100C : CD 00 10               17       17 main:   call  delay\n"
+            "       100F : ED B0               16-21    33-38         ldir\n");
+}
+
+void test_dis_cycles_z80() {
+    PREP_DIS(z80::DisZ80);
+    listing.addCycleCounter(z80::CYCLES);
+
+    DIS8("z80", 0x1000,
+            "      cpu   z80\n"
+            "      org   1000H\n"
+            "      ld    b, 10\n"
+            "      djnz  1002H\n"
+            "      bit   0, (iy+1)\n",
+            "       0 :                                            cpu   z80\n"
+            "    1000 :                                            org   1000H\n"
+            "    1000 : 06 0A                   7        7         ld    b, 10\n"
+            "    1002 : 10 FE                8-13    15-20         djnz  1002H\n"
+            "    1004 : FD CB 01 46            20    35-40         bit   0, (iy+1)\n",
+            0x06, 0x0a, 0x10, 0xfe, 0xfd, 0xcb, 0x01, 0x46);
+}
+
 void run_tests() {
     RUN_TEST(test_asm_z80);
     RUN_TEST(test_dis_z80);
+    RUN_TEST(test_cycles_z80);
+    RUN_TEST(test_dis_cycles_z80);
 }
 
 }  // namespace test
@@ -0,0 +1,154 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "json_message.h"
+#include "test_driver_helper.h"
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+using cli::JsonRequest;
+using cli::JsonWriter;
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_parse_values() {
+    JsonRequest request;
+    const auto error = request.parse(R"( {"op" : "asm", "address":-4096, "listing":true,)"
+                                     R"( "quiet":false, "id":null,)"
+                                     R"( "bytes":[ 134 , 1 ], "none":[]} )");
+    TRUE("parse", error == nullptr);
+    EQ("op", "asm", request.string("op"));
+    int64_t address = 0;
+    TRUE("address", request.integer("address", address));
+    EQ("address", -4096, address);
+    bool flag = false;
+    TRUE("listing", request.boolean("listing", flag));
+    TRUE("listing", flag);
+    TRUE("quiet", request.boolean("quiet", flag));
+    FALSE("quiet", flag);
+    TRUE("id", request.has("id"));
+    EQ("id", "null", request.raw("id").c_str());
+    const auto bytes = request.array("bytes");
+    TRUE("bytes", bytes != nullptr);
+    EQ("bytes", 2, bytes->size());
+    EQ("bytes 0", 134, bytes->at(0));
+    EQ("bytes 1", 1, bytes->at(1));
+    EQ("bytes", "[ 134 , 1 ]", request.raw("bytes").c_str());
+    EQ("none", 0, request.array("none")->size());
+
+    FALSE("unknown", request.has("unknown"));
+    EQ("unknown", "", request.raw("unknown").c_str());
+    TRUE("not string", request.string("address") == nullptr);
+    FALSE("not integer", request.integer("op", address));
+    FALSE("not boolean", request.boolean("address", flag));
+    TRUE("not array", request.array("op") == nullptr);
+
+    TRUE("empty", request.parse("{}") == nullptr);
+    FALSE("cleared", request.has("op"));
+}
+
+void test_parse_escapes() {
+    JsonRequest request;
+    const auto error =
+            request.parse(R"({"s":"\"\\\/\b\f\n\r\t", "u":"\u0041\u00e9\u3042", "k\"":1})");
+    TRUE("parse", error == nullptr);
+    EQ("s", "\"\\/\b\f\n\r\t", request.string("s"));
+    EQ("u", "A\xC3\xA9\xE3\x81\x82", request.string("u"));
+    EQ("raw", R"("\u0041\u00e9\u3042")", request.raw("u").c_str());
+    TRUE("key", request.has("k\""));
+}
+
+void test_parse_errors() {
+    JsonRequest request;
+    EQ("empty", "'{' expected", request.parse(""));
+    EQ("array", "'{' expected", request.parse("[1]"));
+    EQ("key", "string expected", request.parse("{op:1}"));
+    EQ("colon", "':' expected", request.parse(R"({"op" 1})"));
+    EQ("comma", "',' expected", request.parse(R"({"a":1 "b":2})"));
+    EQ("unterminated", "unterminated string", request.parse(R"({"a":"abc)"));
+    EQ("unterminated key", "unterminated string", request.parse(R"({"a)"));
+    EQ("escape", "illegal escape", request.parse(R"({"a":"\x41"})"));
+    EQ("unicode", "illegal unicode escape", request.parse(R"({"a":"\u00G1"})"));
+    EQ("short unicode", "illegal unicode escape", request.parse(R"({"a":"\u41"})"));
+    EQ("nested", "nested object is not supported", request.parse(R"({"a":{"b":1}})"));
+    EQ("real", "integer expected", request.parse(R"({"a":1.5})"));
+    EQ("exponent", "integer expected", request.parse(R"({"a":1e3})"));
+    EQ("overflow", "integer expected", request.parse(R"({"a":99999999999999999999})"));
+    EQ("value", "integer expected", request.parse(R"({"a":})"));
+    EQ("nested array", "integer expected", request.parse(R"({"a":[[1]]})"));
+    EQ("string element", "integer expected", request.parse(R"({"a":["1"]})"));
+    EQ("array comma", "',' expected", request.parse(R"({"a":[1 2]})"));
+    EQ("garbage", "garbage after object", request.parse(R"({"a":1} x)"));
+}
+
+void test_writer() {
+    JsonWriter writer;
+    writer.beginObject();
+    writer.key("id").integer(-1);
+    writer.key("ok").boolean(true);
+    writer.key("text").string("a\"b\\c\nd\te\x01");
+    writer.key("list").beginArray();
+    writer.beginObject().key("x").integer(1).endObject();
+    writer.beginObject().endObject();
+    writer.beginArray().endArray();
+    writer.raw("null");
+    writer.endArray();
+    writer.key("last").boolean(false);
+    writer.endObject();
+    EQ("json",
+            R"({"id":-1,"ok":true,"text":"a\"b\\c\nd\te\u0001",)"
+            R"("list":[{"x":1},{},[],null],"last":false})",
+            writer.str().c_str());
+}
+
+void test_round_trip() {
+    JsonWriter writer;
+    const char *text = "\"quoted\"\t\\path\\\n\x1F";
+    writer.beginObject().key("text").string(text).key("value").integer(INT64_MIN);
+    writer.key("bytes").beginArray().integer(0).integer(255).endArray().endObject();
+
+    JsonRequest request;
+    TRUE("parse", request.parse(writer.str().c_str()) == nullptr);
+    EQ("text", text, request.string("text"));
+    int64_t value = 0;
+    TRUE("value", request.integer("value", value));
+    TRUE("value", value == INT64_MIN);
+    EQ("bytes", 2, request.array("bytes")->size());
+    EQ("bytes", 255, request.array("bytes")->at(1));
+}
+
+void run_tests() {
+    RUN_TEST(test_parse_values);
+    RUN_TEST(test_parse_escapes);
+    RUN_TEST(test_parse_errors);
+    RUN_TEST(test_writer);
+    RUN_TEST(test_round_trip);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
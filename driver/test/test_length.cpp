@@ -0,0 +1,196 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "array_memory.h"
+#include "dis_i8051.h"
+#include "dis_i8086.h"
+#include "dis_mc68000.h"
+#include "dis_mc6809.h"
+#include "dis_mos6502.h"
+#include "dis_z80.h"
+#include "length_i8051.h"
+#include "length_i8086.h"
+#include "length_mc68000.h"
+#include "length_mc6809.h"
+#include "length_mos6502.h"
+#include "length_z80.h"
+#include "test_driver_helper.h"
+
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+// Operand bytes which cover short and long forms of displacements and
+// postbytes.
+constexpr uint8_t FILLS[] = {0x00, 0x06, 0x46, 0x89, 0x9E, 0xFF};
+
+/**
+ * Check |decoder| decodes the same lengths as |dis| for every opcode
+ * which follows |prefix|. An opcode is two bytes when |opcodes| is more
+ * than 256.
+ */
+static void crossCheck(Disassembler &dis, const LengthDecoder &decoder,
+        const std::initializer_list<uint8_t> &prefix, uint32_t opcodes = 0x100) {
+    uint8_t bytes[16];
+    char operands[80];
+    for (const auto fill : FILLS) {
+        for (uint32_t opc = 0; opc < opcodes; opc++) {
+            memset(bytes, fill, sizeof(bytes));
+            auto pos = 0;
+            for (const auto b : prefix)
+                bytes[pos++] = b;
+            if (opcodes > 0x100)
+                bytes[pos++] = opc >> 8;
+            bytes[pos] = opc;
+            const ArrayMemory memory(0x1000, bytes, sizeof(bytes));
+            auto it = memory.iterator();
+            Insn insn(0x1000);
+            if (dis.decode(it, insn, operands, sizeof(operands)) != OK)
+                continue;
+            const auto actual = decoder.decode(bytes, sizeof(bytes)).length;
+            if (actual != insn.length()) {
+                char hex[16];
+                snprintf(hex, sizeof(hex), "%02X %02X %02X %02X: ", bytes[0], bytes[1], bytes[2],
+                        bytes[3]);
+                const auto msg = std::string(hex) + insn.name() + " " + operands;
+                EQ(msg.c_str(), insn.length(), actual);
+            }
+        }
+    }
+}
+
+static InsnLength decode(
+        const LengthDecoder &decoder, const std::initializer_list<uint8_t> &bytes) {
+    uint8_t buf[16];
+    auto size = 0;
+    for (const auto b : bytes)
+        buf[size++] = b;
+    return decoder.decode(buf, size);
+}
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_z80() {
+    z80::DisZ80 dis;
+    crossCheck(dis, z80::LENGTH, {});
+    crossCheck(dis, z80::LENGTH, {0xCB});
+    crossCheck(dis, z80::LENGTH, {0xED});
+    crossCheck(dis, z80::LENGTH, {0xDD});
+    crossCheck(dis, z80::LENGTH, {0xFD});
+    crossCheck(dis, z80::LENGTH, {0xDD, 0xCB, 0x12});
+    crossCheck(dis, z80::LENGTH, {0xFD, 0xCB, 0x12});
+
+    EQ("JP", 3, decode(z80::LENGTH, {0xC3, 0x00, 0x10}).length);
+    TRUE("JP", decode(z80::LENGTH, {0xC3, 0x00, 0x10}).transfer);
+    FALSE("LD", decode(z80::LENGTH, {0x21, 0x00, 0x10}).transfer);
+    TRUE("JP (IX)", decode(z80::LENGTH, {0xDD, 0xE9}).transfer);
+    TRUE("RETI", decode(z80::LENGTH, {0xED, 0x4D}).transfer);
+    EQ("short", 0, decode(z80::LENGTH, {0xDD, 0xCB, 0x12}).length);
+    EQ("empty", 0, decode(z80::LENGTH, {}).length);
+}
+
+void test_mos6502() {
+    mos6502::DisMos6502 dis;
+    crossCheck(dis, mos6502::LENGTH, {});
+
+    TRUE("JSR", decode(mos6502::LENGTH, {0x20, 0x00, 0x10}).transfer);
+    TRUE("BNE", decode(mos6502::LENGTH, {0xD0, 0xFE}).transfer);
+    FALSE("LDA", decode(mos6502::LENGTH, {0xAD, 0x00, 0x10}).transfer);
+}
+
+void test_mc6809() {
+    mc6809::DisMc6809 dis;
+    crossCheck(dis, mc6809::LENGTH, {});
+    crossCheck(dis, mc6809::LENGTH, {0x10});
+    crossCheck(dis, mc6809::LENGTH, {0x11});
+
+    EQ("LDA [n]", 4, decode(mc6809::LENGTH, {0xA6, 0x9F, 0x10, 0x00}).length);
+    EQ("LDY n,X", 4, decode(mc6809::LENGTH, {0x10, 0xAE, 0x88, 0x10}).length);
+    TRUE("PULS PC", decode(mc6809::LENGTH, {0x35, 0x80}).transfer);
+    FALSE("PULS A", decode(mc6809::LENGTH, {0x35, 0x02}).transfer);
+    TRUE("TFR X,PC", decode(mc6809::LENGTH, {0x1F, 0x15}).transfer);
+    FALSE("TFR X,Y", decode(mc6809::LENGTH, {0x1F, 0x12}).transfer);
+    EQ("short", 0, decode(mc6809::LENGTH, {0xA6}).length);
+}
+
+void test_i8051() {
+    i8051::DisI8051 dis;
+    crossCheck(dis, i8051::LENGTH, {});
+
+    TRUE("LCALL", decode(i8051::LENGTH, {0x12, 0x10, 0x00}).transfer);
+    TRUE("CJNE", decode(i8051::LENGTH, {0xB4, 0x01, 0xFE}).transfer);
+    FALSE("MOV", decode(i8051::LENGTH, {0x74, 0x01}).transfer);
+}
+
+void test_i8086() {
+    i8086::DisI8086 dis;
+    crossCheck(dis, i8086::LENGTH, {});
+    crossCheck(dis, i8086::LENGTH, {0xF3});
+
+    dis.setOption("string-insn", "enable");
+    const i8086::LengthI8086 stringInsn(true);
+    crossCheck(dis, stringInsn, {});
+    crossCheck(dis, stringInsn, {0xF3});
+
+    EQ("MOV [BX+n],n", 6, decode(i8086::LENGTH, {0xC7, 0x87, 0x34, 0x12, 0x78, 0x56}).length);
+    EQ("TEST [n],n", 6, decode(i8086::LENGTH, {0xF7, 0x06, 0x34, 0x12, 0x78, 0x56}).length);
+    TRUE("CALL AX", decode(i8086::LENGTH, {0xFF, 0xD0}).transfer);
+    FALSE("INC AX", decode(i8086::LENGTH, {0xFF, 0xC0}).transfer);
+    EQ("REP", 1, decode(i8086::LENGTH, {0xF3, 0xA4}).length);
+    EQ("REP MOVSB", 2, decode(stringInsn, {0xF3, 0xA4}).length);
+    EQ("short", 0, decode(i8086::LENGTH, {0x8B}).length);
+}
+
+void test_mc68000() {
+    mc68000::DisMc68000 dis;
+    crossCheck(dis, mc68000::LENGTH, {}, 0x10000);
+
+    EQ("MOVE.L #n,(n).L", 10,
+            decode(mc68000::LENGTH, {0x23, 0xFC, 0, 0, 0, 1, 0, 0, 0x10, 0}).length);
+    TRUE("RTS", decode(mc68000::LENGTH, {0x4E, 0x75}).transfer);
+    TRUE("BRA.W", decode(mc68000::LENGTH, {0x60, 0x00, 0x00, 0x10}).transfer);
+    EQ("BRA.W", 4, decode(mc68000::LENGTH, {0x60, 0x00, 0x00, 0x10}).length);
+    TRUE("DBRA", decode(mc68000::LENGTH, {0x51, 0xC8, 0xFF, 0xFE}).transfer);
+    FALSE("NOP", decode(mc68000::LENGTH, {0x4E, 0x71}).transfer);
+    EQ("short", 0, decode(mc68000::LENGTH, {0x4E}).length);
+}
+
+void run_tests() {
+    RUN_TEST(test_z80);
+    RUN_TEST(test_mos6502);
+    RUN_TEST(test_mc6809);
+    RUN_TEST(test_i8051);
+    RUN_TEST(test_i8086);
+    RUN_TEST(test_mc68000);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libasm.h"
+#include "test_driver_helper.h"
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_assembler() {
+    TRUE("unknown", libasm_asm_create("unknown") == nullptr);
+    const auto assembler = libasm_asm_create("z80");
+    TRUE("create", assembler != nullptr);
+    EQ("cpu", "Z80", libasm_asm_cpu(assembler));
+    EQ("option", UNKNOWN_OPTION, libasm_asm_set_option(assembler, "unknown", "on"));
+
+    const char *lines[] = {"LD A, 1", "NOP", "LD A, (IX+200)", "RET"};
+    libasm_encoded results[4];
+    EQ("errors", 1, libasm_encode_lines(assembler, 0x1000, lines, 4, results));
+    EQ("addr 0", 0x1000, results[0].address);
+    EQ("error 0", OK, results[0].error);
+    EQ("length 0", 2, results[0].length);
+    EQ("byte 0", 0x3E, results[0].bytes[0]);
+    EQ("byte 1", 0x01, results[0].bytes[1]);
+    EQ("addr 1", 0x1002, results[1].address);
+    EQ("length 1", 1, results[1].length);
+    EQ("byte 0", 0x00, results[1].bytes[0]);
+    EQ("addr 2", 0x1003, results[2].address);
+    EQ("error 2", OVERFLOW_RANGE, results[2].error);
+    EQ("error at 2", 6, results[2].error_at);
+    EQ("error text", "Overflow range", libasm_error_text(results[2].error));
+    EQ("addr 3", 0x1003, results[3].address);
+    EQ("byte 3", 0xC9, results[3].bytes[0]);
+    libasm_asm_destroy(assembler);
+}
+
+void test_disassembler() {
+    TRUE("unknown", libasm_dis_create("unknown") == nullptr);
+    const auto disassembler = libasm_dis_create("z80");
+    TRUE("create", disassembler != nullptr);
+    EQ("cpu", "Z80", libasm_dis_cpu(disassembler));
+
+    const uint8_t bytes[] = {0xC3, 0x34, 0x12, 0x00, 0x3E};
+    libasm_decoded results[4];
+    EQ("count", 3, libasm_decode_range(disassembler, 0x1000, bytes, sizeof(bytes), results, 4));
+    EQ("addr 0", 0x1000, results[0].address);
+    EQ("error 0", OK, results[0].error);
+    EQ("length 0", 3, results[0].length);
+    EQ("text 0", "JP 1234H", results[0].text);
+    EQ("addr 1", 0x1003, results[1].address);
+    EQ("text 1", "NOP", results[1].text);
+    EQ("addr 2", 0x1004, results[2].address);
+    EQ("error 2", NO_MEMORY, results[2].error);
+    EQ("max", 1, libasm_decode_range(disassembler, 0x1000, bytes, sizeof(bytes), results, 1));
+
+    EQ("option", OK, libasm_dis_set_option(disassembler, "c-style", "on"));
+    EQ("c-style", 1, libasm_decode_range(disassembler, 0x1000, bytes, 3, results, 4));
+    EQ("c-style", "JP 0x1234", results[0].text);
+    EQ("option", UNKNOWN_OPTION, libasm_dis_set_option(disassembler, "unknown", "on"));
+    libasm_dis_destroy(disassembler);
+}
+
+void test_decode_cached() {
+    const auto disassembler = libasm_dis_create("z80");
+    uint8_t memory[] = {0xC3, 0x34, 0x12, 0x00};
+    libasm_decoded result;
+    EQ("decode", OK, libasm_decode_cached(disassembler, 0x2000, memory, sizeof(memory), &result));
+    EQ("addr", 0x2000, result.address);
+    EQ("length", 3, result.length);
+    EQ("text", "JP 1234H", result.text);
+
+    memory[1] = 0x56;  // not notified
+    libasm_decode_cached(disassembler, 0x2000, memory, sizeof(memory), &result);
+    EQ("cached", "JP 1234H", result.text);
+
+    libasm_dis_invalidate(disassembler, 0x2001, 1);
+    libasm_decode_cached(disassembler, 0x2000, memory, sizeof(memory), &result);
+    EQ("invalidated", "JP 1256H", result.text);
+
+    libasm_dis_invalidate(disassembler, 0x2003, 1);
+    libasm_decode_cached(disassembler, 0x2000, memory, sizeof(memory), &result);
+    EQ("other", "JP 1256H", result.text);
+
+    libasm_dis_set_option(disassembler, "c-style", "on");
+    libasm_decode_cached(disassembler, 0x2000, memory, sizeof(memory), &result);
+    EQ("option", "JP 0x1256", result.text);
+    libasm_dis_destroy(disassembler);
+}
+
+void test_long_operands() {
+    const auto disassembler = libasm_dis_create("32032");
+    const uint8_t bytes[] = {
+            0xCE, 0xCF, 0xFF, 0xB7, 0xB6,                     // EXTSD
+            0xE8, 0xFF, 0xEA, 0x4F, 0xE1, 0x60, 0x2B, 0xC6,  // EXT(...)+(...)
+            0xE8, 0xFF, 0xEA, 0x4F, 0xE1, 0x60, 0x2B, 0xC6,  // EXT(...)+(...)
+            0xF8,                                             // 7, 25
+    };
+    const auto text =
+            "EXTSD EXT(-X'170015B1)+(-X'1E9FD43A)[R7:Q], EXT(-X'170015B1)+(-X'1E9FD43A)[R6:Q], "
+            "7, 25";
+    libasm_decoded result;
+    EQ("count", 1, libasm_decode_range(disassembler, 0, bytes, sizeof(bytes), &result, 1));
+    EQ("range", OK, result.error);
+    EQ("range", sizeof(bytes), result.length);
+    EQ("range", text, result.text);
+    EQ("cached", OK, libasm_decode_cached(disassembler, 0, bytes, sizeof(bytes), &result));
+    EQ("cached", text, result.text);
+    libasm_dis_destroy(disassembler);
+}
+
+void run_tests() {
+    RUN_TEST(test_assembler);
+    RUN_TEST(test_disassembler);
+    RUN_TEST(test_decode_cached);
+    RUN_TEST(test_long_operands);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asm_mos6502.h"
+#include "asm_z80.h"
+#include "pattern_search.h"
+#include "test_driver_helper.h"
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+static std::string signature(const Signature &sig) {
+    std::string text;
+    char buf[8];
+    for (size_t i = 0; i < sig.bytes.size(); i++) {
+        if (i)
+            text += ' ';
+        snprintf(buf, sizeof(buf), "%02X/%02X", sig.bytes[i], sig.mask[i]);
+        text += buf;
+    }
+    return text;
+}
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_compile_mos6502() {
+    mos6502::AsmMos6502 assembler;
+    PatternCompiler compiler(assembler);
+    std::vector<Signature> sigs;
+    size_t lineno;
+
+    EQ("literal", OK, compiler.compile("save", {"PHA", "TXA", "PHA"}, sigs, lineno));
+    EQ("literal", 1, sigs.size());
+    EQ("literal", "48/FF 8A/FF 48/FF", signature(sigs[0]).c_str());
+
+    sigs.clear();
+    EQ("forms", OK, compiler.compile("load", {"LDA ?"}, sigs, lineno));
+    EQ("forms", 2, sigs.size());
+    EQ("zero page", "A5/FF 00/00", signature(sigs[0]).c_str());
+    EQ("absolute", "AD/FF 00/00 00/00", signature(sigs[1]).c_str());
+
+    sigs.clear();
+    EQ("loop", OK, compiler.compile("loop", {"LDX #?", "DEX", "BNE ?"}, sigs, lineno));
+    EQ("loop", 1, sigs.size());
+    EQ("loop", "A2/FF 00/00 CA/FF D0/FF 00/00", signature(sigs[0]).c_str());
+
+    sigs.clear();
+    EQ("error", UNKNOWN_INSTRUCTION, compiler.compile("bad", {"NOP", "FOO ?"}, sigs, lineno));
+    EQ("error", 1, lineno);
+    EQ("error", 0, sigs.size());
+}
+
+void test_compile_z80() {
+    z80::AsmZ80 assembler;
+    PatternCompiler compiler(assembler);
+    std::vector<Signature> sigs;
+    size_t lineno;
+
+    EQ("ld", OK, compiler.compile("ld", {"LD HL,?", "JR NZ,?", "LD (IX+?),A"}, sigs, lineno));
+    EQ("ld", 1, sigs.size());
+    EQ("ld", "21/FF 00/00 00/00 20/FF 00/00 DD/FF 77/FF 00/00", signature(sigs[0]).c_str());
+}
+
+void test_search() {
+    mos6502::AsmMos6502 assembler;
+    PatternCompiler compiler(assembler);
+    std::vector<Signature> sigs;
+    size_t lineno;
+    compiler.compile("load", {"LDA ?"}, sigs, lineno);
+    compiler.compile("loop", {"DEX", "BNE ?"}, sigs, lineno);
+    PatternMatcher matcher;
+    for (const auto &sig : sigs)
+        matcher.add(sig);
+    EQ("size", 3, matcher.size());
+
+    BinMemory memory;
+    write(memory, 0x1000,
+            {
+                    0xA5, 0x12,        // 1000: LDA $12
+                    0xCA,              // 1002: DEX
+                    0xD0, 0xFD,        // 1003: BNE $1002
+                    0xAD, 0x34, 0x12,  // 1005: LDA $1234
+                    0xCA,              // 1008: DEX
+            });
+    write(memory, 0x2000,
+            {
+                    0xD0, 0x00,  // 2000: BNE $2002
+                    0xA5,        // 2002: LDA, truncated
+            });
+    const auto hits = matcher.search(memory);
+    EQ("hits", 3, hits.size());
+    EQ("zero page", 0x1000, hits[0].address);
+    EQ("zero page", "load", matcher.signature(hits[0].index).name.c_str());
+    EQ("loop", 0x1002, hits[1].address);
+    EQ("loop", "loop", matcher.signature(hits[1].index).name.c_str());
+    EQ("absolute", 0x1005, hits[2].address);
+    EQ("absolute", 3, matcher.signature(hits[2].index).bytes.size());
+}
+
+void run_tests() {
+    RUN_TEST(test_compile_mos6502);
+    RUN_TEST(test_compile_z80);
+    RUN_TEST(test_search);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
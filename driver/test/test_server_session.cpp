@@ -0,0 +1,132 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "server_session.h"
+#include "test_driver_helper.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+using cli::ServerSession;
+
+static ServerSession *session;
+
+void set_up() {}
+
+void tear_down() {}
+
+/** |expected| and |request| may be either const char* or std::string. */
+#define HANDLE(msg, expected, request) \
+    EQ(msg, std::string(expected).c_str(), session->handle(std::string(request).c_str()).c_str())
+
+void test_assemble_line() {
+    HANDLE("6809",
+            R"({"id":7,"ok":true,"address":4096,"bytes":[134,1],"next":4098,)"
+            R"("listing":"       1000 : 86 01               lda #1\n"})",
+            R"({"op":"assemble-line", "cpu":"6809", "address":4096, "line":" lda #1", "id":7})");
+    HANDLE("z80",
+            R"({"ok":false,"error":"line:1:7: error: Overflow range","address":0,"bytes":[],)"
+            R"("next":0,"listing":"          0 :                     ld a,(ix+200)\n"})",
+            R"-({"op":"assemble-line", "cpu":"z80", "line":" ld a,(ix+200)"})-");
+    HANDLE("no line", R"({"ok":false,"error":"no line"})", R"({"op":"assemble-line"})");
+}
+
+void test_disassemble_bytes() {
+    HANDLE("6809",
+            R"({"id":"a","lines":[{"address":4096,"bytes":[134,1],"text":"lda #1"},)"
+            R"({"address":4098,"bytes":[32],"text":"bra $1003","error":"Not enough memory"}],)"
+            R"("ok":false})",
+            R"({"id":"a", "op":"disassemble-bytes", "cpu":"6809", "address":4096,)"
+            R"( "bytes":[134,1,32]})");
+    HANDLE("z80",
+            R"({"lines":[{"address":0,"bytes":[195,52,18],"text":"jp 1234H"}],"ok":true})",
+            R"({"op":"disassemble-bytes", "cpu":"z80", "bytes":[195,52,18]})");
+    HANDLE("no bytes", R"({"ok":false,"error":"no bytes"})", R"({"op":"disassemble-bytes"})");
+    HANDLE("range", R"({"ok":false,"error":"byte out of range"})",
+            R"({"op":"disassemble-bytes", "bytes":[256]})");
+}
+
+void test_assemble_file() {
+    char path[] = "/tmp/test_server_session_XXXXXX";
+    const auto fd = mkstemp(path);
+    TRUE("mkstemp", fd >= 0);
+    const char source[] = "\tcpu\t6809\n\torg\t$1000\nstart:\tlda\t#1\n\tbra\tstart\n\tfoo\n";
+    TRUE("write", ::write(fd, source, sizeof(source) - 1) == sizeof(source) - 1);
+    close(fd);
+
+    const auto request = std::string(R"({"op":"assemble-file", "path":")") + path + "\"";
+    const auto error = std::string(path) + ":5:2: error: Unknown instruction";
+    HANDLE("file",
+            R"({"ok":false,"errors":[")" + error +
+                    R"(","       1004 :                    \tfoo"],)"
+                    R"("blocks":[{"address":4096,"bytes":[134,1,32,252]}]})",
+            request + "}");
+    HANDLE("listing",
+            R"({"ok":false,"errors":[")" + error +
+                    R"(","       1004 :                    \tfoo"],)"
+                    R"("blocks":[{"address":4096,"bytes":[134,1,32,252]}],)"
+                    R"("listing":"          0 :                    \tcpu\t6809\n)"
+                    R"(       1000 :                    \torg\t$1000\n)"
+                    R"(       1000 : 86 01              start:\tlda\t#1\n)"
+                    R"(       1002 : 20 FC              \tbra\tstart\n)" +
+                    error + R"(\n       1004 :                    \tfoo\n"})",
+            request + R"(, "listing":true})");
+    unlink(path);
+
+    HANDLE("no file", R"({"ok":false,"error":"can't open input file"})", request + "}");
+    HANDLE("no path", R"({"ok":false,"error":"no path"})", R"({"op":"assemble-file"})");
+}
+
+void test_errors() {
+    HANDLE("malformed", R"({"ok":false,"error":"'{' expected"})", "op");
+    HANDLE("truncated", R"({"id":[1,2],"ok":false,"error":"integer expected"})",
+            R"({"id":[1,2], "op":)");
+    HANDLE("no op", R"({"id":"x","ok":false,"error":"no op"})", R"({"id":"x"})");
+    HANDLE("unknown op", R"({"ok":false,"error":"unknown op"})", R"({"op":"link"})");
+    HANDLE("unknown cpu", R"({"ok":false,"error":"unknown CPU"})",
+            R"({"op":"assemble-line", "cpu":"unknown", "line":" nop"})");
+    HANDLE("unknown cpu", R"({"ok":false,"error":"unknown CPU"})",
+            R"({"op":"disassemble-bytes", "cpu":"unknown", "bytes":[0]})");
+    HANDLE("recover", R"({"lines":[{"address":0,"bytes":[0],"text":"nop"}],"ok":true})",
+            R"({"op":"disassemble-bytes", "cpu":"z80", "bytes":[0]})");
+}
+
+void run_tests() {
+    ServerSession instance;
+    session = &instance;
+    RUN_TEST(test_assemble_line);
+    RUN_TEST(test_disassemble_bytes);
+    RUN_TEST(test_assemble_file);
+    RUN_TEST(test_errors);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
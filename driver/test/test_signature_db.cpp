@@ -0,0 +1,227 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "array_memory.h"
+#include "dis_formatter.h"
+#include "dis_mc68000.h"
+#include "dis_z80.h"
+#include "signature_db.h"
+#include "test_driver_helper.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+// memcpy: LD A,B; OR C; RET Z; LD A,(HL); LD (DE),A; INC HL; INC DE; DEC BC; JP memcpy
+static void memcpy(BinMemory &memory, uint32_t addr) {
+    write(memory, addr,
+            {0x78, 0xB1, 0xC8, 0x7E, 0x12, 0x23, 0x13, 0x0B, 0xC3, uint8_t(addr),
+                    uint8_t(addr >> 8)});
+}
+
+// strlen: LD BC,0; LD A,(HL); OR A; RET Z; INC HL; INC BC; JR $-6
+static void strlen(BinMemory &memory, uint32_t addr) {
+    write(memory, addr, {0x01, 0x00, 0x00, 0x7E, 0xB7, 0xC8, 0x23, 0x03, 0x18, 0xF9});
+}
+
+static uint64_t hashOf(
+        Disassembler &dis, const BinMemory &memory, uint32_t addr, uint16_t max, uint16_t &len) {
+    SignatureHasher hasher(dis, memory);
+    uint64_t hash = 0;
+    len = 0;
+    hasher.hash(addr, max, [&](uint16_t length, uint64_t h) {
+        len = length;
+        hash = h;
+    });
+    return hash;
+}
+
+static SignatureDb::Entry entry(uint64_t hash, uint16_t length) {
+    SignatureDb::Entry e{};
+    e.hash = hash;
+    e.length = length;
+    return e;
+}
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_hash_relocated() {
+    z80::DisZ80 dis;
+    BinMemory memory;
+    memcpy(memory, 0x1000);
+    memcpy(memory, 0x2345);
+    strlen(memory, 0x3000);
+    uint16_t len1, len2, len3;
+    const auto h1 = hashOf(dis, memory, 0x1000, 32, len1);
+    const auto h2 = hashOf(dis, memory, 0x2345, 32, len2);
+    const auto h3 = hashOf(dis, memory, 0x3000, 32, len3);
+    EQ("memcpy length", 11, len1);
+    EQ("relocated length", 11, len2);
+    TRUE("relocated", h1 == h2);
+    EQ("strlen length", 10, len3);
+    TRUE("different", h1 != h3);
+
+    // whole instructions within limit
+    hashOf(dis, memory, 0x1000, 10, len1);
+    EQ("rounded", 8, len1);
+
+    // an opcode is not masked
+    memory.writeByte(0x2347, 0xC0);  // RET NZ
+    TRUE("opcode", hashOf(dis, memory, 0x2345, 32, len2) != h1);
+}
+
+void test_hash_registers() {
+    mc68000::DisMc68000 dis;
+    BinMemory memory;
+    write(memory, 0x1000, {0x22, 0x00});  // MOVE.L D0,D1
+    write(memory, 0x1002, {0x2E, 0x03});  // MOVE.L D3,D7
+    write(memory, 0x1004, {0x4E, 0xF9, 0x00, 0x00, 0x12, 0x34});  // JMP ($1234).L
+    write(memory, 0x100A, {0x4E, 0xF9, 0x00, 0x00, 0x56, 0x78});  // JMP ($5678).L
+    uint16_t len1, len2;
+    const auto h1 = hashOf(dis, memory, 0x1000, 2, len1);
+    const auto h2 = hashOf(dis, memory, 0x1002, 2, len2);
+    EQ("D0,D1 length", 2, len1);
+    EQ("D3,D7 length", 2, len2);
+    TRUE("registers", h1 != h2);
+
+    const auto h3 = hashOf(dis, memory, 0x1004, 6, len1);
+    const auto h4 = hashOf(dis, memory, 0x100A, 6, len2);
+    EQ("JMP length", 6, len1);
+    TRUE("address", h3 == h4);
+}
+
+void test_database() {
+    std::vector<std::pair<SignatureDb::Entry, std::string>> routines;
+    for (uint64_t i = 0; i < 100; i++)
+        routines.emplace_back(
+                entry(i * UINT64_C(0x9E3779B97F4A7C15), 8 + i % 3), "r" + std::to_string(i));
+    const auto image = SignatureDb::build(routines);
+
+    SignatureDb db;
+    TRUE("attach", db.attach(image.data(), image.size()));
+    EQ("size", 100, db.size());
+    EQ("lengths", 3, db.lengths().size());
+    EQ("shortest", 8, db.lengths().front());
+    EQ("longest", 10, db.lengths().back());
+    for (uint64_t i = 0; i < 100; i++) {
+        const auto name = "r" + std::to_string(i);
+        const auto hash = i * UINT64_C(0x9E3779B97F4A7C15);
+        EQ(name.c_str(), name.c_str(), db.lookup(hash, 8 + i % 3));
+        TRUE(name.c_str(), db.lookup(hash, 9 - i % 3) == nullptr || i % 3 == 1);
+    }
+    TRUE("missing", db.lookup(12345, 8) == nullptr);
+
+    SignatureDb bad;
+    FALSE("truncated", bad.attach(image.data(), image.size() - 1));
+    auto broken = image;
+    broken[0] = 'X';
+    FALSE("magic", bad.attach(broken.data(), broken.size()));
+    EQ("empty", 0, bad.size());
+
+    SignatureDb::Header header;
+    std::memcpy(&header, image.data(), sizeof(header));
+    const auto index = sizeof(header);
+    const auto last = index + (UINT32_C(1) << header.bits) * sizeof(uint32_t);
+    const auto entries = header.names - header.count * sizeof(SignatureDb::Entry);
+    const uint32_t over = header.count + 1;
+    broken = image;
+    std::memcpy(&broken[last], &over, sizeof(over));
+    FALSE("index over", bad.attach(broken.data(), broken.size()));
+    const uint32_t zero = 0;
+    broken = image;
+    std::memcpy(&broken[last], &zero, sizeof(zero));
+    FALSE("index decreasing", bad.attach(broken.data(), broken.size()));
+    const uint32_t name = header.size - header.names;
+    broken = image;
+    std::memcpy(&broken[entries + offsetof(SignatureDb::Entry, name)], &name, sizeof(name));
+    FALSE("name", bad.attach(broken.data(), broken.size()));
+    broken = image;
+    broken.back() = 'X';
+    FALSE("names", bad.attach(broken.data(), broken.size()));
+    EQ("broken", 0, bad.size());
+    TRUE("empty", bad.lookup(0, 8) == nullptr);
+}
+
+void test_matcher() {
+    z80::DisZ80 dis;
+    BinMemory library;
+    memcpy(library, 0x1000);
+    strlen(library, 0x100B);
+    std::vector<std::pair<SignatureDb::Entry, std::string>> routines;
+    uint16_t len;
+    auto hash = hashOf(dis, library, 0x1000, 11, len);
+    routines.emplace_back(entry(hash, len), "memcpy");
+    hash = hashOf(dis, library, 0x100B, 32, len);
+    routines.emplace_back(entry(hash, len), "strlen");
+    const auto image = SignatureDb::build(routines);
+    SignatureDb db;
+    TRUE("attach", db.attach(image.data(), image.size()));
+
+    BinMemory program;
+    write(program, 0x2000, {0xCD, 0x0A, 0x20, 0xCD, 0x04, 0x20, 0x76});  // CALL; CALL; HALT
+    write(program, 0x2007, {0x00, 0x00, 0x00});                       // NOP
+    strlen(program, 0x200A);
+    memcpy(program, 0x2014);
+    SignatureMatcher matcher(dis, db);
+    EQ("match", 2, matcher.match(program));
+    EQ("strlen", "strlen", matcher.lookupValue(0x200A));
+    EQ("memcpy", "memcpy", matcher.lookupValue(0x2014));
+    TRUE("none", matcher.lookupValue(0x2000) == nullptr);
+
+    DisFormatter formatter(dis, "test");
+    formatter.setSymbolTable(&matcher);
+    const uint8_t call[] = {0xCD, 0x14, 0x20};
+    const ArrayMemory callMemory(0x2000, call, sizeof(call));
+    auto callIt = callMemory.iterator();
+    formatter.disassemble(callIt, 0x2000);
+    TRUE("call", formatter.hasNextContent());
+    EQ("call", "      call  memcpy", formatter.getContent());
+    FALSE("call", formatter.hasNextContent());
+
+    const uint8_t ld[] = {0x78};
+    const ArrayMemory ldMemory(0x2014, ld, sizeof(ld));
+    auto ldIt = ldMemory.iterator();
+    formatter.disassemble(ldIt, 0x2014);
+    EQ("label", "memcpy:", formatter.getContent());
+    EQ("label", "      ld    a, b", formatter.getContent());
+    FALSE("label", formatter.hasNextContent());
+    EQ("label line", "    2014 :                      memcpy:", formatter.getLine());
+    EQ("label line", "    2014 : 78                         ld    a, b", formatter.getLine());
+    FALSE("label line", formatter.hasNextLine());
+}
+
+void run_tests() {
+    RUN_TEST(test_hash_relocated);
+    RUN_TEST(test_hash_registers);
+    RUN_TEST(test_database);
+    RUN_TEST(test_matcher);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
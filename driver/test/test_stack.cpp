@@ -0,0 +1,150 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cycles_mc6809.h"
+#include "cycles_z80.h"
+#include "dis_mc6809.h"
+#include "dis_z80.h"
+#include "flow_graph.h"
+#include "flow_mc6809.h"
+#include "flow_z80.h"
+#include "stack_analyzer.h"
+#include "test_driver_helper.h"
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_z80() {
+    z80::DisZ80 disassembler;
+    BinMemory memory;
+    write(memory, 0x1000,
+            {
+                    0x31, 0x00, 0x80,  // 1000: LD   SP,8000H
+                    0xC5,              // 1003: PUSH BC
+                    0xCD, 0x0A, 0x10,  // 1004: CALL 100AH
+                    0xC1,              // 1007: POP  BC
+                    0x18, 0xF9,        // 1008: JR   1003H
+                    0xDD, 0xE5,        // 100A: PUSH IX
+                    0x3B,              // 100C: DEC  SP
+                    0xC8,              // 100D: RET  Z
+                    0xCF,              // 100E: RST  08H
+                    0x33,              // 100F: INC  SP
+                    0xDD, 0xE1,        // 1010: POP  IX
+                    0xC9,              // 1012: RET
+            });
+    write(memory, 0x0008,
+            {
+                    0xF5,  // 0008: PUSH AF
+                    0xF1,  // 0009: POP  AF
+                    0xC9,  // 000A: RET
+            });
+    FlowGraph graph(disassembler, z80::FLOW, z80::CYCLES);
+    graph.addEntry(0x1000);
+    graph.build(memory);
+    EQ("functions", 3, graph.functions().size());
+
+    StackAnalyzer stack(graph);
+    stack.analyze();
+    const auto rst = graph.functionAt(0x0008);
+    EQ("rst", 2, stack.depth(rst).bytes);
+    const auto sub = graph.functionAt(0x100A);
+    // PUSH IX + DEC SP + RST + PUSH AF
+    EQ("sub", 2 + 1 + 2 + 2, stack.depth(sub).bytes);
+    EQ("sub", DEPTH_OK, stack.depth(sub).status);
+    const auto main = graph.functionAt(0x1000);
+    // PUSH BC + CALL + sub
+    EQ("main", 2 + 2 + 7, stack.depth(main).bytes);
+    EQ("main", DEPTH_OK, stack.depth(main).status);
+}
+
+void test_mc6809() {
+    mc6809::DisMc6809 disassembler;
+    BinMemory memory;
+    write(memory, 0x2000,
+            {
+                    0x34, 0x32,  // 2000: PSHS X,Y,A
+                    0x32, 0x7C,  // 2002: LEAS -4,S
+                    0x8D, 0x04,  // 2004: BSR  200AH
+                    0x32, 0x64,  // 2006: LEAS 4,S
+                    0x35, 0xB2,  // 2008: PULS X,Y,A,PC
+                    0x34, 0x40,  // 200A: PSHS U
+                    0x1F, 0x14,  // 200C: TFR  X,S
+                    0x35, 0xC0,  // 200E: PULS U,PC
+                    0x34, 0x02,  // 2010: PSHS A
+                    0x20, 0xFC,  // 2012: BRA  2010H
+            });
+    FlowGraph graph(disassembler, mc6809::FLOW, mc6809::CYCLES);
+    graph.addEntry(0x2000);
+    graph.addEntry(0x2010);
+    graph.build(memory);
+
+    StackAnalyzer stack(graph);
+    stack.analyze();
+    const auto func = graph.functionAt(0x200A);
+    EQ("func", 2, stack.depth(func).bytes);
+    EQ("func", DEPTH_UNKNOWN_POINTER, stack.depth(func).status);
+    EQ("func", 0x200C, stack.depth(func).at);
+    const auto main = graph.functionAt(0x2000);
+    // PSHS X,Y,A + LEAS -4,S + BSR + func
+    EQ("main", 5 + 4 + 2 + 2, stack.depth(main).bytes);
+    EQ("main", DEPTH_UNKNOWN_POINTER, stack.depth(main).status);
+    const auto grow = graph.functionAt(0x2010);
+    EQ("grow", DEPTH_UNBOUNDED, stack.depth(grow).status);
+    EQ("grow", 0x2010, stack.depth(grow).at);
+}
+
+void test_recursion() {
+    z80::DisZ80 disassembler;
+    BinMemory memory;
+    write(memory, 0x3000,
+            {
+                    0xE5,              // 3000: PUSH HL
+                    0xCD, 0x00, 0x30,  // 3001: CALL 3000H
+                    0xE1,              // 3004: POP  HL
+                    0xC9,              // 3005: RET
+            });
+    FlowGraph graph(disassembler, z80::FLOW, z80::CYCLES);
+    graph.addEntry(0x3000);
+    graph.build(memory);
+
+    StackAnalyzer stack(graph);
+    stack.analyze();
+    EQ("recursion", DEPTH_RECURSION, stack.depth(0).status);
+    EQ("recursion", 0x3001, stack.depth(0).at);
+    EQ("recursion", 4, stack.depth(0).bytes);
+}
+
+void run_tests() {
+    RUN_TEST(test_z80);
+    RUN_TEST(test_mc6809);
+    RUN_TEST(test_recursion);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Run independent assembler and disassembler instances on many threads
+ * at once and compare the results with a serial run. Build with
+ * |make DEBUG_FLAGS=-fsanitize=thread test_threads| to check data races
+ * under ThreadSanitizer.
+ */
+
+#include "asm_mc6809.h"
+#include "asm_z80.h"
+#include "dis_mc6809.h"
+#include "dis_z80.h"
+#include "intel_hex.h"
+#include "moto_srec.h"
+#include "stored_printer.h"
+#include "test_formatter_helper.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+void set_up() {}
+
+void tear_down() {}
+
+static constexpr int THREADS = 4;
+static constexpr int ROUNDS = 20;
+
+static const char SOURCE_MC6809[] =
+        "        cpu   6809\n"
+        "        org   $1000\n"
+        "label:  ldx   #label\n"
+        "        cmpd  [$1234,y]\n"
+        "        lbra  label\n"
+        "        fcc   /text/\n"
+        "        fdb   label, *+2\n";
+
+static const char SOURCE_Z80[] =
+        "        cpu   z80\n"
+        "        org   2000H\n"
+        "label:  ld    hl, label\n"
+        "        ld    (ix+12), 34H\n"
+        "        jr    label\n"
+        "        db    'text'\n"
+        "        dw    label, $+2\n";
+
+template <typename ASM, typename DIS>
+static std::string assemble(const char *cpu, const char *text, BinEncoder &encoder) {
+    ASM assembler;
+    MotorolaDirective motorola(assembler);
+    IntelDirective intel(assembler);
+    AsmDirective *dirs[] = {&motorola, &intel};
+    TestSources sources;
+    AsmDriver driver(std::begin(dirs), std::end(dirs), sources, REPORT_UNDEFINED);
+    BinMemory memory;
+    AsmFormatter listing(driver, sources, memory);
+    TestReader source(cpu);
+    source.add(text);
+    sources.add(source);
+    sources.open(source.name().c_str());
+
+    std::string out;
+    StrScanner *line;
+    while ((line = sources.readLine()) != nullptr) {
+        listing.assemble(*line, /* reportError */ true);
+        while (listing.hasNextLine())
+            out.append(listing.getLine()).append("\n");
+    }
+
+    StoredPrinter hex;
+    encoder.reset(ADDRESS_16BIT, 16);
+    encoder.encode(memory, hex);
+    for (size_t i = 1; i <= hex.size(); i++)
+        out.append(hex.line(i)).append("\n");
+
+    DIS disassembler;
+    DisFormatter dis(disassembler, cpu);
+    dis.setCpu(cpu);
+    for (const auto &block : memory) {
+        auto reader = memory.reader(block.base);
+        while (reader.hasNext()) {
+            dis.disassemble(reader, reader.address());
+            while (dis.hasNextLine())
+                out.append(dis.getLine()).append("\n");
+        }
+    }
+    return out;
+}
+
+static std::string run_all() {
+    std::string out;
+    out += assemble<mc6809::AsmMc6809, mc6809::DisMc6809>(
+            "mc6809", SOURCE_MC6809, MotoSrec::encoder());
+    out += assemble<z80::AsmZ80, z80::DisZ80>("z80", SOURCE_Z80, IntelHex::encoder());
+    return out;
+}
+
+void test_parallel_asm_dis() {
+    const auto expected = run_all();
+    std::vector<std::string> results(THREADS);
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < THREADS; t++) {
+        threads.emplace_back([&results, t] {
+            for (auto i = 0; i < ROUNDS; i++)
+                results[t] = run_all();
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    for (auto t = 0; t < THREADS; t++)
+        EQ("result", expected.c_str(), results[t].c_str());
+}
+
+void test_shared_memory_readers() {
+    BinMemory memory;
+    for (uint32_t addr = 0; addr < 0x100; addr++) {
+        memory.writeByte(0x1000 + addr, addr);
+        memory.writeByte(0x3000 + addr, ~addr);
+    }
+    const auto &shared = memory;
+    std::vector<uint32_t> sums(THREADS);
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < THREADS; t++) {
+        threads.emplace_back([&shared, &sums, t] {
+            uint32_t sum = 0;
+            for (auto i = 0; i < ROUNDS; i++) {
+                for (const auto &block : shared) {
+                    auto reader = shared.reader(block.base);
+                    while (reader.hasNext())
+                        sum += reader.readByte();
+                }
+                for (uint32_t addr = 0x0f00; addr < 0x3200; addr += 0x81)
+                    sum += shared.hasByte(addr) ? shared.readByte(addr) : 0;
+            }
+            sums[t] = sum;
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    for (auto t = 1; t < THREADS; t++)
+        EQ("sum", sums[0], sums[t]);
+}
+
+void run_tests() {
+    RUN_TEST(test_parallel_asm_dis);
+    RUN_TEST(test_shared_memory_readers);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dis_z80.h"
+#include "stored_printer.h"
+#include "test_driver_helper.h"
+#include "trace_disassembler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+/** A trace source which returns at most |piece| bytes at once. */
+struct VectorSource : TraceSource {
+    VectorSource(const std::vector<uint8_t> &trace, size_t piece = 1000)
+        : trace(trace), piece(piece), pos(0) {}
+    size_t read(uint8_t *buffer, size_t size) override {
+        const auto n = std::min(std::min(size, piece), trace.size() - pos);
+        memcpy(buffer, trace.data() + pos, n);
+        pos += n;
+        return n;
+    }
+    const std::vector<uint8_t> &trace;
+    const size_t piece;
+    size_t pos;
+};
+
+static void append(std::vector<uint8_t> &trace, uint32_t pc,
+        const std::initializer_list<uint8_t> &bytes) {
+    TraceDisassembler::append(trace, pc, bytes.begin(), bytes.size());
+}
+
+/** LD HL,1234H; JR $+4; LD A,1; repeated at two places */
+static void loop(std::vector<uint8_t> &trace, size_t times) {
+    for (size_t i = 0; i < times; i++) {
+        const uint32_t base = (i % 2) ? 0x2000 : 0x1000;
+        append(trace, base + 0, {0x21, 0x34, 0x12});
+        append(trace, base + 3, {0x18, 0x02});
+        append(trace, base + 7, {0x3E, 0x01});
+    }
+}
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_trace() {
+    z80::DisZ80 dis;
+    TraceDisassembler tracer({&dis});
+    std::vector<uint8_t> trace;
+    loop(trace, 3);
+    append(trace, 0x3000, {0xED, 0xFF});
+    append(trace, 0x3002, {0xCD, 0x00});
+    VectorSource in(trace, 7);
+    StoredPrinter out;
+    EQ("records", 11, tracer.trace(in, out));
+    EQ("lines", 11, out.size());
+    EQ("line 1", "1000 : 21 34 12     ld    hl, 1234H", out.line(1));
+    EQ("line 2", "1003 : 18 02        jr    1007H", out.line(2));
+    EQ("line 3", "1007 : 3E 01        ld    a, 1", out.line(3));
+    EQ("line 4", "2000 : 21 34 12     ld    hl, 1234H", out.line(4));
+    EQ("line 5", "2003 : 18 02        jr    2007H", out.line(5));
+    EQ("line 7", "1000 : 21 34 12     ld    hl, 1234H", out.line(7));
+    EQ("line 10", "3000 : ED FF  ; Unknown instruction", out.line(10));
+    EQ("line 11", "3002 : CD 00        call  0  ; Not enough memory", out.line(11));
+    // LD HL and LD A are shared by two places, JR is not.
+    EQ("misses", 6, tracer.misses());
+    EQ("hits", 5, tracer.hits());
+}
+
+void test_count() {
+    z80::DisZ80 dis;
+    TraceDisassembler tracer({&dis}, true);
+    std::vector<uint8_t> trace;
+    loop(trace, 5);
+    VectorSource in(trace);
+    StoredPrinter out;
+    EQ("records", 15, tracer.count(in, out));
+    EQ("lines", 6, out.size());
+    EQ("line 1", "         3  1000 : 21 34 12     LD    HL, 1234H", out.line(1));
+    EQ("line 2", "         3  1003 : 18 02        JR    1007H", out.line(2));
+    EQ("line 6", "         2  2007 : 3E 01        LD    A, 1", out.line(6));
+}
+
+void test_truncated() {
+    z80::DisZ80 dis;
+    TraceDisassembler tracer({&dis});
+    std::vector<uint8_t> trace;
+    loop(trace, 1);
+    trace.resize(trace.size() - 1);
+    VectorSource in(trace);
+    StoredPrinter out;
+    TRUE("truncated", tracer.trace(in, out) < 0);
+    EQ("lines", 2, out.size());
+}
+
+void test_threads() {
+    std::vector<uint8_t> trace;
+    loop(trace, 40000);
+    z80::DisZ80 dis;
+    TraceDisassembler single({&dis});
+    VectorSource in1(trace, 100000);
+    StoredPrinter out1;
+    EQ("single", 120000, single.trace(in1, out1));
+
+    z80::DisZ80 dis1, dis2, dis3;
+    TraceDisassembler multi({&dis, &dis1, &dis2, &dis3});
+    VectorSource in4(trace, 100000);
+    StoredPrinter out4;
+    EQ("multi", 120000, multi.trace(in4, out4));
+    EQ("lines", out1.size(), out4.size());
+    auto same = true;
+    for (size_t i = 1; same && i <= out1.size(); i++)
+        same = strcmp(out1.line(i), out4.line(i)) == 0;
+    TRUE("same", same);
+    TRUE("dedup", multi.misses() <= 4 * 6);
+
+    VectorSource in(trace, 100000);
+    StoredPrinter out;
+    EQ("count", 120000, multi.count(in, out));
+    EQ("count lines", 6, out.size());
+    EQ("count line", "     20000  1000 : 21 34 12     ld    hl, 1234H", out.line(1));
+}
+
+void run_tests() {
+    RUN_TEST(test_trace);
+    RUN_TEST(test_count);
+    RUN_TEST(test_truncated);
+    RUN_TEST(test_threads);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cycles_z80.h"
+#include "dis_z80.h"
+#include "flow_graph.h"
+#include "flow_z80.h"
+#include "test_driver_helper.h"
+#include "wcet_analyzer.h"
+
+namespace libasm {
+namespace driver {
+namespace test {
+
+void set_up() {}
+
+void tear_down() {}
+
+void test_flow_graph() {
+    z80::DisZ80 disassembler;
+    BinMemory memory;
+    write(memory, 0x1000,
+            {
+                    0x06, 0x0A,        // 1000: LD   B,10
+                    0xCD, 0x08, 0x10,  // 1002: CALL 1008H
+                    0x10, 0xFB,        // 1005: DJNZ 1002H
+                    0x76,              // 1007: HALT
+                    0x7E,              // 1008: LD   A,(HL)
+                    0xB7,              // 1009: OR   A
+                    0x28, 0x01,        // 100A: JR   Z,100DH
+                    0x23,              // 100C: INC  HL
+                    0xC9,              // 100D: RET
+            });
+    FlowGraph graph(disassembler, z80::FLOW, z80::CYCLES);
+    graph.addEntry(0x1000);
+    graph.build(memory);
+
+    EQ("insns", 9, graph.insns().size());
+    EQ("functions", 2, graph.functions().size());
+    EQ("main", 0x1000, graph.functions()[0].entry);
+    EQ("sub", 0x1008, graph.functions()[1].entry);
+    EQ("sub", 1, graph.functionAt(0x1008));
+    EQ("not entry", FlowGraph::NONE, graph.functionAt(0x1002));
+
+    const auto &blocks = graph.blocks();
+    const auto loop = graph.blockAt(0x1002);
+    TRUE("loop", loop != FlowGraph::NONE);
+    EQ("call", 1, blocks[loop].callee);
+    const auto djnz = blocks[loop].next;
+    EQ("djnz", graph.blockAt(0x1005), djnz);
+    EQ("back edge", loop, blocks[djnz].jump);
+    EQ("exit", graph.blockAt(0x1007), blocks[djnz].next);
+    EQ("ret", FlowGraph::NONE, blocks[graph.blockAt(0x100D)].next);
+
+    WcetAnalyzer wcet(graph);
+    wcet.analyze();
+    EQ("sub", 39, wcet.wcet(1).cycles);
+    EQ("sub", WCET_OK, wcet.wcet(1).status);
+    EQ("unbound", WCET_NO_LOOP_BOUND, wcet.wcet(0).status);
+    EQ("unbound", 0x1002, wcet.wcet(0).at);
+
+    WcetAnalyzer bound(graph);
+    bound.setLoopBound(0x1002, 10);
+    bound.analyze();
+    EQ("main", WCET_OK, bound.wcet(0).status);
+    // LD B + 10 * (CALL + sub + DJNZ) + HALT
+    EQ("main", 7 + 10 * (17 + 39 + 13) + 4, bound.wcet(0).cycles);
+}
+
+void test_recursion() {
+    z80::DisZ80 disassembler;
+    BinMemory memory;
+    write(memory, 0x2000,
+            {
+                    0xCD, 0x00, 0x20,  // 2000: CALL 2000H
+                    0xC9,              // 2003: RET
+            });
+    FlowGraph graph(disassembler, z80::FLOW, z80::CYCLES);
+    graph.addEntry(0x2000);
+    graph.build(memory);
+
+    WcetAnalyzer wcet(graph);
+    wcet.analyze();
+    EQ("recursion", WCET_RECURSION, wcet.wcet(0).status);
+    EQ("recursion", 0x2000, wcet.wcet(0).at);
+}
+
+void test_unknown_target() {
+    z80::DisZ80 disassembler;
+    BinMemory memory;
+    write(memory, 0x3000,
+            {
+                    0x21, 0x00, 0x40,  // 3000: LD HL,4000H
+                    0xE9,              // 3003: JP (HL)
+            });
+    FlowGraph graph(disassembler, z80::FLOW, z80::CYCLES);
+    graph.addEntry(0x3000);
+    graph.build(memory);
+
+    WcetAnalyzer wcet(graph);
+    wcet.analyze();
+    EQ("indirect", WCET_UNKNOWN_TARGET, wcet.wcet(0).status);
+    EQ("indirect", 0x3003, wcet.wcet(0).at);
+    EQ("indirect", 10 + 4, wcet.wcet(0).cycles);
+}
+
+void run_tests() {
+    RUN_TEST(test_flow_graph);
+    RUN_TEST(test_recursion);
+    RUN_TEST(test_unknown_target);
+}
+
+}  // namespace test
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "trace_cache.h"
+
+#include "array_memory.h"
+
+namespace libasm {
+namespace driver {
+
+TraceCache::TraceCache(Disassembler &disassembler, size_t capacity)
+    : _disassembler(disassembler),
+      _addrUnit(disassembler.config().addressUnit()),
+      _capacity(capacity),
+      _hits(0),
+      _misses(0) {}
+
+const TraceCache::Entry &TraceCache::decode(uint32_t pc, const uint8_t *bytes, uint8_t size) {
+    if (_disassembler.config().checkAddr(pc)) {
+        // Out of address space or misaligned PC fails regardless of bytes.
+        _misses++;
+        decode(pc, bytes, size, _uncached);
+        return _uncached;
+    }
+    Key key{_disassembler.cpu_P(), ANY_PC, std::string(bytes, bytes + size)};
+    const auto any = _entries.find(key);
+    if (any != _entries.end()) {
+        if (!any->second.pcRelative) {
+            _hits++;
+            return any->second;
+        }
+        key.pc = pc;
+        const auto it = _entries.find(key);
+        if (it != _entries.end()) {
+            _hits++;
+            return it->second;
+        }
+    }
+    _misses++;
+
+    Entry entry;
+    decode(pc, bytes, size, entry);
+    if (any == _entries.end()) {
+        Entry probe;
+        decode(pc ^ PROBE_PC, bytes, size, probe);
+        entry.pcRelative = probe.error != entry.error || probe.operands != entry.operands;
+        if (!entry.pcRelative)
+            return insert(key, entry);
+        // Mark that these bytes need PC to look up.
+        Entry marker{OK, true, 0, std::string(), std::string()};
+        insert(key, marker);
+        key.pc = pc;
+    }
+    return insert(key, entry);
+}
+
+const TraceCache::Entry &TraceCache::insert(const Key &key, Entry &entry) {
+    if (_entries.size() >= _capacity) {
+        clear();
+        if (key.pc != ANY_PC) {
+            // The marker for these bytes is dropped too.
+            Key any{key.cpu, ANY_PC, key.bytes};
+            _entries.emplace(any, Entry{OK, true, 0, std::string(), std::string()});
+        }
+    }
+    return _entries.emplace(key, std::move(entry)).first->second;
+}
+
+void TraceCache::decode(uint32_t pc, const uint8_t *bytes, uint8_t size, Entry &entry) {
+    const ArrayMemory memory(pc * _addrUnit, bytes, size);
+    auto it = memory.iterator();
+    Insn insn(pc);
+    char operands[256] = "";
+    entry.error = _disassembler.decode(it, insn, operands, sizeof(operands));
+    entry.pcRelative = false;
+    entry.length = insn.length();
+    entry.name = insn.name();
+    entry.operands = operands;
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TRACE_CACHE_H__
+#define __TRACE_CACHE_H__
+
+#include "dis_base.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace libasm {
+namespace driver {
+
+/**
+ * A cache of instructions decoded from emulator trace records, keyed by
+ * CPU and opcode bytes. Most instructions don't depend on where they
+ * are, so the same bytes at any PC share one entry. An instruction whose
+ * text depends on PC, such as a relative branch, is found by decoding it
+ * at another PC too, and is cached by its PC as well. Options of the
+ * disassembler are not part of the key; call |clear| when they change.
+ */
+class TraceCache {
+public:
+    struct Entry {
+        Error error;
+        bool pcRelative;  // text depends on PC
+        uint8_t length;
+        std::string name;
+        std::string operands;
+    };
+
+    /** the whole cache is dropped when it holds |capacity| instructions */
+    TraceCache(Disassembler &disassembler, size_t capacity = 0x100000);
+
+    /** decode |size| opcode |bytes| at |pc| in address unit */
+    const Entry &decode(uint32_t pc, const uint8_t *bytes, uint8_t size);
+    void clear() { _entries.clear(); }
+
+    Disassembler &disassembler() const { return _disassembler; }
+    size_t size() const { return _entries.size(); }
+    size_t hits() const { return _hits; }
+    size_t misses() const { return _misses; }
+
+private:
+    struct Key {
+        const /*PROGMEM*/ char *cpu;
+        uint32_t pc;  // ANY_PC unless the text depends on PC
+        std::string bytes;
+
+        bool operator==(const Key &other) const {
+            return cpu == other.cpu && pc == other.pc && bytes == other.bytes;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return std::hash<std::string>()(key.bytes) ^ (key.pc * UINT32_C(0x9E3779B1));
+        }
+    };
+
+    static constexpr uint32_t ANY_PC = UINT32_MAX;
+    // flips bits both within and above a page, keeping word alignment
+    static constexpr uint32_t PROBE_PC = 0x0A5A;
+
+    Disassembler &_disassembler;
+    const uint8_t _addrUnit;
+    const size_t _capacity;
+    std::unordered_map<Key, Entry, KeyHash> _entries;
+    Entry _uncached;
+    size_t _hits;
+    size_t _misses;
+
+    void decode(uint32_t pc, const uint8_t *bytes, uint8_t size, Entry &entry);
+    const Entry &insert(const Key &key, Entry &entry);
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,208 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "trace_disassembler.h"
+
+#include "phase_stats.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <thread>
+
+namespace libasm {
+namespace driver {
+
+TraceDisassembler::TraceDisassembler(
+        const std::vector<Disassembler *> &disassemblers, bool uppercase)
+    : _uppercase(uppercase),
+      _pcDigits((disassemblers.front()->config().addressWidth() + 3) / 4),
+      _bytesWidth(std::min<int>(disassemblers.front()->config().codeMax(), 6) * 3),
+      _nameWidth(disassemblers.front()->config().nameMax() + 1) {
+    for (auto dis : disassemblers) {
+        dis->setUppercase(uppercase);
+        _workers.emplace_back(new Worker(*dis));
+    }
+}
+
+size_t TraceDisassembler::hits() const {
+    size_t hits = 0;
+    for (const auto &w : _workers)
+        hits += w->cache.hits();
+    return hits;
+}
+
+size_t TraceDisassembler::misses() const {
+    size_t misses = 0;
+    for (const auto &w : _workers)
+        misses += w->cache.misses();
+    return misses;
+}
+
+void TraceDisassembler::append(
+        std::vector<uint8_t> &trace, uint32_t pc, const uint8_t *bytes, uint8_t size) {
+    for (auto i = 0; i < 4; i++)
+        trace.push_back(pc >> (i * 8));
+    trace.push_back(size);
+    trace.insert(trace.end(), bytes, bytes + size);
+}
+
+static uint32_t pcOf(const uint8_t *record) {
+    return record[0] | (record[1] << 8) | (record[2] << 16) |
+           (static_cast<uint32_t>(record[3]) << 24);
+}
+
+int64_t TraceDisassembler::trace(TraceSource &in, TextPrinter &out) {
+    return run(in, &out);
+}
+
+int64_t TraceDisassembler::count(TraceSource &in, TextPrinter &out) {
+    const auto records = run(in, nullptr);
+    std::map<Record, uint64_t> counts;
+    for (auto &w : _workers) {
+        for (const auto &it : w->counts)
+            counts[it.first] += it.second;
+        w->counts.clear();
+    }
+    LIBASM_STATS_SCOPE(PASS);
+    auto &worker = *_workers.front();
+    for (const auto &it : counts) {
+        const auto &r = it.first;
+        const auto bytes = reinterpret_cast<const uint8_t *>(r.bytes.data());
+        const auto size = r.bytes.size();
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%10llu  ", static_cast<unsigned long long>(it.second));
+        worker.text = buf;
+        format(worker.text, r.pc, bytes, size, worker.cache.decode(r.pc, bytes, size));
+        out.println(worker.text.c_str());
+    }
+    return records;
+}
+
+int64_t TraceDisassembler::run(TraceSource &in, TextPrinter *out) {
+    _rest.clear();
+    for (auto &w : _workers)
+        w->records = 0;
+    auto more = true;
+    while (more) {
+        size_t n = 0;
+        while (more && n < _workers.size())
+            more = fill(in, *_workers[n++]);
+        {
+            LIBASM_STATS_SCOPE(PASS);
+            std::vector<std::thread> threads;
+            for (size_t i = 1; i < n; i++)
+                threads.emplace_back([this, i, out] { decode(*_workers[i], out == nullptr); });
+            decode(*_workers[0], out == nullptr);
+            for (auto &thread : threads)
+                thread.join();
+        }
+        if (out) {
+            for (size_t i = 0; i < n; i++) {
+                const auto &text = _workers[i]->text;
+                for (auto p = text.data(); p < text.data() + text.size(); p += strlen(p) + 1)
+                    out->println(p);
+            }
+        }
+    }
+    int64_t records = 0;
+    for (const auto &w : _workers)
+        records += w->records;
+    return _rest.empty() ? records : -records - 1;
+}
+
+bool TraceDisassembler::fill(TraceSource &in, Worker &worker) {
+    auto &chunk = worker.chunk;
+    chunk.swap(_rest);
+    auto len = chunk.size();
+    chunk.resize(CHUNK_SIZE);
+    auto more = true;
+    while (len < CHUNK_SIZE) {
+        const auto n = in.read(chunk.data() + len, CHUNK_SIZE - len);
+        if (n == 0) {
+            more = false;
+            break;
+        }
+        len += n;
+    }
+    size_t pos = 0;
+    int64_t records = 0;
+    while (pos + HEADER_SIZE <= len && pos + HEADER_SIZE + chunk[pos + 4] <= len) {
+        pos += HEADER_SIZE + chunk[pos + 4];
+        records++;
+    }
+    _rest.assign(chunk.begin() + pos, chunk.begin() + len);
+    chunk.resize(pos);
+    worker.records += records;
+    return more;
+}
+
+void TraceDisassembler::decode(Worker &worker, bool counting) const {
+    worker.text.clear();
+    const auto end = worker.chunk.data() + worker.chunk.size();
+    for (auto p = worker.chunk.data(); p < end; p += HEADER_SIZE + p[4]) {
+        const auto pc = pcOf(p);
+        const auto bytes = p + HEADER_SIZE;
+        const auto size = p[4];
+        if (counting) {
+            worker.counts[Record{pc, std::string(bytes, bytes + size)}]++;
+        } else {
+            format(worker.text, pc, bytes, size, worker.cache.decode(pc, bytes, size));
+            worker.text.push_back(0);
+        }
+    }
+}
+
+void TraceDisassembler::format(std::string &text, uint32_t pc, const uint8_t *bytes, uint8_t size,
+        const TraceCache::Entry &entry) const {
+    static constexpr char HEX[] = "0123456789ABCDEF";
+    for (auto i = _pcDigits - 1; i >= 0; i--)
+        text.push_back(HEX[(pc >> (i * 4)) & 0xF]);
+    text.append(" :");
+    for (auto i = 0; i < size; i++) {
+        text.push_back(' ');
+        text.push_back(HEX[bytes[i] >> 4]);
+        text.push_back(HEX[bytes[i] & 0xF]);
+    }
+    text.append(size * 3 < _bytesWidth ? _bytesWidth - size * 3 : 0, ' ');
+    text.append("  ");
+    const auto name = text.size();
+    for (const auto c : entry.name)
+        text.push_back(_uppercase ? toupper(c) : tolower(c));
+    if (entry.operands.size()) {
+        text.append(text.size() - name < size_t(_nameWidth) ? _nameWidth - (text.size() - name) : 1,
+                ' ');
+        text.append(entry.operands);
+    }
+    if (entry.error) {
+        while (text.back() == ' ')
+            text.pop_back();
+        text.append("  ; ");
+        text.append(ErrorReporter::errorText_P(entry.error));
+    }
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TRACE_DISASSEMBLER_H__
+#define __TRACE_DISASSEMBLER_H__
+
+#include "dis_base.h"
+#include "text_printer.h"
+#include "trace_cache.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+/** A source of binary trace, such as a file or a pipe. */
+struct TraceSource {
+    /** read at most |size| bytes into |buffer|; returns zero at the end */
+    virtual size_t read(uint8_t *buffer, size_t size) = 0;
+};
+
+/**
+ * Disassemble an emulator trace. A trace is a sequence of records, each
+ * of which is a 32-bit little endian PC in address unit, a byte count,
+ * and opcode bytes. The trace is read in chunks which are decoded
+ * concurrently, one thread for each disassembler, through a
+ * |TraceCache| of each thread.
+ */
+class TraceDisassembler {
+public:
+    /** each of |disassemblers| is used by one thread and must be set up alike */
+    TraceDisassembler(const std::vector<Disassembler *> &disassemblers, bool uppercase = false);
+
+    /**
+     * Print each record with its instruction. Returns the number of
+     * records, or negative if the trace ends in the middle of a record.
+     */
+    int64_t trace(TraceSource &in, TextPrinter &out);
+    /** Print execution count of each instruction, ordered by PC. */
+    int64_t count(TraceSource &in, TextPrinter &out);
+
+    size_t hits() const;
+    size_t misses() const;
+
+    /** append a record to |trace| */
+    static void append(
+            std::vector<uint8_t> &trace, uint32_t pc, const uint8_t *bytes, uint8_t size);
+
+    static constexpr size_t HEADER_SIZE = 5;
+    static constexpr size_t CHUNK_SIZE = 0x40000;
+
+private:
+    struct Record {
+        uint32_t pc;
+        std::string bytes;
+
+        bool operator==(const Record &other) const {
+            return pc == other.pc && bytes == other.bytes;
+        }
+        bool operator<(const Record &other) const {
+            return pc < other.pc || (pc == other.pc && bytes < other.bytes);
+        }
+    };
+    struct RecordHash {
+        size_t operator()(const Record &r) const {
+            return std::hash<std::string>()(r.bytes) ^ (r.pc * UINT32_C(0x9E3779B1));
+        }
+    };
+    struct Worker {
+        Worker(Disassembler &dis) : cache(dis), records(0) {}
+        TraceCache cache;
+        std::vector<uint8_t> chunk;  // complete records
+        std::string text;            // NUL terminated lines
+        std::unordered_map<Record, uint64_t, RecordHash> counts;
+        int64_t records;
+    };
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::vector<uint8_t> _rest;
+    const bool _uppercase;
+    const int _pcDigits;
+    const int _bytesWidth;
+    const int _nameWidth;
+
+    int64_t run(TraceSource &in, TextPrinter *out);
+    bool fill(TraceSource &in, Worker &worker);
+    void decode(Worker &worker, bool counting) const;
+    void format(std::string &text, uint32_t pc, const uint8_t *bytes, uint8_t size,
+            const TraceCache::Entry &entry) const;
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,275 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wcet_analyzer.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace libasm {
+namespace driver {
+
+namespace {
+
+constexpr uint8_t NEW = 0;
+constexpr uint8_t ACTIVE = 1;
+constexpr uint8_t DONE = 2;
+
+void setStatus(WcetAnalyzer::Wcet &wcet, WcetStatus status, uint32_t at) {
+    if (wcet.status == WCET_OK) {
+        wcet.status = status;
+        wcet.at = at;
+    }
+}
+
+/** Blocks of a function in local index, where loops are collapsed into their header. */
+struct Region {
+    std::vector<uint64_t> cost;
+    std::vector<std::vector<int32_t>> succs;
+    std::vector<std::vector<int32_t>> preds;
+    std::vector<std::vector<int32_t>> members;
+    std::vector<int32_t> rep;
+    std::vector<int32_t> mark;
+
+    Region(size_t n) : cost(n), succs(n), preds(n), members(n), rep(n), mark(n, FlowGraph::NONE) {
+        for (size_t i = 0; i < n; i++) {
+            members[i].push_back(i);
+            rep[i] = i;
+        }
+    }
+
+    int32_t find(int32_t x) {
+        while (rep[x] != x)
+            x = rep[x] = rep[rep[x]];
+        return x;
+    }
+
+    /** Whether |y| is in the body of loop |header|, or in the function if |header| is NONE. */
+    bool inside(int32_t y, int32_t header) const {
+        return header == FlowGraph::NONE || (y != header && mark[y] == header);
+    }
+
+    /**
+     * Longest path from |start| within the body of loop |header|. Set |cyclic| when there is a
+     * cycle which isn't collapsed.
+     */
+    uint64_t longestPath(int32_t start, int32_t header, bool &cyclic) {
+        const auto n = cost.size();
+        std::vector<uint8_t> state(n, NEW);
+        std::vector<uint64_t> dist(n, 0);
+        std::vector<std::vector<int32_t>> kids(n);
+        std::vector<std::pair<int32_t, size_t>> stack;
+        auto visit = [&](int32_t x) {
+            state[x] = ACTIVE;
+            for (const auto m : members[x]) {
+                for (const auto s : succs[m]) {
+                    const auto y = find(s);
+                    if (y != x && inside(y, header))
+                        kids[x].push_back(y);
+                }
+            }
+            stack.emplace_back(x, 0);
+        };
+        visit(start);
+        while (!stack.empty()) {
+            const auto x = stack.back().first;
+            auto &i = stack.back().second;
+            if (i < kids[x].size()) {
+                const auto y = kids[x][i++];
+                if (state[y] == NEW) {
+                    visit(y);
+                } else if (state[y] == ACTIVE) {
+                    cyclic = true;
+                }
+                continue;
+            }
+            uint64_t longest = 0;
+            for (const auto y : kids[x]) {
+                if (state[y] == DONE)
+                    longest = std::max(longest, dist[y]);
+            }
+            dist[x] = cost[x] + longest;
+            state[x] = DONE;
+            stack.pop_back();
+        }
+        return dist[start];
+    }
+};
+
+}  // namespace
+
+WcetAnalyzer::WcetAnalyzer(const FlowGraph &graph) : _graph(graph) {}
+
+void WcetAnalyzer::analyze() {
+    const auto size = _graph.functions().size();
+    _wcets.assign(size, Wcet{0, WCET_OK, 0});
+    _states.assign(size, NEW);
+    for (size_t func = 0; func < size; func++) {
+        if (_states[func] == NEW)
+            analyze(func);
+    }
+}
+
+void WcetAnalyzer::analyze(int32_t func) {
+    const auto &insns = _graph.insns();
+    const auto &blocks = _graph.blocks();
+    auto &wcet = _wcets[func];
+    _states[func] = ACTIVE;
+    const auto entry = _graph.functions()[func].block;
+    if (entry == FlowGraph::NONE) {
+        setStatus(wcet, WCET_UNKNOWN_TARGET, _graph.functions()[func].entry);
+        _states[func] = DONE;
+        return;
+    }
+
+    // Collect blocks reachable from the entry without following calls.
+    std::vector<int32_t> nodes{entry};
+    std::unordered_map<int32_t, int32_t> local{{entry, 0}};
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const auto &block = blocks[nodes[i]];
+        for (const auto b : {block.next, block.jump}) {
+            if (b != FlowGraph::NONE && local.emplace(b, nodes.size()).second)
+                nodes.push_back(b);
+        }
+    }
+
+    Region region(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const auto &block = blocks[nodes[i]];
+        uint64_t cost = 0;
+        for (auto n = block.first; n < block.end; n++) {
+            if (!insns[n].cycles.known())
+                setStatus(wcet, WCET_UNKNOWN_CYCLES, insns[n].address);
+            cost += insns[n].cycles.max;
+        }
+        const auto &last = insns[block.end - 1];
+        if (block.callee != FlowGraph::NONE) {
+            if (_states[block.callee] == ACTIVE) {
+                setStatus(wcet, WCET_RECURSION, last.address);
+            } else {
+                if (_states[block.callee] == NEW)
+                    analyze(block.callee);
+                const auto &callee = _wcets[block.callee];
+                cost += callee.cycles;
+                setStatus(wcet, callee.status, callee.at);
+            }
+        } else if (last.flow.type == FLOW_CALL) {
+            setStatus(wcet, WCET_UNKNOWN_TARGET, last.address);
+        }
+        if (last.flow.type == FLOW_JUMP && block.jump == FlowGraph::NONE)
+            setStatus(wcet, WCET_UNKNOWN_TARGET, last.address);
+        region.cost[i] = cost;
+        for (const auto b : {block.next, block.jump}) {
+            if (b != FlowGraph::NONE) {
+                const auto j = local[b];
+                region.succs[i].push_back(j);
+                region.preds[j].push_back(i);
+            }
+        }
+    }
+
+    // Find back edges by depth first search.
+    const auto n = nodes.size();
+    std::vector<int32_t> order(n, FlowGraph::NONE);
+    std::vector<bool> active(n, false);
+    std::vector<std::pair<int32_t, int32_t>> backs;  // header and latch
+    std::vector<std::pair<int32_t, size_t>> stack{{0, 0}};
+    int32_t count = 0;
+    order[0] = count++;
+    active[0] = true;
+    while (!stack.empty()) {
+        const auto x = stack.back().first;
+        auto &i = stack.back().second;
+        if (i < region.succs[x].size()) {
+            const auto y = region.succs[x][i++];
+            if (order[y] == FlowGraph::NONE) {
+                order[y] = count++;
+                active[y] = true;
+                stack.emplace_back(y, 0);
+            } else if (active[y]) {
+                backs.emplace_back(y, x);
+            }
+            continue;
+        }
+        active[x] = false;
+        stack.pop_back();
+    }
+
+    // Collapse innermost loops first; an inner header is found later than its outer header.
+    std::sort(backs.begin(), backs.end(), [&order](const std::pair<int32_t, int32_t> &a,
+                                                  const std::pair<int32_t, int32_t> &b) {
+        return order[a.first] > order[b.first];
+    });
+    for (size_t i = 0; i < backs.size();) {
+        const auto header = backs[i].first;
+        std::vector<int32_t> body;
+        for (; i < backs.size() && backs[i].first == header; i++) {
+            const auto latch = region.find(backs[i].second);
+            if (latch != header && region.mark[latch] != header) {
+                region.mark[latch] = header;
+                body.push_back(latch);
+            }
+        }
+        for (size_t k = 0; k < body.size(); k++) {
+            for (const auto m : region.members[body[k]]) {
+                for (const auto p : region.preds[m]) {
+                    const auto q = region.find(p);
+                    if (q != header && region.mark[q] != header) {
+                        region.mark[q] = header;
+                        body.push_back(q);
+                    }
+                }
+            }
+        }
+
+        const auto address = insns[blocks[nodes[header]].first].address;
+        uint64_t bound = 1;
+        const auto it = _bounds.find(address);
+        if (it == _bounds.end()) {
+            setStatus(wcet, WCET_NO_LOOP_BOUND, address);
+        } else {
+            bound = it->second;
+        }
+        auto cyclic = false;
+        const auto iteration = region.longestPath(header, header, cyclic);
+        if (cyclic)
+            setStatus(wcet, WCET_NO_LOOP_BOUND, address);
+        region.cost[header] = bound * iteration;
+        for (const auto x : body) {
+            region.rep[x] = header;
+            auto &members = region.members[header];
+            members.insert(members.end(), region.members[x].begin(), region.members[x].end());
+            region.members[x].clear();
+        }
+    }
+
+    auto cyclic = false;
+    const auto cycles = region.longestPath(region.find(0), FlowGraph::NONE, cyclic);
+    if (cyclic)
+        setStatus(wcet, WCET_NO_LOOP_BOUND, _graph.functions()[func].entry);
+    wcet.cycles = std::min<uint64_t>(cycles, UINT32_MAX);
+    _states[func] = DONE;
+}
+
+}  // namespace driver
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
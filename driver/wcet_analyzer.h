@@ -0,0 +1,80 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __WCET_ANALYZER_H__
+#define __WCET_ANALYZER_H__
+
+#include "flow_graph.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace libasm {
+namespace driver {
+
+enum WcetStatus : uint8_t {
+    WCET_OK = 0,
+    WCET_UNKNOWN_TARGET = 1,  // jump or call target is unknown or can't be decoded
+    WCET_UNKNOWN_CYCLES = 2,  // cycles of an instruction are unknown
+    WCET_NO_LOOP_BOUND = 3,   // loop has no bound
+    WCET_RECURSION = 4,       // function calls itself
+};
+
+/**
+ * Static worst case execution time of functions in a |FlowGraph|.
+ *
+ * Each function is analyzed after its callees. Innermost loops are
+ * collapsed first into their header block, whose cost is the bound
+ * times the longest path of an iteration. Then the longest path from
+ * the entry block is the worst case.
+ */
+class WcetAnalyzer {
+public:
+    WcetAnalyzer(const FlowGraph &graph);
+
+    /** Bound loop whose header is at |address| to execute its header at most |count| times. */
+    void setLoopBound(uint32_t address, uint32_t count) { _bounds[address] = count; }
+    void analyze();
+
+    struct Wcet {
+        uint32_t cycles;    // worst case cycles including callees
+        WcetStatus status;  // why |cycles| may not be the upper bound
+        uint32_t at;        // address where |status| is detected
+    };
+    /** returns worst case of |function| index of |FlowGraph| */
+    const Wcet &wcet(int32_t function) const { return _wcets[function]; }
+
+private:
+    const FlowGraph &_graph;
+    std::map<uint32_t, uint32_t> _bounds;
+    std::vector<Wcet> _wcets;
+    std::vector<uint8_t> _states;
+
+    void analyze(int32_t function);
+};
+
+}  // namespace driver
+}  // namespace libasm
+
+#endif
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
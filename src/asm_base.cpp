@@ -15,6 +15,7 @@
  */
 
 #include "asm_base.h"
+#include "phase_stats.h"
 
 namespace libasm {
 
@@ -27,6 +28,7 @@ Error Assembler::setCurrentLocation(uint32_t location) {
 }
 
 Error Assembler::encode(const char *line, Insn &insn, SymbolTable *symtab) {
+    LIBASM_STATS_SCOPE(ENCODING);
     _symtab = symtab;
     setAt(line);
     StrScanner scan(line);
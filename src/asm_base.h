@@ -54,6 +54,8 @@ struct Assembler : ErrorAt, private ValueParser::Locator {
 
     /** Whether this CPU has "SET" instruction which conflict with "SET" directive */
     virtual bool hasSetInstruction() const { return false; }
+    /** Whether |insn| is generated by a pseudo instruction, such as data definition */
+    bool isPseudo(const Insn &insn) const { return _pseudos.search(insn) != nullptr; }
 
     Error setCurrentLocation(uint32_t location);
     uint32_t currentLocation() const { return _currentLocation; }
@@ -133,6 +133,37 @@ struct ConfigSetter {
     }
 };
 
+/**
+ * Returns true if |cpuType| is one of |cpus|.
+ *
+ * A CPU family which has several variants declares the selected variants as |CPUS| in its
+ * config header. Those can be narrowed at compile time by defining LIBASM_<FAMILY>_CPUS to a
+ * comma separated list of CpuType, such as -DLIBASM_MC6809_CPUS=HD6309. The first one becomes
+ * the default CPU, and instruction tables only used by the other variants are not linked.
+ */
+template <typename CPUTYPE, size_t N>
+constexpr bool cpuSelected(const CPUTYPE (&cpus)[N], CPUTYPE cpuType, size_t i = 0) {
+    // A single return statement keeps this a constant expression in C++11.
+    return i < N && (cpus[i] == cpuType || cpuSelected(cpus, cpuType, i + 1));
+}
+
+/** Returns true if |cpuType| is one of |cpus| in PROGMEM until |end|, or |cpus| is nullptr. */
+template <typename CPUTYPE>
+bool cpuSelected_P(const /*PROGMEM*/ CPUTYPE *cpus, const /*PROGMEM*/ CPUTYPE *end, CPUTYPE cpuType) {
+    if (cpus == nullptr)
+        return true;
+    for (const auto *cpu = cpus; cpu < end; cpu++) {
+        if (cpuType == static_cast<CPUTYPE>(pgm_read_byte(cpu)))
+            return true;
+    }
+    return false;
+}
+
+/** ARRAY_RANGE(|array|) if |cpuType| is in |CPUS|, otherwise an empty range. */
+#define CPU_RANGE(cpuType, array)                                \
+    (cpuSelected(CPUS, cpuType) ? ARRAY_BEGIN(array) : nullptr), \
+            (cpuSelected(CPUS, cpuType) ? ARRAY_END(array) : nullptr)
+
 /** Base class for instruction table fo |CPUTYPE|. */
 template <typename CPUTYPE>
 struct InsnTable {
@@ -168,7 +199,9 @@ struct ConfigImpl : ConfigBase, ConfigSetter {
         auto p = scan.skipSpaces();
         auto name = OptionBase::readSymbol(p);
         CPUTYPE cpuType;
-        const auto error = _table.searchCpuName(name, cpuType);
+        auto error = _table.searchCpuName(name, cpuType);
+        if (error == OK && !cpuSelected_P(_cpus, _cpusEnd, cpuType))
+            error = UNSUPPORTED_CPU;
         if (error == OK) {
             setCpuType(cpuType);
             scan = p;
@@ -179,10 +212,20 @@ struct ConfigImpl : ConfigBase, ConfigSetter {
 private:
     const InsnTable<CPUTYPE> &_table;
     CPUTYPE _cpuType;
+    const /*PROGMEM*/ CPUTYPE *_cpus;
+    const /*PROGMEM*/ CPUTYPE *_cpusEnd;
 
 protected:
     ConfigImpl(const InsnTable<CPUTYPE> &table, CPUTYPE defaultCpu)
-        : _table(table), _cpuType(defaultCpu) {}
+        : _table(table), _cpuType(defaultCpu), _cpus(nullptr), _cpusEnd(nullptr) {}
+
+    /** |cpus| are the selected variants in PROGMEM and the first one is the default. */
+    template <size_t N>
+    ConfigImpl(const InsnTable<CPUTYPE> &table, const /*PROGMEM*/ CPUTYPE (&cpus)[N])
+        : _table(table),
+          _cpuType(static_cast<CPUTYPE>(pgm_read_byte(&cpus[0]))),
+          _cpus(cpus),
+          _cpusEnd(cpus + N) {}
 };
 
 }  // namespace libasm
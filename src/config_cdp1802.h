@@ -28,8 +28,15 @@ enum CpuType : uint8_t {
     CDP1804A,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_CDP1802_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_CDP1802_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {CDP1802, CDP1804, CDP1804A};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_16BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_BIG, 4, 4> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CDP1802){};
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace cdp1802
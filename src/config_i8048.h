@@ -33,8 +33,15 @@ enum CpuType : uint8_t {
     MSM80C39,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_I8048_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_I8048_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {I8048, I8039, I80C48, I80C39, MSM80C48, MSM80C39};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_12BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_BIG, 2, 5> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, I8048) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace i8048
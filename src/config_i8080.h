@@ -28,8 +28,15 @@ enum CpuType : uint8_t {
     V30EMU,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_I8080_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_I8080_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {I8080, I8085, V30EMU};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_16BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_LITTLE, 3, 5> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, I8080) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace i8080
@@ -28,8 +28,15 @@ enum CpuType : uint8_t {
     V30,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_I8086_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_I8086_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {I8086, I80186, V30};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_20BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_LITTLE, 7, 6> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, I8086) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace i8086
@@ -30,9 +30,16 @@ enum CpuType : uint8_t {
     MC68HC11,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_MC6800_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_MC6800_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {MC6800, MB8861, MC6801, HD6301, MC68HC11};
+#endif
+
 struct Config
     : public ConfigImpl<CpuType, ADDRESS_16BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_BIG, 5, 5> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, MC6800) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace mc6800
@@ -28,8 +28,15 @@ enum CpuType : uint8_t {
     MC68HC05,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_MC6805_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_MC6805_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {MC6805, MC146805, MC68HC05};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_16BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_BIG, 3, 5> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, MC6805) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace mc6805
@@ -27,8 +27,15 @@ enum CpuType : uint8_t {
     HD6309,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_MC6809_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_MC6809_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {MC6809, HD6309};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_16BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_BIG, 5, 5> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, MC6809) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace mc6809
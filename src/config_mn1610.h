@@ -28,8 +28,15 @@ enum CpuType : uint8_t {
     MN1613A,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_MN1610_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_MN1610_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {MN1610, MN1613, MN1613A};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_18BIT, ADDRESS_WORD, OPCODE_16BIT, ENDIAN_BIG, 4, 4> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, MN1610) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 
     AddressWidth addressWidth() const override {
         return cpuType() == MN1610 ? ADDRESS_16BIT : ADDRESS_18BIT;
@@ -30,8 +30,15 @@ enum CpuType : uint8_t {
     W65C816,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_MOS6502_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_MOS6502_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {MOS6502, G65SC02, R65C02, W65C02S, W65C816};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_24BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_LITTLE, 4, 4> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, MOS6502) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 
     AddressWidth addressWidth() const override {
         return cpuType() == W65C816 ? ADDRESS_24BIT : ADDRESS_16BIT;
@@ -27,9 +27,16 @@ enum CpuType : uint8_t {
     TMS32015,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_TMS32010_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_TMS32010_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {TMS32010, TMS32015};
+#endif
+
 struct Config
     : ConfigImpl<CpuType, ADDRESS_12BIT, ADDRESS_WORD, OPCODE_16BIT, ENDIAN_LITTLE, 4, 4> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, TMS32010) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 
     uint16_t dataMemoryLimit() const {
         return cpuType() == TMS32010 ? 0x8F : 0xFF;
@@ -28,8 +28,15 @@ enum CpuType : uint8_t {
     TMS99105,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_TMS9900_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_TMS9900_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {TMS9900, TMS9995, TMS99105};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_16BIT, ADDRESS_BYTE, OPCODE_16BIT, ENDIAN_BIG, 8, 4> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, TMS9900) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace tms9900
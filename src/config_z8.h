@@ -28,8 +28,15 @@ enum CpuType : uint8_t {
     SUPER8,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_Z8_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_Z8_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {Z8, Z86C, SUPER8};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_16BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_BIG, 4, 7> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, Z8) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 
     bool isSuper8() const { return cpuType() == SUPER8; }
 };
@@ -29,8 +29,15 @@ enum CpuType : uint8_t {
     V30EMU,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_Z80_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_Z80_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {Z80, I8080, I8085, V30EMU};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_16BIT, ADDRESS_BYTE, OPCODE_8BIT, ENDIAN_LITTLE, 4, 5> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, Z80) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 };
 
 }  // namespace z80
@@ -27,8 +27,15 @@ enum CpuType : uint8_t {
     Z8002,
 };
 
+/** CPU variants to be linked, see cpuSelected(). */
+#if defined(LIBASM_Z8000_CPUS)
+constexpr CpuType CPUS[] PROGMEM = {LIBASM_Z8000_CPUS};
+#else
+constexpr CpuType CPUS[] PROGMEM = {Z8001, Z8002};
+#endif
+
 struct Config : ConfigImpl<CpuType, ADDRESS_23BIT, ADDRESS_BYTE, OPCODE_16BIT, ENDIAN_BIG, 10, 6> {
-    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, Z8001) {}
+    Config(const InsnTable<CpuType> &table) : ConfigImpl(table, CPUS) {}
 
     AddressWidth addressWidth() const override {
         return segmentedModel() ? ADDRESS_23BIT : ADDRESS_16BIT;
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CYCLES_BASE_H__
+#define __CYCLES_BASE_H__
+
+#include <stdint.h>
+
+namespace libasm {
+
+/**
+ * Clock cycles of an instruction. |max| is larger than |min| when cycles
+ * depend on run time, such as a branch taken, a page boundary crossed,
+ * or a count of repetition. Both are zero when unknown.
+ */
+struct Cycles {
+    constexpr Cycles() : min(0), max(0) {}
+    constexpr Cycles(uint16_t cycles) : min(cycles), max(cycles) {}
+    constexpr Cycles(uint16_t min_, uint16_t max_) : min(min_), max(max_) {}
+
+    uint16_t min;
+    uint16_t max;
+
+    bool known() const { return max != 0; }
+    Cycles operator+(const Cycles &other) const { return Cycles(min + other.min, max + other.max); }
+    Cycles &operator+=(const Cycles &other) { return *this = *this + other; }
+};
+
+/**
+ * Count clock cycles of instructions of a CPU from their bytes.
+ */
+struct CycleCounter {
+    /** name of CPU which cycles are counted for */
+    virtual const /*PROGMEM*/ char *cpu_P() const = 0;
+    /** returns clock cycles of instruction |bytes| of |length|, or unknown */
+    virtual Cycles count(const uint8_t *bytes, uint8_t length) const = 0;
+};
+
+}  // namespace libasm
+
+#endif  // __CYCLES_BASE_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
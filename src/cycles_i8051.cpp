@@ -0,0 +1,74 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cycles_i8051.h"
+
+#include "config_host.h"
+#include "text_i8051.h"
+
+using namespace libasm::text::i8051;
+
+namespace libasm {
+namespace i8051 {
+
+namespace {
+
+#define NA 0
+
+// clang-format off
+constexpr uint8_t I8051_CYCLES[] PROGMEM = {
+     1,  2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 00
+     2,  2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 10
+     2,  2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 20
+     2,  2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 30
+     2,  2,  1,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 40
+     2,  2,  1,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 50
+     2,  2,  1,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 60
+     2,  2,  2,  2,  1,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 70
+     2,  2,  2,  2,  4,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  // 80
+     2,  2,  2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // 90
+     2,  2,  1,  2,  4, NA,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  // A0
+     2,  2,  1,  1,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  // B0
+     2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // C0
+     2,  2,  1,  1,  1,  2,  1,  1,  2,  2,  2,  2,  2,  2,  2,  2,  // D0
+     2,  2,  2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // E0
+     2,  2,  2,  2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  // F0
+};
+// clang-format on
+
+}  // namespace
+
+const /*PROGMEM*/ char *CyclesI8051::cpu_P() const {
+    return TEXT_CPU_8051;
+}
+
+Cycles CyclesI8051::count(const uint8_t *bytes, uint8_t length) const {
+    if (length == 0)
+        return Cycles();
+    return Cycles(pgm_read_byte(&I8051_CYCLES[bytes[0]]));
+}
+
+const CyclesI8051 CYCLES;
+
+}  // namespace i8051
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
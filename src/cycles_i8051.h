@@ -0,0 +1,45 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CYCLES_I8051_H__
+#define __CYCLES_I8051_H__
+
+#include "cycles_base.h"
+
+namespace libasm {
+namespace i8051 {
+
+/**
+ * Machine cycles of i8051, each of which is 12 oscillator periods.
+ */
+struct CyclesI8051 final : CycleCounter {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    Cycles count(const uint8_t *bytes, uint8_t length) const override;
+};
+
+extern const CyclesI8051 CYCLES;
+
+}  // namespace i8051
+}  // namespace libasm
+
+#endif  // __CYCLES_I8051_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
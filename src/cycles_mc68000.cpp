@@ -0,0 +1,340 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cycles_mc68000.h"
+
+#include "config_host.h"
+#include "text_mc68000.h"
+
+using namespace libasm::text::mc68000;
+
+namespace libasm {
+namespace mc68000 {
+
+namespace {
+
+constexpr uint8_t IMMEDIATE = 074;  // #imm effective address
+
+// Effective address calculation of byte and word; Dn An (An) (An)+ -(An) d16(An) d8(An,Xn)
+// abs.W abs.L d16(PC) d8(PC,Xn) #imm
+constexpr uint8_t EA_CYCLES[] PROGMEM = {0, 0, 4, 4, 6, 8, 10, 8, 12, 8, 10, 4};
+
+// Control addressing; (An) d16(An) d8(An,Xn) abs.W abs.L d16(PC) d8(PC,Xn)
+constexpr uint8_t JMP_CYCLES[] PROGMEM = {8, 10, 14, 10, 12, 10, 14};
+constexpr uint8_t LEA_CYCLES[] PROGMEM = {4, 8, 12, 8, 12, 8, 12};
+
+uint8_t mode(uint8_t ea) {
+    return (ea >> 3) & 7;
+}
+
+bool dataReg(uint8_t ea) {
+    return mode(ea) == 0;
+}
+
+/** Register direct or immediate */
+bool regOrImm(uint8_t ea) {
+    return mode(ea) <= 1 || ea == IMMEDIATE;
+}
+
+uint8_t eaCycles(uint8_t ea, bool isLong) {
+    const uint8_t index = mode(ea) < 7 ? mode(ea) : 7 + (ea & 7);
+    if (index >= sizeof(EA_CYCLES))
+        return 0;
+    const auto cycles = pgm_read_byte(&EA_CYCLES[index]);
+    return (isLong && index >= 2) ? cycles + 4 : cycles;
+}
+
+/** Writing to -(An) takes the same cycles as (An). */
+uint8_t writeCycles(uint8_t ea, bool isLong) {
+    return eaCycles(mode(ea) == 4 ? (ea & ~070) | 020 : ea, isLong);
+}
+
+Cycles control(const /*PROGMEM*/ uint8_t *table, uint8_t ea) {
+    uint8_t index;
+    if (mode(ea) == 2) {
+        index = 0;
+    } else if (mode(ea) == 5 || mode(ea) == 6) {
+        index = mode(ea) - 4;
+    } else if (mode(ea) == 7 && (ea & 7) < 4) {
+        index = 3 + (ea & 7);
+    } else {
+        return Cycles();
+    }
+    return pgm_read_byte(&table[index]);
+}
+
+uint8_t bitCount(uint16_t bits) {
+    uint8_t n = 0;
+    for (; bits; bits &= bits - 1)
+        n++;
+    return n;
+}
+
+Cycles bitOrImmediate(uint16_t opc) {
+    const uint8_t ea = opc & 077;
+    if ((opc & 0x0138) == 0x0108)  // MOVEP
+        return (opc & 0x40) ? 24 : 16;
+    if ((opc & 0x0100) || (opc & 0x0F00) == 0x0800) {  // BTST BCHG BCLR BSET
+        const auto type = (opc >> 6) & 3;
+        const uint8_t extra = (opc & 0x0100) ? 0 : 4;  // static bit number
+        if (dataReg(ea)) {
+            static constexpr uint8_t REG_CYCLES[] = {6, 8, 10, 8};
+            const uint8_t cycles = REG_CYCLES[type] + extra;
+            return type == 0 ? Cycles(cycles) : Cycles(cycles - 2, cycles);  // bit 0~15 is faster
+        }
+        return (type == 0 ? 4 : 8) + extra + eaCycles(ea, false);
+    }
+    if (ea == IMMEDIATE)  // ANDI/EORI/ORI to CCR/SR
+        return 20;
+    const auto isLong = ((opc >> 6) & 3) == 2;
+    const auto op = (opc >> 9) & 7;
+    if (op == 6) {  // CMPI
+        if (dataReg(ea))
+            return isLong ? 14 : 8;
+        return (isLong ? 12 : 8) + eaCycles(ea, isLong);
+    }
+    if (dataReg(ea))
+        return isLong ? (op == 1 ? 14 : 16) : 8;  // ANDI.L is faster
+    return (isLong ? 20 : 12) + eaCycles(ea, isLong);
+}
+
+Cycles move(uint16_t opc, bool isLong) {
+    const uint8_t dst = ((opc >> 3) & 070) | ((opc >> 9) & 7);
+    return 4 + eaCycles(opc & 077, isLong) + writeCycles(dst, isLong);
+}
+
+Cycles miscellaneous(const uint8_t *bytes, uint8_t length) {
+    const uint16_t opc = (static_cast<uint16_t>(bytes[0]) << 8) | bytes[1];
+    const uint8_t ea = opc & 077;
+    const auto size = (opc >> 6) & 3;
+    const auto isLong = size == 2;
+    switch (opc) {
+    case 0x4AFC:  // ILLEGAL
+        return 34;
+    case 0x4E70:  // RESET
+        return 132;
+    case 0x4E71:  // NOP
+    case 0x4E72:  // STOP
+        return 4;
+    case 0x4E73:  // RTE
+    case 0x4E77:  // RTR
+        return 20;
+    case 0x4E75:  // RTS
+        return 16;
+    case 0x4E76:  // TRAPV
+        return Cycles(4, 34);
+    }
+    if ((opc & 0xFFF0) == 0x4E40)  // TRAP
+        return 34;
+    if ((opc & 0xFFF8) == 0x4E50)  // LINK
+        return 16;
+    if ((opc & 0xFFF8) == 0x4E58)  // UNLK
+        return 12;
+    if ((opc & 0xFFF0) == 0x4E60)  // MOVE USP
+        return 4;
+    if ((opc & 0xFFC0) == 0x4E80)  // JSR
+        return control(JMP_CYCLES, ea) + 8;
+    if ((opc & 0xFFC0) == 0x4EC0)  // JMP
+        return control(JMP_CYCLES, ea);
+    if ((opc & 0xF1C0) == 0x41C0)  // LEA
+        return control(LEA_CYCLES, ea);
+    if ((opc & 0xF1C0) == 0x4180) {  // CHK
+        const auto cycles = eaCycles(ea, false);
+        return Cycles(10 + cycles, 40 + cycles);
+    }
+    if ((opc & 0xFFC0) == 0x4840)  // SWAP, PEA
+        return dataReg(ea) ? Cycles(4) : control(LEA_CYCLES, ea) + 8;
+    if ((opc & 0xFFB8) == 0x4880)  // EXT
+        return 4;
+    if ((opc & 0xFB80) == 0x4880) {  // MOVEM
+        if (length < 4)
+            return Cycles();
+        const auto regs = bitCount((static_cast<uint16_t>(bytes[2]) << 8) | bytes[3]);
+        const auto perReg = (opc & 0x40) ? 8 : 4;
+        if (opc & 0x0400)  // memory to registers
+            return 12 - 4 + eaCycles(ea, false) + perReg * regs;
+        return 8 - 4 + writeCycles(ea, false) + perReg * regs;
+    }
+    if ((opc & 0xFFC0) == 0x40C0)  // MOVE from SR
+        return dataReg(ea) ? 6 : 8 + eaCycles(ea, false);
+    if ((opc & 0xFDC0) == 0x44C0)  // MOVE to CCR/SR
+        return 12 + eaCycles(ea, false);
+    if ((opc & 0xFFC0) == 0x4800)  // NBCD
+        return dataReg(ea) ? 6 : 8 + eaCycles(ea, false);
+    if ((opc & 0xFFC0) == 0x4AC0)  // TAS
+        return dataReg(ea) ? 4 : 14 + eaCycles(ea, false);
+    if ((opc & 0xFF00) == 0x4A00)  // TST
+        return 4 + eaCycles(ea, isLong);
+    if ((opc & 0xF900) == 0x4000 && size != 3) {  // NEGX CLR NEG NOT
+        if (dataReg(ea))
+            return isLong ? 6 : 4;
+        return (isLong ? 12 : 8) + eaCycles(ea, isLong);
+    }
+    return Cycles();
+}
+
+Cycles quickOrCondition(uint16_t opc) {
+    const uint8_t ea = opc & 077;
+    const auto size = (opc >> 6) & 3;
+    if (size == 3) {
+        if (mode(ea) == 1)  // DBcc
+            return Cycles(10, 14);
+        if (dataReg(ea))  // Scc
+            return Cycles(4, 6);
+        return 8 + eaCycles(ea, false);
+    }
+    const auto isLong = size == 2;  // ADDQ SUBQ
+    if (dataReg(ea))
+        return isLong ? 8 : 4;
+    if (mode(ea) == 1)
+        return 8;
+    return (isLong ? 12 : 8) + eaCycles(ea, isLong);
+}
+
+Cycles branch(uint16_t opc) {
+    const auto cond = (opc >> 8) & 0xF;
+    if (cond == 0)  // BRA
+        return 10;
+    if (cond == 1)  // BSR
+        return 18;
+    return (opc & 0xFF) == 0 ? Cycles(10, 12) : Cycles(8, 10);  // word branch not taken is slower
+}
+
+/** ADD AND OR SUB */
+Cycles standard(uint16_t opc) {
+    const uint8_t ea = opc & 077;
+    const auto opmode = (opc >> 6) & 7;
+    const auto isLong = (opmode & 3) == 2;
+    if (opmode < 4) {  // <ea>,Dn
+        if (!isLong)
+            return 4 + eaCycles(ea, false);
+        return 6 + eaCycles(ea, true) + (regOrImm(ea) ? 2 : 0);
+    }
+    return (isLong ? 12 : 8) + eaCycles(ea, isLong);  // Dn,<ea>
+}
+
+Cycles orAnd(uint16_t opc) {
+    const uint8_t ea = opc & 077;
+    const auto opmode = (opc >> 6) & 7;
+    const auto isAnd = (opc & 0xF000) == 0xC000;
+    if (opmode == 3 || opmode == 7) {
+        const auto cycles = eaCycles(ea, false);
+        if (isAnd)  // MULU MULS
+            return Cycles(38 + cycles, 70 + cycles);
+        return (opmode == 3 ? 140 : 158) + cycles;  // DIVU DIVS
+    }
+    if ((opc & 0x01F0) == 0x0100)  // ABCD SBCD
+        return (opc & 010) ? 18 : 6;
+    if (isAnd && (opmode == 5 || opmode == 6) && mode(ea) <= 1)  // EXG
+        return 6;
+    return standard(opc);
+}
+
+Cycles addSub(uint16_t opc) {
+    const uint8_t ea = opc & 077;
+    const auto opmode = (opc >> 6) & 7;
+    if (opmode == 3)  // ADDA.W SUBA.W
+        return 8 + eaCycles(ea, false);
+    if (opmode == 7)  // ADDA.L SUBA.L
+        return 6 + eaCycles(ea, true) + (regOrImm(ea) ? 2 : 0);
+    if ((opc & 0x0130) == 0x0100) {  // ADDX SUBX
+        const auto isLong = opmode == 6;
+        if (opc & 010)
+            return isLong ? 30 : 18;
+        return isLong ? 8 : 4;
+    }
+    return standard(opc);
+}
+
+Cycles compareEor(uint16_t opc) {
+    const uint8_t ea = opc & 077;
+    const auto opmode = (opc >> 6) & 7;
+    const auto isLong = (opmode & 3) == 2;
+    if (opmode == 3 || opmode == 7)  // CMPA
+        return 6 + eaCycles(ea, opmode == 7);
+    if (opmode < 4)  // CMP
+        return (isLong ? 6 : 4) + eaCycles(ea, isLong);
+    if (mode(ea) == 1)  // CMPM
+        return isLong ? 20 : 12;
+    if (dataReg(ea))  // EOR
+        return isLong ? 8 : 4;
+    return (isLong ? 12 : 8) + eaCycles(ea, isLong);
+}
+
+Cycles shiftRotate(uint16_t opc) {
+    const auto size = (opc >> 6) & 3;
+    if (size == 3)  // memory shifts by one
+        return 8 + eaCycles(opc & 077, false);
+    const uint8_t base = size == 2 ? 8 : 6;
+    if (opc & 040)  // count in register
+        return Cycles(base, base + 2 * 63);
+    const auto count = (opc >> 9) & 7;
+    return base + 2 * (count == 0 ? 8 : count);
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *CyclesMc68000::cpu_P() const {
+    return TEXT_CPU_68000;
+}
+
+Cycles CyclesMc68000::count(const uint8_t *bytes, uint8_t length) const {
+    if (length < 2)
+        return Cycles();
+    const uint16_t opc = (static_cast<uint16_t>(bytes[0]) << 8) | bytes[1];
+    switch (opc >> 12) {
+    case 0x0:
+        return bitOrImmediate(opc);
+    case 0x1:
+        return move(opc, false);
+    case 0x2:
+        return move(opc, true);
+    case 0x3:
+        return move(opc, false);
+    case 0x4:
+        return miscellaneous(bytes, length);
+    case 0x5:
+        return quickOrCondition(opc);
+    case 0x6:
+        return branch(opc);
+    case 0x7:  // MOVEQ
+        return 4;
+    case 0x8:
+    case 0xC:
+        return orAnd(opc);
+    case 0x9:
+    case 0xD:
+        return addSub(opc);
+    case 0xB:
+        return compareEor(opc);
+    case 0xE:
+        return shiftRotate(opc);
+    default:
+        return Cycles();
+    }
+}
+
+const CyclesMc68000 CYCLES;
+
+}  // namespace mc68000
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CYCLES_MC68000_H__
+#define __CYCLES_MC68000_H__
+
+#include "cycles_base.h"
+
+namespace libasm {
+namespace mc68000 {
+
+/**
+ * Clock cycles of MC68000 with no wait states, including effective
+ * address calculation. Cycles of a conditional branch depend on whether
+ * it is taken, and those of shift, multiply and MOVEM instructions depend
+ * on operands. Divide instructions are counted by their worst case.
+ */
+struct CyclesMc68000 final : CycleCounter {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    Cycles count(const uint8_t *bytes, uint8_t length) const override;
+};
+
+extern const CyclesMc68000 CYCLES;
+
+}  // namespace mc68000
+}  // namespace libasm
+
+#endif  // __CYCLES_MC68000_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
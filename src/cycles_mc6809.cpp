@@ -0,0 +1,171 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cycles_mc6809.h"
+
+#include "config_host.h"
+#include "text_mc6809.h"
+
+using namespace libasm::text::mc6809;
+
+namespace libasm {
+namespace mc6809 {
+
+namespace {
+
+constexpr uint8_t INDEXED = 0x20;  // add cycles of indexed post byte
+constexpr uint8_t STACK = 0x40;    // add cycles of registers pushed or pulled
+constexpr uint8_t LONG = 0x80;     // long branch taken adds a cycle
+
+#define X(cycles) ((cycles) | INDEXED)
+#define S(cycles) ((cycles) | STACK)
+#define L(cycles) ((cycles) | LONG)
+#define NA 0
+
+// clang-format off
+constexpr uint8_t MC6809_CYCLES[] PROGMEM = {
+        6,    NA,    NA,     6,     6,    NA,     6,     6,  // 00
+        6,     6,     6,    NA,     6,     6,     3,     6,  // 08
+       NA,    NA,     2,     4,    NA,    NA,     5,     9,  // 10
+       NA,     2,     3,    NA,     3,     2,     8,     6,  // 18
+        3,     3,     3,     3,     3,     3,     3,     3,  // 20
+        3,     3,     3,     3,     3,     3,     3,     3,  // 28
+     X(4),  X(4),  X(4),  X(4),  S(5),  S(5),  S(5),  S(5),  // 30
+       NA,     5,     3,     6,    20,    11,    NA,    19,  // 38
+        2,    NA,    NA,     2,     2,    NA,     2,     2,  // 40
+        2,     2,     2,    NA,     2,     2,    NA,     2,  // 48
+        2,    NA,    NA,     2,     2,    NA,     2,     2,  // 50
+        2,     2,     2,    NA,     2,     2,    NA,     2,  // 58
+     X(6),    NA,    NA,  X(6),  X(6),    NA,  X(6),  X(6),  // 60
+     X(6),  X(6),  X(6),    NA,  X(6),  X(6),  X(3),  X(6),  // 68
+        7,    NA,    NA,     7,     7,    NA,     7,     7,  // 70
+        7,     7,     7,    NA,     7,     7,     4,     7,  // 78
+        2,     2,     2,     4,     2,     2,     2,    NA,  // 80
+        2,     2,     2,     2,     4,     7,     3,    NA,  // 88
+        4,     4,     4,     6,     4,     4,     4,     4,  // 90
+        4,     4,     4,     4,     6,     7,     5,     5,  // 98
+     X(4),  X(4),  X(4),  X(6),  X(4),  X(4),  X(4),  X(4),  // A0
+     X(4),  X(4),  X(4),  X(4),  X(6),  X(7),  X(5),  X(5),  // A8
+        5,     5,     5,     7,     5,     5,     5,     5,  // B0
+        5,     5,     5,     5,     7,     8,     6,     6,  // B8
+        2,     2,     2,     4,     2,     2,     2,    NA,  // C0
+        2,     2,     2,     2,     3,    NA,     3,    NA,  // C8
+        4,     4,     4,     6,     4,     4,     4,     4,  // D0
+        4,     4,     4,     4,     5,     5,     5,     5,  // D8
+     X(4),  X(4),  X(4),  X(6),  X(4),  X(4),  X(4),  X(4),  // E0
+     X(4),  X(4),  X(4),  X(4),  X(5),  X(5),  X(5),  X(5),  // E8
+        5,     5,     5,     7,     5,     5,     5,     5,  // F0
+        5,     5,     5,     5,     6,     6,     6,     6,  // F8
+};
+
+struct Prefixed {
+    uint8_t opc;
+    uint8_t cycles;
+};
+
+constexpr Prefixed MC6809_P10[] PROGMEM = {
+    {0x21, 5}, {0x22, L(5)}, {0x23, L(5)}, {0x24, L(5)}, {0x25, L(5)}, {0x26, L(5)},
+    {0x27, L(5)}, {0x28, L(5)}, {0x29, L(5)}, {0x2A, L(5)}, {0x2B, L(5)}, {0x2C, L(5)},
+    {0x2D, L(5)}, {0x2E, L(5)}, {0x2F, L(5)}, {0x3F, 20}, {0x83, 5}, {0x8C, 5},
+    {0x8E, 4}, {0x93, 7}, {0x9C, 7}, {0x9E, 6}, {0x9F, 6}, {0xA3, X(7)},
+    {0xAC, X(7)}, {0xAE, X(6)}, {0xAF, X(6)}, {0xB3, 8}, {0xBC, 8}, {0xBE, 7},
+    {0xBF, 7}, {0xCE, 4}, {0xDE, 6}, {0xDF, 6}, {0xEE, X(6)}, {0xEF, X(6)},
+    {0xFE, 7}, {0xFF, 7},
+};
+
+constexpr Prefixed MC6809_P11[] PROGMEM = {
+    {0x3F, 20}, {0x83, 5}, {0x8C, 5}, {0x93, 7}, {0x9C, 7}, {0xA3, X(7)},
+    {0xAC, X(7)}, {0xB3, 8}, {0xBC, 8},
+};
+
+// Indexed addressing cycles by post byte bits 3~0, to which indirect adds 3;
+// ,R+ ,R++ ,-R ,--R ,R B,R A,R - n8,R n16,R - D,R n8,PCR n16,PCR - [n16]
+constexpr uint8_t INDEXED_CYCLES[] PROGMEM = {
+    2, 3, 2, 3, 0, 1, 1, NA, 1, 4, NA, 4, 1, 5, NA, 2,
+};
+// clang-format on
+
+uint8_t indexed(uint8_t post) {
+    if ((post & 0x80) == 0)
+        return 1;  // n5,R
+    const auto cycles = pgm_read_byte(&INDEXED_CYCLES[post & 0xF]);
+    return (post & 0x10) ? cycles + 3 : cycles;  // indirect
+}
+
+uint8_t stacked(uint8_t post) {
+    uint8_t cycles = 0;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (post & (1 << bit))
+            cycles += bit < 4 ? 1 : 2;  // CC, A, B, DP / X, Y, U/S, PC
+    }
+    return cycles;
+}
+
+uint8_t prefixed(const /*PROGMEM*/ Prefixed *table, const /*PROGMEM*/ Prefixed *end, uint8_t opc) {
+    for (const auto *entry = table; entry < end; entry++) {
+        if (pgm_read_byte(&entry->opc) == opc)
+            return pgm_read_byte(&entry->cycles);
+    }
+    return NA;
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *CyclesMc6809::cpu_P() const {
+    return TEXT_CPU_6809;
+}
+
+Cycles CyclesMc6809::count(const uint8_t *bytes, uint8_t length) const {
+    if (length == 0)
+        return Cycles();
+    auto opc = bytes[0];
+    uint8_t value;
+    uint8_t pos = 1;
+    if (opc == 0x10 || opc == 0x11) {
+        if (length < 2)
+            return Cycles();
+        const auto prefix = opc;
+        opc = bytes[pos++];
+        value = prefix == 0x10 ? prefixed(ARRAY_RANGE(MC6809_P10), opc)
+                               : prefixed(ARRAY_RANGE(MC6809_P11), opc);
+    } else {
+        if (opc == 0x3B)  // RTI
+            return Cycles(6, 15);
+        value = pgm_read_byte(&MC6809_CYCLES[opc]);
+    }
+    uint8_t cycles = value & 0x1F;
+    if (cycles == 0)
+        return Cycles();
+    if (value & (INDEXED | STACK)) {
+        if (pos >= length)
+            return Cycles();
+        const auto post = bytes[pos];
+        cycles += (value & INDEXED) ? indexed(post) : stacked(post);
+    }
+    return Cycles(cycles, (value & LONG) ? cycles + 1 : cycles);
+}
+
+const CyclesMc6809 CYCLES;
+
+}  // namespace mc6809
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CYCLES_MC6809_H__
+#define __CYCLES_MC6809_H__
+
+#include "cycles_base.h"
+
+namespace libasm {
+namespace mc6809 {
+
+/**
+ * E clock cycles of MC6809, including indexed addressing post byte and
+ * registers pushed or pulled. A long conditional branch taken adds one
+ * cycle, and RTI takes longer when the entire state was stacked.
+ */
+struct CyclesMc6809 final : CycleCounter {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    Cycles count(const uint8_t *bytes, uint8_t length) const override;
+};
+
+extern const CyclesMc6809 CYCLES;
+
+}  // namespace mc6809
+}  // namespace libasm
+
+#endif  // __CYCLES_MC6809_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
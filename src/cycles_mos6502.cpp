@@ -0,0 +1,99 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cycles_mos6502.h"
+
+#include "config_host.h"
+#include "text_mos6502.h"
+
+using namespace libasm::text::mos6502;
+
+namespace libasm {
+namespace mos6502 {
+
+namespace {
+
+constexpr uint8_t PAGE = 0x10;    // crossing a page boundary adds a cycle
+constexpr uint8_t BRANCH = 0x20;  // branch taken adds a cycle, and a page crossing more
+
+#define P(cycles) ((cycles) | PAGE)
+#define BR (2 | BRANCH)
+#define NA 0
+
+// clang-format off
+constexpr uint8_t MOS6502_CYCLES[] PROGMEM = {
+       7,    6,   NA,   NA,   NA,    3,    5,   NA,  // 00
+       3,    2,    2,   NA,   NA,    4,    6,   NA,  // 08
+      BR, P(5),   NA,   NA,   NA,    4,    6,   NA,  // 10
+       2, P(4),   NA,   NA,   NA, P(4),    7,   NA,  // 18
+       6,    6,   NA,   NA,    3,    3,    5,   NA,  // 20
+       4,    2,    2,   NA,    4,    4,    6,   NA,  // 28
+      BR, P(5),   NA,   NA,   NA,    4,    6,   NA,  // 30
+       2, P(4),   NA,   NA,   NA, P(4),    7,   NA,  // 38
+       6,    6,   NA,   NA,   NA,    3,    5,   NA,  // 40
+       3,    2,    2,   NA,    3,    4,    6,   NA,  // 48
+      BR, P(5),   NA,   NA,   NA,    4,    6,   NA,  // 50
+       2, P(4),   NA,   NA,   NA, P(4),    7,   NA,  // 58
+       6,    6,   NA,   NA,   NA,    3,    5,   NA,  // 60
+       4,    2,    2,   NA,    5,    4,    6,   NA,  // 68
+      BR, P(5),   NA,   NA,   NA,    4,    6,   NA,  // 70
+       2, P(4),   NA,   NA,   NA, P(4),    7,   NA,  // 78
+      NA,    6,   NA,   NA,    3,    3,    3,   NA,  // 80
+       2,   NA,    2,   NA,    4,    4,    4,   NA,  // 88
+      BR,    6,   NA,   NA,    4,    4,    4,   NA,  // 90
+       2,    5,    2,   NA,   NA,    5,   NA,   NA,  // 98
+       2,    6,    2,   NA,    3,    3,    3,   NA,  // A0
+       2,    2,    2,   NA,    4,    4,    4,   NA,  // A8
+      BR, P(5),   NA,   NA,    4,    4,    4,   NA,  // B0
+       2, P(4),    2,   NA, P(4), P(4), P(4),   NA,  // B8
+       2,    6,   NA,   NA,    3,    3,    5,   NA,  // C0
+       2,    2,    2,   NA,    4,    4,    6,   NA,  // C8
+      BR, P(5),   NA,   NA,   NA,    4,    6,   NA,  // D0
+       2, P(4),   NA,   NA,   NA, P(4),    7,   NA,  // D8
+       2,    6,   NA,   NA,    3,    3,    5,   NA,  // E0
+       2,    2,    2,   NA,    4,    4,    6,   NA,  // E8
+      BR, P(5),   NA,   NA,   NA,    4,    6,   NA,  // F0
+       2, P(4),   NA,   NA,   NA, P(4),    7,   NA,  // F8
+};
+// clang-format on
+
+}  // namespace
+
+const /*PROGMEM*/ char *CyclesMos6502::cpu_P() const {
+    return TEXT_CPU_6502;
+}
+
+Cycles CyclesMos6502::count(const uint8_t *bytes, uint8_t length) const {
+    if (length == 0)
+        return Cycles();
+    const auto cycles = pgm_read_byte(&MOS6502_CYCLES[bytes[0]]);
+    const uint8_t min = cycles & 0x0F;
+    if (cycles & BRANCH)
+        return Cycles(min, min + 2);
+    return Cycles(min, (cycles & PAGE) ? min + 1 : min);
+}
+
+const CyclesMos6502 CYCLES;
+
+}  // namespace mos6502
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
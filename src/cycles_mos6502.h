@@ -0,0 +1,47 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CYCLES_MOS6502_H__
+#define __CYCLES_MOS6502_H__
+
+#include "cycles_base.h"
+
+namespace libasm {
+namespace mos6502 {
+
+/**
+ * Clock cycles of MOS6502. A branch taken adds one cycle and crossing a
+ * page boundary adds one more. Indexed reads crossing a page boundary
+ * add one cycle.
+ */
+struct CyclesMos6502 final : CycleCounter {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    Cycles count(const uint8_t *bytes, uint8_t length) const override;
+};
+
+extern const CyclesMos6502 CYCLES;
+
+}  // namespace mos6502
+}  // namespace libasm
+
+#endif  // __CYCLES_MOS6502_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
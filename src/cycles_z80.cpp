@@ -0,0 +1,160 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cycles_z80.h"
+
+#include "config_host.h"
+#include "text_z80.h"
+
+using namespace libasm::text::z80;
+
+namespace libasm {
+namespace z80 {
+
+namespace {
+
+// Upper 2 bits of a table value select T-states added when taken.
+#define JR(tstates) ((tstates) | (1 << 5))    // JR cc, DJNZ, and block repeat
+#define RET(tstates) ((tstates) | (2 << 5))   // RET cc
+#define CALL(tstates) ((tstates) | (3 << 5))  // CALL cc
+#define NA 0
+
+constexpr uint8_t TAKEN[] = {0, 5, 6, 7};
+
+// clang-format off
+constexpr uint8_t Z80_CYCLES[] PROGMEM = {
+           4,       10,        7,        6,        4,        4,        7,        4,  // 00
+           4,       11,        7,        6,        4,        4,        7,        4,  // 08
+       JR(8),       10,        7,        6,        4,        4,        7,        4,  // 10
+          12,       11,        7,        6,        4,        4,        7,        4,  // 18
+       JR(7),       10,       16,        6,        4,        4,        7,        4,  // 20
+       JR(7),       11,       16,        6,        4,        4,        7,        4,  // 28
+       JR(7),       10,       13,        6,       11,       11,       10,        4,  // 30
+       JR(7),       11,       13,        6,        4,        4,        7,        4,  // 38
+           4,        4,        4,        4,        4,        4,        7,        4,  // 40
+           4,        4,        4,        4,        4,        4,        7,        4,  // 48
+           4,        4,        4,        4,        4,        4,        7,        4,  // 50
+           4,        4,        4,        4,        4,        4,        7,        4,  // 58
+           4,        4,        4,        4,        4,        4,        7,        4,  // 60
+           4,        4,        4,        4,        4,        4,        7,        4,  // 68
+           7,        7,        7,        7,        7,        7,        4,        7,  // 70
+           4,        4,        4,        4,        4,        4,        7,        4,  // 78
+           4,        4,        4,        4,        4,        4,        7,        4,  // 80
+           4,        4,        4,        4,        4,        4,        7,        4,  // 88
+           4,        4,        4,        4,        4,        4,        7,        4,  // 90
+           4,        4,        4,        4,        4,        4,        7,        4,  // 98
+           4,        4,        4,        4,        4,        4,        7,        4,  // A0
+           4,        4,        4,        4,        4,        4,        7,        4,  // A8
+           4,        4,        4,        4,        4,        4,        7,        4,  // B0
+           4,        4,        4,        4,        4,        4,        7,        4,  // B8
+      RET(5),       10,       10,       10, CALL(10),       11,        7,       11,  // C0
+      RET(5),       10,       10,       NA, CALL(10),       17,        7,       11,  // C8
+      RET(5),       10,       10,       11, CALL(10),       11,        7,       11,  // D0
+      RET(5),        4,       10,       11, CALL(10),       NA,        7,       11,  // D8
+      RET(5),       10,       10,       19, CALL(10),       11,        7,       11,  // E0
+      RET(5),        4,       10,        4, CALL(10),       NA,        7,       11,  // E8
+      RET(5),       10,       10,        4, CALL(10),       11,        7,       11,  // F0
+      RET(5),        6,       10,        4, CALL(10),       NA,        7,       11,  // F8
+};
+
+// ED40~ED7F, EDA0~EDBF
+constexpr uint8_t ED_CYCLES[] PROGMEM = {
+          12,       12,       15,       20,        8,       14,        8,        9,  // 40
+          12,       12,       15,       20,       NA,       14,       NA,        9,  // 48
+          12,       12,       15,       20,       NA,       NA,        8,        9,  // 50
+          12,       12,       15,       20,       NA,       NA,        8,        9,  // 58
+          12,       12,       15,       20,       NA,       NA,       NA,       18,  // 60
+          12,       12,       15,       20,       NA,       NA,       NA,       18,  // 68
+          12,       12,       15,       20,       NA,       NA,       NA,       NA,  // 70
+          12,       12,       15,       20,       NA,       NA,       NA,       NA,  // 78
+          16,       16,       16,       16,       NA,       NA,       NA,       NA,  // A0
+          16,       16,       16,       16,       NA,       NA,       NA,       NA,  // A8
+      JR(16),   JR(16),   JR(16),   JR(16),       NA,       NA,       NA,       NA,  // B0
+      JR(16),   JR(16),   JR(16),   JR(16),       NA,       NA,       NA,       NA,  // B8
+};
+// clang-format on
+
+Cycles tstates(uint8_t value) {
+    const uint8_t min = value & 0x1F;
+    return min ? Cycles(min, min + TAKEN[value >> 5]) : Cycles();
+}
+
+Cycles prefixCb(uint8_t opc) {
+    const auto memory = (opc & 7) == 6;  // (HL)
+    if ((opc & 0xC0) == 0x40)            // BIT b,r
+        return memory ? 12 : 8;
+    return memory ? 15 : 8;
+}
+
+Cycles prefixEd(uint8_t opc) {
+    if (opc >= 0x40 && opc < 0x80)
+        return tstates(pgm_read_byte(&ED_CYCLES[opc - 0x40]));
+    if (opc >= 0xA0 && opc < 0xC0)
+        return tstates(pgm_read_byte(&ED_CYCLES[opc - 0xA0 + 0x40]));
+    return Cycles();
+}
+
+/** Instructions with (HL) operand turn into (IX+d), others add 4 T-states for prefix. */
+Cycles prefixIx(const uint8_t *bytes, uint8_t length) {
+    const auto opc = bytes[0];
+    if (opc == 0xCB) {
+        if (length < 3)
+            return Cycles();
+        return (bytes[2] & 0xC0) == 0x40 ? 20 : 23;  // BIT b,(IX+d)
+    }
+    if (opc == 0x34 || opc == 0x35)  // INC/DEC (IX+d)
+        return 23;
+    if (opc == 0x36)  // LD (IX+d),n
+        return 19;
+    if (opc != 0x76 && ((opc & 0xC7) == 0x46 || (opc & 0xF8) == 0x70 || (opc & 0xC7) == 0x86))
+        return 19;  // LD r,(IX+d), LD (IX+d),r, and ALU (IX+d)
+    const auto cycles = tstates(pgm_read_byte(&Z80_CYCLES[opc]));
+    return cycles.known() ? cycles + 4 : cycles;
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *CyclesZ80::cpu_P() const {
+    return TEXT_CPU_Z80;
+}
+
+Cycles CyclesZ80::count(const uint8_t *bytes, uint8_t length) const {
+    if (length == 0)
+        return Cycles();
+    const auto opc = bytes[0];
+    if (opc == 0xCB || opc == 0xED || opc == 0xDD || opc == 0xFD) {
+        if (length < 2)
+            return Cycles();
+        if (opc == 0xCB)
+            return prefixCb(bytes[1]);
+        if (opc == 0xED)
+            return prefixEd(bytes[1]);
+        return prefixIx(bytes + 1, length - 1);
+    }
+    return tstates(pgm_read_byte(&Z80_CYCLES[opc]));
+}
+
+const CyclesZ80 CYCLES;
+
+}  // namespace z80
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -15,6 +15,7 @@
  */
 
 #include "dis_base.h"
+#include "phase_stats.h"
 
 namespace libasm {
 
@@ -77,6 +78,7 @@ Error Disassembler::setCurSym(char curSym) {
 
 Error Disassembler::decode(
         DisMemory &memory, Insn &insn, char *operands, size_t size, SymbolTable *symtab) {
+    LIBASM_STATS_SCOPE(DECODING);
     _symtab = symtab;
     // This setError also reset error of Disassembler.
     if (setError(config().checkAddr(insn.address())))
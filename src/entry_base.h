@@ -18,21 +18,22 @@
 #define __ENTRY_BASE_H__
 
 #include "config_host.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace entry {
 
 /**
- * Base class for instruction table entry.
+ * Base class for instruction table entry. The name of an entry is a 16-bit offset in the text
+ * pool |POOL| of the CPU.
  */
-template <typename OPCODE>
+template <typename OPCODE, const /* PROGMEM */ char *POOL>
 struct Base {
-    constexpr Base(const /* PROGMEM */ char *name_P, OPCODE opCode)
-        : _name_P(name_P), _opCode(opCode) {}
+    typedef text::Text<POOL> name_t;
 
-    const /* PROGMEM */ char *name_P() const {
-        return reinterpret_cast<const char *>(pgm_read_ptr(&_name_P));
-    }
+    constexpr Base(name_t name, OPCODE opCode) : _name(name.offset()), _opCode(opCode) {}
+
+    const /* PROGMEM */ char *name_P() const { return name_t::at(pgm_read_word(&_name)); }
 
     OPCODE opCode() const {
         if (sizeof(OPCODE) == 1) {
@@ -43,7 +44,7 @@ struct Base {
     }
 
 private:
-    const /* PROGMEM */ char *_name_P;
+    uint16_t _name;
     OPCODE _opCode;
 };
 
@@ -21,6 +21,7 @@
 
 #include "config_cdp1802.h"
 #include "entry_base.h"
+#include "text_cdp1802.h"
 
 namespace libasm {
 namespace cdp1802 {
@@ -35,7 +36,7 @@ enum AddrMode : uint8_t {
     M_IOAD = 6,  // IO address, 1~7
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::cdp1802::TEXT_POOL> {
     struct Flags final {
         uint8_t _attr;
 
@@ -56,7 +57,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return _attr & undef_bm; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_f3850.h"
 #include "entry_base.h"
+#include "text_f3850.h"
 #include "reg_f3850.h"
 
 namespace libasm {
@@ -53,7 +54,7 @@ enum AddrMode : uint8_t {
     M_UNDEF = 23,
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::f3850::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -73,7 +74,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return mode1() == M_UNDEF; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_i8048.h"
 #include "entry_base.h"
+#include "text_i8048.h"
 
 namespace libasm {
 namespace i8048 {
@@ -57,7 +58,7 @@ enum AddrMode : uint8_t {
     M_P2 = 27,   // P2
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::i8048::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -71,7 +72,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         AddrMode src() const { return AddrMode((_attr >> src_gp) & mode_gm); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
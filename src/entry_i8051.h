@@ -21,6 +21,7 @@
 
 #include "config_i8051.h"
 #include "entry_base.h"
+#include "text_i8051.h"
 
 namespace libasm {
 namespace i8051 {
@@ -46,7 +47,7 @@ enum AddrMode : uint8_t {
     M_INDXP = 17,  // @A+PC
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::i8051::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -62,7 +63,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         AddrMode ext() const { return AddrMode((_attr >> ext_gp) & mode_gm); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_i8080.h"
 #include "entry_base.h"
+#include "text_i8080.h"
 
 namespace libasm {
 namespace i8080 {
@@ -40,7 +41,7 @@ enum AddrMode : uint8_t {
     M_REGH = 11,  // H register
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::i8080::TEXT_POOL> {
     struct Flags final {
         uint8_t _attr;
 
@@ -54,7 +55,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         AddrMode src() const { return AddrMode((_attr >> src_gp) & mode_gm); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
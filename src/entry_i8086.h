@@ -21,6 +21,7 @@
 
 #include "config_i8086.h"
 #include "entry_base.h"
+#include "text_i8086.h"
 
 namespace libasm {
 namespace i8086 {
@@ -89,7 +90,7 @@ enum OprSize : uint8_t {
     SZ_SOFF = 3,  // Segment:Offset
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::i8086::TEXT_POOL> {
     struct Flags final {
         uint8_t _dst;
         uint8_t _src;
@@ -121,7 +122,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool stringInst() const { return _size & strInst_bm; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
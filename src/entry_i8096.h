@@ -21,6 +21,7 @@
 
 #include "config_i8096.h"
 #include "entry_base.h"
+#include "text_i8096.h"
 
 namespace libasm {
 namespace i8096 {
@@ -53,7 +54,7 @@ enum AddrMode : uint8_t {
     M_ADDR = 16,   // 16-bit address or register number
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::i8096::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -77,7 +78,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return _attr & undef_bm; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_ins8060.h"
 #include "entry_base.h"
+#include "text_ins8060.h"
 
 namespace libasm {
 namespace ins8060 {
@@ -34,7 +35,7 @@ enum AddrMode : uint8_t {
     M_INDX = 6,  // Indexed, M_DISP + @dd(Pn), @E(Pn)
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::ins8060::TEXT_POOL> {
     struct Flags final {
         uint8_t _attr;
 
@@ -52,7 +53,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return _attr & undef_bm; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
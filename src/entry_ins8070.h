@@ -21,6 +21,7 @@
 
 #include "config_ins8070.h"
 #include "entry_base.h"
+#include "text_ins8070.h"
 
 namespace libasm {
 namespace ins8070 {
@@ -49,7 +50,7 @@ enum AddrMode : uint8_t {
     M_GEN = 14,  // nnnn/nnnn,PC/nn,SP/nn,Pn/@nn,Pn/nn,@Pn/0xFFnn
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::ins8070::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -81,7 +82,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return _attr & undef_bm; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_mc6800.h"
 #include "entry_base.h"
+#include "text_mc6800.h"
 
 namespace libasm {
 namespace mc6800 {
@@ -43,7 +44,7 @@ enum AddrMode : uint8_t {
     M_IDY = 12,  // Indexed Y
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::mc6800::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -67,7 +68,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return _attr & undef_bm; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
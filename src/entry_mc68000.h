@@ -21,6 +21,7 @@
 
 #include "config_mc68000.h"
 #include "entry_base.h"
+#include "text_mc68000.h"
 
 namespace libasm {
 namespace mc68000 {
@@ -93,7 +94,7 @@ enum OprPos : uint8_t {
     OP___ = 4,  // ___|___|___|___
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::mc68000::TEXT_POOL> {
     struct Flags final {
         uint8_t _src;
         uint8_t _dst;
@@ -126,7 +127,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         void setInsnSize(InsnSize size) { _size = Entry::_size(oprSize(), size, hasSize()); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
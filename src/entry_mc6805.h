@@ -21,6 +21,7 @@
 
 #include "config_mc6805.h"
 #include "entry_base.h"
+#include "text_mc6805.h"
 
 namespace libasm {
 namespace mc6805 {
@@ -39,7 +40,7 @@ enum AddrMode : uint8_t {
     M_MEM = 10,  // Generic memory, M_DIR/M_IDX/M_IX0
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::mc6805::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -63,7 +64,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return (_attr & (1 << undef_bp)) != 0; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
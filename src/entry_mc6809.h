@@ -21,6 +21,7 @@
 
 #include "config_mc6809.h"
 #include "entry_base.h"
+#include "text_mc6809.h"
 
 namespace libasm {
 namespace mc6809 {
@@ -44,7 +45,7 @@ enum AddrMode : uint8_t {
     M_GMEM = 15,   // Generic memory: M_DIR/M_IDX/M_EXT
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::mc6809::TEXT_POOL> {
     struct Flags final {
         uint8_t _attr;
 
@@ -64,7 +65,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return mode2() == M_LIST; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_mn1610.h"
 #include "entry_base.h"
+#include "text_mn1610.h"
 
 namespace libasm {
 namespace mn1610 {
@@ -61,7 +62,7 @@ enum AddrMode : uint8_t {
     M_IDIX = 32,  // (v)(r)
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::mn1610::TEXT_POOL> {
     struct Flags final {
         uint8_t _opr1;
         uint8_t _opr2;
@@ -83,7 +84,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         AddrMode mode4() const { return AddrMode(_opr4); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
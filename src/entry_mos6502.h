@@ -21,6 +21,7 @@
 
 #include "config_mos6502.h"
 #include "entry_base.h"
+#include "text_mos6502.h"
 
 namespace libasm {
 namespace mos6502 {
@@ -79,7 +80,7 @@ enum AddrMode : uint8_t {
     // Block move:                           M_DPG,  M_DPG,  M_NONE
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::mos6502::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -97,7 +98,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         AddrMode mode3() const { return AddrMode((_attr >> opr3_gp) & mode_gm); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_ns32000.h"
 #include "entry_base.h"
+#include "text_ns32000.h"
 
 namespace libasm {
 namespace ns32000 {
@@ -93,7 +94,7 @@ enum OprSize : uint8_t {
     SZ_NONE = 6,
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::ns32000::TEXT_POOL> {
     struct Flags final {
         uint8_t _src;
         uint8_t _dst;
@@ -126,7 +127,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         OprSize size() const { return OprSize((_ex2 >> size_gp) & size_gm); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_scn2650.h"
 #include "entry_base.h"
+#include "text_scn2650.h"
 
 namespace libasm {
 namespace scn2650 {
@@ -41,7 +42,7 @@ enum AddrMode : uint8_t {
     M_AB15 = 12,  // (*)a: Absolute jump, 15 bit, optionally indirect
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::scn2650::TEXT_POOL> {
     struct Flags final {
         uint8_t _attr;
 
@@ -61,7 +62,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return mode2() == M_REGN; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
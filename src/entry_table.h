@@ -19,9 +19,11 @@
 
 #include <string.h>
 
+#include "phase_stats.h"
 #include "str_buffer.h"
 #include "str_scanner.h"
 #include "table_base.h"
+#include "table_stats.h"
 
 namespace libasm {
 namespace entry {
@@ -62,6 +64,7 @@ struct TableBase {
     }
 
     bool notExactMatch(const ENTRY *entry) const { return _entries.notExactMatch(entry); }
+    const ENTRY *table() const { return _entries.table(); }
 
 private:
     const table::IndexedTable<ENTRY, uint8_t> _entries;
@@ -131,10 +134,14 @@ struct CpuBase {
             INSN &insn, bool (*acceptOperands)(INSN &, const ENTRY *),
             void (*pageSetup)(INSN &, const ENTRY_PAGE *) = [](INSN &, const ENTRY_PAGE *) {},
             void (*readCode)(INSN &, const ENTRY *, const ENTRY_PAGE *) = defaultReadCode) const {
+        LIBASM_STATS_SCOPE(SEARCH_NAME);
         auto found = false;
         for (auto page = _pages.table(); page < _pages.end(); page++) {
             pageSetup(insn, page);
+            LIBASM_STATS_LOOKUP_START();
             const auto *entry = page->binarySearch(insn, nameComparator, acceptOperands);
+            LIBASM_STATS_LOOKUP(name_P(), BY_NAME, page - _pages.table(),
+                    entry && !page->notExactMatch(entry) ? entry - page->table() : -1);
             if (page->notExactMatch(entry)) {
                 found = true;
             } else if (entry) {
@@ -169,9 +176,13 @@ struct CpuBase {
             bool (*matchCode)(INSN &, const ENTRY *, const ENTRY_PAGE *) = defaultMatchOpCode,
             void (*readName)(INSN &, const ENTRY *, StrBuffer &,
                     const ENTRY_PAGE *) = defaultReadEntryName) const {
+        LIBASM_STATS_SCOPE(SEARCH_CODE);
         for (const ENTRY_PAGE *page = _pages.table(); page < _pages.end(); page++) {
             if (page->prefixMatch(insn.prefix())) {
+                LIBASM_STATS_LOOKUP_START();
                 const auto *entry = page->linearSearch(insn, matchCode, page);
+                LIBASM_STATS_LOOKUP(
+                        name_P(), BY_CODE, page - _pages.table(), entry ? entry - page->table() : -1);
                 if (entry) {
                     readName(insn, entry, out, page);
                     return entry;
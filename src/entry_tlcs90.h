@@ -21,6 +21,7 @@
 
 #include "config_tlcs90.h"
 #include "entry_base.h"
+#include "text_tlcs90.h"
 
 namespace libasm {
 namespace tlcs90 {
@@ -56,7 +57,7 @@ enum AddrMode : uint8_t {
     M_DST = 62,
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::tlcs90::TEXT_POOL> {
     struct Flags final {
         uint8_t _dst;
         uint8_t _src;
@@ -70,7 +71,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         AddrMode src() const { return AddrMode(_src); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_tms32010.h"
 #include "entry_base.h"
+#include "text_tms32010.h"
 
 namespace libasm {
 namespace tms32010 {
@@ -46,7 +47,7 @@ enum AddrMode : uint8_t {
     M_DEC = 16,   // _P: "*-"  Indirect then auto decrement addressing
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::tms32010::TEXT_POOL> {
     struct Flags final {
         uint16_t _attr;
 
@@ -62,7 +63,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         AddrMode mode3() const { return AddrMode((_attr >> opr3_gp) & mode_gm); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
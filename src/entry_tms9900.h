@@ -21,6 +21,7 @@
 
 #include "config_tms9900.h"
 #include "entry_base.h"
+#include "text_tms9900.h"
 
 namespace libasm {
 namespace tms9900 {
@@ -49,7 +50,7 @@ enum AddrMode : uint8_t {
     M_INDX = 20,  // Indexed Addressing: @TABLE(Rn)
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::tms9900::TEXT_POOL> {
     struct Flags final {
         uint8_t _src;
         uint8_t _dst;
@@ -63,7 +64,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         AddrMode dst() const { return AddrMode(_dst); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
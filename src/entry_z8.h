@@ -21,6 +21,7 @@
 
 #include "config_z8.h"
 #include "entry_base.h"
+#include "text_z8.h"
 
 namespace libasm {
 namespace z8 {
@@ -73,7 +74,7 @@ enum OprOrder : uint8_t {
     SRC_FIRST = 1,   // source first, destination second.
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::z8::TEXT_POOL> {
     struct Flags final {
         uint8_t _dst;
         uint8_t _src;
@@ -97,7 +98,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool dstFirst() const { return OprOrder((_fmt >> order_gp) & order_gm) == DST_FIRST; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
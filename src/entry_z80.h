@@ -21,6 +21,7 @@
 
 #include "config_z80.h"
 #include "entry_base.h"
+#include "text_z80.h"
 
 namespace libasm {
 namespace z80 {
@@ -62,7 +63,7 @@ enum AddrMode : uint8_t {
     R_IM = 26 + 18,  // REG_IM (8085)
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::z80::TEXT_POOL> {
     struct Flags final {
         uint8_t _dst;
         uint8_t _src;
@@ -86,7 +87,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         bool undefined() const { return _src & undef_bm; }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -21,6 +21,7 @@
 
 #include "config_z8000.h"
 #include "entry_base.h"
+#include "text_z8000.h"
 
 namespace libasm {
 namespace z8000 {
@@ -116,7 +117,7 @@ enum ModeField : uint8_t {
     MF_P8 = 6,
 };
 
-struct Entry final : entry::Base<Config::opcode_t> {
+struct Entry final : entry::Base<Config::opcode_t, text::z8000::TEXT_POOL> {
     struct Flags final {
         uint8_t _dst;
         uint8_t _src;
@@ -153,7 +154,7 @@ struct Entry final : entry::Base<Config::opcode_t> {
         uint16_t codeMask() const { return Entry::codeMask(_size); }
     };
 
-    constexpr Entry(Config::opcode_t opCode, Flags flags, const char *name)
+    constexpr Entry(Config::opcode_t opCode, Flags flags, name_t name)
         : Base(name, opCode), _flags(flags) {}
 
     Flags flags() const { return _flags.read(); }
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FLOW_BASE_H__
+#define __FLOW_BASE_H__
+
+#include <stdint.h>
+
+namespace libasm {
+
+enum FlowType : uint8_t {
+    FLOW_NEXT = 0,    // continue to the next instruction
+    FLOW_JUMP = 1,    // jump to target
+    FLOW_CALL = 2,    // call target and return to the next instruction
+    FLOW_RETURN = 3,  // return to caller
+    FLOW_STOP = 4,    // never continue, such as halt
+};
+
+/** Stack effect of an instruction which loads the stack pointer. */
+constexpr int16_t STACK_UNKNOWN = INT16_MIN;
+
+/**
+ * Control flow of an instruction. A conditional instruction may also
+ * continue to the next instruction. |target| is valid only when |known|;
+ * a jump or a call through a register or a vector has unknown target.
+ *
+ * |stack| is bytes pushed onto the hardware stack, negative when popped.
+ * Bytes pushed by a call are its return frame, which the callee pops.
+ */
+struct Flow {
+    constexpr Flow(FlowType type_ = FLOW_NEXT)
+        : type(type_), conditional(false), known(false), stack(0), target(0) {}
+    constexpr Flow(FlowType type_, uint32_t target_)
+        : type(type_), conditional(false), known(true), stack(0), target(target_) {}
+
+    FlowType type;
+    bool conditional;
+    bool known;
+    int16_t stack;
+    uint32_t target;
+
+    /** Make this flow conditional. */
+    Flow &orNext() {
+        conditional = true;
+        return *this;
+    }
+    /** Set stack effect; |bytes| is negative when popped. */
+    Flow &push(int16_t bytes) {
+        stack = bytes;
+        return *this;
+    }
+};
+
+/**
+ * Trace control flow of instructions of a CPU from their bytes.
+ */
+struct FlowTracer {
+    /** name of CPU which flows are traced for */
+    virtual const /*PROGMEM*/ char *cpu_P() const = 0;
+    /** returns control flow of instruction |bytes| of |length| at |address| */
+    virtual Flow trace(const uint8_t *bytes, uint8_t length, uint32_t address) const = 0;
+    /** bytes pushed onto the stack by an interrupt */
+    virtual uint8_t interruptFrame() const = 0;
+};
+
+}  // namespace libasm
+
+#endif  // __FLOW_BASE_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow_i8051.h"
+
+#include "config_host.h"
+#include "text_i8051.h"
+
+using namespace libasm::text::i8051;
+
+namespace libasm {
+namespace i8051 {
+
+namespace {
+
+constexpr uint8_t SP = 0x81;  // address of stack pointer SFR
+
+uint16_t addr16(const uint8_t *bytes) {
+    return (static_cast<uint16_t>(bytes[0]) << 8) | bytes[1];
+}
+
+/** Relative offset is the last byte of instruction. */
+Flow relative(const uint8_t *bytes, uint8_t length, uint32_t address) {
+    const uint16_t target = address + length + static_cast<int8_t>(bytes[length - 1]);
+    return Flow(FLOW_JUMP, target);
+}
+
+/** Whether an instruction other than INC, DEC, PUSH and POP writes SP. */
+bool writeSp(uint8_t opc, const uint8_t *bytes, uint8_t length) {
+    switch (opc) {
+    case 0x85:  // MOV direct,direct; source comes first
+        return length >= 3 && bytes[2] == SP;
+    case 0x75:  // MOV direct,#data
+    case 0x42:  // ORL direct,A
+    case 0x43:  // ORL direct,#data
+    case 0x52:  // ANL direct,A
+    case 0x53:  // ANL direct,#data
+    case 0x62:  // XRL direct,A
+    case 0x63:  // XRL direct,#data
+    case 0x86:  // MOV direct,@R0
+    case 0x87:  // MOV direct,@R1
+    case 0xC5:  // XCH A,direct
+    case 0xF5:  // MOV direct,A
+        return length >= 2 && bytes[1] == SP;
+    }
+    if ((opc & 0xF8) == 0x88)  // MOV direct,Rn
+        return length >= 2 && bytes[1] == SP;
+    return false;
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *FlowI8051::cpu_P() const {
+    return TEXT_CPU_8051;
+}
+
+Flow FlowI8051::trace(const uint8_t *bytes, uint8_t length, uint32_t address) const {
+    const auto opc = bytes[0];
+    if ((opc & 0x0F) == 0x01) {  // AJMP, ACALL
+        const uint16_t target = ((address + 2) & 0xF800) | ((opc & 0xE0) << 3) | bytes[1];
+        return (opc & 0x10) ? Flow(FLOW_CALL, target).push(2) : Flow(FLOW_JUMP, target);
+    }
+    if (opc >= 0xB4 && opc <= 0xBF)  // CJNE
+        return relative(bytes, length, address).orNext();
+    if ((opc & 0xF8) == 0xD8)  // DJNZ Rn
+        return relative(bytes, length, address).orNext();
+    switch (opc) {
+    case 0x02:  // LJMP
+        return Flow(FLOW_JUMP, addr16(bytes + 1));
+    case 0x12:  // LCALL
+        return Flow(FLOW_CALL, addr16(bytes + 1)).push(2);
+    case 0x22:  // RET
+    case 0x32:  // RETI
+        return Flow(FLOW_RETURN).push(-2);
+    case 0xC0:  // PUSH direct
+        return Flow().push(1);
+    case 0xD0:  // POP direct
+        return length >= 2 && bytes[1] == SP ? Flow().push(STACK_UNKNOWN) : Flow().push(-1);
+    case 0x05:  // INC direct
+        return length >= 2 && bytes[1] == SP ? Flow().push(1) : Flow();
+    case 0x15:  // DEC direct
+        return length >= 2 && bytes[1] == SP ? Flow().push(-1) : Flow();
+    case 0x73:  // JMP @A+DPTR
+        return Flow(FLOW_JUMP);
+    case 0x80:  // SJMP
+        return relative(bytes, length, address);
+    case 0x10:  // JBC
+    case 0x20:  // JB
+    case 0x30:  // JNB
+    case 0x40:  // JC
+    case 0x50:  // JNC
+    case 0x60:  // JZ
+    case 0x70:  // JNZ
+    case 0xD5:  // DJNZ direct
+        return relative(bytes, length, address).orNext();
+    default:
+        return writeSp(opc, bytes, length) ? Flow().push(STACK_UNKNOWN) : Flow();
+    }
+}
+
+const FlowI8051 FLOW;
+
+}  // namespace i8051
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FLOW_I8051_H__
+#define __FLOW_I8051_H__
+
+#include "flow_base.h"
+
+namespace libasm {
+namespace i8051 {
+
+/**
+ * Control flow of i8051. AJMP and ACALL stay in the 2K byte block of the
+ * next instruction.
+ */
+struct FlowI8051 final : FlowTracer {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    Flow trace(const uint8_t *bytes, uint8_t length, uint32_t address) const override;
+    uint8_t interruptFrame() const override { return 2; }
+};
+
+extern const FlowI8051 FLOW;
+
+}  // namespace i8051
+}  // namespace libasm
+
+#endif  // __FLOW_I8051_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
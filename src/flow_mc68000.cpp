@@ -0,0 +1,165 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow_mc68000.h"
+
+#include "config_host.h"
+#include "text_mc68000.h"
+
+using namespace libasm::text::mc68000;
+
+namespace libasm {
+namespace mc68000 {
+
+namespace {
+
+constexpr uint32_t ADDRESS_MASK = 0xFFFFFF;
+
+uint16_t word(const uint8_t *bytes) {
+    return (static_cast<uint16_t>(bytes[0]) << 8) | bytes[1];
+}
+
+uint32_t disp16(const uint8_t *bytes) {
+    return static_cast<int16_t>(word(bytes));
+}
+
+Flow jumpOrCall(uint16_t opc, const uint8_t *bytes, uint8_t length, uint32_t address) {
+    const auto type = (opc & 0x40) ? FLOW_JUMP : FLOW_CALL;
+    const auto ea = opc & 077;
+    if (ea == 070 && length >= 4)  // abs.W
+        return Flow(type, disp16(bytes + 2) & ADDRESS_MASK);
+    if (ea == 071 && length >= 6)  // abs.L
+        return Flow(type, ((static_cast<uint32_t>(word(bytes + 2)) << 16) | word(bytes + 4)) &
+                                  ADDRESS_MASK);
+    if (ea == 072 && length >= 4)  // d16(PC)
+        return Flow(type, (address + 2 + disp16(bytes + 2)) & ADDRESS_MASK);
+    return Flow(type);
+}
+
+uint32_t long32(const uint8_t *bytes) {
+    return (static_cast<uint32_t>(word(bytes)) << 16) | word(bytes + 2);
+}
+
+uint8_t registerCount(uint16_t mask) {
+    uint8_t count = 0;
+    for (; mask; mask &= mask - 1)
+        count++;
+    return count;
+}
+
+/** Stack effect of an instruction which isn't a flow. */
+int16_t stack(uint16_t opc, const uint8_t *bytes, uint8_t length) {
+    if ((opc & 0xC000) == 0 && (opc & 0x3000) != 0) {  // MOVE, MOVEA
+        const int16_t size = (opc & 0x3000) == 0x2000 ? 4 : 2;  // byte keeps SP even
+        if ((opc & 0x0FC0) == 0x0E40)                          // MOVEA to A7
+            return STACK_UNKNOWN;
+        int16_t effect = 0;
+        if ((opc & 0x0FC0) == 0x0F00)  // to -(A7)
+            effect += size;
+        if ((opc & 0x003F) == 0x001F)  // from (A7)+
+            effect -= size;
+        return effect;
+    }
+    if ((opc & 0xFFC0) == 0x4840 && (opc & 0x0038) >= 0x0010)  // PEA
+        return 4;
+    if ((opc & 0xFFF8) == 0x4E50 && length >= 4)  // LINK
+        return 4 - static_cast<int16_t>(word(bytes + 2));
+    if ((opc & 0xFFBF) == 0x48A7 && length >= 4)  // MOVEM to -(A7)
+        return registerCount(word(bytes + 2)) * ((opc & 0x40) ? 4 : 2);
+    if ((opc & 0xFFBF) == 0x4C9F && length >= 4)  // MOVEM from (A7)+
+        return -registerCount(word(bytes + 2)) * ((opc & 0x40) ? 4 : 2);
+    if ((opc & 0xF03F) == 0x500F && (opc & 0x00C0) != 0x00C0) {  // ADDQ/SUBQ #n,A7
+        const int16_t data = ((opc >> 9) & 7) ? (opc >> 9) & 7 : 8;
+        return (opc & 0x0100) ? data : -data;
+    }
+    if (opc == 0x4FEF && length >= 4)  // LEA d16(A7),A7
+        return -static_cast<int16_t>(word(bytes + 2));
+    if ((opc & 0xFFC0) == 0x4FC0)  // LEA to A7
+        return STACK_UNKNOWN;
+    if ((opc & 0xBEC0) == 0x9EC0) {  // ADDA/SUBA to A7
+        int32_t data;
+        if ((opc & 0x003F) != 0x003C) {
+            return STACK_UNKNOWN;
+        } else if (opc & 0x0100) {
+            if (length < 6)
+                return STACK_UNKNOWN;
+            data = static_cast<int32_t>(long32(bytes + 2));
+        } else {
+            if (length < 4)
+                return STACK_UNKNOWN;
+            data = static_cast<int16_t>(word(bytes + 2));
+        }
+        if (data < INT16_MIN + 1 || data > INT16_MAX)
+            return STACK_UNKNOWN;
+        return (opc & 0x4000) ? -data : data;
+    }
+    return 0;
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *FlowMc68000::cpu_P() const {
+    return TEXT_CPU_68000;
+}
+
+Flow FlowMc68000::trace(const uint8_t *bytes, uint8_t length, uint32_t address) const {
+    if (length < 2)
+        return Flow();
+    const auto opc = word(bytes);
+    if ((opc & 0xF000) == 0x6000) {  // Bcc, BRA, BSR
+        uint32_t disp = static_cast<int8_t>(opc & 0xFF);
+        if (disp == 0 && length >= 4)
+            disp = disp16(bytes + 2);
+        Flow flow(FLOW_JUMP, (address + 2 + disp) & ADDRESS_MASK);
+        const auto cond = (opc >> 8) & 0xF;
+        if (cond == 1) {
+            flow.type = FLOW_CALL;
+            flow.push(4);
+        }
+        return cond < 2 ? flow : flow.orNext();
+    }
+    if ((opc & 0xF0F8) == 0x50C8 && length >= 4)  // DBcc
+        return Flow(FLOW_JUMP, (address + 2 + disp16(bytes + 2)) & ADDRESS_MASK).orNext();
+    if ((opc & 0xFF80) == 0x4E80) {  // JSR, JMP
+        auto flow = jumpOrCall(opc, bytes, length, address);
+        return flow.type == FLOW_CALL ? flow.push(4) : flow;
+    }
+    if ((opc & 0xFFF0) == 0x4E40)  // TRAP
+        return Flow(FLOW_CALL).push(6);
+    switch (opc) {
+    case 0x4E73:  // RTE
+    case 0x4E77:  // RTR
+        return Flow(FLOW_RETURN).push(-6);
+    case 0x4E75:  // RTS
+        return Flow(FLOW_RETURN).push(-4);
+    case 0x4AFC:  // ILLEGAL
+        return Flow(FLOW_STOP);
+    default:
+        return Flow().push(stack(opc, bytes, length));
+    }
+}
+
+const FlowMc68000 FLOW;
+
+}  // namespace mc68000
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow_mc6809.h"
+
+#include "config_host.h"
+#include "text_mc6809.h"
+
+using namespace libasm::text::mc6809;
+
+namespace libasm {
+namespace mc6809 {
+
+namespace {
+
+constexpr uint8_t S = 4;   // register number of S in TFR/EXG
+constexpr uint8_t PC = 5;  // register number of PC in TFR/EXG
+
+uint16_t addr16(const uint8_t *bytes) {
+    return (static_cast<uint16_t>(bytes[0]) << 8) | bytes[1];
+}
+
+Flow relative8(const uint8_t *bytes, uint32_t address) {
+    const uint16_t target = address + 2 + static_cast<int8_t>(bytes[1]);
+    return Flow(FLOW_JUMP, target);
+}
+
+Flow relative16(const uint8_t *bytes, uint32_t address, uint8_t length) {
+    const uint16_t target = address + length + static_cast<int16_t>(addr16(bytes + length - 2));
+    return Flow(FLOW_JUMP, target);
+}
+
+/** Bytes of registers in post byte of PSHS/PULS. */
+int16_t registerBytes(uint8_t post) {
+    int16_t bytes = 0;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (post & (1 << bit))
+            bytes += bit < 4 ? 1 : 2;
+    }
+    return bytes;
+}
+
+/** Stack effect of LEAS, whose offset from S is the post byte and following. */
+int16_t leas(const uint8_t *bytes, uint8_t length) {
+    const auto post = bytes[1];
+    if ((post & 0xE0) == 0x60)  // n5,S
+        return -(static_cast<int8_t>(post << 3) >> 3);
+    if (post == 0xE4)  // ,S
+        return 0;
+    if (post == 0xE8 && length >= 3)  // n8,S
+        return -static_cast<int8_t>(bytes[2]);
+    if (post == 0xE9 && length >= 4)  // n16,S
+        return -static_cast<int16_t>(addr16(bytes + 2));
+    return STACK_UNKNOWN;
+}
+
+Flow prefixed(const uint8_t *bytes, uint8_t length, uint32_t address) {
+    const auto opc = bytes[1];
+    if (bytes[0] == 0x10 && opc > 0x21 && opc <= 0x2F && length >= 4)  // LBcc
+        return relative16(bytes, address, 4).orNext();
+    if (opc == 0x3F)  // SWI2, SWI3
+        return Flow(FLOW_CALL).push(12);
+    if (bytes[0] == 0x10 && (opc & 0xCF) == 0xCE)  // LDS
+        return Flow().push(STACK_UNKNOWN);
+    return Flow();
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *FlowMc6809::cpu_P() const {
+    return TEXT_CPU_6809;
+}
+
+Flow FlowMc6809::trace(const uint8_t *bytes, uint8_t length, uint32_t address) const {
+    const auto opc = bytes[0];
+    if (opc == 0x10 || opc == 0x11)
+        return length >= 2 ? prefixed(bytes, length, address) : Flow();
+    if (opc >= 0x20 && opc <= 0x2F) {
+        if (opc == 0x20)  // BRA
+            return relative8(bytes, address);
+        if (opc == 0x21)  // BRN
+            return Flow();
+        return relative8(bytes, address).orNext();  // Bcc
+    }
+    switch (opc) {
+    case 0x16:  // LBRA
+        return relative16(bytes, address, 3);
+    case 0x17: {  // LBSR
+        auto flow = relative16(bytes, address, 3);
+        flow.type = FLOW_CALL;
+        return flow.push(2);
+    }
+    case 0x8D: {  // BSR
+        auto flow = relative8(bytes, address);
+        flow.type = FLOW_CALL;
+        return flow.push(2);
+    }
+    case 0x7E:  // JMP extended
+        return Flow(FLOW_JUMP, addr16(bytes + 1));
+    case 0xBD:  // JSR extended
+        return Flow(FLOW_CALL, addr16(bytes + 1)).push(2);
+    case 0x0E:  // JMP direct
+    case 0x6E:  // JMP indexed
+        return Flow(FLOW_JUMP);
+    case 0x9D:  // JSR direct
+    case 0xAD:  // JSR indexed
+        return Flow(FLOW_CALL).push(2);
+    case 0x3F:  // SWI
+        return Flow(FLOW_CALL).push(12);
+    case 0x39:  // RTS
+        return Flow(FLOW_RETURN).push(-2);
+    case 0x3B:  // RTI
+        return Flow(FLOW_RETURN).push(-12);
+    case 0x34:  // PSHS
+        return Flow().push(registerBytes(bytes[1]));
+    case 0x35:  // PULS
+        return ((bytes[1] & 0x80) ? Flow(FLOW_RETURN) : Flow()).push(-registerBytes(bytes[1]));
+    case 0x37:  // PULU
+        return (bytes[1] & 0x80) ? Flow(FLOW_RETURN) : Flow();
+    case 0x32:  // LEAS
+        return Flow().push(leas(bytes, length));
+    case 0x1E:  // EXG
+        if ((bytes[1] >> 4) == PC)
+            return Flow(FLOW_JUMP);
+        if ((bytes[1] >> 4) == S)
+            return Flow().push(STACK_UNKNOWN);
+        /* Fall-through */
+    case 0x1F:  // TFR
+        if ((bytes[1] & 0xF) == PC)
+            return Flow(FLOW_JUMP);
+        return (bytes[1] & 0xF) == S ? Flow().push(STACK_UNKNOWN) : Flow();
+    default:
+        return Flow();
+    }
+}
+
+const FlowMc6809 FLOW;
+
+}  // namespace mc6809
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
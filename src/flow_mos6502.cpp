@@ -0,0 +1,85 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow_mos6502.h"
+
+#include "config_host.h"
+#include "text_mos6502.h"
+
+using namespace libasm::text::mos6502;
+
+namespace libasm {
+namespace mos6502 {
+
+namespace {
+
+uint16_t addr16(const uint8_t *bytes) {
+    return bytes[0] | (static_cast<uint16_t>(bytes[1]) << 8);
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *FlowMos6502::cpu_P() const {
+    return TEXT_CPU_6502;
+}
+
+Flow FlowMos6502::trace(const uint8_t *bytes, uint8_t length, uint32_t address) const {
+    const auto opc = bytes[0];
+    if ((opc & 0x1F) == 0x10 && length >= 2) {  // Bcc
+        const uint16_t target = address + 2 + static_cast<int8_t>(bytes[1]);
+        return Flow(FLOW_JUMP, target).orNext();
+    }
+    switch (opc) {
+    case 0x00:  // BRK
+        return Flow(FLOW_CALL).push(3);
+    case 0x20:  // JSR
+        return (length >= 3 ? Flow(FLOW_CALL, addr16(bytes + 1)) : Flow(FLOW_CALL)).push(2);
+    case 0x4C:  // JMP
+        return length >= 3 ? Flow(FLOW_JUMP, addr16(bytes + 1)) : Flow(FLOW_JUMP);
+    case 0x6C:  // JMP (abs)
+        return Flow(FLOW_JUMP);
+    case 0x40:  // RTI
+        return Flow(FLOW_RETURN).push(-3);
+    case 0x60:  // RTS
+        return Flow(FLOW_RETURN).push(-2);
+    case 0x08:  // PHP
+    case 0x48:  // PHA
+    case 0x5A:  // PHY
+    case 0xDA:  // PHX
+        return Flow().push(1);
+    case 0x28:  // PLP
+    case 0x68:  // PLA
+    case 0x7A:  // PLY
+    case 0xFA:  // PLX
+        return Flow().push(-1);
+    case 0x9A:  // TXS
+        return Flow().push(STACK_UNKNOWN);
+    default:
+        return Flow();
+    }
+}
+
+const FlowMos6502 FLOW;
+
+}  // namespace mos6502
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FLOW_MOS6502_H__
+#define __FLOW_MOS6502_H__
+
+#include "flow_base.h"
+
+namespace libasm {
+namespace mos6502 {
+
+/**
+ * Control flow of MOS6502. BRK is a call through the interrupt vector.
+ */
+struct FlowMos6502 final : FlowTracer {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    Flow trace(const uint8_t *bytes, uint8_t length, uint32_t address) const override;
+    uint8_t interruptFrame() const override { return 3; }
+};
+
+extern const FlowMos6502 FLOW;
+
+}  // namespace mos6502
+}  // namespace libasm
+
+#endif  // __FLOW_MOS6502_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
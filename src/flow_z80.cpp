@@ -0,0 +1,120 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flow_z80.h"
+
+#include "config_host.h"
+#include "text_z80.h"
+
+using namespace libasm::text::z80;
+
+namespace libasm {
+namespace z80 {
+
+namespace {
+
+uint16_t addr16(const uint8_t *bytes) {
+    return bytes[0] | (static_cast<uint16_t>(bytes[1]) << 8);
+}
+
+Flow relative(const uint8_t *bytes, uint32_t address) {
+    const uint16_t target = address + 2 + static_cast<int8_t>(bytes[1]);
+    return Flow(FLOW_JUMP, target);
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *FlowZ80::cpu_P() const {
+    return TEXT_CPU_Z80;
+}
+
+Flow FlowZ80::trace(const uint8_t *bytes, uint8_t length, uint32_t address) const {
+    const auto opc = bytes[0];
+    switch (opc) {
+    case 0x18:  // JR
+        return relative(bytes, address);
+    case 0x10:  // DJNZ
+    case 0x20:  // JR NZ
+    case 0x28:  // JR Z
+    case 0x30:  // JR NC
+    case 0x38:  // JR C
+        return relative(bytes, address).orNext();
+    case 0xC3:  // JP nn
+        return Flow(FLOW_JUMP, addr16(bytes + 1));
+    case 0xCD:  // CALL nn
+        return Flow(FLOW_CALL, addr16(bytes + 1)).push(2);
+    case 0xC9:  // RET
+        return Flow(FLOW_RETURN).push(-2);
+    case 0xE9:  // JP (HL)
+        return Flow(FLOW_JUMP);
+    case 0x76:  // HALT
+        return Flow(FLOW_STOP);
+    case 0x31:  // LD SP,nn
+    case 0xF9:  // LD SP,HL
+        return Flow().push(STACK_UNKNOWN);
+    case 0x33:  // INC SP
+        return Flow().push(-1);
+    case 0x3B:  // DEC SP
+        return Flow().push(1);
+    case 0xDD:
+    case 0xFD:
+        if (length < 2)
+            return Flow();
+        switch (bytes[1]) {
+        case 0xE9:  // JP (IX), JP (IY)
+            return Flow(FLOW_JUMP);
+        case 0xE5:  // PUSH IX, PUSH IY
+            return Flow().push(2);
+        case 0xE1:  // POP IX, POP IY
+            return Flow().push(-2);
+        case 0xF9:  // LD SP,IX, LD SP,IY
+            return Flow().push(STACK_UNKNOWN);
+        default:
+            return Flow();
+        }
+    case 0xED:
+        if (length >= 2 && (bytes[1] & 0xC7) == 0x45)  // RETN, RETI
+            return Flow(FLOW_RETURN).push(-2);
+        if (length >= 2 && bytes[1] == 0x7B)  // LD SP,(nn)
+            return Flow().push(STACK_UNKNOWN);
+        return Flow();
+    }
+    if ((opc & 0xC7) == 0xC2)  // JP cc, nn
+        return Flow(FLOW_JUMP, addr16(bytes + 1)).orNext();
+    if ((opc & 0xC7) == 0xC4)  // CALL cc, nn
+        return Flow(FLOW_CALL, addr16(bytes + 1)).orNext().push(2);
+    if ((opc & 0xC7) == 0xC0)  // RET cc
+        return Flow(FLOW_RETURN).orNext().push(-2);
+    if ((opc & 0xC7) == 0xC7)  // RST
+        return Flow(FLOW_CALL, opc & 0x38).push(2);
+    if ((opc & 0xCF) == 0xC5)  // PUSH qq
+        return Flow().push(2);
+    if ((opc & 0xCF) == 0xC1)  // POP qq
+        return Flow().push(-2);
+    return Flow();
+}
+
+const FlowZ80 FLOW;
+
+}  // namespace z80
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
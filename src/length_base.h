@@ -0,0 +1,60 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LENGTH_BASE_H__
+#define __LENGTH_BASE_H__
+
+#include <stdint.h>
+
+namespace libasm {
+
+/**
+ * Byte length of an instruction, and whether it may transfer control
+ * other than to the next instruction, such as a jump, a branch, a call,
+ * a return, or a software interrupt. |length| is zero when bytes are not
+ * an instruction, or not enough to know its length.
+ */
+struct InsnLength {
+    constexpr InsnLength() : length(0), transfer(false) {}
+    constexpr InsnLength(uint8_t length_, bool transfer_ = false)
+        : length(length_), transfer(transfer_) {}
+
+    uint8_t length;
+    bool transfer;
+};
+
+/**
+ * Decode only lengths of instructions of a CPU from their bytes, which is
+ * much faster than |Disassembler::decode| because neither mnemonic nor
+ * operands are looked up and formatted.
+ */
+struct LengthDecoder {
+    /** name of CPU which lengths are decoded for */
+    virtual const /*PROGMEM*/ char *cpu_P() const = 0;
+    /** returns length of instruction at |bytes|, which has |size| bytes available */
+    virtual InsnLength decode(const uint8_t *bytes, uint8_t size) const = 0;
+};
+
+}  // namespace libasm
+
+#endif  // __LENGTH_BASE_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "length_i8051.h"
+
+#include "config_host.h"
+#include "text_i8051.h"
+
+using namespace libasm::text::i8051;
+
+namespace libasm {
+namespace i8051 {
+
+namespace {
+
+// Lower 4 bits of a table value are byte length.
+#define J(len) ((len) | TRANSFER)  // may transfer control
+#define NA 0
+
+constexpr uint8_t LENGTH_MASK = 0x0F;
+constexpr uint8_t TRANSFER = 0x10;
+
+InsnLength length(uint8_t value) {
+    return InsnLength(value & LENGTH_MASK, value & TRANSFER);
+}
+
+// clang-format off
+constexpr uint8_t I8051_LENGTH[] PROGMEM = {
+           1,     J(2),     J(3),        1,        1,        2,        1,        1,  // 00
+           1,        1,        1,        1,        1,        1,        1,        1,  // 08
+        J(3),     J(2),     J(3),        1,        1,        2,        1,        1,  // 10
+           1,        1,        1,        1,        1,        1,        1,        1,  // 18
+        J(3),     J(2),     J(1),        1,        2,        2,        1,        1,  // 20
+           1,        1,        1,        1,        1,        1,        1,        1,  // 28
+        J(3),     J(2),     J(1),        1,        2,        2,        1,        1,  // 30
+           1,        1,        1,        1,        1,        1,        1,        1,  // 38
+        J(2),     J(2),        2,        3,        2,        2,        1,        1,  // 40
+           1,        1,        1,        1,        1,        1,        1,        1,  // 48
+        J(2),     J(2),        2,        3,        2,        2,        1,        1,  // 50
+           1,        1,        1,        1,        1,        1,        1,        1,  // 58
+        J(2),     J(2),        2,        3,        2,        2,        1,        1,  // 60
+           1,        1,        1,        1,        1,        1,        1,        1,  // 68
+        J(2),     J(2),        2,     J(1),        2,        3,        2,        2,  // 70
+           2,        2,        2,        2,        2,        2,        2,        2,  // 78
+        J(2),     J(2),        2,        1,        1,        3,        2,        2,  // 80
+           2,        2,        2,        2,        2,        2,        2,        2,  // 88
+           3,     J(2),        2,        1,        2,        2,        1,        1,  // 90
+           1,        1,        1,        1,        1,        1,        1,        1,  // 98
+           2,     J(2),        2,        1,        1,       NA,        2,        2,  // A0
+           2,        2,        2,        2,        2,        2,        2,        2,  // A8
+           2,     J(2),        2,        1,     J(3),     J(3),     J(3),     J(3),  // B0
+        J(3),     J(3),     J(3),     J(3),     J(3),     J(3),     J(3),     J(3),  // B8
+           2,     J(2),        2,        1,        1,        2,        1,        1,  // C0
+           1,        1,        1,        1,        1,        1,        1,        1,  // C8
+           2,     J(2),        2,        1,        1,     J(3),        1,        1,  // D0
+        J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),  // D8
+           1,     J(2),        1,        1,        1,        2,        1,        1,  // E0
+           1,        1,        1,        1,        1,        1,        1,        1,  // E8
+           1,     J(2),        1,        1,        1,        2,        1,        1,  // F0
+           1,        1,        1,        1,        1,        1,        1,        1,  // F8
+};
+// clang-format on
+
+}  // namespace
+
+const /*PROGMEM*/ char *LengthI8051::cpu_P() const {
+    return TEXT_CPU_8051;
+}
+
+InsnLength LengthI8051::decode(const uint8_t *bytes, uint8_t size) const {
+    if (size == 0)
+        return InsnLength();
+    return length(pgm_read_byte(&I8051_LENGTH[bytes[0]]));
+}
+
+const LengthI8051 LENGTH;
+
+}  // namespace i8051
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LENGTH_I8051_H__
+#define __LENGTH_I8051_H__
+
+#include "length_base.h"
+
+namespace libasm {
+namespace i8051 {
+
+/**
+ * Lengths of i8051 instructions, which are decided by their opcodes.
+ */
+struct LengthI8051 final : LengthDecoder {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    InsnLength decode(const uint8_t *bytes, uint8_t size) const override;
+};
+
+extern const LengthI8051 LENGTH;
+
+}  // namespace i8051
+}  // namespace libasm
+
+#endif  // __LENGTH_I8051_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "length_i8086.h"
+
+#include "config_host.h"
+#include "text_i8086.h"
+
+using namespace libasm::text::i8086;
+
+namespace libasm {
+namespace i8086 {
+
+namespace {
+
+// Lower 4 bits of a table value are byte length.
+#define J(len) ((len) | TRANSFER)  // may transfer control
+#define X(len) ((len) | MODRM)      // has ModR/M byte
+#define NA 0
+
+constexpr uint8_t LENGTH_MASK = 0x0F;
+constexpr uint8_t TRANSFER = 0x10;
+constexpr uint8_t MODRM = 0x20;
+
+InsnLength length(uint8_t value) {
+    return InsnLength(value & LENGTH_MASK, value & TRANSFER);
+}
+
+// clang-format off
+constexpr uint8_t I8086_LENGTH[] PROGMEM = {
+        X(2),     X(2),     X(2),     X(2),        2,        3,        1,        1,  // 00
+        X(2),     X(2),     X(2),     X(2),        2,        3,        1,       NA,  // 08
+        X(2),     X(2),     X(2),     X(2),        2,        3,        1,        1,  // 10
+        X(2),     X(2),     X(2),     X(2),        2,        3,        1,        1,  // 18
+        X(2),     X(2),     X(2),     X(2),        2,        3,        1,        1,  // 20
+        X(2),     X(2),     X(2),     X(2),        2,        3,        1,        1,  // 28
+        X(2),     X(2),     X(2),     X(2),        2,        3,        1,        1,  // 30
+        X(2),     X(2),     X(2),     X(2),        2,        3,        1,        1,  // 38
+           1,        1,        1,        1,        1,        1,        1,        1,  // 40
+           1,        1,        1,        1,        1,        1,        1,        1,  // 48
+           1,        1,        1,        1,        1,        1,        1,        1,  // 50
+           1,        1,        1,        1,        1,        1,        1,        1,  // 58
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 60
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 68
+        J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),  // 70
+        J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),  // 78
+        X(3),     X(4),       NA,     X(3),     X(2),     X(2),     X(2),     X(2),  // 80
+        X(2),     X(2),     X(2),     X(2),     X(2),     X(2),     X(2),     X(2),  // 88
+           1,        1,        1,        1,        1,        1,        1,        1,  // 90
+           1,        1,     J(5),        1,        1,        1,        1,        1,  // 98
+           3,        3,        3,        3,        1,        1,        1,        1,  // A0
+           2,        3,        1,        1,        1,        1,        1,        1,  // A8
+           2,        2,        2,        2,        2,        2,        2,        2,  // B0
+           3,        3,        3,        3,        3,        3,        3,        3,  // B8
+          NA,       NA,     J(3),     J(1),     X(2),     X(2),     X(3),     X(4),  // C0
+          NA,       NA,     J(3),     J(1),     J(1),     J(2),     J(1),     J(1),  // C8
+        X(2),     X(2),     X(2),     X(2),        2,        2,       NA,        1,  // D0
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // D8
+        J(2),     J(2),     J(2),     J(2),        2,        2,        2,        2,  // E0
+        J(3),     J(3),     J(5),     J(2),        1,        1,        1,        1,  // E8
+           1,       NA,        1,        1,        1,        1,     X(2),     X(2),  // F0
+           1,        1,        1,        1,        1,        1,     X(2),     X(2),  // F8
+};
+// clang-format on
+
+/** Bytes of a displacement which follows |modrm| byte. */
+uint8_t displacementBytes(uint8_t modrm) {
+    switch (modrm >> 6) {
+    case 0:
+        return (modrm & 7) == 6 ? 2 : 0;  // direct address
+    case 1:
+        return 1;
+    case 2:
+        return 2;
+    default:
+        return 0;  // register
+    }
+}
+
+bool isStringInsn(uint8_t opc) {
+    return (opc >= 0xA4 && opc < 0xA8) || (opc >= 0xAA && opc < 0xB0);
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *LengthI8086::cpu_P() const {
+    return TEXT_CPU_8086;
+}
+
+InsnLength LengthI8086::decode(const uint8_t *bytes, uint8_t size) const {
+    if (size == 0)
+        return InsnLength();
+    const auto opc = bytes[0];
+    if ((opc == 0xF2 || opc == 0xF3) && _repeatHasStringInsn) {  // REPNE, REP
+        if (size < 2 || !isStringInsn(bytes[1]))
+            return InsnLength();
+        return InsnLength(2);
+    }
+    const auto value = pgm_read_byte(&I8086_LENGTH[opc]);
+    auto insn = length(value);
+    if ((value & MODRM) == 0)
+        return insn;
+    if (size < 2)
+        return InsnLength();
+    const auto modrm = bytes[1];
+    const auto reg = (modrm >> 3) & 7;
+    insn.length += displacementBytes(modrm);
+    if ((opc == 0xF6 || opc == 0xF7) && reg == 0)  // TEST r/m,imm
+        insn.length += (opc == 0xF6) ? 1 : 2;
+    if (opc == 0xFF && reg >= 2 && reg < 6)  // CALL, CALLF, JMP, JMPF
+        insn.transfer = true;
+    return insn;
+}
+
+const LengthI8086 LENGTH;
+
+}  // namespace i8086
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LENGTH_I8086_H__
+#define __LENGTH_I8086_H__
+
+#include "length_base.h"
+
+namespace libasm {
+namespace i8086 {
+
+/**
+ * Lengths of i8086 instructions. A displacement and an immediate which
+ * follow a ModR/M byte are parts of an instruction. A segment override
+ * prefix, LOCK and REP prefix are instructions by themselves, as the
+ * disassembler decodes them by default. When |repeatHasStringInsn|, REP
+ * prefix and the following string instruction are one instruction, same
+ * as "string-insn" option of the disassembler.
+ */
+struct LengthI8086 final : LengthDecoder {
+    LengthI8086(bool repeatHasStringInsn = false) : _repeatHasStringInsn(repeatHasStringInsn) {}
+
+    const /*PROGMEM*/ char *cpu_P() const override;
+    InsnLength decode(const uint8_t *bytes, uint8_t size) const override;
+
+private:
+    const bool _repeatHasStringInsn;
+};
+
+extern const LengthI8086 LENGTH;
+
+}  // namespace i8086
+}  // namespace libasm
+
+#endif  // __LENGTH_I8086_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "length_mc68000.h"
+
+#include "config_host.h"
+#include "text_mc68000.h"
+
+using namespace libasm::text::mc68000;
+
+namespace libasm {
+namespace mc68000 {
+
+namespace {
+
+constexpr uint8_t INVALID = 0xFF;
+
+enum Size : uint8_t {
+    BYTE = 0,
+    WORD = 1,
+    LONG = 2,
+};
+
+/** Bytes of extension words of effective address |ea| of |size| operand. */
+uint8_t extBytes(uint16_t ea, Size size) {
+    const auto mode = (ea >> 3) & 7;
+    const auto reg = ea & 7;
+    if (mode < 5)
+        return 0;
+    if (mode < 7)
+        return 2;  // (d16,An), (d8,An,Xn)
+    switch (reg) {
+    case 0:  // (xxx).W
+    case 2:  // (d16,PC)
+    case 3:  // (d8,PC,Xn)
+        return 2;
+    case 1:  // (xxx).L
+        return 4;
+    case 4:  // #imm
+        return size == LONG ? 4 : 2;
+    default:
+        return INVALID;
+    }
+}
+
+/** Size field of bits 7-6, which is invalid when 3. */
+Size sizeOf(uint16_t opc) {
+    return Size((opc >> 6) & 3);
+}
+
+/** Size field of MOVE, which is 1:byte, 3:word and 2:long. */
+Size moveSize(uint16_t opc) {
+    const auto size = (opc >> 12) & 3;
+    return size == 1 ? BYTE : (size == 3 ? WORD : LONG);
+}
+
+/** Size of address register operand of ADDA, SUBA and CMPA. */
+Size addrSize(uint16_t opc) {
+    return (opc & 0x100) ? LONG : WORD;
+}
+
+InsnLength withEa(uint8_t base, uint16_t ea, Size size, bool transfer = false) {
+    const auto ext = extBytes(ea, size);
+    if (ext == INVALID)
+        return InsnLength();
+    return InsnLength(base + ext, transfer);
+}
+
+InsnLength line0(uint16_t opc) {
+    if ((opc & 0x0138) == 0x0108)
+        return InsnLength(4);  // MOVEP
+    if (opc & 0x0100)
+        return withEa(2, opc, BYTE);  // BTST/BCHG/BCLR/BSET Dn
+    const auto size = sizeOf(opc);
+    switch ((opc >> 9) & 7) {
+    case 4:  // BTST/BCHG/BCLR/BSET #n
+        return withEa(4, opc, BYTE);
+    case 7:
+        return InsnLength();
+    default:  // ORI/ANDI/SUBI/ADDI/EORI/CMPI
+        if (size == 3)
+            return InsnLength();
+        if ((opc & 0x3F) == 0x3C)
+            return InsnLength(4);  // to CCR/SR
+        return withEa(size == LONG ? 6 : 4, opc, size);
+    }
+}
+
+InsnLength line4(uint16_t opc) {
+    switch (opc) {
+    case 0x4AFC:  // ILLEGAL
+    case 0x4E70:  // RESET
+    case 0x4E71:  // NOP
+        return InsnLength(2);
+    case 0x4E72:  // STOP
+        return InsnLength(4);
+    case 0x4E73:  // RTE
+    case 0x4E75:  // RTS
+    case 0x4E76:  // TRAPV
+    case 0x4E77:  // RTR
+        return InsnLength(2, true);
+    }
+    if ((opc & 0xFFF0) == 0x4E40)
+        return InsnLength(2, true);  // TRAP
+    if ((opc & 0xFFF8) == 0x4E50)
+        return InsnLength(4);  // LINK
+    if ((opc & 0xFFF0) == 0x4E60)
+        return InsnLength(2);  // MOVE USP
+    if ((opc & 0xFF80) == 0x4E80)
+        return withEa(2, opc, LONG, true);  // JSR, JMP
+    if ((opc & 0xFB80) == 0x4880 && (opc & 0x38) != 0)
+        return withEa(4, opc, WORD);  // MOVEM
+    if ((opc & 0xF1C0) == 0x41C0 || (opc & 0xF1C0) == 0x4180)
+        return withEa(2, opc, WORD);  // LEA, CHK
+    if ((opc & 0xFFC0) == 0x4AC0 || (opc & 0xFFC0) == 0x4800)
+        return withEa(2, opc, BYTE);  // TAS, NBCD
+    if ((opc & 0xF9C0) == 0x40C0)
+        return withEa(2, opc, WORD);  // MOVE from SR, to CCR, to SR
+    const auto size = sizeOf(opc);
+    return withEa(2, opc, size == 3 ? WORD : size);
+}
+
+InsnLength line5(uint16_t opc) {
+    if (sizeOf(opc) != 3)
+        return withEa(2, opc, sizeOf(opc));  // ADDQ, SUBQ
+    if ((opc & 0x38) == 0x08)
+        return InsnLength(4, true);  // DBcc
+    return withEa(2, opc, BYTE);  // Scc
+}
+
+InsnLength lineArith(uint16_t opc) {
+    const auto line = opc >> 12;
+    const auto size = sizeOf(opc);
+    if (size == 3) {
+        if (line == 0x8 || line == 0xC)
+            return withEa(2, opc, WORD);  // DIVU/DIVS, MULU/MULS
+        return withEa(2, opc, addrSize(opc));  // SUBA, CMPA, ADDA
+    }
+    if ((opc & 0x130) == 0x100 && line != 0xB)
+        return InsnLength(2);  // SBCD, SUBX, ABCD, EXG, ADDX
+    if ((opc & 0x138) == 0x108 && line == 0xB)
+        return InsnLength(2);  // CMPM
+    return withEa(2, opc, size);
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *LengthMc68000::cpu_P() const {
+    return TEXT_CPU_68000;
+}
+
+InsnLength LengthMc68000::decode(const uint8_t *bytes, uint8_t size) const {
+    if (size < 2)
+        return InsnLength();
+    const uint16_t opc = (static_cast<uint16_t>(bytes[0]) << 8) | bytes[1];
+    switch (opc >> 12) {
+    case 0x0:
+        return line0(opc);
+    case 0x1:
+    case 0x2:
+    case 0x3: {
+        const auto dst = ((opc >> 3) & 0x38) | ((opc >> 9) & 7);
+        const auto src = extBytes(opc, moveSize(opc));
+        if (src == INVALID)
+            return InsnLength();
+        return withEa(2 + src, dst, moveSize(opc));
+    }
+    case 0x4:
+        return line4(opc);
+    case 0x5:
+        return line5(opc);
+    case 0x6:
+        return InsnLength((opc & 0xFF) == 0 ? 4 : 2, true);  // Bcc, BSR
+    case 0x7:
+        return InsnLength(2);  // MOVEQ
+    case 0xE:
+        return sizeOf(opc) == 3 ? withEa(2, opc, WORD) : InsnLength(2);
+    case 0xA:
+    case 0xF:
+        return InsnLength();
+    default:
+        return lineArith(opc);
+    }
+}
+
+const LengthMc68000 LENGTH;
+
+}  // namespace mc68000
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
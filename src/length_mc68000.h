@@ -0,0 +1,47 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LENGTH_MC68000_H__
+#define __LENGTH_MC68000_H__
+
+#include "length_base.h"
+
+namespace libasm {
+namespace mc68000 {
+
+/**
+ * Lengths of MC68000 instructions, which are decided by the first
+ * operation word including extension words of immediate data and
+ * effective addresses.
+ */
+struct LengthMc68000 final : LengthDecoder {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    InsnLength decode(const uint8_t *bytes, uint8_t size) const override;
+};
+
+extern const LengthMc68000 LENGTH;
+
+}  // namespace mc68000
+}  // namespace libasm
+
+#endif  // __LENGTH_MC68000_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
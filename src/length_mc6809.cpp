@@ -0,0 +1,227 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "length_mc6809.h"
+
+#include "config_host.h"
+#include "text_mc6809.h"
+
+using namespace libasm::text::mc6809;
+
+namespace libasm {
+namespace mc6809 {
+
+namespace {
+
+// Lower 4 bits of a table value are byte length.
+#define J(len) ((len) | TRANSFER)  // may transfer control
+#define X(len) ((len) | INDEXED)   // has indexed addressing postbyte
+#define NA 0
+
+constexpr uint8_t LENGTH_MASK = 0x0F;
+constexpr uint8_t TRANSFER = 0x10;
+constexpr uint8_t INDEXED = 0x20;
+
+InsnLength length(uint8_t value) {
+    return InsnLength(value & LENGTH_MASK, value & TRANSFER);
+}
+
+// clang-format off
+constexpr uint8_t MC6809_LENGTH[] PROGMEM = {
+           2,       NA,       NA,        2,        2,       NA,        2,        2,  // 00
+           2,        2,        2,       NA,        2,        2,     J(2),        2,  // 08
+          NA,       NA,        1,        1,       NA,       NA,     J(3),     J(3),  // 10
+          NA,        1,        2,       NA,        2,        1,        2,        2,  // 18
+        J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),  // 20
+        J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),     J(2),  // 28
+        X(2),     X(2),     X(2),     X(2),        2,        2,        2,        2,  // 30
+          NA,     J(1),        1,     J(1),        2,        1,       NA,     J(1),  // 38
+           1,       NA,       NA,        1,        1,       NA,        1,        1,  // 40
+           1,        1,        1,       NA,        1,        1,       NA,        1,  // 48
+           1,       NA,       NA,        1,        1,       NA,        1,        1,  // 50
+           1,        1,        1,       NA,        1,        1,       NA,        1,  // 58
+        X(2),       NA,       NA,     X(2),     X(2),       NA,     X(2),     X(2),  // 60
+        X(2),     X(2),     X(2),       NA,     X(2),     X(2),  J(X(2)),     X(2),  // 68
+           3,       NA,       NA,        3,        3,       NA,        3,        3,  // 70
+           3,        3,        3,       NA,        3,        3,     J(3),        3,  // 78
+           2,        2,        2,        3,        2,        2,        2,       NA,  // 80
+           2,        2,        2,        2,        3,     J(2),        3,       NA,  // 88
+           2,        2,        2,        2,        2,        2,        2,        2,  // 90
+           2,        2,        2,        2,        2,     J(2),        2,        2,  // 98
+        X(2),     X(2),     X(2),     X(2),     X(2),     X(2),     X(2),     X(2),  // A0
+        X(2),     X(2),     X(2),     X(2),     X(2),  J(X(2)),     X(2),     X(2),  // A8
+           3,        3,        3,        3,        3,        3,        3,        3,  // B0
+           3,        3,        3,        3,        3,     J(3),        3,        3,  // B8
+           2,        2,        2,        3,        2,        2,        2,       NA,  // C0
+           2,        2,        2,        2,        3,       NA,        3,       NA,  // C8
+           2,        2,        2,        2,        2,        2,        2,        2,  // D0
+           2,        2,        2,        2,        2,        2,        2,        2,  // D8
+        X(2),     X(2),     X(2),     X(2),     X(2),     X(2),     X(2),     X(2),  // E0
+        X(2),     X(2),     X(2),     X(2),     X(2),     X(2),     X(2),     X(2),  // E8
+           3,        3,        3,        3,        3,        3,        3,        3,  // F0
+           3,        3,        3,        3,        3,        3,        3,        3,  // F8
+};
+
+// 10 prefixed
+constexpr uint8_t PAGE2_LENGTH[] PROGMEM = {
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 00
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 08
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 10
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 18
+          NA,     J(4),     J(4),     J(4),     J(4),     J(4),     J(4),     J(4),  // 20
+        J(4),     J(4),     J(4),     J(4),     J(4),     J(4),     J(4),     J(4),  // 28
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 30
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,     J(2),  // 38
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 40
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 48
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 50
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 58
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 60
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 68
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 70
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 78
+          NA,       NA,       NA,        4,       NA,       NA,       NA,       NA,  // 80
+          NA,       NA,       NA,       NA,        4,       NA,        4,       NA,  // 88
+          NA,       NA,       NA,        3,       NA,       NA,       NA,       NA,  // 90
+          NA,       NA,       NA,       NA,        3,       NA,        3,        3,  // 98
+          NA,       NA,       NA,     X(3),       NA,       NA,       NA,       NA,  // A0
+          NA,       NA,       NA,       NA,     X(3),       NA,     X(3),     X(3),  // A8
+          NA,       NA,       NA,        4,       NA,       NA,       NA,       NA,  // B0
+          NA,       NA,       NA,       NA,        4,       NA,        4,        4,  // B8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // C0
+          NA,       NA,       NA,       NA,       NA,       NA,        4,       NA,  // C8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // D0
+          NA,       NA,       NA,       NA,       NA,       NA,        3,        3,  // D8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // E0
+          NA,       NA,       NA,       NA,       NA,       NA,     X(3),     X(3),  // E8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // F0
+          NA,       NA,       NA,       NA,       NA,       NA,        4,        4,  // F8
+};
+
+// 11 prefixed
+constexpr uint8_t PAGE3_LENGTH[] PROGMEM = {
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 00
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 08
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 10
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 18
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 20
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 28
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 30
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,     J(2),  // 38
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 40
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 48
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 50
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 58
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 60
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 68
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 70
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 78
+          NA,       NA,       NA,        4,       NA,       NA,       NA,       NA,  // 80
+          NA,       NA,       NA,       NA,        4,       NA,       NA,       NA,  // 88
+          NA,       NA,       NA,        3,       NA,       NA,       NA,       NA,  // 90
+          NA,       NA,       NA,       NA,        3,       NA,       NA,       NA,  // 98
+          NA,       NA,       NA,     X(3),       NA,       NA,       NA,       NA,  // A0
+          NA,       NA,       NA,       NA,     X(3),       NA,       NA,       NA,  // A8
+          NA,       NA,       NA,        4,       NA,       NA,       NA,       NA,  // B0
+          NA,       NA,       NA,       NA,        4,       NA,       NA,       NA,  // B8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // C0
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // C8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // D0
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // D8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // E0
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // E8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // F0
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // F8
+};
+// clang-format on
+
+/** Bytes of an offset or an address which follow indexed addressing |post| byte. */
+uint8_t indexedBytes(uint8_t post) {
+    if ((post & 0x80) == 0)
+        return 0;  // 5-bit offset
+    switch (post & 0xF) {
+    case 0x8:  // 8-bit offset
+    case 0xC:  // 8-bit PC relative
+        return 1;
+    case 0x9:  // 16-bit offset
+    case 0xD:  // 16-bit PC relative
+    case 0xF:  // extended indirect
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+/** PULS/PULU PC and TFR/EXG to PC transfer control by their postbyte. */
+bool loadsPc(uint8_t opc, uint8_t post) {
+    switch (opc) {
+    case 0x35:  // PULS
+    case 0x37:  // PULU
+        return post & 0x80;
+    case 0x1E:  // EXG
+        return (post & 0xF0) == 0x50 || (post & 0xF) == 5;
+    case 0x1F:  // TFR
+        return (post & 0xF) == 5;
+    default:
+        return false;
+    }
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *LengthMc6809::cpu_P() const {
+    return TEXT_CPU_6809;
+}
+
+InsnLength LengthMc6809::decode(const uint8_t *bytes, uint8_t size) const {
+    if (size == 0)
+        return InsnLength();
+    const auto opc = bytes[0];
+    uint8_t value;
+    uint8_t pos = 1;
+    if (opc == 0x10 || opc == 0x11) {
+        if (size < 2)
+            return InsnLength();
+        const auto table = opc == 0x10 ? PAGE2_LENGTH : PAGE3_LENGTH;
+        value = pgm_read_byte(&table[bytes[1]]);
+        pos = 2;
+    } else {
+        value = pgm_read_byte(&MC6809_LENGTH[opc]);
+    }
+    auto insn = length(value);
+    if (insn.length == 0 || ((value & INDEXED) == 0 && pos == 2))
+        return insn;
+    if (size <= pos)
+        return InsnLength();
+    const auto post = bytes[pos];
+    if (value & INDEXED)
+        insn.length += indexedBytes(post);
+    if (loadsPc(opc, post))
+        insn.transfer = true;
+    return insn;
+}
+
+const LengthMc6809 LENGTH;
+
+}  // namespace mc6809
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LENGTH_MC6809_H__
+#define __LENGTH_MC6809_H__
+
+#include "length_base.h"
+
+namespace libasm {
+namespace mc6809 {
+
+/**
+ * Lengths of MC6809 instructions. Page prefixes 10 and 11 are parts of
+ * an instruction, and so are an offset and an address which follow an
+ * indexed addressing postbyte.
+ */
+struct LengthMc6809 final : LengthDecoder {
+    const /*PROGMEM*/ char *cpu_P() const override;
+    InsnLength decode(const uint8_t *bytes, uint8_t size) const override;
+};
+
+extern const LengthMc6809 LENGTH;
+
+}  // namespace mc6809
+}  // namespace libasm
+
+#endif  // __LENGTH_MC6809_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
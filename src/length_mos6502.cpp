@@ -0,0 +1,99 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "length_mos6502.h"
+
+#include "config_host.h"
+#include "text_mos6502.h"
+
+using namespace libasm::text::mos6502;
+
+namespace libasm {
+namespace mos6502 {
+
+namespace {
+
+// Lower 4 bits of a table value are byte length.
+#define J(len) ((len) | TRANSFER)  // may transfer control
+#define NA 0
+
+constexpr uint8_t LENGTH_MASK = 0x0F;
+constexpr uint8_t TRANSFER = 0x10;
+
+InsnLength length(uint8_t value) {
+    return InsnLength(value & LENGTH_MASK, value & TRANSFER);
+}
+
+// clang-format off
+constexpr uint8_t MOS6502_LENGTH[] PROGMEM = {
+        J(1),        2,       NA,       NA,       NA,        2,        2,       NA,  // 00
+           1,        2,        1,       NA,       NA,        3,        3,       NA,  // 08
+        J(2),        2,       NA,       NA,       NA,        2,        2,       NA,  // 10
+           1,        3,       NA,       NA,       NA,        3,        3,       NA,  // 18
+        J(3),        2,       NA,       NA,        2,        2,        2,       NA,  // 20
+           1,        2,        1,       NA,        3,        3,        3,       NA,  // 28
+        J(2),        2,       NA,       NA,       NA,        2,        2,       NA,  // 30
+           1,        3,       NA,       NA,       NA,        3,        3,       NA,  // 38
+        J(1),        2,       NA,       NA,       NA,        2,        2,       NA,  // 40
+           1,        2,        1,       NA,     J(3),        3,        3,       NA,  // 48
+        J(2),        2,       NA,       NA,       NA,        2,        2,       NA,  // 50
+           1,        3,       NA,       NA,       NA,        3,        3,       NA,  // 58
+        J(1),        2,       NA,       NA,       NA,        2,        2,       NA,  // 60
+           1,        2,        1,       NA,     J(3),        3,        3,       NA,  // 68
+        J(2),        2,       NA,       NA,       NA,        2,        2,       NA,  // 70
+           1,        3,       NA,       NA,       NA,        3,        3,       NA,  // 78
+          NA,        2,       NA,       NA,        2,        2,        2,       NA,  // 80
+           1,       NA,        1,       NA,        3,        3,        3,       NA,  // 88
+        J(2),        2,       NA,       NA,        2,        2,        2,       NA,  // 90
+           1,        3,        1,       NA,       NA,        3,       NA,       NA,  // 98
+           2,        2,        2,       NA,        2,        2,        2,       NA,  // A0
+           1,        2,        1,       NA,        3,        3,        3,       NA,  // A8
+        J(2),        2,       NA,       NA,        2,        2,        2,       NA,  // B0
+           1,        3,        1,       NA,        3,        3,        3,       NA,  // B8
+           2,        2,       NA,       NA,        2,        2,        2,       NA,  // C0
+           1,        2,        1,       NA,        3,        3,        3,       NA,  // C8
+        J(2),        2,       NA,       NA,       NA,        2,        2,       NA,  // D0
+           1,        3,       NA,       NA,       NA,        3,        3,       NA,  // D8
+           2,        2,       NA,       NA,        2,        2,        2,       NA,  // E0
+           1,        2,        1,       NA,        3,        3,        3,       NA,  // E8
+        J(2),        2,       NA,       NA,       NA,        2,        2,       NA,  // F0
+           1,        3,       NA,       NA,       NA,        3,        3,       NA,  // F8
+};
+// clang-format on
+
+}  // namespace
+
+const /*PROGMEM*/ char *LengthMos6502::cpu_P() const {
+    return TEXT_CPU_6502;
+}
+
+InsnLength LengthMos6502::decode(const uint8_t *bytes, uint8_t size) const {
+    if (size == 0)
+        return InsnLength();
+    return length(pgm_read_byte(&MOS6502_LENGTH[bytes[0]]));
+}
+
+const LengthMos6502 LENGTH;
+
+}  // namespace mos6502
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "length_z80.h"
+
+#include "config_host.h"
+#include "text_z80.h"
+
+using namespace libasm::text::z80;
+
+namespace libasm {
+namespace z80 {
+
+namespace {
+
+// Lower 4 bits of a table value are byte length.
+#define J(len) ((len) | TRANSFER)  // may transfer control
+#define NA 0
+
+constexpr uint8_t LENGTH_MASK = 0x0F;
+constexpr uint8_t TRANSFER = 0x10;
+
+InsnLength length(uint8_t value) {
+    return InsnLength(value & LENGTH_MASK, value & TRANSFER);
+}
+
+// clang-format off
+constexpr uint8_t Z80_LENGTH[] PROGMEM = {
+           1,        3,        1,        1,        1,        1,        2,        1,  // 00
+           1,        1,        1,        1,        1,        1,        2,        1,  // 08
+        J(2),        3,        1,        1,        1,        1,        2,        1,  // 10
+        J(2),        1,        1,        1,        1,        1,        2,        1,  // 18
+        J(2),        3,        3,        1,        1,        1,        2,        1,  // 20
+        J(2),        1,        3,        1,        1,        1,        2,        1,  // 28
+        J(2),        3,        3,        1,        1,        1,        2,        1,  // 30
+        J(2),        1,        3,        1,        1,        1,        2,        1,  // 38
+           1,        1,        1,        1,        1,        1,        1,        1,  // 40
+           1,        1,        1,        1,        1,        1,        1,        1,  // 48
+           1,        1,        1,        1,        1,        1,        1,        1,  // 50
+           1,        1,        1,        1,        1,        1,        1,        1,  // 58
+           1,        1,        1,        1,        1,        1,        1,        1,  // 60
+           1,        1,        1,        1,        1,        1,        1,        1,  // 68
+           1,        1,        1,        1,        1,        1,        1,        1,  // 70
+           1,        1,        1,        1,        1,        1,        1,        1,  // 78
+           1,        1,        1,        1,        1,        1,        1,        1,  // 80
+           1,        1,        1,        1,        1,        1,        1,        1,  // 88
+           1,        1,        1,        1,        1,        1,        1,        1,  // 90
+           1,        1,        1,        1,        1,        1,        1,        1,  // 98
+           1,        1,        1,        1,        1,        1,        1,        1,  // A0
+           1,        1,        1,        1,        1,        1,        1,        1,  // A8
+           1,        1,        1,        1,        1,        1,        1,        1,  // B0
+           1,        1,        1,        1,        1,        1,        1,        1,  // B8
+        J(1),        1,     J(3),     J(3),     J(3),        1,        2,     J(1),  // C0
+        J(1),     J(1),     J(3),        2,     J(3),     J(3),        2,     J(1),  // C8
+        J(1),        1,     J(3),        2,     J(3),        1,        2,     J(1),  // D0
+        J(1),        1,     J(3),        2,     J(3),       NA,        2,     J(1),  // D8
+        J(1),        1,     J(3),        1,     J(3),        1,        2,     J(1),  // E0
+        J(1),     J(1),     J(3),        1,     J(3),       NA,        2,     J(1),  // E8
+        J(1),        1,     J(3),        1,     J(3),        1,        2,     J(1),  // F0
+        J(1),        1,     J(3),        1,     J(3),       NA,        2,     J(1),  // F8
+};
+
+// ED40~ED7F, EDA0~EDBF
+constexpr uint8_t ED_LENGTH[] PROGMEM = {
+           2,        2,        2,        4,        2,     J(2),        2,        2,  // 40
+           2,        2,        2,        4,       NA,     J(2),       NA,        2,  // 48
+           2,        2,        2,        4,       NA,       NA,        2,        2,  // 50
+           2,        2,        2,        4,       NA,       NA,        2,        2,  // 58
+           2,        2,        2,       NA,       NA,       NA,       NA,        2,  // 60
+           2,        2,        2,       NA,       NA,       NA,       NA,        2,  // 68
+          NA,       NA,        2,        4,       NA,       NA,       NA,       NA,  // 70
+           2,        2,        2,        4,       NA,       NA,       NA,       NA,  // 78
+           2,        2,        2,        2,       NA,       NA,       NA,       NA,  // A0
+           2,        2,        2,        2,       NA,       NA,       NA,       NA,  // A8
+           2,        2,        2,        2,       NA,       NA,       NA,       NA,  // B0
+           2,        2,        2,        2,       NA,       NA,       NA,       NA,  // B8
+};
+
+// DD/FD prefixed
+constexpr uint8_t IX_LENGTH[] PROGMEM = {
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 00
+          NA,        2,       NA,       NA,       NA,       NA,       NA,       NA,  // 08
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // 10
+          NA,        2,       NA,       NA,       NA,       NA,       NA,       NA,  // 18
+          NA,        4,        4,        2,       NA,       NA,       NA,       NA,  // 20
+          NA,        2,        4,        2,       NA,       NA,       NA,       NA,  // 28
+          NA,       NA,       NA,       NA,        3,        3,        4,       NA,  // 30
+          NA,        2,       NA,       NA,       NA,       NA,       NA,       NA,  // 38
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 40
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 48
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 50
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 58
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 60
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 68
+           3,        3,        3,        3,        3,        3,       NA,        3,  // 70
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 78
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 80
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 88
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 90
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // 98
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // A0
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // A8
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // B0
+          NA,       NA,       NA,       NA,       NA,       NA,        3,       NA,  // B8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // C0
+          NA,       NA,       NA,        4,       NA,       NA,       NA,       NA,  // C8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // D0
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // D8
+          NA,        2,       NA,        2,       NA,        2,       NA,       NA,  // E0
+          NA,     J(2),       NA,       NA,       NA,       NA,       NA,       NA,  // E8
+          NA,       NA,       NA,       NA,       NA,       NA,       NA,       NA,  // F0
+          NA,        2,       NA,       NA,       NA,       NA,       NA,       NA,  // F8
+};
+// clang-format on
+
+InsnLength prefixEd(uint8_t opc) {
+    if (opc >= 0x40 && opc < 0x80)
+        return length(pgm_read_byte(&ED_LENGTH[opc - 0x40]));
+    if (opc >= 0xA0 && opc < 0xC0)
+        return length(pgm_read_byte(&ED_LENGTH[opc - 0xA0 + 0x40]));
+    return InsnLength();
+}
+
+/** DD CB d op and FD CB d op have only (IX+d) and (IY+d) operand. */
+InsnLength prefixIxCb(uint8_t opc) {
+    if ((opc & 7) != 6 || (opc & 0xF8) == 0x30)
+        return InsnLength();
+    return InsnLength(4);
+}
+
+}  // namespace
+
+const /*PROGMEM*/ char *LengthZ80::cpu_P() const {
+    return TEXT_CPU_Z80;
+}
+
+InsnLength LengthZ80::decode(const uint8_t *bytes, uint8_t size) const {
+    if (size == 0)
+        return InsnLength();
+    const auto opc = bytes[0];
+    if (opc == 0xCB || opc == 0xED || opc == 0xDD || opc == 0xFD) {
+        if (size < 2)
+            return InsnLength();
+        const auto opc2 = bytes[1];
+        if (opc == 0xCB)
+            return (opc2 & 0xF8) == 0x30 ? InsnLength() : InsnLength(2);
+        if (opc == 0xED)
+            return prefixEd(opc2);
+        if (opc2 == 0xCB)
+            return size < 4 ? InsnLength() : prefixIxCb(bytes[3]);
+        return length(pgm_read_byte(&IX_LENGTH[opc2]));
+    }
+    return length(pgm_read_byte(&Z80_LENGTH[opc]));
+}
+
+const LengthZ80 LENGTH;
+
+}  // namespace z80
+}  // namespace libasm
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
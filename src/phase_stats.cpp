@@ -0,0 +1,109 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "phase_stats.h"
+
+#if defined(LIBASM_STATS)
+
+#include <chrono>
+
+namespace libasm {
+namespace stats {
+
+namespace {
+
+struct ThreadStats {
+    Counter counters[PHASE_END];
+    Scope *current;
+};
+
+thread_local ThreadStats STATS;
+
+uint64_t now() {
+    const auto time = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+}
+
+constexpr const char *NAMES[] = {
+        "pass",
+        "file I/O",
+        "line lexing",
+        "directive dispatch",
+        "expression evaluation",
+        "mnemonic search",
+        "encoding",
+        "decoding",
+        "opcode search",
+        "formatting",
+        "memory write",
+        "convergence check",
+};
+
+}  // namespace
+
+const Counter &counter(Phase phase) {
+    return STATS.counters[phase];
+}
+
+void reset() {
+    for (auto &counter : STATS.counters)
+        counter = Counter{0, 0, 0};
+}
+
+const char *name(Phase phase) {
+    return phase < PHASE_END ? NAMES[phase] : "";
+}
+
+bool Scope::isRecursive(const Scope *scope, Phase phase) {
+    for (; scope; scope = scope->_outer) {
+        if (scope->_phase == phase)
+            return true;
+    }
+    return false;
+}
+
+Scope::Scope(Phase phase)
+    : _outer(STATS.current),
+      _phase(phase),
+      _recursive(isRecursive(_outer, phase)),
+      _start(0),
+      _nested_ns(0) {
+    STATS.counters[phase].count++;
+    STATS.current = this;
+    _start = now();
+}
+
+Scope::~Scope() {
+    const auto elapsed = now() - _start;
+    STATS.current = _outer;
+    if (_outer)
+        _outer->_nested_ns += elapsed;
+    if (!_recursive)
+        STATS.counters[_phase].total_ns += elapsed;
+    STATS.counters[_phase].self_ns += elapsed - _nested_ns;
+}
+
+}  // namespace stats
+}  // namespace libasm
+
+#endif  // LIBASM_STATS
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
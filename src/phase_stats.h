@@ -0,0 +1,101 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PHASE_STATS_H__
+#define __PHASE_STATS_H__
+
+/**
+ * Per-phase counters and timers of assembling and disassembling.
+ *
+ * Instrumentation is compiled in only when LIBASM_STATS is defined;
+ * otherwise LIBASM_STATS_SCOPE expands to nothing and costs nothing.
+ */
+#if defined(LIBASM_STATS)
+
+#include <stdint.h>
+
+namespace libasm {
+namespace stats {
+
+enum Phase : uint8_t {
+    PASS = 0,          // AsmDriver::assemble, DisDriver::disassemble
+    FILE_IO = 1,       // reading source and binary, writing output
+    LEXING = 2,        // AsmFormatter::assemble
+    DIRECTIVE = 3,     // AsmDirective::processPseudo
+    EVALUATION = 4,    // ValueParser::eval
+    SEARCH_NAME = 5,   // CpuBase::searchName
+    ENCODING = 6,      // Assembler::encode
+    DECODING = 7,      // Disassembler::decode
+    SEARCH_CODE = 8,   // CpuBase::searchOpCode
+    FORMATTING = 9,    // listing and disassembler output
+    MEMORY_WRITE = 10, // BinMemory::writeByte
+    CONVERGENCE = 11,  // BinMemory::equals
+    PHASE_END = 12,
+};
+
+struct Counter {
+    uint64_t count;
+    uint64_t total_ns;  // including nested phases
+    uint64_t self_ns;   // excluding nested phases
+};
+
+/** counters of the calling thread */
+const Counter &counter(Phase phase);
+/** clear counters of the calling thread */
+void reset();
+const char *name(Phase phase);
+
+/**
+ * Count a call of |phase| and measure time until the end of scope.
+ * Recursive calls of the same phase are counted but not timed twice.
+ */
+class Scope {
+public:
+    Scope(Phase phase);
+    ~Scope();
+
+private:
+    Scope *const _outer;
+    const Phase _phase;
+    const bool _recursive;
+    uint64_t _start;
+    uint64_t _nested_ns;
+
+    static bool isRecursive(const Scope *scope, Phase phase);
+};
+
+}  // namespace stats
+}  // namespace libasm
+
+#define LIBASM_STATS_SCOPE(phase) \
+    const ::libasm::stats::Scope stats_scope_(::libasm::stats::phase)
+
+#else
+
+#define LIBASM_STATS_SCOPE(phase) \
+    do {                          \
+    } while (0)
+
+#endif  // LIBASM_STATS
+
+#endif  // __PHASE_STATS_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
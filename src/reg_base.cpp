@@ -45,31 +45,6 @@ StrBuffer &outRegNumber(StrBuffer &out, int8_t num) {
     return out.letter(num + '0');
 }
 
-const NameEntry *searchName(uint8_t name, const NameEntry *begin, const NameEntry *end) {
-    for (const auto *entry = begin; entry < end; entry++) {
-        if (name == entry->name())
-            return entry;
-    }
-    return nullptr;
-}
-
-uint8_t nameLen(uint8_t name, const NameEntry *begin, const NameEntry *end) {
-    const auto *entry = searchName(name, begin, end);
-    return entry ? entry->len() : 0;
-}
-
-const NameEntry *searchText(StrScanner &scan, const NameEntry *begin, const NameEntry *end) {
-    for (const auto *entry = begin; entry < end; entry++) {
-        const /*PROGMEM*/ char *text_P = entry->text_P();
-        const uint8_t len = entry->len();
-        if (scan.istarts_P(text_P, len) && !isidchar(scan[len])) {
-            scan += len;
-            return entry;
-        }
-    }
-    return nullptr;
-}
-
 }  // namespace reg
 }  // namespace libasm
 
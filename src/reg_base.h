@@ -22,16 +22,20 @@
 #include "config_host.h"
 #include "str_buffer.h"
 #include "str_scanner.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace reg {
 
 /**
- * Entry of registers, condition codes and flags table.
+ * Entry of registers, condition codes and flags table. The text of an entry is a 16-bit offset
+ * in the text pool |POOL| of the CPU.
  */
+template <const /*PROGMEM*/ char *POOL>
 struct NameEntry {
-    const uint8_t _name;
-    const /*PROGMEM*/ char *const _text_P;
+    typedef text::Text<POOL> text_t;
+
+    constexpr NameEntry(uint8_t name, text_t text) : _name(name), _text(text.offset()) {}
 #define NAME_ENTRY(name) \
     { name, TEXT_##name }
 
@@ -39,20 +43,50 @@ struct NameEntry {
         return pgm_read_byte(&this->_name);
     }
     inline const /*PROGMEM*/ char *text_P() const {
-        return reinterpret_cast<const char *>(pgm_read_ptr(&this->_text_P));
+        return text_t::at(pgm_read_word(&this->_text));
     }
     inline uint8_t len() const {
         return strlen_P(text_P());
     }
+
+private:
+    const uint8_t _name;
+    const uint16_t _text;
 };
 
 static inline bool isidchar(char c) {
     return isalnum(c) || c == '_';
 }
 
-const NameEntry *searchName(uint8_t name, const NameEntry *begin, const NameEntry *end);
-uint8_t nameLen(uint8_t name, const NameEntry *begin, const NameEntry *end);
-const NameEntry *searchText(StrScanner &scan, const NameEntry *begin, const NameEntry *end);
+template <const /*PROGMEM*/ char *POOL>
+const NameEntry<POOL> *searchName(
+        uint8_t name, const NameEntry<POOL> *begin, const NameEntry<POOL> *end) {
+    for (const auto *entry = begin; entry < end; entry++) {
+        if (name == entry->name())
+            return entry;
+    }
+    return nullptr;
+}
+
+template <const /*PROGMEM*/ char *POOL>
+uint8_t nameLen(uint8_t name, const NameEntry<POOL> *begin, const NameEntry<POOL> *end) {
+    const auto *entry = searchName(name, begin, end);
+    return entry ? entry->len() : 0;
+}
+
+template <const /*PROGMEM*/ char *POOL>
+const NameEntry<POOL> *searchText(
+        StrScanner &scan, const NameEntry<POOL> *begin, const NameEntry<POOL> *end) {
+    for (const auto *entry = begin; entry < end; entry++) {
+        const /*PROGMEM*/ char *text_P = entry->text_P();
+        const uint8_t len = entry->len();
+        if (scan.istarts_P(text_P, len) && !isidchar(scan[len])) {
+            scan += len;
+            return entry;
+        }
+    }
+    return nullptr;
+}
 
 /**
  * Parse register number from 0 to less than 20.
@@ -26,7 +26,7 @@ namespace libasm {
 namespace f3850 {
 namespace reg {
 
-static constexpr NameEntry REG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> REG_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_A),
         NAME_ENTRY(REG_W),
         NAME_ENTRY(REG_IS),
@@ -25,7 +25,7 @@ namespace libasm {
 namespace i8086 {
 namespace reg {
 
-static constexpr NameEntry REG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> REG_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_AL),
         NAME_ENTRY(REG_AH),
         NAME_ENTRY(REG_AX),
@@ -25,7 +25,7 @@ namespace libasm {
 namespace ins8070 {
 namespace reg {
 
-static constexpr NameEntry REG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> REG_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_A),
         NAME_ENTRY(REG_E),
         NAME_ENTRY(REG_EA),
@@ -25,7 +25,7 @@ namespace libasm {
 namespace mc68000 {
 namespace reg {
 
-static constexpr NameEntry REG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> REG_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_D0),
         NAME_ENTRY(REG_D1),
         NAME_ENTRY(REG_D2),
@@ -25,7 +25,7 @@ namespace libasm {
 namespace mn1610 {
 namespace reg {
 
-static constexpr NameEntry REG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> REG_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_R0),
         NAME_ENTRY(REG_R1),
         NAME_ENTRY(REG_R2),
@@ -171,7 +171,7 @@ StrBuffer &outRegName(StrBuffer &out, RegName name) {
     return out;
 }
 
-static constexpr NameEntry CC_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> CC_TABLE[] PROGMEM = {
         NAME_ENTRY(CC_SKP),
         NAME_ENTRY(CC_M),
         NAME_ENTRY(CC_PZ),
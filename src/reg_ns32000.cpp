@@ -25,7 +25,7 @@ namespace libasm {
 namespace ns32000 {
 namespace reg {
 
-static constexpr NameEntry REG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> REG_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_R0),
         NAME_ENTRY(REG_R1),
         NAME_ENTRY(REG_R2),
@@ -89,7 +89,7 @@ bool isRegPair(RegName name) {
     return num >= 0 && num < 16 && num % 2 == 0;
 }
 
-static constexpr NameEntry PREG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> PREG_TABLE[] PROGMEM = {
         NAME_ENTRY(PREG_UPSR),
         {PREG_UPSR, TEXT_PREG_US},
         {PREG_FP, TEXT_REG_FP},
@@ -125,7 +125,7 @@ uint8_t encodePregName(PregName name) {
     return uint8_t(name);
 }
 
-static constexpr NameEntry MREG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> MREG_TABLE[] PROGMEM = {
         NAME_ENTRY(MREG_BPR0),
         NAME_ENTRY(MREG_BPR1),
         NAME_ENTRY(MREG_MSR),
@@ -158,7 +158,7 @@ uint8_t encodeMregName(MregName name) {
     return uint8_t(name);
 }
 
-static constexpr NameEntry CONFIG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> CONFIG_TABLE[] PROGMEM = {
         NAME_ENTRY(CONFIG_I),
         NAME_ENTRY(CONFIG_M),
         NAME_ENTRY(CONFIG_F),
@@ -185,7 +185,7 @@ StrBuffer &outConfigNames(StrBuffer &out, uint8_t configs) {
     return out.letter(']');
 }
 
-static constexpr NameEntry STROPT_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> STROPT_TABLE[] PROGMEM = {
         NAME_ENTRY(STROPT_B),
         NAME_ENTRY(STROPT_W),
         NAME_ENTRY(STROPT_U),
@@ -49,7 +49,7 @@ StrBuffer &outRegName(StrBuffer &out, RegName name) {
     return outRegNumber(out.letter('R'), int8_t(name));
 }
 
-static constexpr NameEntry CC_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> CC_TABLE[] PROGMEM = {
         NAME_ENTRY(CC_EQ),
         NAME_ENTRY(CC_GT),
         NAME_ENTRY(CC_LT),
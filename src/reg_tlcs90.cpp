@@ -25,7 +25,7 @@ namespace libasm {
 namespace tlcs90 {
 namespace reg {
 
-static constexpr NameEntry REG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> REG_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_BC),
         NAME_ENTRY(REG_DE),
         NAME_ENTRY(REG_HL),
@@ -111,7 +111,7 @@ RegName decodeIndexReg(uint8_t num) {
     return RegName(num + 4);
 }
 
-static constexpr NameEntry CC_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> CC_TABLE[] PROGMEM = {
         NAME_ENTRY(CC_F),
         NAME_ENTRY(CC_LT),
         NAME_ENTRY(CC_LE),
@@ -80,7 +80,7 @@ StrBuffer &outRegName(StrBuffer &out, RegName name) {
     return outRegNumber(out.text_P(PSTR("RR")), num - 16);
 }
 
-static constexpr NameEntry CC_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> CC_TABLE[] PROGMEM = {
         NAME_ENTRY(CC_F),
         NAME_ENTRY(CC_LT),
         NAME_ENTRY(CC_LE),
@@ -26,7 +26,7 @@ namespace libasm {
 namespace z80 {
 namespace reg {
 
-static constexpr NameEntry REG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> REG_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_BC),
         NAME_ENTRY(REG_DE),
         NAME_ENTRY(REG_HL),
@@ -133,7 +133,7 @@ RegName decodeIrReg(uint8_t num) {
     return RegName((num & 1) + 16);
 }
 
-static constexpr NameEntry CC_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> CC_TABLE[] PROGMEM = {
         NAME_ENTRY(CC_NZ),
         NAME_ENTRY(CC_Z),
         NAME_ENTRY(CC_NC),
@@ -153,7 +153,7 @@ bool isCtlReg(RegName name) {
     return static_cast<int8_t>(name) >= 64;
 }
 
-static constexpr NameEntry CTL_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> CTL_TABLE[] PROGMEM = {
         NAME_ENTRY(REG_FLAGS),
         NAME_ENTRY(REG_FCW),
         NAME_ENTRY(REG_REFRESH),
@@ -203,9 +203,7 @@ int8_t encodeCtlReg(bool segmentedModel, RegName name) {
     return isSegCtlReg(name) ? -1 : num;
 }
 
-static constexpr char TEXT_INTR_VI[] PROGMEM = "VI";
-static constexpr char TEXT_INTR_NVI[] PROGMEM = "NVI";
-static constexpr NameEntry INTR_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> INTR_TABLE[] PROGMEM = {
         NAME_ENTRY(INTR_NVI),
         NAME_ENTRY(INTR_VI),
 };
@@ -233,7 +231,7 @@ uint8_t encodeIntrName(IntrName name) {
     return uint8_t(name);
 }
 
-static constexpr NameEntry CC_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> CC_TABLE[] PROGMEM = {
         NAME_ENTRY(CC_F),
         NAME_ENTRY(CC_LT),
         NAME_ENTRY(CC_LE),
@@ -279,7 +277,7 @@ StrBuffer &outCcName(StrBuffer &out, CcName name) {
     return out;
 }
 
-static constexpr NameEntry FLAG_TABLE[] PROGMEM = {
+static constexpr NameEntry<TEXT_POOL> FLAG_TABLE[] PROGMEM = {
         NAME_ENTRY(FLAG_C),
         NAME_ENTRY(FLAG_Z),
         NAME_ENTRY(FLAG_S),
@@ -146,7 +146,7 @@ public:
     /** return true if this starts with |text_P| with ignore case. */
     bool istarts_P(const /*PROGMEM*/ char *text_P, size_t len = 0) const;
 
-    static StrScanner EMPTY;
+    static const StrScanner EMPTY;
 
 private:
     /** |str| must not be greater than |_end|. */
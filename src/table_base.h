@@ -19,6 +19,7 @@
 
 #include "config_host.h"
 #include "error_reporter.h"
+#include "table_stats.h"
 
 namespace libasm {
 namespace table {
@@ -47,6 +48,7 @@ struct Table {
     template <typename DATA, typename EXTRA>
     const ITEM *linearSearch(DATA &data, Matcher<DATA, EXTRA> matcher, EXTRA extra) const {
         for (const auto *item = table(); item < end(); item++) {
+            LIBASM_STATS_PROBE();
             if (matcher(data, item, extra))
                 return item;
         }
@@ -66,6 +68,7 @@ struct Table {
                 return nullptr;
             const auto *middle = first;
             middle += diff / 2;
+            LIBASM_STATS_PROBE();
             const auto res = comparator(data, middle);
             if (res == 0) {
                 return middle;
@@ -105,6 +108,7 @@ struct IndexedTable {
     using Matcher2 = bool (*)(DATA &, const ITEM *);
 
     bool notExactMatch(const ITEM *item) const { return item == _items.end(); }
+    const ITEM *table() const { return _items.table(); }
 
     template <typename DATA>
     const ITEM *binarySearch(
@@ -117,6 +121,7 @@ struct IndexedTable {
                 break;
             const auto *middle = first;
             middle += diff / 2;
+            LIBASM_STATS_PROBE();
             if (comparator(data, itemAt(middle)) > 0) {
                 first = middle + 1;
             } else {
@@ -127,6 +132,7 @@ struct IndexedTable {
         const ITEM *found = nullptr;
         while (first < _indexes.end()) {
             const auto *item = itemAt(first);
+            LIBASM_STATS_PROBE();
             if (comparator(data, item))
                 return found;
             found = _items.end();
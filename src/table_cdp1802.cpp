@@ -320,9 +320,9 @@ static constexpr EntryPage CDP1804A_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {CDP1802, TEXT_CPU_1802, ARRAY_RANGE(CDP1802_PAGES)},
-        {CDP1804, TEXT_CPU_1804, ARRAY_RANGE(CDP1804_PAGES)},
-        {CDP1804A, TEXT_CPU_1804A, ARRAY_RANGE(CDP1804A_PAGES)},
+        {CDP1802, TEXT_CPU_1802, CPU_RANGE(CDP1802, CDP1802_PAGES)},
+        {CDP1804, TEXT_CPU_1804, CPU_RANGE(CDP1804, CDP1804_PAGES)},
+        {CDP1804A, TEXT_CPU_1804A, CPU_RANGE(CDP1804A, CDP1804A_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
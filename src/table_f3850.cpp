@@ -263,7 +263,7 @@ const /*PROGMEM*/ char *TableF3850::cpuName_P(CpuType cpuType) const {
 }
 
 Error TableF3850::searchCpuName(StrScanner &name, CpuType &cpuType) const {
-    if (name.iequals(TEXT_CPU_3850) || name.iequals(TEXT_CPU_F3850)) {
+    if (name.iequals_P(TEXT_CPU_3850) || name.iequals_P(TEXT_CPU_F3850)) {
         cpuType = F3850;
         return OK;
     }
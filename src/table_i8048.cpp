@@ -300,12 +300,12 @@ static constexpr EntryPage MSM80C48_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {I8039, TEXT_CPU_8039, ARRAY_RANGE(I8039_PAGES)},
-        {I8048, TEXT_CPU_8048, ARRAY_RANGE(I8048_PAGES)},
-        {I80C39, TEXT_CPU_80C39, ARRAY_RANGE(I80C39_PAGES)},
-        {I80C48, TEXT_CPU_80C48, ARRAY_RANGE(I80C48_PAGES)},
-        {MSM80C39, TEXT_CPU_MSM80C39, ARRAY_RANGE(MSM80C39_PAGES)},
-        {MSM80C48, TEXT_CPU_MSM80C48, ARRAY_RANGE(MSM80C48_PAGES)},
+        {I8039, TEXT_CPU_8039, CPU_RANGE(I8039, I8039_PAGES)},
+        {I8048, TEXT_CPU_8048, CPU_RANGE(I8048, I8048_PAGES)},
+        {I80C39, TEXT_CPU_80C39, CPU_RANGE(I80C39, I80C39_PAGES)},
+        {I80C48, TEXT_CPU_80C48, CPU_RANGE(I80C48, I80C48_PAGES)},
+        {MSM80C39, TEXT_CPU_MSM80C39, CPU_RANGE(MSM80C39, MSM80C39_PAGES)},
+        {MSM80C48, TEXT_CPU_MSM80C48, CPU_RANGE(MSM80C48, MSM80C48_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
@@ -234,9 +234,9 @@ static constexpr EntryPage V30EMU_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {I8080, TEXT_CPU_8080, ARRAY_RANGE(I8080_PAGES)},
-        {I8085, TEXT_CPU_8085, ARRAY_RANGE(I8085_PAGES)},
-        {V30EMU, TEXT_CPU_V30EMU, ARRAY_RANGE(V30EMU_PAGES)},
+        {I8080, TEXT_CPU_8080, CPU_RANGE(I8080, I8080_PAGES)},
+        {I8085, TEXT_CPU_8085, CPU_RANGE(I8085, I8085_PAGES)},
+        {V30EMU, TEXT_CPU_V30EMU, CPU_RANGE(V30EMU, V30EMU_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
@@ -308,9 +308,9 @@ Error TableI8080::searchCpuName(StrScanner &name, CpuType &cpuType) const {
         cpuType = t->cpuType();
     } else {
         name.iexpect('i');
-        if (name.iequals(TEXT_CPU_8080)) {
+        if (name.iequals_P(TEXT_CPU_8080)) {
             cpuType = I8080;
-        } else if (name.iequals(TEXT_CPU_8085)) {
+        } else if (name.iequals_P(TEXT_CPU_8085)) {
             cpuType = I8085;
         } else {
             return UNSUPPORTED_CPU;
@@ -971,9 +971,9 @@ static constexpr EntryPage V30_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {I8086, TEXT_CPU_8086, ARRAY_RANGE(I8086_PAGES)},
-        {I80186, TEXT_CPU_80186, ARRAY_RANGE(I80186_PAGES)},
-        {V30, TEXT_CPU_V30, ARRAY_RANGE(V30_PAGES)},
+        {I8086, TEXT_CPU_8086, CPU_RANGE(I8086, I8086_PAGES)},
+        {I80186, TEXT_CPU_80186, CPU_RANGE(I80186, I80186_PAGES)},
+        {V30, TEXT_CPU_V30, CPU_RANGE(V30, V30_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
@@ -1116,9 +1116,9 @@ Error TableI8086::searchCpuName(StrScanner &name, CpuType &cpuType) const {
         cpuType = t->cpuType();
     } else {
         name.iexpect('i');
-        if (name.iequals(TEXT_CPU_8086)) {
+        if (name.iequals_P(TEXT_CPU_8086)) {
             cpuType = I8086;
-        } else if (name.iequals(TEXT_CPU_80186)) {
+        } else if (name.iequals_P(TEXT_CPU_80186)) {
             cpuType = I80186;
         } else {
             return UNSUPPORTED_CPU;
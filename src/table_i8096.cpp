@@ -337,7 +337,7 @@ const /*PROGMEM*/ char *TableI8096::cpuName_P(CpuType cpuType) const {
 
 Error TableI8096::searchCpuName(StrScanner &name, CpuType &cpuType) const {
     name.iexpect('i');
-    if (name.iequals(TEXT_CPU_8096)) {
+    if (name.iequals_P(TEXT_CPU_8096)) {
         cpuType = I8096;
         return OK;
     }
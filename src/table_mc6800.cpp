@@ -597,11 +597,11 @@ static constexpr EntryPage MC68HC11_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {MC6800, TEXT_CPU_6800, ARRAY_RANGE(MC6800_PAGES)},
-        {MB8861, TEXT_CPU_MB8861, ARRAY_RANGE(MB8861_PAGES)},
-        {MC6801, TEXT_CPU_6801, ARRAY_RANGE(MC6801_PAGES)},
-        {HD6301, TEXT_CPU_6301, ARRAY_RANGE(HD6301_PAGES)},
-        {MC68HC11, TEXT_CPU_6811, ARRAY_RANGE(MC68HC11_PAGES)},
+        {MC6800, TEXT_CPU_6800, CPU_RANGE(MC6800, MC6800_PAGES)},
+        {MB8861, TEXT_CPU_MB8861, CPU_RANGE(MB8861, MB8861_PAGES)},
+        {MC6801, TEXT_CPU_6801, CPU_RANGE(MC6801, MC6801_PAGES)},
+        {HD6301, TEXT_CPU_6301, CPU_RANGE(HD6301, HD6301_PAGES)},
+        {MC68HC11, TEXT_CPU_6811, CPU_RANGE(MC68HC11, MC68HC11_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
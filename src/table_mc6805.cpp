@@ -259,9 +259,9 @@ static constexpr EntryPage MC68HC05_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {MC6805, TEXT_CPU_6805, ARRAY_RANGE(MC6805_PAGES)},
-        {MC146805, TEXT_CPU_146805, ARRAY_RANGE(MC146805_PAGES)},
-        {MC68HC05, TEXT_CPU_68HC05, ARRAY_RANGE(MC68HC05_PAGES)},
+        {MC6805, TEXT_CPU_6805, CPU_RANGE(MC6805, MC6805_PAGES)},
+        {MC146805, TEXT_CPU_146805, CPU_RANGE(MC146805, MC146805_PAGES)},
+        {MC68HC05, TEXT_CPU_68HC05, CPU_RANGE(MC68HC05, MC68HC05_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
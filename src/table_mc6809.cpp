@@ -640,8 +640,8 @@ private:
 };
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {MC6809, TEXT_CPU_6809, ARRAY_RANGE(MC6809_PAGES), ARRAY_RANGE(MC6809_POSTS)},
-        {HD6309, TEXT_CPU_6309, ARRAY_RANGE(HD6309_PAGES), ARRAY_RANGE(HD6309_POSTS)},
+        {MC6809, TEXT_CPU_6809, CPU_RANGE(MC6809, MC6809_PAGES), CPU_RANGE(MC6809, MC6809_POSTS)},
+        {HD6309, TEXT_CPU_6309, CPU_RANGE(HD6309, HD6309_PAGES), CPU_RANGE(HD6309, HD6309_POSTS)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
@@ -284,9 +284,9 @@ static constexpr EntryPage MN1613_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {MN1610, TEXT_CPU_MN1610, ARRAY_RANGE(MN1610_PAGES)},
-        {MN1613, TEXT_CPU_MN1613, ARRAY_RANGE(MN1613_PAGES)},
-        {MN1613A, TEXT_CPU_MN1613A, ARRAY_RANGE(MN1613_PAGES)},
+        {MN1610, TEXT_CPU_MN1610, CPU_RANGE(MN1610, MN1610_PAGES)},
+        {MN1613, TEXT_CPU_MN1613, CPU_RANGE(MN1613, MN1613_PAGES)},
+        {MN1613A, TEXT_CPU_MN1613A, CPU_RANGE(MN1613A, MN1613_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
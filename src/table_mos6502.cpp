@@ -703,11 +703,11 @@ static constexpr EntryPage W65C816_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {MOS6502, TEXT_CPU_6502, ARRAY_RANGE(MOS6502_PAGES)},
-        {G65SC02, TEXT_CPU_65SC02, ARRAY_RANGE(G65SC02_PAGES)},
-        {R65C02, TEXT_CPU_65C02, ARRAY_RANGE(R65C02_PAGES)},
-        {W65C02S, TEXT_CPU_W65C02S, ARRAY_RANGE(W65C02S_PAGES)},
-        {W65C816, TEXT_CPU_65816, ARRAY_RANGE(W65C816_PAGES)},
+        {MOS6502, TEXT_CPU_6502, CPU_RANGE(MOS6502, MOS6502_PAGES)},
+        {G65SC02, TEXT_CPU_65SC02, CPU_RANGE(G65SC02, G65SC02_PAGES)},
+        {R65C02, TEXT_CPU_65C02, CPU_RANGE(R65C02, R65C02_PAGES)},
+        {W65C02S, TEXT_CPU_W65C02S, CPU_RANGE(W65C02S, W65C02S_PAGES)},
+        {W65C816, TEXT_CPU_65816, CPU_RANGE(W65C816, W65C816_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
@@ -771,17 +771,17 @@ Error TableMos6502::searchCpuName(StrScanner &name, CpuType &cpuType) const {
     const auto t = Cpu::search(name, ARRAY_RANGE(CPU_TABLE));
     if (t) {
         cpuType = t->cpuType();
-    } else if (name.iequals(TEXT_CPU_MOS6502)) {
+    } else if (name.iequals_P(TEXT_CPU_MOS6502)) {
         cpuType = MOS6502;
-    } else if (name.iequals(TEXT_CPU_R65C02)) {
+    } else if (name.iequals_P(TEXT_CPU_R65C02)) {
         cpuType = R65C02;
-    } else if (name.iequals(TEXT_CPU_G65SC02)) {
+    } else if (name.iequals_P(TEXT_CPU_G65SC02)) {
         cpuType = G65SC02;
     } else if (name.iexpect('W')) {
-        if (name.iequals(TEXT_CPU_65C02)) {
+        if (name.iequals_P(TEXT_CPU_65C02)) {
             cpuType = W65C02S;
-        } else if (name.iequals(TEXT_CPU_65816) || name.iequals(TEXT_CPU_65C816) ||
-                   name.iequals(TEXT_CPU_65C816S)) {
+        } else if (name.iequals_P(TEXT_CPU_65816) || name.iequals_P(TEXT_CPU_65C816) ||
+                   name.iequals_P(TEXT_CPU_65C816S)) {
             cpuType = W65C816;
         } else {
             return UNSUPPORTED_CPU;
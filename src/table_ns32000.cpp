@@ -1001,7 +1001,7 @@ const /*PROGMEM*/ char *TableNs32000::cpuName_P(CpuType cpuType) const {
 }
 
 Error TableNs32000::searchCpuName(StrScanner &name, CpuType &cpuType) const {
-    if (name.iequals(TEXT_CPU_NS32032) || name.iequals(TEXT_CPU_32032)) {
+    if (name.iequals_P(TEXT_CPU_NS32032) || name.iequals_P(TEXT_CPU_32032)) {
         cpuType = NS32032;
         return OK;
     }
@@ -281,7 +281,7 @@ const /*PROGMEM*/ char *TableScn2650::cpuName_P(CpuType cpuType) const {
 }
 
 Error TableScn2650::searchCpuName(StrScanner &name, CpuType &cpuType) const {
-    if (name.iequals(TEXT_CPU_2650) || name.iequals(TEXT_CPU_SCN2650)) {
+    if (name.iequals_P(TEXT_CPU_2650) || name.iequals_P(TEXT_CPU_SCN2650)) {
         cpuType = SCN2650;
         return OK;
     }
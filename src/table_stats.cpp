@@ -0,0 +1,75 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "table_stats.h"
+
+#if defined(LIBASM_STATS)
+
+namespace libasm {
+namespace stats {
+
+thread_local uint32_t tableProbes;
+
+static thread_local std::map<TableKey, TableProfile> PROFILES;
+
+bool TableKey::operator<(const TableKey &other) const {
+    if (cpu != other.cpu)
+        return cpu < other.cpu;
+    if (search != other.search)
+        return search < other.search;
+    return page < other.page;
+}
+
+void recordLookup(const /*PROGMEM*/ char *cpu_P, Search search, uint8_t page, int position) {
+    auto &profile = PROFILES[TableKey{cpu_P, search, page}];
+    profile.lookups++;
+    if (profile.probes.size() <= tableProbes)
+        profile.probes.resize(tableProbes + 1);
+    profile.probes[tableProbes]++;
+    if (position < 0) {
+        profile.misses++;
+    } else {
+        if (profile.hits.size() <= size_t(position))
+            profile.hits.resize(position + 1);
+        profile.hits[position]++;
+    }
+    tableProbes = 0;
+}
+
+const std::map<TableKey, TableProfile> &tableProfiles() {
+    return PROFILES;
+}
+
+void resetTables() {
+    PROFILES.clear();
+    tableProbes = 0;
+}
+
+const char *name(Search search) {
+    return search == BY_NAME ? "name" : "opcode";
+}
+
+}  // namespace stats
+}  // namespace libasm
+
+#endif  // LIBASM_STATS
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
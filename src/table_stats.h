@@ -0,0 +1,98 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TABLE_STATS_H__
+#define __TABLE_STATS_H__
+
+/**
+ * Profile of instruction table lookups; how many entries each lookup
+ * probes and which entry of which page hits.
+ *
+ * Like phase_stats.h, it is compiled in only when LIBASM_STATS is
+ * defined; otherwise the macros expand to nothing.
+ */
+#if defined(LIBASM_STATS)
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libasm {
+namespace stats {
+
+enum Search : uint8_t {
+    BY_NAME = 0,  // CpuBase::searchName, binary search
+    BY_CODE = 1,  // CpuBase::searchOpCode, linear search
+};
+
+struct TableKey {
+    std::string cpu;
+    Search search;
+    uint8_t page;
+
+    bool operator<(const TableKey &other) const;
+};
+
+struct TableProfile {
+    uint64_t lookups;
+    uint64_t misses;
+    std::vector<uint64_t> probes;  // histogram of probes per lookup
+    std::vector<uint64_t> hits;    // hits per entry position of a page
+};
+
+/** probes since the start of the current lookup of the calling thread */
+extern thread_local uint32_t tableProbes;
+
+/** record a lookup of |page| which hit an entry at |position|, or missed if negative */
+void recordLookup(const /*PROGMEM*/ char *cpu_P, Search search, uint8_t page, int position);
+/** profiles of the calling thread */
+const std::map<TableKey, TableProfile> &tableProfiles();
+/** clear profiles of the calling thread */
+void resetTables();
+const char *name(Search search);
+
+}  // namespace stats
+}  // namespace libasm
+
+#define LIBASM_STATS_PROBE() (++::libasm::stats::tableProbes)
+#define LIBASM_STATS_LOOKUP_START() (::libasm::stats::tableProbes = 0)
+#define LIBASM_STATS_LOOKUP(cpu_P, search, page, position) \
+    ::libasm::stats::recordLookup(cpu_P, ::libasm::stats::search, page, position)
+
+#else
+
+#define LIBASM_STATS_PROBE() \
+    do {                     \
+    } while (0)
+#define LIBASM_STATS_LOOKUP_START() \
+    do {                            \
+    } while (0)
+#define LIBASM_STATS_LOOKUP(cpu_P, search, page, position) \
+    do {                                                   \
+    } while (0)
+
+#endif  // LIBASM_STATS
+
+#endif  // __TABLE_STATS_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -654,7 +654,7 @@ const /*PROGMEM*/ char *TableTlcs90::cpuName_P(CpuType cpuType) const {
 }
 
 Error TableTlcs90::searchCpuName(StrScanner &name, CpuType &cpuType) const {
-    if (name.iequals(TEXT_CPU_TLCS90)) {
+    if (name.iequals_P(TEXT_CPU_TLCS90)) {
         cpuType = TLCS90;
         return OK;
     }
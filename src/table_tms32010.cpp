@@ -168,8 +168,8 @@ static constexpr EntryPage TMS32010_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {TMS32010, TEXT_CPU_32010, ARRAY_RANGE(TMS32010_PAGES)},
-        {TMS32015, TEXT_CPU_32015, ARRAY_RANGE(TMS32010_PAGES)},
+        {TMS32010, TEXT_CPU_32010, CPU_RANGE(TMS32010, TMS32010_PAGES)},
+        {TMS32015, TEXT_CPU_32015, CPU_RANGE(TMS32015, TMS32010_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
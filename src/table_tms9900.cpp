@@ -238,9 +238,9 @@ static constexpr EntryPage TMS99105_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {TMS9900, TEXT_CPU_9900, ARRAY_RANGE(TMS9900_PAGES)},
-        {TMS9995, TEXT_CPU_9995, ARRAY_RANGE(TMS9995_PAGES)},
-        {TMS99105, TEXT_CPU_99105, ARRAY_RANGE(TMS99105_PAGES)},
+        {TMS9900, TEXT_CPU_9900, CPU_RANGE(TMS9900, TMS9900_PAGES)},
+        {TMS9995, TEXT_CPU_9995, CPU_RANGE(TMS9995, TMS9995_PAGES)},
+        {TMS99105, TEXT_CPU_99105, CPU_RANGE(TMS99105, TMS99105_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
@@ -488,9 +488,9 @@ static constexpr EntryPage SUPER8_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {Z8, TEXT_CPU_Z8, ARRAY_RANGE(Z8_PAGES)},
-        {Z86C, TEXT_CPU_Z86C, ARRAY_RANGE(Z86C_PAGES)},
-        {SUPER8, TEXT_CPU_Z88, ARRAY_RANGE(SUPER8_PAGES)},
+        {Z8, TEXT_CPU_Z8, CPU_RANGE(Z8, Z8_PAGES)},
+        {Z86C, TEXT_CPU_Z86C, CPU_RANGE(Z86C, Z86C_PAGES)},
+        {SUPER8, TEXT_CPU_Z88, CPU_RANGE(SUPER8, SUPER8_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
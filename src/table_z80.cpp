@@ -430,10 +430,10 @@ static constexpr EntryPage V30EMU_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {Z80, TEXT_CPU_Z80, ARRAY_RANGE(Z80_PAGES)},
-        {I8080, TEXT_CPU_8080, ARRAY_RANGE(I8080_PAGES)},
-        {I8085, TEXT_CPU_8085, ARRAY_RANGE(I8085_PAGES)},
-        {V30EMU, TEXT_CPU_V30EMU, ARRAY_RANGE(V30EMU_PAGES)},
+        {Z80, TEXT_CPU_Z80, CPU_RANGE(Z80, Z80_PAGES)},
+        {I8080, TEXT_CPU_8080, CPU_RANGE(I8080, I8080_PAGES)},
+        {I8085, TEXT_CPU_8085, CPU_RANGE(I8085, I8085_PAGES)},
+        {V30EMU, TEXT_CPU_V30EMU, CPU_RANGE(V30EMU, V30EMU_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
@@ -584,8 +584,8 @@ static constexpr EntryPage Z8000_PAGES[] PROGMEM = {
 using Cpu = entry::CpuBase<CpuType, EntryPage>;
 
 static constexpr Cpu CPU_TABLE[] PROGMEM = {
-        {Z8001, TEXT_CPU_Z8001, ARRAY_RANGE(Z8000_PAGES)},
-        {Z8002, TEXT_CPU_Z8002, ARRAY_RANGE(Z8000_PAGES)},
+        {Z8001, TEXT_CPU_Z8001, CPU_RANGE(Z8001, Z8000_PAGES)},
+        {Z8002, TEXT_CPU_Z8002, CPU_RANGE(Z8002, Z8000_PAGES)},
 };
 
 static const Cpu *cpu(CpuType cpuType) {
@@ -664,7 +664,7 @@ const /*PROGMEM*/ char *TableZ8000::cpuName_P(CpuType cpuType) const {
 }
 
 Error TableZ8000::searchCpuName(StrScanner &name, CpuType &cpuType) const {
-    if (name.iequals(TEXT_CPU_Z8001)) {
+    if (name.iequals_P(TEXT_CPU_Z8001)) {
         cpuType = Z8001;
     } else if (name.iequals_P(TEXT_CPU_Z8002)) {
         cpuType = Z8002;
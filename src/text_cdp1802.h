@@ -18,149 +18,148 @@
 #define __TEXT_CDP1802__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace cdp1802 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]  PROGMEM;
-extern const char TEXT_CPU_1802[]  PROGMEM;
-extern const char TEXT_CPU_1804[]  PROGMEM;
-extern const char TEXT_CPU_1804A[] PROGMEM;
+#define TEXT_CDP1802_LIST(T, A)                     \
+    T(TEXT_CPU_LIST,  "CDP1802, CDP1804, CDP1804A") \
+    T(TEXT_CPU_1802,  "1802")                       \
+    T(TEXT_CPU_1804,  "1804")                       \
+    T(TEXT_CPU_1804A, "1804A")                      \
+    T(TEXT_null,      "")                           \
+    /* CDP1802 */                                   \
+    T(TEXT_ADC,       "ADC")                        \
+    T(TEXT_ADCI,      "ADCI")                       \
+    T(TEXT_ADD,       "ADD")                        \
+    T(TEXT_ADI,       "ADI")                        \
+    T(TEXT_AND,       "AND")                        \
+    T(TEXT_ANI,       "ANI")                        \
+    T(TEXT_B1,        "B1")                         \
+    T(TEXT_B2,        "B2")                         \
+    T(TEXT_B3,        "B3")                         \
+    T(TEXT_B4,        "B4")                         \
+    T(TEXT_BDF,       "BDF")                        \
+    T(TEXT_BGE,       "BGE")                        \
+    T(TEXT_BL,        "BL")                         \
+    T(TEXT_BM,        "BM")                         \
+    T(TEXT_BN1,       "BN1")                        \
+    T(TEXT_BN2,       "BN2")                        \
+    T(TEXT_BN3,       "BN3")                        \
+    T(TEXT_BN4,       "BN4")                        \
+    T(TEXT_BNF,       "BNF")                        \
+    T(TEXT_BNQ,       "BNQ")                        \
+    T(TEXT_BNZ,       "BNZ")                        \
+    T(TEXT_BPZ,       "BPZ")                        \
+    T(TEXT_BQ,        "BQ")                         \
+    T(TEXT_BR,        "BR")                         \
+    T(TEXT_BZ,        "BZ")                         \
+    T(TEXT_DEC,       "DEC")                        \
+    T(TEXT_DIS,       "DIS")                        \
+    T(TEXT_GHI,       "GHI")                        \
+    T(TEXT_GLO,       "GLO")                        \
+    T(TEXT_IDL,       "IDL")                        \
+    T(TEXT_INC,       "INC")                        \
+    T(TEXT_INP,       "INP")                        \
+    T(TEXT_IRX,       "IRX")                        \
+    T(TEXT_LBDF,      "LBDF")                       \
+    T(TEXT_LBPZ,      "LBPZ")                       \
+    T(TEXT_LBGE,      "LBGE")                       \
+    T(TEXT_LBNF,      "LBNF")                       \
+    T(TEXT_LBM,       "LBM")                        \
+    T(TEXT_LBL,       "LBL")                        \
+    T(TEXT_LBNQ,      "LBNQ")                       \
+    T(TEXT_LBNZ,      "LBNZ")                       \
+    T(TEXT_LBQ,       "LBQ")                        \
+    T(TEXT_LBR,       "LBR")                        \
+    T(TEXT_LBZ,       "LBZ")                        \
+    T(TEXT_LDA,       "LDA")                        \
+    T(TEXT_LDI,       "LDI")                        \
+    T(TEXT_LDN,       "LDN")                        \
+    T(TEXT_LDX,       "LDX")                        \
+    T(TEXT_LDXA,      "LDXA")                       \
+    T(TEXT_LSDF,      "LSDF")                       \
+    T(TEXT_LSIE,      "LSIE")                       \
+    T(TEXT_LSKP,      "LSKP")                       \
+    T(TEXT_LSNF,      "LSNF")                       \
+    T(TEXT_LSNQ,      "LSNQ")                       \
+    T(TEXT_LSNZ,      "LSNZ")                       \
+    T(TEXT_LSQ,       "LSQ")                        \
+    T(TEXT_LSZ,       "LSZ")                        \
+    T(TEXT_MARK,      "MARK")                       \
+    T(TEXT_NBR,       "NBR")                        \
+    T(TEXT_NLBR,      "NLBR")                       \
+    T(TEXT_NOP,       "NOP")                        \
+    T(TEXT_OR,        "OR")                         \
+    T(TEXT_ORI,       "ORI")                        \
+    T(TEXT_OUT,       "OUT")                        \
+    T(TEXT_PHI,       "PHI")                        \
+    T(TEXT_PLO,       "PLO")                        \
+    T(TEXT_REQ,       "REQ")                        \
+    T(TEXT_RET,       "RET")                        \
+    T(TEXT_RSHL,      "RSHL")                       \
+    T(TEXT_RSHR,      "RSHR")                       \
+    T(TEXT_SAV,       "SAV")                        \
+    T(TEXT_SD,        "SD")                         \
+    T(TEXT_SDB,       "SDB")                        \
+    T(TEXT_SDBI,      "SDBI")                       \
+    T(TEXT_SDI,       "SDI")                        \
+    T(TEXT_SEP,       "SEP")                        \
+    T(TEXT_SEQ,       "SEQ")                        \
+    T(TEXT_SEX,       "SEX")                        \
+    T(TEXT_SHL,       "SHL")                        \
+    T(TEXT_SHLC,      "SHLC")                       \
+    T(TEXT_SHR,       "SHR")                        \
+    T(TEXT_SHRC,      "SHRC")                       \
+    T(TEXT_SKP,       "SKP")                        \
+    T(TEXT_SM,        "SM")                         \
+    T(TEXT_SMB,       "SMB")                        \
+    T(TEXT_SMBI,      "SMBI")                       \
+    T(TEXT_SMI,       "SMI")                        \
+    T(TEXT_STR,       "STR")                        \
+    T(TEXT_STXD,      "STXD")                       \
+    T(TEXT_XOR,       "XOR")                        \
+    T(TEXT_XRI,       "XRI")                        \
+    /* CDP1804 */                                   \
+    T(TEXT_BCI,       "BCI")                        \
+    T(TEXT_BXI,       "BXI")                        \
+    T(TEXT_CID,       "CID")                        \
+    T(TEXT_CIE,       "CIE")                        \
+    T(TEXT_DTC,       "DTC")                        \
+    T(TEXT_ETQ,       "ETQ")                        \
+    T(TEXT_GEC,       "GEC")                        \
+    T(TEXT_LDC,       "LDC")                        \
+    T(TEXT_RLDI,      "RLDI")                       \
+    T(TEXT_RLXA,      "RLXA")                       \
+    T(TEXT_RNX,       "RNX")                        \
+    T(TEXT_RSXD,      "RSXD")                       \
+    T(TEXT_SCAL,      "SCAL")                       \
+    T(TEXT_SCM1,      "SCM1")                       \
+    T(TEXT_SCM2,      "SCM2")                       \
+    T(TEXT_SPM1,      "SPM1")                       \
+    T(TEXT_SPM2,      "SPM2")                       \
+    T(TEXT_SRET,      "SRET")                       \
+    T(TEXT_STM,       "STM")                        \
+    T(TEXT_STPC,      "STPC")                       \
+    T(TEXT_XID,       "XID")                        \
+    T(TEXT_XIE,       "XIE")                        \
+    /* CDP1804A */                                  \
+    T(TEXT_DACI,      "DACI")                       \
+    T(TEXT_DADC,      "DADC")                       \
+    T(TEXT_DADD,      "DADD")                       \
+    T(TEXT_DADI,      "DADI")                       \
+    T(TEXT_DBNZ,      "DBNZ")                       \
+    T(TEXT_DSAV,      "DSAV")                       \
+    T(TEXT_DSBI,      "DSBI")                       \
+    T(TEXT_DSM,       "DSM")                        \
+    T(TEXT_DSMB,      "DSMB")                       \
+    T(TEXT_DSMI,      "DSMI")
+// clang-format on
 
-using common::TEXT_null;
-
-// CDP1802
-using common::TEXT_ADC;
-extern const char TEXT_ADCI[] PROGMEM;
-using common::TEXT_ADD;
-using common::TEXT_ADI;
-using common::TEXT_AND;
-using common::TEXT_ANI;
-extern const char TEXT_B1[]   PROGMEM;
-extern const char TEXT_B2[]   PROGMEM;
-extern const char TEXT_B3[]   PROGMEM;
-extern const char TEXT_B4[]   PROGMEM;
-extern const char TEXT_BDF[]  PROGMEM;
-using common::TEXT_BGE;
-using common::TEXT_BL;
-using common::TEXT_BM;
-extern const char TEXT_BN1[]  PROGMEM;
-extern const char TEXT_BN2[]  PROGMEM;
-extern const char TEXT_BN3[]  PROGMEM;
-extern const char TEXT_BN4[]  PROGMEM;
-extern const char TEXT_BNF[]  PROGMEM;
-extern const char TEXT_BNQ[]  PROGMEM;
-using common::TEXT_BNZ;
-extern const char TEXT_BPZ[]  PROGMEM;
-extern const char TEXT_BQ[]   PROGMEM;
-using common::TEXT_BR;
-using common::TEXT_BZ;
-using common::TEXT_DEC;
-using common::TEXT_DIS;
-extern const char TEXT_GHI[]  PROGMEM;
-extern const char TEXT_GLO[]  PROGMEM;
-using common::TEXT_IDL;
-using common::TEXT_INC;
-extern const char TEXT_INP[]  PROGMEM;
-extern const char TEXT_IRX[]  PROGMEM;
-extern const char TEXT_LBDF[] PROGMEM;
-extern const char TEXT_LBPZ[] PROGMEM;
-using common::TEXT_LBGE;
-extern const char TEXT_LBNF[] PROGMEM;
-extern const char TEXT_LBM[]  PROGMEM;
-extern const char TEXT_LBL[]  PROGMEM;
-extern const char TEXT_LBNQ[] PROGMEM;
-extern const char TEXT_LBNZ[] PROGMEM;
-extern const char TEXT_LBQ[]  PROGMEM;
-extern const char TEXT_LBR[]  PROGMEM;
-extern const char TEXT_LBZ[]  PROGMEM;
-using common::TEXT_LDA;
-using common::TEXT_LDI;
-extern const char TEXT_LDN[]  PROGMEM;
-using common::TEXT_LDX;
-extern const char TEXT_LDXA[] PROGMEM;
-extern const char TEXT_LSDF[] PROGMEM;
-extern const char TEXT_LSIE[] PROGMEM;
-extern const char TEXT_LSKP[] PROGMEM;
-extern const char TEXT_LSNF[] PROGMEM;
-extern const char TEXT_LSNQ[] PROGMEM;
-extern const char TEXT_LSNZ[] PROGMEM;
-extern const char TEXT_LSQ[]  PROGMEM;
-extern const char TEXT_LSZ[]  PROGMEM;
-extern const char TEXT_MARK[] PROGMEM;
-extern const char TEXT_NBR[]  PROGMEM;
-extern const char TEXT_NLBR[] PROGMEM;
-extern const char TEXT_NOP[]  PROGMEM;
-extern const char TEXT_OR[]   PROGMEM;
-extern const char TEXT_ORI[]  PROGMEM;
-extern const char TEXT_OUT[]  PROGMEM;
-extern const char TEXT_PHI[]  PROGMEM;
-extern const char TEXT_PLO[]  PROGMEM;
-extern const char TEXT_REQ[]  PROGMEM;
-extern const char TEXT_RET[]  PROGMEM;
-extern const char TEXT_RSHL[] PROGMEM;
-extern const char TEXT_RSHR[] PROGMEM;
-extern const char TEXT_SAV[]  PROGMEM;
-extern const char TEXT_SD[]   PROGMEM;
-extern const char TEXT_SDB[]  PROGMEM;
-extern const char TEXT_SDBI[] PROGMEM;
-extern const char TEXT_SDI[]  PROGMEM;
-extern const char TEXT_SEP[]  PROGMEM;
-extern const char TEXT_SEQ[]  PROGMEM;
-extern const char TEXT_SEX[]  PROGMEM;
-extern const char TEXT_SHL[]  PROGMEM;
-extern const char TEXT_SHLC[] PROGMEM;
-extern const char TEXT_SHR[]  PROGMEM;
-extern const char TEXT_SHRC[] PROGMEM;
-extern const char TEXT_SKP[]  PROGMEM;
-extern const char TEXT_SM[]   PROGMEM;
-extern const char TEXT_SMB[]  PROGMEM;
-extern const char TEXT_SMBI[] PROGMEM;
-extern const char TEXT_SMI[]  PROGMEM;
-extern const char TEXT_STR[]  PROGMEM;
-extern const char TEXT_STXD[] PROGMEM;
-extern const char TEXT_XOR[]  PROGMEM;
-extern const char TEXT_XRI[]  PROGMEM;
-
-// CDP1804
-extern const char TEXT_BCI[]  PROGMEM;
-extern const char TEXT_BXI[]  PROGMEM;
-extern const char TEXT_CID[]  PROGMEM;
-extern const char TEXT_CIE[]  PROGMEM;
-extern const char TEXT_DTC[]  PROGMEM;
-extern const char TEXT_ETQ[]  PROGMEM;
-extern const char TEXT_GEC[]  PROGMEM;
-extern const char TEXT_LDC[]  PROGMEM;
-extern const char TEXT_RLDI[] PROGMEM;
-extern const char TEXT_RLXA[] PROGMEM;
-extern const char TEXT_RNX[]  PROGMEM;
-extern const char TEXT_RSXD[] PROGMEM;
-extern const char TEXT_SCAL[] PROGMEM;
-extern const char TEXT_SCM1[] PROGMEM;
-extern const char TEXT_SCM2[] PROGMEM;
-extern const char TEXT_SPM1[] PROGMEM;
-extern const char TEXT_SPM2[] PROGMEM;
-extern const char TEXT_SRET[] PROGMEM;
-extern const char TEXT_STM[]  PROGMEM;
-extern const char TEXT_STPC[] PROGMEM;
-extern const char TEXT_XID[]  PROGMEM;
-extern const char TEXT_XIE[]  PROGMEM;
-
-// CDP1804A
-extern const char TEXT_DACI[] PROGMEM;
-extern const char TEXT_DADC[] PROGMEM;
-extern const char TEXT_DADD[] PROGMEM;
-extern const char TEXT_DADI[] PROGMEM;
-extern const char TEXT_DBNZ[] PROGMEM;
-extern const char TEXT_DSAV[] PROGMEM;
-extern const char TEXT_DSBI[] PROGMEM;
-extern const char TEXT_DSM[]  PROGMEM;
-extern const char TEXT_DSMB[] PROGMEM;
-extern const char TEXT_DSMI[] PROGMEM;
-
-// clang-format om
+DECLARE_TEXT_POOL(TEXT_CDP1802_LIST);
 
 } // namespace cdp1802
 } // namespace text
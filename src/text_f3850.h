@@ -18,96 +18,96 @@
 #define __TEXT_F3850__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace f3850 {
 
 // clang-format off
-extern const char TEXT_CPU_F3850[] PROGMEM;
-extern const char TEXT_CPU_3850[]  PROGMEM;
-
-using common::TEXT_null;
-
-// F3850
-using common::TEXT_ADC;
-using common::TEXT_AI;
-using common::TEXT_AM;
-extern const char TEXT_AMD[]  PROGMEM;
-extern const char TEXT_AS[]   PROGMEM;
-extern const char TEXT_ASD[]  PROGMEM;
-extern const char TEXT_BC[]   PROGMEM;
-extern const char TEXT_BF[]   PROGMEM;
-using common::TEXT_BM;
-extern const char TEXT_BNC[]  PROGMEM;
-extern const char TEXT_BNO[]  PROGMEM;
-using common::TEXT_BNZ;
-using common::TEXT_BP;
-using common::TEXT_BR;
-extern const char TEXT_BR7[]  PROGMEM;
-using common::TEXT_BT;
-using common::TEXT_BZ;
-using common::TEXT_CI;
-using common::TEXT_CLR;
-using common::TEXT_CM;
-using common::TEXT_COM;
-extern const char TEXT_DCI[]  PROGMEM;
-using common::TEXT_DI;
-extern const char TEXT_DS[]   PROGMEM;
-using common::TEXT_EI;
-using common::TEXT_IN;
-using common::TEXT_INC;
-using common::TEXT_INS;
-extern const char TEXT_JMP[]  PROGMEM;
-extern const char TEXT_LI[]   PROGMEM;
-extern const char TEXT_LIS[]  PROGMEM;
-extern const char TEXT_LISL[] PROGMEM;
-extern const char TEXT_LISU[] PROGMEM;
-extern const char TEXT_LM[]   PROGMEM;
-extern const char TEXT_LNK[]  PROGMEM;
-extern const char TEXT_LR[]   PROGMEM;
-extern const char TEXT_NI[]   PROGMEM;
-extern const char TEXT_NM[]   PROGMEM;
-extern const char TEXT_NOP[]  PROGMEM;
-extern const char TEXT_NS[]   PROGMEM;
-extern const char TEXT_OI[]   PROGMEM;
-extern const char TEXT_OM[]   PROGMEM;
-extern const char TEXT_OUT[]  PROGMEM;
-extern const char TEXT_OUTS[] PROGMEM;
-extern const char TEXT_PI[]   PROGMEM;
-extern const char TEXT_PK[]   PROGMEM;
-extern const char TEXT_POP[]  PROGMEM;
-extern const char TEXT_SL[]   PROGMEM;
-extern const char TEXT_SR[]   PROGMEM;
-extern const char TEXT_ST[]   PROGMEM;
-extern const char TEXT_XDC[]  PROGMEM;
-extern const char TEXT_XI[]   PROGMEM;
-extern const char TEXT_XM[]   PROGMEM;
-extern const char TEXT_XS[]   PROGMEM;
-
-using common::TEXT_REG_A;
-using common::TEXT_REG_W;
-extern const char TEXT_REG_IS[] PROGMEM;
-extern const char TEXT_REG_KU[] PROGMEM;
-extern const char TEXT_REG_KL[] PROGMEM;
-extern const char TEXT_REG_QU[] PROGMEM;
-extern const char TEXT_REG_QL[] PROGMEM;
-using common::TEXT_REG_H;
-extern const char TEXT_REG_K[]  PROGMEM;
-extern const char TEXT_REG_Q[]  PROGMEM;
-using common::TEXT_REG_P;
-using common::TEXT_REG_P0;
-extern const char TEXT_REG_DC[] PROGMEM;
-// register alias
-extern const char TEXT_REG_J[]  PROGMEM;
-extern const char TEXT_REG_HU[] PROGMEM;
-using common::TEXT_REG_HL;
-using common::TEXT_REG_S;
-using common::TEXT_REG_I;
-using common::TEXT_REG_D;
-
+#define TEXT_F3850_LIST(T, A)  \
+    T(TEXT_CPU_F3850, "F3850") \
+    T(TEXT_CPU_3850,  "3850")  \
+    T(TEXT_null,      "")      \
+    /* F3850 */                \
+    T(TEXT_ADC,       "ADC")   \
+    T(TEXT_AI,        "AI")    \
+    T(TEXT_AM,        "AM")    \
+    T(TEXT_AMD,       "AMD")   \
+    T(TEXT_AS,        "AS")    \
+    T(TEXT_ASD,       "ASD")   \
+    T(TEXT_BC,        "BC")    \
+    T(TEXT_BF,        "BF")    \
+    T(TEXT_BM,        "BM")    \
+    T(TEXT_BNC,       "BNC")   \
+    T(TEXT_BNO,       "BNO")   \
+    T(TEXT_BNZ,       "BNZ")   \
+    T(TEXT_BP,        "BP")    \
+    T(TEXT_BR,        "BR")    \
+    T(TEXT_BR7,       "BR7")   \
+    T(TEXT_BT,        "BT")    \
+    T(TEXT_BZ,        "BZ")    \
+    T(TEXT_CI,        "CI")    \
+    T(TEXT_CLR,       "CLR")   \
+    T(TEXT_CM,        "CM")    \
+    T(TEXT_COM,       "COM")   \
+    T(TEXT_DCI,       "DCI")   \
+    T(TEXT_DI,        "DI")    \
+    T(TEXT_DS,        "DS")    \
+    T(TEXT_EI,        "EI")    \
+    T(TEXT_IN,        "IN")    \
+    T(TEXT_INC,       "INC")   \
+    T(TEXT_INS,       "INS")   \
+    T(TEXT_JMP,       "JMP")   \
+    T(TEXT_LI,        "LI")    \
+    T(TEXT_LIS,       "LIS")   \
+    T(TEXT_LISL,      "LISL")  \
+    T(TEXT_LISU,      "LISU")  \
+    T(TEXT_LM,        "LM")    \
+    T(TEXT_LNK,       "LNK")   \
+    T(TEXT_LR,        "LR")    \
+    T(TEXT_NI,        "NI")    \
+    T(TEXT_NM,        "NM")    \
+    T(TEXT_NOP,       "NOP")   \
+    T(TEXT_NS,        "NS")    \
+    T(TEXT_OI,        "OI")    \
+    T(TEXT_OM,        "OM")    \
+    T(TEXT_OUT,       "OUT")   \
+    T(TEXT_OUTS,      "OUTS")  \
+    T(TEXT_PI,        "PI")    \
+    T(TEXT_PK,        "PK")    \
+    T(TEXT_POP,       "POP")   \
+    T(TEXT_SL,        "SL")    \
+    T(TEXT_SR,        "SR")    \
+    T(TEXT_ST,        "ST")    \
+    T(TEXT_XDC,       "XDC")   \
+    T(TEXT_XI,        "XI")    \
+    T(TEXT_XM,        "XM")    \
+    T(TEXT_XS,        "XS")    \
+    T(TEXT_REG_A,     "A")     \
+    T(TEXT_REG_W,     "W")     \
+    T(TEXT_REG_IS,    "IS")    \
+    T(TEXT_REG_KU,    "KU")    \
+    T(TEXT_REG_KL,    "KL")    \
+    T(TEXT_REG_QU,    "QU")    \
+    T(TEXT_REG_QL,    "QL")    \
+    T(TEXT_REG_H,     "H")     \
+    T(TEXT_REG_K,     "K")     \
+    T(TEXT_REG_Q,     "Q")     \
+    T(TEXT_REG_P,     "P")     \
+    T(TEXT_REG_P0,    "P0")    \
+    T(TEXT_REG_DC,    "DC")    \
+    /* register alias */       \
+    T(TEXT_REG_J,     "J")     \
+    T(TEXT_REG_HU,    "HU")    \
+    T(TEXT_REG_HL,    "HL")    \
+    T(TEXT_REG_S,     "S")     \
+    T(TEXT_REG_I,     "I")     \
+    T(TEXT_REG_D,     "D")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_F3850_LIST);
+
 }  // namespace f3850
 }  // namespace text
 }  // namespace libasm
@@ -18,119 +18,118 @@
 #define __TEXT_I8048__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace i8048 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]     PROGMEM;
-extern const char TEXT_CPU_8039[]     PROGMEM;
-extern const char TEXT_CPU_8048[]     PROGMEM;
-extern const char TEXT_CPU_80C39[]    PROGMEM;
-extern const char TEXT_CPU_80C48[]    PROGMEM;
-extern const char TEXT_CPU_MSM80C39[] PROGMEM;
-extern const char TEXT_CPU_MSM80C48[] PROGMEM;
-
-using common::TEXT_ADD;
-using common::TEXT_ADDC;
-using common::TEXT_ANL;
-extern const char TEXT_ANLD[] PROGMEM;
-using common::TEXT_CALL;
-using common::TEXT_CLR;
-using common::TEXT_CPL;
-using common::TEXT_DA;
-using common::TEXT_DEC;
-using common::TEXT_DIS;
-using common::TEXT_DJNZ;
-extern const char TEXT_EN[]   PROGMEM;
-extern const char TEXT_ENT0[] PROGMEM;
-using common::TEXT_IN;
-using common::TEXT_INC;
-using common::TEXT_INS;
-extern const char TEXT_IRL[]  PROGMEM;
-using common::TEXT_JB;
-using common::TEXT_JC;
-extern const char TEXT_JF0[]  PROGMEM;
-extern const char TEXT_JF1[]  PROGMEM;
-using common::TEXT_JMP;
-extern const char TEXT_JMPP[] PROGMEM;
-using common::TEXT_JNC;
-extern const char TEXT_JNI[]  PROGMEM;
-extern const char TEXT_JNT0[] PROGMEM;
-extern const char TEXT_JNT1[] PROGMEM;
-using common::TEXT_JNZ;
-extern const char TEXT_JT0[]  PROGMEM;
-extern const char TEXT_JT1[]  PROGMEM;
-extern const char TEXT_JTF[]  PROGMEM;
-using common::TEXT_JZ;
-using common::TEXT_MOV;
-using common::TEXT_MOVD;
-extern const char TEXT_MOVP[] PROGMEM;
-extern const char TEXT_MOVP3[] PROGMEM;
-using common::TEXT_MOVX;
-using common::TEXT_NOP;
-using common::TEXT_ORL;
-extern const char TEXT_ORLD[] PROGMEM;
-extern const char TEXT_OUTL[] PROGMEM;
-using common::TEXT_RET;
-extern const char TEXT_RETR[] PROGMEM;
-using common::TEXT_RL;
-using common::TEXT_RLC;
-using common::TEXT_RR;
-using common::TEXT_RRC;
-extern const char TEXT_SEL[]  PROGMEM;
-using common::TEXT_STOP;
-extern const char TEXT_STRT[] PROGMEM;
-using common::TEXT_SWAP;
-using common::TEXT_XCH;
-using common::TEXT_XCHD;
-using common::TEXT_XRL;
-
-// i80C48
-using common::TEXT_HALT;
-
-// MSM80C48
-using common::TEXT_FLT;
-extern const char TEXT_FLTT[] PROGMEM;
-extern const char TEXT_FRES[] PROGMEM;
-extern const char TEXT_HLTS[] PROGMEM;
-extern const char TEXT_MOVP1[] PROGMEM;
-
-// clang-format off
-using common::TEXT_REG_A;
-extern const char TEXT_REG_BUS[]  PROGMEM;
-using common::TEXT_REG_C;
-extern const char TEXT_REG_CLK[]  PROGMEM;
-extern const char TEXT_REG_CNT[]  PROGMEM;
-using common::TEXT_REG_F0;
-using common::TEXT_REG_F1;
-using common::TEXT_REG_I;
-extern const char TEXT_REG_MB0[]  PROGMEM;
-extern const char TEXT_REG_MB1[]  PROGMEM;
-using common::TEXT_REG_P;
-using common::TEXT_REG_P1;
-using common::TEXT_REG_P2;
-extern const char TEXT_REG_P4[]   PROGMEM;
-extern const char TEXT_REG_P5[]   PROGMEM;
-extern const char TEXT_REG_P6[]   PROGMEM;
-extern const char TEXT_REG_P7[]   PROGMEM;
-using common::TEXT_REG_PSW;
-using common::TEXT_REG_R0;
-using common::TEXT_REG_R1;
-using common::TEXT_REG_R2;
-using common::TEXT_REG_R3;
-using common::TEXT_REG_R4;
-using common::TEXT_REG_R5;
-using common::TEXT_REG_R6;
-using common::TEXT_REG_R7;
-extern const char TEXT_REG_RB0[]  PROGMEM;
-extern const char TEXT_REG_RB1[]  PROGMEM;
-using common::TEXT_REG_T;
-extern const char TEXT_REG_TCNT[] PROGMEM;
-extern const char TEXT_REG_TCNTI[] PROGMEM;
+#define TEXT_I8048_LIST(T, A)                                                \
+    T(TEXT_CPU_LIST,     "i8039, i8048, i80C39, i80C48, MSM80C39, MSM80C48") \
+    T(TEXT_CPU_8039,     "8039")                                             \
+    T(TEXT_CPU_8048,     "8048")                                             \
+    T(TEXT_CPU_80C39,    "80C39")                                            \
+    T(TEXT_CPU_80C48,    "80C48")                                            \
+    T(TEXT_CPU_MSM80C39, "MSM80C39")                                         \
+    T(TEXT_CPU_MSM80C48, "MSM80C48")                                         \
+    T(TEXT_ADD,          "ADD")                                              \
+    T(TEXT_ADDC,         "ADDC")                                             \
+    T(TEXT_ANL,          "ANL")                                              \
+    T(TEXT_ANLD,         "ANLD")                                             \
+    T(TEXT_CALL,         "CALL")                                             \
+    T(TEXT_CLR,          "CLR")                                              \
+    T(TEXT_CPL,          "CPL")                                              \
+    T(TEXT_DA,           "DA")                                               \
+    T(TEXT_DEC,          "DEC")                                              \
+    T(TEXT_DIS,          "DIS")                                              \
+    T(TEXT_DJNZ,         "DJNZ")                                             \
+    T(TEXT_EN,           "EN")                                               \
+    T(TEXT_ENT0,         "ENT0")                                             \
+    T(TEXT_IN,           "IN")                                               \
+    T(TEXT_INC,          "INC")                                              \
+    T(TEXT_INS,          "INS")                                              \
+    T(TEXT_IRL,          "IRL")                                              \
+    T(TEXT_JB,           "JB")                                               \
+    T(TEXT_JC,           "JC")                                               \
+    T(TEXT_JF0,          "JF0")                                              \
+    T(TEXT_JF1,          "JF1")                                              \
+    T(TEXT_JMP,          "JMP")                                              \
+    T(TEXT_JMPP,         "JMPP")                                             \
+    T(TEXT_JNC,          "JNC")                                              \
+    T(TEXT_JNI,          "JNI")                                              \
+    T(TEXT_JNT0,         "JNT0")                                             \
+    T(TEXT_JNT1,         "JNT1")                                             \
+    T(TEXT_JNZ,          "JNZ")                                              \
+    T(TEXT_JT0,          "JT0")                                              \
+    T(TEXT_JT1,          "JT1")                                              \
+    T(TEXT_JTF,          "JTF")                                              \
+    T(TEXT_JZ,           "JZ")                                               \
+    T(TEXT_MOV,          "MOV")                                              \
+    T(TEXT_MOVD,         "MOVD")                                             \
+    T(TEXT_MOVP,         "MOVP")                                             \
+    T(TEXT_MOVP3,        "MOVP3")                                            \
+    T(TEXT_MOVX,         "MOVX")                                             \
+    T(TEXT_NOP,          "NOP")                                              \
+    T(TEXT_ORL,          "ORL")                                              \
+    T(TEXT_ORLD,         "ORLD")                                             \
+    T(TEXT_OUTL,         "OUTL")                                             \
+    T(TEXT_RET,          "RET")                                              \
+    T(TEXT_RETR,         "RETR")                                             \
+    T(TEXT_RL,           "RL")                                               \
+    T(TEXT_RLC,          "RLC")                                              \
+    T(TEXT_RR,           "RR")                                               \
+    T(TEXT_RRC,          "RRC")                                              \
+    T(TEXT_SEL,          "SEL")                                              \
+    T(TEXT_STOP,         "STOP")                                             \
+    T(TEXT_STRT,         "STRT")                                             \
+    T(TEXT_SWAP,         "SWAP")                                             \
+    T(TEXT_XCH,          "XCH")                                              \
+    T(TEXT_XCHD,         "XCHD")                                             \
+    T(TEXT_XRL,          "XRL")                                              \
+    /* i80C48 */                                                             \
+    T(TEXT_HALT,         "HALT")                                             \
+    /* MSM80C48 */                                                           \
+    T(TEXT_FLT,          "FLT")                                              \
+    T(TEXT_FLTT,         "FLTT")                                             \
+    T(TEXT_FRES,         "FRES")                                             \
+    T(TEXT_HLTS,         "HLTS")                                             \
+    T(TEXT_MOVP1,        "MOVP1")                                            \
+    T(TEXT_REG_A,        "A")                                                \
+    T(TEXT_REG_BUS,      "BUS")                                              \
+    T(TEXT_REG_C,        "C")                                                \
+    T(TEXT_REG_CLK,      "CLK")                                              \
+    T(TEXT_REG_CNT,      "CNT")                                              \
+    T(TEXT_REG_F0,       "F0")                                               \
+    T(TEXT_REG_F1,       "F1")                                               \
+    T(TEXT_REG_I,        "I")                                                \
+    T(TEXT_REG_MB0,      "MB0")                                              \
+    T(TEXT_REG_MB1,      "MB1")                                              \
+    T(TEXT_REG_P,        "P")                                                \
+    T(TEXT_REG_P1,       "P1")                                               \
+    T(TEXT_REG_P2,       "P2")                                               \
+    T(TEXT_REG_P4,       "P4")                                               \
+    T(TEXT_REG_P5,       "P5")                                               \
+    T(TEXT_REG_P6,       "P6")                                               \
+    T(TEXT_REG_P7,       "P7")                                               \
+    T(TEXT_REG_PSW,      "PSW")                                              \
+    T(TEXT_REG_R0,       "R0")                                               \
+    T(TEXT_REG_R1,       "R1")                                               \
+    T(TEXT_REG_R2,       "R2")                                               \
+    T(TEXT_REG_R3,       "R3")                                               \
+    T(TEXT_REG_R4,       "R4")                                               \
+    T(TEXT_REG_R5,       "R5")                                               \
+    T(TEXT_REG_R6,       "R6")                                               \
+    T(TEXT_REG_R7,       "R7")                                               \
+    T(TEXT_REG_RB0,      "RB0")                                              \
+    T(TEXT_REG_RB1,      "RB1")                                              \
+    T(TEXT_REG_T,        "T")                                                \
+    T(TEXT_REG_TCNT,     "TCNT")                                             \
+    T(TEXT_REG_TCNTI,    "TCNTI")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_I8048_LIST);
+
 }  // namespace i8048
 }  // namespace text
 }  // namespace libasm
@@ -18,77 +18,78 @@
 #define __TEXT_I8051__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace i8051 {
 
 // clang-format off
-extern const char TEXT_CPU_I8051[] PROGMEM;
-extern const char TEXT_CPU_8051[]  PROGMEM;
-
-extern const char TEXT_ACALL[] PROGMEM;
-using common::TEXT_ADD;
-using common::TEXT_ADDC;
-extern const char TEXT_AJMP[]  PROGMEM;
-using common::TEXT_ANL;
-extern const char TEXT_CJNE[]  PROGMEM;
-using common::TEXT_CLR;
-using common::TEXT_CPL;
-using common::TEXT_CPU;
-using common::TEXT_DA;
-using common::TEXT_DEC;
-using common::TEXT_DIV;
-using common::TEXT_DJNZ;
-using common::TEXT_INC;
-using common::TEXT_JB;
-using common::TEXT_JBC;
-using common::TEXT_JC;
-using common::TEXT_JMP;
-using common::TEXT_JNB;
-using common::TEXT_JNC;
-using common::TEXT_JNZ;
-using common::TEXT_JZ;
-using common::TEXT_LCALL;
-using common::TEXT_LJMP;
-using common::TEXT_MOV;
-extern const char TEXT_MOVC[]  PROGMEM;
-using common::TEXT_MOVX;
-using common::TEXT_MUL;
-using common::TEXT_NOP;
-using common::TEXT_ORL;
-using common::TEXT_POP;
-using common::TEXT_PUSH;
-using common::TEXT_RET;
-using common::TEXT_RETI;
-using common::TEXT_RL;
-using common::TEXT_RLC;
-using common::TEXT_RR;
-using common::TEXT_RRC;
-using common::TEXT_SETB;
-using common::TEXT_SJMP;
-using common::TEXT_SUBB;
-using common::TEXT_SWAP;
-using common::TEXT_XCH;
-using common::TEXT_XCHD;
-using common::TEXT_XRL;
-
-// clang-format off
-using common::TEXT_REG_A;
-using common::TEXT_REG_C;
-extern const char TEXT_REG_AB[]   PROGMEM;
-using common::TEXT_REG_R0;
-using common::TEXT_REG_R1;
-using common::TEXT_REG_R2;
-using common::TEXT_REG_R3;
-using common::TEXT_REG_R4;
-using common::TEXT_REG_R5;
-using common::TEXT_REG_R6;
-using common::TEXT_REG_R7;
-using common::TEXT_REG_PC;
-extern const char TEXT_REG_DPTR[] PROGMEM;
+#define TEXT_I8051_LIST(T, A)  \
+    T(TEXT_CPU_I8051, "i8051") \
+    T(TEXT_CPU_8051,  "8051")  \
+    T(TEXT_ACALL,     "ACALL") \
+    T(TEXT_ADD,       "ADD")   \
+    T(TEXT_ADDC,      "ADDC")  \
+    T(TEXT_AJMP,      "AJMP")  \
+    T(TEXT_ANL,       "ANL")   \
+    T(TEXT_CJNE,      "CJNE")  \
+    T(TEXT_CLR,       "CLR")   \
+    T(TEXT_CPL,       "CPL")   \
+    T(TEXT_CPU,       "CPU")   \
+    T(TEXT_DA,        "DA")    \
+    T(TEXT_DEC,       "DEC")   \
+    T(TEXT_DIV,       "DIV")   \
+    T(TEXT_DJNZ,      "DJNZ")  \
+    T(TEXT_INC,       "INC")   \
+    T(TEXT_JB,        "JB")    \
+    T(TEXT_JBC,       "JBC")   \
+    T(TEXT_JC,        "JC")    \
+    T(TEXT_JMP,       "JMP")   \
+    T(TEXT_JNB,       "JNB")   \
+    T(TEXT_JNC,       "JNC")   \
+    T(TEXT_JNZ,       "JNZ")   \
+    T(TEXT_JZ,        "JZ")    \
+    T(TEXT_LCALL,     "LCALL") \
+    T(TEXT_LJMP,      "LJMP")  \
+    T(TEXT_MOV,       "MOV")   \
+    T(TEXT_MOVC,      "MOVC")  \
+    T(TEXT_MOVX,      "MOVX")  \
+    T(TEXT_MUL,       "MUL")   \
+    T(TEXT_NOP,       "NOP")   \
+    T(TEXT_ORL,       "ORL")   \
+    T(TEXT_POP,       "POP")   \
+    T(TEXT_PUSH,      "PUSH")  \
+    T(TEXT_RET,       "RET")   \
+    T(TEXT_RETI,      "RETI")  \
+    T(TEXT_RL,        "RL")    \
+    T(TEXT_RLC,       "RLC")   \
+    T(TEXT_RR,        "RR")    \
+    T(TEXT_RRC,       "RRC")   \
+    T(TEXT_SETB,      "SETB")  \
+    T(TEXT_SJMP,      "SJMP")  \
+    T(TEXT_SUBB,      "SUBB")  \
+    T(TEXT_SWAP,      "SWAP")  \
+    T(TEXT_XCH,       "XCH")   \
+    T(TEXT_XCHD,      "XCHD")  \
+    T(TEXT_XRL,       "XRL")   \
+    T(TEXT_REG_A,     "A")     \
+    T(TEXT_REG_C,     "C")     \
+    T(TEXT_REG_AB,    "AB")    \
+    T(TEXT_REG_R0,    "R0")    \
+    T(TEXT_REG_R1,    "R1")    \
+    T(TEXT_REG_R2,    "R2")    \
+    T(TEXT_REG_R3,    "R3")    \
+    T(TEXT_REG_R4,    "R4")    \
+    T(TEXT_REG_R5,    "R5")    \
+    T(TEXT_REG_R6,    "R6")    \
+    T(TEXT_REG_R7,    "R7")    \
+    T(TEXT_REG_PC,    "PC")    \
+    T(TEXT_REG_DPTR,  "DPTR")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_I8051_LIST);
+
 }  // namespace i8051
 }  // namespace text
 }  // namespace libasm
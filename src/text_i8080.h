@@ -18,116 +18,116 @@
 #define __TEXT_I8080__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace i8080 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]   PROGMEM;
-using common::TEXT_CPU_8080;
-using common::TEXT_CPU_8085;
-using common::TEXT_CPU_V30EMU;
-
-extern const char TEXT_ACI[]  PROGMEM;
-using common::TEXT_ADC;
-using common::TEXT_ADD;
-using common::TEXT_ADI;
-extern const char TEXT_ANA[]  PROGMEM;
-using common::TEXT_ANI;
-using common::TEXT_CALL;
-extern const char TEXT_CC[]   PROGMEM;
-using common::TEXT_CM;
-extern const char TEXT_CMA[]  PROGMEM;
-using common::TEXT_CMC;
-using common::TEXT_CMP;
-extern const char TEXT_CNC[]  PROGMEM;
-extern const char TEXT_CNZ[]  PROGMEM;
-using common::TEXT_CP;
-extern const char TEXT_CPE[]  PROGMEM;
-using common::TEXT_CPI;
-extern const char TEXT_CPO[]  PROGMEM;
-extern const char TEXT_CZ[]   PROGMEM;
-using common::TEXT_DAA;
-using common::TEXT_DAD;
-extern const char TEXT_DCR[]  PROGMEM;
-extern const char TEXT_DCX[]  PROGMEM;
-using common::TEXT_DI;
-using common::TEXT_EI;
-using common::TEXT_HLT;
-using common::TEXT_IN;
-extern const char TEXT_INR[]  PROGMEM;
-using common::TEXT_INX;
-using common::TEXT_JC;
-extern const char TEXT_JM[]   PROGMEM;
-using common::TEXT_JMP;
-using common::TEXT_JNC;
-using common::TEXT_JNZ;
-using common::TEXT_JP;
-using common::TEXT_JPE;
-using common::TEXT_JPO;
-using common::TEXT_JZ;
-using common::TEXT_LDA;
-extern const char TEXT_LDAX[] PROGMEM;
-extern const char TEXT_LHLD[] PROGMEM;
-extern const char TEXT_LXI[]  PROGMEM;
-using common::TEXT_MOV;
-using common::TEXT_MVI;
-using common::TEXT_NOP;
-using common::TEXT_ORA;
-using common::TEXT_ORI;
-using common::TEXT_OUT;
-extern const char TEXT_PCHL[] PROGMEM;
-using common::TEXT_POP;
-using common::TEXT_PUSH;
-extern const char TEXT_RAL[]  PROGMEM;
-extern const char TEXT_RAR[]  PROGMEM;
-extern const char TEXT_RC[]   PROGMEM;
-using common::TEXT_RET;
-using common::TEXT_RLC;
-extern const char TEXT_RM[]   PROGMEM;
-extern const char TEXT_RNC[]  PROGMEM;
-extern const char TEXT_RNZ[]  PROGMEM;
-extern const char TEXT_RP[]   PROGMEM;
-extern const char TEXT_RPE[]  PROGMEM;
-extern const char TEXT_RPO[]  PROGMEM;
-using common::TEXT_RRC;
-using common::TEXT_RST;
-extern const char TEXT_RZ[]   PROGMEM;
-using common::TEXT_SBB;
-extern const char TEXT_SBI[]  PROGMEM;
-extern const char TEXT_SHLD[] PROGMEM;
-extern const char TEXT_SPHL[] PROGMEM;
-using common::TEXT_STA;
-extern const char TEXT_STAX[] PROGMEM;
-using common::TEXT_STC;
-using common::TEXT_SUB;
-extern const char TEXT_SUI[]  PROGMEM;
-using common::TEXT_XCHG;
-extern const char TEXT_XRA[]  PROGMEM;
-using common::TEXT_XRI;
-extern const char TEXT_XTHL[] PROGMEM;
-
-// i8085
-extern const char TEXT_RIM[]  PROGMEM;
-extern const char TEXT_SIM[]  PROGMEM;
-
-// V30EMU
-using common::TEXT_CALLN;
-using common::TEXT_RETEM;
-
-using common::TEXT_REG_A;
-using common::TEXT_REG_B;
-using common::TEXT_REG_C;
-using common::TEXT_REG_D;
-using common::TEXT_REG_E;
-using common::TEXT_REG_H;
-using common::TEXT_REG_L;
-extern const char TEXT_REG_M[]   PROGMEM;
-using common::TEXT_REG_SP;
-using common::TEXT_REG_PSW;
+#define TEXT_I8080_LIST(T, A)                  \
+    T(TEXT_CPU_LIST,   "i8080, i8085, V30EMU") \
+    T(TEXT_CPU_8080,   "8080")                 \
+    T(TEXT_CPU_8085,   "8085")                 \
+    T(TEXT_CPU_V30EMU, "V30EMU")               \
+    T(TEXT_ACI,        "ACI")                  \
+    T(TEXT_ADC,        "ADC")                  \
+    T(TEXT_ADD,        "ADD")                  \
+    T(TEXT_ADI,        "ADI")                  \
+    T(TEXT_ANA,        "ANA")                  \
+    T(TEXT_ANI,        "ANI")                  \
+    T(TEXT_CALL,       "CALL")                 \
+    T(TEXT_CC,         "CC")                   \
+    T(TEXT_CM,         "CM")                   \
+    T(TEXT_CMA,        "CMA")                  \
+    T(TEXT_CMC,        "CMC")                  \
+    T(TEXT_CMP,        "CMP")                  \
+    T(TEXT_CNC,        "CNC")                  \
+    T(TEXT_CNZ,        "CNZ")                  \
+    T(TEXT_CP,         "CP")                   \
+    T(TEXT_CPE,        "CPE")                  \
+    T(TEXT_CPI,        "CPI")                  \
+    T(TEXT_CPO,        "CPO")                  \
+    T(TEXT_CZ,         "CZ")                   \
+    T(TEXT_DAA,        "DAA")                  \
+    T(TEXT_DAD,        "DAD")                  \
+    T(TEXT_DCR,        "DCR")                  \
+    T(TEXT_DCX,        "DCX")                  \
+    T(TEXT_DI,         "DI")                   \
+    T(TEXT_EI,         "EI")                   \
+    T(TEXT_HLT,        "HLT")                  \
+    T(TEXT_IN,         "IN")                   \
+    T(TEXT_INR,        "INR")                  \
+    T(TEXT_INX,        "INX")                  \
+    T(TEXT_JC,         "JC")                   \
+    T(TEXT_JM,         "JM")                   \
+    T(TEXT_JMP,        "JMP")                  \
+    T(TEXT_JNC,        "JNC")                  \
+    T(TEXT_JNZ,        "JNZ")                  \
+    T(TEXT_JP,         "JP")                   \
+    T(TEXT_JPE,        "JPE")                  \
+    T(TEXT_JPO,        "JPO")                  \
+    T(TEXT_JZ,         "JZ")                   \
+    T(TEXT_LDA,        "LDA")                  \
+    T(TEXT_LDAX,       "LDAX")                 \
+    T(TEXT_LHLD,       "LHLD")                 \
+    T(TEXT_LXI,        "LXI")                  \
+    T(TEXT_MOV,        "MOV")                  \
+    T(TEXT_MVI,        "MVI")                  \
+    T(TEXT_NOP,        "NOP")                  \
+    T(TEXT_ORA,        "ORA")                  \
+    T(TEXT_ORI,        "ORI")                  \
+    T(TEXT_OUT,        "OUT")                  \
+    T(TEXT_PCHL,       "PCHL")                 \
+    T(TEXT_POP,        "POP")                  \
+    T(TEXT_PUSH,       "PUSH")                 \
+    T(TEXT_RAL,        "RAL")                  \
+    T(TEXT_RAR,        "RAR")                  \
+    T(TEXT_RC,         "RC")                   \
+    T(TEXT_RET,        "RET")                  \
+    T(TEXT_RLC,        "RLC")                  \
+    T(TEXT_RM,         "RM")                   \
+    T(TEXT_RNC,        "RNC")                  \
+    T(TEXT_RNZ,        "RNZ")                  \
+    T(TEXT_RP,         "RP")                   \
+    T(TEXT_RPE,        "RPE")                  \
+    T(TEXT_RPO,        "RPO")                  \
+    T(TEXT_RRC,        "RRC")                  \
+    T(TEXT_RST,        "RST")                  \
+    T(TEXT_RZ,         "RZ")                   \
+    T(TEXT_SBB,        "SBB")                  \
+    T(TEXT_SBI,        "SBI")                  \
+    T(TEXT_SHLD,       "SHLD")                 \
+    T(TEXT_SPHL,       "SPHL")                 \
+    T(TEXT_STA,        "STA")                  \
+    T(TEXT_STAX,       "STAX")                 \
+    T(TEXT_STC,        "STC")                  \
+    T(TEXT_SUB,        "SUB")                  \
+    T(TEXT_SUI,        "SUI")                  \
+    T(TEXT_XCHG,       "XCHG")                 \
+    T(TEXT_XRA,        "XRA")                  \
+    T(TEXT_XRI,        "XRI")                  \
+    T(TEXT_XTHL,       "XTHL")                 \
+    /* i8085 */                                \
+    T(TEXT_RIM,        "RIM")                  \
+    T(TEXT_SIM,        "SIM")                  \
+    /* V30EMU */                               \
+    T(TEXT_CALLN,      "CALLN")                \
+    T(TEXT_RETEM,      "RETEM")                \
+    T(TEXT_REG_A,      "A")                    \
+    T(TEXT_REG_B,      "B")                    \
+    T(TEXT_REG_C,      "C")                    \
+    T(TEXT_REG_D,      "D")                    \
+    T(TEXT_REG_E,      "E")                    \
+    T(TEXT_REG_H,      "H")                    \
+    T(TEXT_REG_L,      "L")                    \
+    T(TEXT_REG_M,      "M")                    \
+    T(TEXT_REG_SP,     "SP")                   \
+    T(TEXT_REG_PSW,    "PSW")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_I8080_LIST);
+
 }  // namespace i8080
 }  // namespace text
 }  // namespace libasm
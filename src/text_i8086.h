@@ -18,198 +18,198 @@
 #define __TEXT_I8086__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace i8086 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]  PROGMEM;
-extern const char TEXT_CPU_8086[]  PROGMEM;
-extern const char TEXT_CPU_80186[] PROGMEM;
-extern const char TEXT_CPU_V30[]   PROGMEM;
-
-extern const char TEXT_AAA[]    PROGMEM;
-extern const char TEXT_AAD[]    PROGMEM;
-extern const char TEXT_AAM[]    PROGMEM;
-extern const char TEXT_AAS[]    PROGMEM;
-using common::TEXT_ADC;
-using common::TEXT_ADD;
-using common::TEXT_AND;
-using common::TEXT_CALL;
-extern const char TEXT_CALLF[]  PROGMEM;
-extern const char TEXT_CBW[]    PROGMEM;
-using common::TEXT_CLC;
-using common::TEXT_CLD;
-using common::TEXT_CLI;
-using common::TEXT_CMC;
-using common::TEXT_CMP;
-using common::TEXT_CMPS;
-using common::TEXT_CMPSB;
-using common::TEXT_CMPSW;
-extern const char TEXT_CWD[]    PROGMEM;
-using common::TEXT_DAA;
-using common::TEXT_DAS;
-using common::TEXT_DEC;
-using common::TEXT_DIV;
-using common::TEXT_HLT;
-using common::TEXT_IDIV;
-extern const char TEXT_IMUL[]   PROGMEM;
-using common::TEXT_IN;
-using common::TEXT_INC;
-extern const char TEXT_INT[]    PROGMEM;
-extern const char TEXT_INTO[]   PROGMEM;
-using common::TEXT_IRET;
-extern const char TEXT_JA[]     PROGMEM;
-extern const char TEXT_JAE[]    PROGMEM;
-using common::TEXT_JB;
-extern const char TEXT_JBE[]    PROGMEM;
-using common::TEXT_JC;
-extern const char TEXT_JCXZ[]   PROGMEM;
-using common::TEXT_JE;
-extern const char TEXT_JG[]     PROGMEM;
-using common::TEXT_JGE;
-using common::TEXT_JL;
-using common::TEXT_JLE;
-using common::TEXT_JMP;
-extern const char TEXT_JMPF[]   PROGMEM;
-extern const char TEXT_JNA[]    PROGMEM;
-extern const char TEXT_JNAE[]   PROGMEM;
-using common::TEXT_JNB;
-extern const char TEXT_JNBE[]   PROGMEM;
-using common::TEXT_JNC;
-using common::TEXT_JNE;
-extern const char TEXT_JNG[]    PROGMEM;
-extern const char TEXT_JNGE[]   PROGMEM;
-extern const char TEXT_JNL[]    PROGMEM;
-extern const char TEXT_JNLE[]   PROGMEM;
-using common::TEXT_JNO;
-extern const char TEXT_JNP[]    PROGMEM;
-extern const char TEXT_JNS[]    PROGMEM;
-using common::TEXT_JNZ;
-extern const char TEXT_JO[]     PROGMEM;
-using common::TEXT_JP;
-using common::TEXT_JPE;
-using common::TEXT_JPO;
-extern const char TEXT_JS[]     PROGMEM;
-using common::TEXT_JZ;
-extern const char TEXT_LAHF[]   PROGMEM;
-using common::TEXT_LDS;
-using common::TEXT_LEA;
-extern const char TEXT_LES[]    PROGMEM;
-extern const char TEXT_LOCK[]   PROGMEM;
-extern const char TEXT_LODS[]   PROGMEM;
-extern const char TEXT_LODSB[]  PROGMEM;
-extern const char TEXT_LODSW[]  PROGMEM;
-extern const char TEXT_LOOP[]   PROGMEM;
-extern const char TEXT_LOOPE[]  PROGMEM;
-extern const char TEXT_LOOPNE[] PROGMEM;
-extern const char TEXT_LOOPNZ[] PROGMEM;
-extern const char TEXT_LOOPZ[]  PROGMEM;
-using common::TEXT_MOV;
-extern const char TEXT_MOVS[]   PROGMEM;
-using common::TEXT_MOVSB;
-using common::TEXT_MOVSW;
-using common::TEXT_MUL;
-using common::TEXT_NEG;
-using common::TEXT_NOP;
-using common::TEXT_NOT;
-using common::TEXT_OR;
-using common::TEXT_OUT;
-using common::TEXT_POP;
-using common::TEXT_POPF;
-using common::TEXT_PUSH;
-using common::TEXT_PUSHF;
-extern const char TEXT_RCL[]    PROGMEM;
-extern const char TEXT_RCR[]    PROGMEM;
-using common::TEXT_REP;
-extern const char TEXT_REPE[]   PROGMEM;
-extern const char TEXT_REPNE[]  PROGMEM;
-extern const char TEXT_REPNZ[]  PROGMEM;
-extern const char TEXT_REPZ[]   PROGMEM;
-using common::TEXT_RET;
-extern const char TEXT_RETF[]   PROGMEM;
-using common::TEXT_ROL;
-using common::TEXT_ROR;
-extern const char TEXT_SAHF[]   PROGMEM;
-extern const char TEXT_SAL[]    PROGMEM;
-using common::TEXT_SAR;
-using common::TEXT_SBB;
-extern const char TEXT_SCAS[]   PROGMEM;
-extern const char TEXT_SCASB[]  PROGMEM;
-extern const char TEXT_SCASW[]  PROGMEM;
-extern const char TEXT_SEGCS[]  PROGMEM;
-extern const char TEXT_SEGDS[]  PROGMEM;
-extern const char TEXT_SEGES[]  PROGMEM;
-extern const char TEXT_SEGSS[]  PROGMEM;
-using common::TEXT_SHL;
-using common::TEXT_SHR;
-using common::TEXT_STC;
-using common::TEXT_STD;
-extern const char TEXT_STI[]    PROGMEM;
-extern const char TEXT_STOS[]   PROGMEM;
-extern const char TEXT_STOSB[]  PROGMEM;
-extern const char TEXT_STOSW[]  PROGMEM;
-using common::TEXT_SUB;
-using common::TEXT_TEST;
-using common::TEXT_WAIT;
-using common::TEXT_XCHG;
-extern const char TEXT_XLAT[]   PROGMEM;
-using common::TEXT_XOR;
-
-// i80186
-using common::TEXT_ENTER;
-extern const char TEXT_LEAVE[]  PROGMEM;
-extern const char TEXT_PUSHA[]  PROGMEM;
-extern const char TEXT_POPA[]   PROGMEM;
-extern const char TEXT_BOUND[]  PROGMEM;
-using common::TEXT_INS;
-using common::TEXT_INSB;
-using common::TEXT_INSW;
-using common::TEXT_OUTS;
-extern const char TEXT_OUTSB[]  PROGMEM;
-extern const char TEXT_OUTSW[]  PROGMEM;
-
-// V30
-extern const char TEXT_ADD4S[]  PROGMEM;
-extern const char TEXT_BRKEM[]  PROGMEM;
-extern const char TEXT_CLR1[]   PROGMEM;
-extern const char TEXT_CMP4S[]  PROGMEM;
-using common::TEXT_EXT;
-extern const char TEXT_NOT1[]   PROGMEM;
-extern const char TEXT_REPC[]   PROGMEM;
-extern const char TEXT_REPNC[]  PROGMEM;
-extern const char TEXT_ROL4[]   PROGMEM;
-extern const char TEXT_ROR4[]   PROGMEM;
-extern const char TEXT_SET1[]   PROGMEM;
-extern const char TEXT_SUB4S[]  PROGMEM;
-extern const char TEXT_TEST1[]  PROGMEM;
-
-extern const char TEXT_REG_AL[]   PROGMEM;
-extern const char TEXT_REG_BL[]   PROGMEM;
-extern const char TEXT_REG_CL[]   PROGMEM;
-extern const char TEXT_REG_DL[]   PROGMEM;
-extern const char TEXT_REG_AH[]   PROGMEM;
-extern const char TEXT_REG_BH[]   PROGMEM;
-extern const char TEXT_REG_CH[]   PROGMEM;
-extern const char TEXT_REG_DH[]   PROGMEM;
-extern const char TEXT_REG_AX[]   PROGMEM;
-extern const char TEXT_REG_BX[]   PROGMEM;
-extern const char TEXT_REG_CX[]   PROGMEM;
-extern const char TEXT_REG_DX[]   PROGMEM;
-using common::TEXT_REG_SP;
-extern const char TEXT_REG_BP[]   PROGMEM;
-extern const char TEXT_REG_SI[]   PROGMEM;
-extern const char TEXT_REG_DI[]   PROGMEM;
-extern const char TEXT_REG_CS[]   PROGMEM;
-extern const char TEXT_REG_DS[]   PROGMEM;
-extern const char TEXT_REG_ES[]   PROGMEM;
-extern const char TEXT_REG_SS[]   PROGMEM;
-extern const char TEXT_REG_PTR[]  PROGMEM;
-extern const char TEXT_REG_BYTE[] PROGMEM;
-extern const char TEXT_REG_WORD[] PROGMEM;
+#define TEXT_I8086_LIST(T, A)               \
+    T(TEXT_CPU_LIST,  "i8086, i80186, V30") \
+    T(TEXT_CPU_8086,  "8086")               \
+    T(TEXT_CPU_80186, "80186")              \
+    T(TEXT_CPU_V30,   "V30")                \
+    T(TEXT_AAA,       "AAA")                \
+    T(TEXT_AAD,       "AAD")                \
+    T(TEXT_AAM,       "AAM")                \
+    T(TEXT_AAS,       "AAS")                \
+    T(TEXT_ADC,       "ADC")                \
+    T(TEXT_ADD,       "ADD")                \
+    T(TEXT_AND,       "AND")                \
+    T(TEXT_CALL,      "CALL")               \
+    T(TEXT_CALLF,     "CALLF")              \
+    T(TEXT_CBW,       "CBW")                \
+    T(TEXT_CLC,       "CLC")                \
+    T(TEXT_CLD,       "CLD")                \
+    T(TEXT_CLI,       "CLI")                \
+    T(TEXT_CMC,       "CMC")                \
+    T(TEXT_CMP,       "CMP")                \
+    T(TEXT_CMPS,      "CMPS")               \
+    T(TEXT_CMPSB,     "CMPSB")              \
+    T(TEXT_CMPSW,     "CMPSW")              \
+    T(TEXT_CWD,       "CWD")                \
+    T(TEXT_DAA,       "DAA")                \
+    T(TEXT_DAS,       "DAS")                \
+    T(TEXT_DEC,       "DEC")                \
+    T(TEXT_DIV,       "DIV")                \
+    T(TEXT_HLT,       "HLT")                \
+    T(TEXT_IDIV,      "IDIV")               \
+    T(TEXT_IMUL,      "IMUL")               \
+    T(TEXT_IN,        "IN")                 \
+    T(TEXT_INC,       "INC")                \
+    T(TEXT_INT,       "INT")                \
+    T(TEXT_INTO,      "INTO")               \
+    T(TEXT_IRET,      "IRET")               \
+    T(TEXT_JA,        "JA")                 \
+    T(TEXT_JAE,       "JAE")                \
+    T(TEXT_JB,        "JB")                 \
+    T(TEXT_JBE,       "JBE")                \
+    T(TEXT_JC,        "JC")                 \
+    T(TEXT_JCXZ,      "JCXZ")               \
+    T(TEXT_JE,        "JE")                 \
+    T(TEXT_JG,        "JG")                 \
+    T(TEXT_JGE,       "JGE")                \
+    T(TEXT_JL,        "JL")                 \
+    T(TEXT_JLE,       "JLE")                \
+    T(TEXT_JMP,       "JMP")                \
+    T(TEXT_JMPF,      "JMPF")               \
+    T(TEXT_JNA,       "JNA")                \
+    T(TEXT_JNAE,      "JNAE")               \
+    T(TEXT_JNB,       "JNB")                \
+    T(TEXT_JNBE,      "JNBE")               \
+    T(TEXT_JNC,       "JNC")                \
+    T(TEXT_JNE,       "JNE")                \
+    T(TEXT_JNG,       "JNG")                \
+    T(TEXT_JNGE,      "JNGE")               \
+    T(TEXT_JNL,       "JNL")                \
+    T(TEXT_JNLE,      "JNLE")               \
+    T(TEXT_JNO,       "JNO")                \
+    T(TEXT_JNP,       "JNP")                \
+    T(TEXT_JNS,       "JNS")                \
+    T(TEXT_JNZ,       "JNZ")                \
+    T(TEXT_JO,        "JO")                 \
+    T(TEXT_JP,        "JP")                 \
+    T(TEXT_JPE,       "JPE")                \
+    T(TEXT_JPO,       "JPO")                \
+    T(TEXT_JS,        "JS")                 \
+    T(TEXT_JZ,        "JZ")                 \
+    T(TEXT_LAHF,      "LAHF")               \
+    T(TEXT_LDS,       "LDS")                \
+    T(TEXT_LEA,       "LEA")                \
+    T(TEXT_LES,       "LES")                \
+    T(TEXT_LOCK,      "LOCK")               \
+    T(TEXT_LODS,      "LODS")               \
+    T(TEXT_LODSB,     "LODSB")              \
+    T(TEXT_LODSW,     "LODSW")              \
+    T(TEXT_LOOP,      "LOOP")               \
+    T(TEXT_LOOPE,     "LOOPE")              \
+    T(TEXT_LOOPNE,    "LOOPNE")             \
+    T(TEXT_LOOPNZ,    "LOOPNZ")             \
+    T(TEXT_LOOPZ,     "LOOPZ")              \
+    T(TEXT_MOV,       "MOV")                \
+    T(TEXT_MOVS,      "MOVS")               \
+    T(TEXT_MOVSB,     "MOVSB")              \
+    T(TEXT_MOVSW,     "MOVSW")              \
+    T(TEXT_MUL,       "MUL")                \
+    T(TEXT_NEG,       "NEG")                \
+    T(TEXT_NOP,       "NOP")                \
+    T(TEXT_NOT,       "NOT")                \
+    T(TEXT_OR,        "OR")                 \
+    T(TEXT_OUT,       "OUT")                \
+    T(TEXT_POP,       "POP")                \
+    T(TEXT_POPF,      "POPF")               \
+    T(TEXT_PUSH,      "PUSH")               \
+    T(TEXT_PUSHF,     "PUSHF")              \
+    T(TEXT_RCL,       "RCL")                \
+    T(TEXT_RCR,       "RCR")                \
+    T(TEXT_REP,       "REP")                \
+    T(TEXT_REPE,      "REPE")               \
+    T(TEXT_REPNE,     "REPNE")              \
+    T(TEXT_REPNZ,     "REPNZ")              \
+    T(TEXT_REPZ,      "REPZ")               \
+    T(TEXT_RET,       "RET")                \
+    T(TEXT_RETF,      "RETF")               \
+    T(TEXT_ROL,       "ROL")                \
+    T(TEXT_ROR,       "ROR")                \
+    T(TEXT_SAHF,      "SAHF")               \
+    T(TEXT_SAL,       "SAL")                \
+    T(TEXT_SAR,       "SAR")                \
+    T(TEXT_SBB,       "SBB")                \
+    T(TEXT_SCAS,      "SCAS")               \
+    T(TEXT_SCASB,     "SCASB")              \
+    T(TEXT_SCASW,     "SCASW")              \
+    T(TEXT_SEGCS,     "SEGCS")              \
+    T(TEXT_SEGDS,     "SEGDS")              \
+    T(TEXT_SEGES,     "SEGES")              \
+    T(TEXT_SEGSS,     "SEGSS")              \
+    T(TEXT_SHL,       "SHL")                \
+    T(TEXT_SHR,       "SHR")                \
+    T(TEXT_STC,       "STC")                \
+    T(TEXT_STD,       "STD")                \
+    T(TEXT_STI,       "STI")                \
+    T(TEXT_STOS,      "STOS")               \
+    T(TEXT_STOSB,     "STOSB")              \
+    T(TEXT_STOSW,     "STOSW")              \
+    T(TEXT_SUB,       "SUB")                \
+    T(TEXT_TEST,      "TEST")               \
+    T(TEXT_WAIT,      "WAIT")               \
+    T(TEXT_XCHG,      "XCHG")               \
+    T(TEXT_XLAT,      "XLAT")               \
+    T(TEXT_XOR,       "XOR")                \
+    /* i80186 */                            \
+    T(TEXT_ENTER,     "ENTER")              \
+    T(TEXT_LEAVE,     "LEAVE")              \
+    T(TEXT_PUSHA,     "PUSHA")              \
+    T(TEXT_POPA,      "POPA")               \
+    T(TEXT_BOUND,     "BOUND")              \
+    T(TEXT_INS,       "INS")                \
+    T(TEXT_INSB,      "INSB")               \
+    T(TEXT_INSW,      "INSW")               \
+    T(TEXT_OUTS,      "OUTS")               \
+    T(TEXT_OUTSB,     "OUTSB")              \
+    T(TEXT_OUTSW,     "OUTSW")              \
+    /* V30 */                               \
+    T(TEXT_ADD4S,     "ADD4S")              \
+    T(TEXT_BRKEM,     "BRKEM")              \
+    T(TEXT_CLR1,      "CLR1")               \
+    T(TEXT_CMP4S,     "CMP4S")              \
+    T(TEXT_EXT,       "EXT")                \
+    T(TEXT_NOT1,      "NOT1")               \
+    T(TEXT_REPC,      "REPC")               \
+    T(TEXT_REPNC,     "REPNC")              \
+    T(TEXT_ROL4,      "ROL4")               \
+    T(TEXT_ROR4,      "ROR4")               \
+    T(TEXT_SET1,      "SET1")               \
+    T(TEXT_SUB4S,     "SUB4S")              \
+    T(TEXT_TEST1,     "TEST1")              \
+    T(TEXT_REG_AL,    "AL")                 \
+    T(TEXT_REG_BL,    "BL")                 \
+    T(TEXT_REG_CL,    "CL")                 \
+    T(TEXT_REG_DL,    "DL")                 \
+    T(TEXT_REG_AH,    "AH")                 \
+    T(TEXT_REG_BH,    "BH")                 \
+    T(TEXT_REG_CH,    "CH")                 \
+    T(TEXT_REG_DH,    "DH")                 \
+    T(TEXT_REG_AX,    "AX")                 \
+    T(TEXT_REG_BX,    "BX")                 \
+    T(TEXT_REG_CX,    "CX")                 \
+    T(TEXT_REG_DX,    "DX")                 \
+    T(TEXT_REG_SP,    "SP")                 \
+    T(TEXT_REG_BP,    "BP")                 \
+    T(TEXT_REG_SI,    "SI")                 \
+    T(TEXT_REG_DI,    "DI")                 \
+    T(TEXT_REG_CS,    "CS")                 \
+    T(TEXT_REG_DS,    "DS")                 \
+    T(TEXT_REG_ES,    "ES")                 \
+    T(TEXT_REG_SS,    "SS")                 \
+    T(TEXT_REG_PTR,   "PTR")                \
+    T(TEXT_REG_BYTE,  "BYTE")               \
+    T(TEXT_REG_WORD,  "WORD")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_I8086_LIST);
+
 }  // namespace i8086
 }  // namespace text
 }  // namespace libasm
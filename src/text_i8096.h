@@ -18,109 +18,112 @@
 #define __TEXT_I8096__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace i8096 {
 
 // clang-format off
-extern const char TEXT_CPU_I8096[] PROGMEM;
-extern const char TEXT_CPU_8096[]  PROGMEM;
-
-using common::TEXT_ADD;
-using common::TEXT_ADDB;
-using common::TEXT_ADDC;
-using common::TEXT_ADDCB;
-using common::TEXT_AND;
-using common::TEXT_ANDB;
-using common::TEXT_BR;
-using common::TEXT_CLR;
-using common::TEXT_CLRB;
-extern const char TEXT_CLRC[]  PROGMEM;
-extern const char TEXT_CLRVT[] PROGMEM;
-using common::TEXT_CMP;
-using common::TEXT_CMPB;
-using common::TEXT_CPU;
-using common::TEXT_DEC;
-using common::TEXT_DECB;
-using common::TEXT_DI;
-using common::TEXT_DIV;
-using common::TEXT_DIVB;
-using common::TEXT_DIVU;
-extern const char TEXT_DIVUB[] PROGMEM;
-using common::TEXT_DJNZ;
-using common::TEXT_EI;
-using common::TEXT_EXT;
-using common::TEXT_EXTB;
-using common::TEXT_INC;
-using common::TEXT_INCB;
-using common::TEXT_JBC;
-extern const char TEXT_JBS[]   PROGMEM;
-using common::TEXT_JC;
-using common::TEXT_JE;
-using common::TEXT_JGE;
-using common::TEXT_JGT;
-using common::TEXT_JH;
-using common::TEXT_JLE;
-using common::TEXT_JLT;
-using common::TEXT_JNC;
-using common::TEXT_JNE;
-extern const char TEXT_JNH[]   PROGMEM;
-extern const char TEXT_JNST[]  PROGMEM;
-extern const char TEXT_JNV[]   PROGMEM;
-extern const char TEXT_JNVT[]  PROGMEM;
-extern const char TEXT_JST[]   PROGMEM;
-extern const char TEXT_JV[]    PROGMEM;
-extern const char TEXT_JVT[]   PROGMEM;
-using common::TEXT_LCALL;
-using common::TEXT_LD;
-using common::TEXT_LDB;
-extern const char TEXT_LDBSE[] PROGMEM;
-extern const char TEXT_LDBZE[] PROGMEM;
-using common::TEXT_LJMP;
-using common::TEXT_MUL;
-using common::TEXT_MULB;
-using common::TEXT_MULU;
-extern const char TEXT_MULUB[] PROGMEM;
-using common::TEXT_NEG;
-using common::TEXT_NEGB;
-using common::TEXT_NOP;
-extern const char TEXT_NORML[] PROGMEM;
-using common::TEXT_NOT;
-using common::TEXT_NOTB;
-using common::TEXT_OR;
-using common::TEXT_ORB;
-extern const char TEXT_ORG[]   PROGMEM;
-using common::TEXT_POP;
-using common::TEXT_POPF;
-using common::TEXT_PUSH;
-using common::TEXT_PUSHF;
-using common::TEXT_RET;
-using common::TEXT_RST;
-extern const char TEXT_SCALL[] PROGMEM;
-extern const char TEXT_SETC[]  PROGMEM;
-using common::TEXT_SHL;
-extern const char TEXT_SHLB[]  PROGMEM;
-extern const char TEXT_SHLL[]  PROGMEM;
-using common::TEXT_SHR;
-extern const char TEXT_SHRA[]  PROGMEM;
-extern const char TEXT_SHRAB[] PROGMEM;
-extern const char TEXT_SHRAL[] PROGMEM;
-extern const char TEXT_SHRB[]  PROGMEM;
-extern const char TEXT_SHRL[]  PROGMEM;
-using common::TEXT_SJMP;
-extern const char TEXT_SKIP[]  PROGMEM;
-using common::TEXT_ST;
-using common::TEXT_STB;
-using common::TEXT_SUB;
-using common::TEXT_SUBB;
-using common::TEXT_SUBC;
-using common::TEXT_SUBCB;
-using common::TEXT_TRAP;
-using common::TEXT_XOR;
-using common::TEXT_XORB;
+#define TEXT_I8096_LIST(T, A)  \
+    T(TEXT_CPU_I8096, "i8096") \
+    T(TEXT_CPU_8096,  "8096")  \
+    T(TEXT_ADD,       "ADD")   \
+    T(TEXT_ADDB,      "ADDB")  \
+    T(TEXT_ADDC,      "ADDC")  \
+    T(TEXT_ADDCB,     "ADDCB") \
+    T(TEXT_AND,       "AND")   \
+    T(TEXT_ANDB,      "ANDB")  \
+    T(TEXT_BR,        "BR")    \
+    T(TEXT_CLR,       "CLR")   \
+    T(TEXT_CLRB,      "CLRB")  \
+    T(TEXT_CLRC,      "CLRC")  \
+    T(TEXT_CLRVT,     "CLRVT") \
+    T(TEXT_CMP,       "CMP")   \
+    T(TEXT_CMPB,      "CMPB")  \
+    T(TEXT_CPU,       "CPU")   \
+    T(TEXT_DEC,       "DEC")   \
+    T(TEXT_DECB,      "DECB")  \
+    T(TEXT_DI,        "DI")    \
+    T(TEXT_DIV,       "DIV")   \
+    T(TEXT_DIVB,      "DIVB")  \
+    T(TEXT_DIVU,      "DIVU")  \
+    T(TEXT_DIVUB,     "DIVUB") \
+    T(TEXT_DJNZ,      "DJNZ")  \
+    T(TEXT_EI,        "EI")    \
+    T(TEXT_EXT,       "EXT")   \
+    T(TEXT_EXTB,      "EXTB")  \
+    T(TEXT_INC,       "INC")   \
+    T(TEXT_INCB,      "INCB")  \
+    T(TEXT_JBC,       "JBC")   \
+    T(TEXT_JBS,       "JBS")   \
+    T(TEXT_JC,        "JC")    \
+    T(TEXT_JE,        "JE")    \
+    T(TEXT_JGE,       "JGE")   \
+    T(TEXT_JGT,       "JGT")   \
+    T(TEXT_JH,        "JH")    \
+    T(TEXT_JLE,       "JLE")   \
+    T(TEXT_JLT,       "JLT")   \
+    T(TEXT_JNC,       "JNC")   \
+    T(TEXT_JNE,       "JNE")   \
+    T(TEXT_JNH,       "JNH")   \
+    T(TEXT_JNST,      "JNST")  \
+    T(TEXT_JNV,       "JNV")   \
+    T(TEXT_JNVT,      "JNVT")  \
+    T(TEXT_JST,       "JST")   \
+    T(TEXT_JV,        "JV")    \
+    T(TEXT_JVT,       "JVT")   \
+    T(TEXT_LCALL,     "LCALL") \
+    T(TEXT_LD,        "LD")    \
+    T(TEXT_LDB,       "LDB")   \
+    T(TEXT_LDBSE,     "LDBSE") \
+    T(TEXT_LDBZE,     "LDBZE") \
+    T(TEXT_LJMP,      "LJMP")  \
+    T(TEXT_MUL,       "MUL")   \
+    T(TEXT_MULB,      "MULB")  \
+    T(TEXT_MULU,      "MULU")  \
+    T(TEXT_MULUB,     "MULUB") \
+    T(TEXT_NEG,       "NEG")   \
+    T(TEXT_NEGB,      "NEGB")  \
+    T(TEXT_NOP,       "NOP")   \
+    T(TEXT_NORML,     "NORML") \
+    T(TEXT_NOT,       "NOT")   \
+    T(TEXT_NOTB,      "NOTB")  \
+    T(TEXT_OR,        "OR")    \
+    T(TEXT_ORB,       "ORB")   \
+    T(TEXT_ORG,       "ORG")   \
+    T(TEXT_POP,       "POP")   \
+    T(TEXT_POPF,      "POPF")  \
+    T(TEXT_PUSH,      "PUSH")  \
+    T(TEXT_PUSHF,     "PUSHF") \
+    T(TEXT_RET,       "RET")   \
+    T(TEXT_RST,       "RST")   \
+    T(TEXT_SCALL,     "SCALL") \
+    T(TEXT_SETC,      "SETC")  \
+    T(TEXT_SHL,       "SHL")   \
+    T(TEXT_SHLB,      "SHLB")  \
+    T(TEXT_SHLL,      "SHLL")  \
+    T(TEXT_SHR,       "SHR")   \
+    T(TEXT_SHRA,      "SHRA")  \
+    T(TEXT_SHRAB,     "SHRAB") \
+    T(TEXT_SHRAL,     "SHRAL") \
+    T(TEXT_SHRB,      "SHRB")  \
+    T(TEXT_SHRL,      "SHRL")  \
+    T(TEXT_SJMP,      "SJMP")  \
+    T(TEXT_SKIP,      "SKIP")  \
+    T(TEXT_ST,        "ST")    \
+    T(TEXT_STB,       "STB")   \
+    T(TEXT_SUB,       "SUB")   \
+    T(TEXT_SUBB,      "SUBB")  \
+    T(TEXT_SUBC,      "SUBC")  \
+    T(TEXT_SUBCB,     "SUBCB") \
+    T(TEXT_TRAP,      "TRAP")  \
+    T(TEXT_XOR,       "XOR")   \
+    T(TEXT_XORB,      "XORB")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_I8096_LIST);
+
 }  // namespace i8096
 }  // namespace text
 }  // namespace libasm
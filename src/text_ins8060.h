@@ -18,73 +18,74 @@
 #define __TEXT_INS8060__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace ins8060 {
 
 // clang-format off
-extern const char TEXT_CPU_SCMP[]    PROGMEM;
-extern const char TEXT_CPU_INS8060[] PROGMEM;
-
-using common::TEXT_null;
-
-using common::TEXT_ADD;
-extern const char TEXT_ADE[]  PROGMEM;
-using common::TEXT_ADI;
-using common::TEXT_AND;
-extern const char TEXT_ANE[]  PROGMEM;
-using common::TEXT_ANI;
-extern const char TEXT_CAD[]  PROGMEM;
-extern const char TEXT_CAE[]  PROGMEM;
-extern const char TEXT_CAI[]  PROGMEM;
-extern const char TEXT_CAS[]  PROGMEM;
-extern const char TEXT_CCL[]  PROGMEM;
-extern const char TEXT_CSA[]  PROGMEM;
-using common::TEXT_DAD;
-extern const char TEXT_DAE[]  PROGMEM;
-extern const char TEXT_DAI[]  PROGMEM;
-using common::TEXT_DINT;
-using common::TEXT_DLD;
-extern const char TEXT_DLY[]  PROGMEM;
-using common::TEXT_HALT;
-using common::TEXT_IDL;
-extern const char TEXT_IEN[]  PROGMEM;
-using common::TEXT_ILD;
-using common::TEXT_JMP;
-using common::TEXT_JNZ;
-using common::TEXT_JP;
-using common::TEXT_JZ;
-using common::TEXT_LD;
-using common::TEXT_LDE;
-using common::TEXT_LDI;
-using common::TEXT_NOP;
-using common::TEXT_OR;
-extern const char TEXT_ORE[]  PROGMEM;
-using common::TEXT_ORI;
-using common::TEXT_RR;
-using common::TEXT_RRL;
-extern const char TEXT_SCL[]  PROGMEM;
-extern const char TEXT_SIO[]  PROGMEM;
-using common::TEXT_SR;
-using common::TEXT_SRL;
-using common::TEXT_ST;
-extern const char TEXT_XAE[]  PROGMEM;
-using common::TEXT_XOR;
-extern const char TEXT_XPAH[] PROGMEM;
-extern const char TEXT_XPAL[] PROGMEM;
-extern const char TEXT_XPPC[] PROGMEM;
-extern const char TEXT_XRE[]  PROGMEM;
-using common::TEXT_XRI;
-
-using common::TEXT_REG_E;
-using common::TEXT_REG_P0;
-using common::TEXT_REG_P1;
-using common::TEXT_REG_P2;
-using common::TEXT_REG_P3;
-using common::TEXT_REG_PC;
+#define TEXT_INS8060_LIST(T, A)    \
+    T(TEXT_CPU_SCMP,    "SC/MP")   \
+    T(TEXT_CPU_INS8060, "INS8060") \
+    T(TEXT_null,        "")        \
+    T(TEXT_ADD,         "ADD")     \
+    T(TEXT_ADE,         "ADE")     \
+    T(TEXT_ADI,         "ADI")     \
+    T(TEXT_AND,         "AND")     \
+    T(TEXT_ANE,         "ANE")     \
+    T(TEXT_ANI,         "ANI")     \
+    T(TEXT_CAD,         "CAD")     \
+    T(TEXT_CAE,         "CAE")     \
+    T(TEXT_CAI,         "CAI")     \
+    T(TEXT_CAS,         "CAS")     \
+    T(TEXT_CCL,         "CCL")     \
+    T(TEXT_CSA,         "CSA")     \
+    T(TEXT_DAD,         "DAD")     \
+    T(TEXT_DAE,         "DAE")     \
+    T(TEXT_DAI,         "DAI")     \
+    T(TEXT_DINT,        "DINT")    \
+    T(TEXT_DLD,         "DLD")     \
+    T(TEXT_DLY,         "DLY")     \
+    T(TEXT_HALT,        "HALT")    \
+    T(TEXT_IDL,         "IDL")     \
+    T(TEXT_IEN,         "IEN")     \
+    T(TEXT_ILD,         "ILD")     \
+    T(TEXT_JMP,         "JMP")     \
+    T(TEXT_JNZ,         "JNZ")     \
+    T(TEXT_JP,          "JP")      \
+    T(TEXT_JZ,          "JZ")      \
+    T(TEXT_LD,          "LD")      \
+    T(TEXT_LDE,         "LDE")     \
+    T(TEXT_LDI,         "LDI")     \
+    T(TEXT_NOP,         "NOP")     \
+    T(TEXT_OR,          "OR")      \
+    T(TEXT_ORE,         "ORE")     \
+    T(TEXT_ORI,         "ORI")     \
+    T(TEXT_RR,          "RR")      \
+    T(TEXT_RRL,         "RRL")     \
+    T(TEXT_SCL,         "SCL")     \
+    T(TEXT_SIO,         "SIO")     \
+    T(TEXT_SR,          "SR")      \
+    T(TEXT_SRL,         "SRL")     \
+    T(TEXT_ST,          "ST")      \
+    T(TEXT_XAE,         "XAE")     \
+    T(TEXT_XOR,         "XOR")     \
+    T(TEXT_XPAH,        "XPAH")    \
+    T(TEXT_XPAL,        "XPAL")    \
+    T(TEXT_XPPC,        "XPPC")    \
+    T(TEXT_XRE,         "XRE")     \
+    T(TEXT_XRI,         "XRI")     \
+    T(TEXT_REG_E,       "E")       \
+    T(TEXT_REG_P0,      "P0")      \
+    T(TEXT_REG_P1,      "P1")      \
+    T(TEXT_REG_P2,      "P2")      \
+    T(TEXT_REG_P3,      "P3")      \
+    T(TEXT_REG_PC,      "PC")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_INS8060_LIST);
+
 }  // namespace ins8060
 }  // namespace text
 }  // namespace libasm
@@ -18,58 +18,60 @@
 #define __TEXT_INS8070__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace ins8070 {
 
 // clang-format off
-extern const char TEXT_CPU_INS8070[] PROGMEM;
-extern const char TEXT_CPU_8070[]    PROGMEM;
-
-using common::TEXT_ADD;
-using common::TEXT_AND;
-extern const char TEXT_BND[]  PROGMEM;
-using common::TEXT_BNZ;
-using common::TEXT_BP;
-using common::TEXT_BRA;
-using common::TEXT_BZ;
-using common::TEXT_CALL;
-using common::TEXT_DIV;
-using common::TEXT_DLD;
-using common::TEXT_ILD;
-using common::TEXT_JMP;
-using common::TEXT_JSR;
-using common::TEXT_LD;
-using common::TEXT_MPY;
-using common::TEXT_NOP;
-using common::TEXT_OR;
-extern const char TEXT_PLI[]  PROGMEM;
-using common::TEXT_POP;
-using common::TEXT_PUSH;
-using common::TEXT_RET;
-using common::TEXT_RRL;
-using common::TEXT_RR;
-using common::TEXT_SL;
-using common::TEXT_SRL;
-using common::TEXT_SR;
-extern const char TEXT_SSM[]  PROGMEM;
-using common::TEXT_ST;
-using common::TEXT_SUB;
-using common::TEXT_XCH;
-using common::TEXT_XOR;
-
-using common::TEXT_REG_A;
-using common::TEXT_REG_E;
-extern const char TEXT_REG_EA[] PROGMEM;
-using common::TEXT_REG_T;
-using common::TEXT_REG_S;
-using common::TEXT_REG_PC;
-using common::TEXT_REG_SP;
-using common::TEXT_REG_P2;
-using common::TEXT_REG_P3;
+#define TEXT_INS8070_LIST(T, A)    \
+    T(TEXT_CPU_INS8070, "INS8070") \
+    T(TEXT_CPU_8070,    "8070")    \
+    T(TEXT_ADD,         "ADD")     \
+    T(TEXT_AND,         "AND")     \
+    T(TEXT_BND,         "BND")     \
+    T(TEXT_BNZ,         "BNZ")     \
+    T(TEXT_BP,          "BP")      \
+    T(TEXT_BRA,         "BRA")     \
+    T(TEXT_BZ,          "BZ")      \
+    T(TEXT_CALL,        "CALL")    \
+    T(TEXT_DIV,         "DIV")     \
+    T(TEXT_DLD,         "DLD")     \
+    T(TEXT_ILD,         "ILD")     \
+    T(TEXT_JMP,         "JMP")     \
+    T(TEXT_JSR,         "JSR")     \
+    T(TEXT_LD,          "LD")      \
+    T(TEXT_MPY,         "MPY")     \
+    T(TEXT_NOP,         "NOP")     \
+    T(TEXT_OR,          "OR")      \
+    T(TEXT_PLI,         "PLI")     \
+    T(TEXT_POP,         "POP")     \
+    T(TEXT_PUSH,        "PUSH")    \
+    T(TEXT_RET,         "RET")     \
+    T(TEXT_RRL,         "RRL")     \
+    T(TEXT_RR,          "RR")      \
+    T(TEXT_SL,          "SL")      \
+    T(TEXT_SRL,         "SRL")     \
+    T(TEXT_SR,          "SR")      \
+    T(TEXT_SSM,         "SSM")     \
+    T(TEXT_ST,          "ST")      \
+    T(TEXT_SUB,         "SUB")     \
+    T(TEXT_XCH,         "XCH")     \
+    T(TEXT_XOR,         "XOR")     \
+    T(TEXT_REG_A,       "A")       \
+    T(TEXT_REG_E,       "E")       \
+    T(TEXT_REG_EA,      "EA")      \
+    T(TEXT_REG_T,       "T")       \
+    T(TEXT_REG_S,       "S")       \
+    T(TEXT_REG_PC,      "PC")      \
+    T(TEXT_REG_SP,      "SP")      \
+    T(TEXT_REG_P2,      "P2")      \
+    T(TEXT_REG_P3,      "P3")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_INS8070_LIST);
+
 }  // namespace ins8070
 }  // namespace text
 }  // namespace libasm
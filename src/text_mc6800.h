@@ -18,200 +18,199 @@
 #define __TEXT_MC6800__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace mc6800 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]  PROGMEM;
-extern const char TEXT_CPU_6800[]  PROGMEM;
-extern const char TEXT_CPU_6801[]  PROGMEM;
-extern const char TEXT_CPU_6301[]  PROGMEM;
-extern const char TEXT_CPU_6811[]  PROGMEM;
-extern const char TEXT_CPU_68HC11[] PROGMEM;
-extern const char TEXT_CPU_HD6301[] PROGMEM;
-extern const char TEXT_CPU_MB8861[] PROGMEM;
-
-// MC6800
-extern const char TEXT_ABA[]  PROGMEM;
-using common::TEXT_ADC;
-using common::TEXT_ADCA;
-using common::TEXT_ADCB;
-using common::TEXT_ADD;
-using common::TEXT_ADDA;
-using common::TEXT_ADDB;
-using common::TEXT_AND;
-using common::TEXT_ANDA;
-using common::TEXT_ANDB;
-using common::TEXT_ASL;
-using common::TEXT_ASLA;
-using common::TEXT_ASLB;
-using common::TEXT_ASR;
-using common::TEXT_ASRA;
-using common::TEXT_ASRB;
-using common::TEXT_BCC;
-using common::TEXT_BCS;
-using common::TEXT_BEQ;
-using common::TEXT_BGE;
-using common::TEXT_BGT;
-using common::TEXT_BHI;
-using common::TEXT_BHS;
-using common::TEXT_BIT;
-using common::TEXT_BITA;
-using common::TEXT_BITB;
-using common::TEXT_BLE;
-using common::TEXT_BLO;
-using common::TEXT_BLS;
-using common::TEXT_BLT;
-using common::TEXT_BMI;
-using common::TEXT_BNE;
-using common::TEXT_BPL;
-using common::TEXT_BRA;
-using common::TEXT_BSR;
-using common::TEXT_BVC;
-using common::TEXT_BVS;
-extern const char TEXT_CBA[]  PROGMEM;
-using common::TEXT_CLC;
-using common::TEXT_CLI;
-using common::TEXT_CLR;
-using common::TEXT_CLRA;
-using common::TEXT_CLRB;
-using common::TEXT_CLV;
-using common::TEXT_CMP;
-using common::TEXT_CMPA;
-using common::TEXT_CMPB;
-using common::TEXT_COM;
-using common::TEXT_COMA;
-using common::TEXT_COMB;
-using common::TEXT_CPX;
-using common::TEXT_DAA;
-using common::TEXT_DEC;
-using common::TEXT_DECA;
-using common::TEXT_DECB;
-extern const char TEXT_DES[]  PROGMEM;
-using common::TEXT_DEX;
-using common::TEXT_EOR;
-using common::TEXT_EORA;
-using common::TEXT_EORB;
-using common::TEXT_INC;
-using common::TEXT_INCA;
-using common::TEXT_INCB;
-using common::TEXT_INS;
-using common::TEXT_INX;
-using common::TEXT_JMP;
-using common::TEXT_JSR;
-using common::TEXT_LDA;
-extern const char TEXT_LDAA[] PROGMEM;
-extern const char TEXT_LDAB[] PROGMEM;
-using common::TEXT_LDS;
-using common::TEXT_LDX;
-using common::TEXT_LSL;
-using common::TEXT_LSLA;
-using common::TEXT_LSLB;
-using common::TEXT_LSR;
-using common::TEXT_LSRA;
-using common::TEXT_LSRB;
-using common::TEXT_NEG;
-using common::TEXT_NEGA;
-using common::TEXT_NEGB;
-using common::TEXT_NOP;
-using common::TEXT_ORA;
-extern const char TEXT_ORAA[] PROGMEM;
-extern const char TEXT_ORAB[] PROGMEM;
-extern const char TEXT_PSH[]  PROGMEM;
-extern const char TEXT_PSHA[] PROGMEM;
-extern const char TEXT_PSHB[] PROGMEM;
-extern const char TEXT_PUL[]  PROGMEM;
-extern const char TEXT_PULA[] PROGMEM;
-extern const char TEXT_PULB[] PROGMEM;
-using common::TEXT_ROL;
-using common::TEXT_ROLA;
-using common::TEXT_ROLB;
-using common::TEXT_ROR;
-using common::TEXT_RORA;
-using common::TEXT_RORB;
-using common::TEXT_RTI;
-using common::TEXT_RTS;
-extern const char TEXT_SBA[]  PROGMEM;
-using common::TEXT_SBC;
-using common::TEXT_SBCA;
-using common::TEXT_SBCB;
-using common::TEXT_SEC;
-using common::TEXT_SEI;
-extern const char TEXT_SEV[]  PROGMEM;
-using common::TEXT_STA;
-extern const char TEXT_STAA[] PROGMEM;
-extern const char TEXT_STAB[] PROGMEM;
-using common::TEXT_STS;
-using common::TEXT_STX;
-using common::TEXT_SUB;
-using common::TEXT_SUBA;
-using common::TEXT_SUBB;
-using common::TEXT_SWI;
-extern const char TEXT_TAB[]  PROGMEM;
-extern const char TEXT_TAP[]  PROGMEM;
-extern const char TEXT_TBA[]  PROGMEM;
-extern const char TEXT_TPA[]  PROGMEM;
-using common::TEXT_TST;
-using common::TEXT_TSTA;
-using common::TEXT_TSTB;
-using common::TEXT_TSX;
-using common::TEXT_TXS;
-using common::TEXT_WAI;
-
-// MB8861
-extern const char TEXT_ADX[] PROGMEM;
-extern const char TEXT_NIM[] PROGMEM;
-extern const char TEXT_TMM[] PROGMEM;
-extern const char TEXT_XIM[] PROGMEM;
-
-// MC6801
-using common::TEXT_ABX;
-using common::TEXT_ADDD;
-using common::TEXT_ASLD;
-using common::TEXT_BRN;
-using common::TEXT_LDD;
-using common::TEXT_LSLD;
-using common::TEXT_LSRD;
-using common::TEXT_MUL;
-using common::TEXT_STD;
-using common::TEXT_SUBD;
-extern const char TEXT_PSHX[] PROGMEM;
-extern const char TEXT_PULX[] PROGMEM;
-
-// HD6301
-using common::TEXT_AIM;
-using common::TEXT_BCLR;
-using common::TEXT_BSET;
-extern const char TEXT_BTGL[] PROGMEM;
-using common::TEXT_BTST;
-using common::TEXT_EIM;
-using common::TEXT_OIM;
-extern const char TEXT_SLP[]  PROGMEM;
-using common::TEXT_TIM;
-extern const char TEXT_XGDX[] PROGMEM;
-
-// MC68HC11
-extern const char TEXT_ABY[]   PROGMEM;
-using common::TEXT_BRCLR;
-using common::TEXT_BRSET;
-using common::TEXT_CPD;
-using common::TEXT_CPY;
-using common::TEXT_DEY;
-extern const char TEXT_FDIV[]  PROGMEM;
-using common::TEXT_IDIV;
-using common::TEXT_INY;
-using common::TEXT_LDY;
-extern const char TEXT_PSHY[]  PROGMEM;
-extern const char TEXT_PULY[]  PROGMEM;
-using common::TEXT_STOP;
-using common::TEXT_STY;
-extern const char TEXT_TSY[]   PROGMEM;
-extern const char TEXT_TYS[]   PROGMEM;
-extern const char TEXT_XGDY[]  PROGMEM;
+#define TEXT_MC6800_LIST(T, A)                                     \
+    T(TEXT_CPU_LIST,   "MC6800, MB8861, MC6801, HD6301, MC68HC11") \
+    T(TEXT_CPU_6800,   "6800")                                     \
+    T(TEXT_CPU_6801,   "6801")                                     \
+    T(TEXT_CPU_6301,   "6301")                                     \
+    T(TEXT_CPU_6811,   "6811")                                     \
+    T(TEXT_CPU_68HC11, "68HC11")                                   \
+    T(TEXT_CPU_HD6301, "HD6301")                                   \
+    T(TEXT_CPU_MB8861, "MB8861")                                   \
+    /* MC6800 */                                                   \
+    T(TEXT_ABA,        "ABA")                                      \
+    T(TEXT_ADC,        "ADC")                                      \
+    T(TEXT_ADCA,       "ADCA")                                     \
+    T(TEXT_ADCB,       "ADCB")                                     \
+    T(TEXT_ADD,        "ADD")                                      \
+    T(TEXT_ADDA,       "ADDA")                                     \
+    T(TEXT_ADDB,       "ADDB")                                     \
+    T(TEXT_AND,        "AND")                                      \
+    T(TEXT_ANDA,       "ANDA")                                     \
+    T(TEXT_ANDB,       "ANDB")                                     \
+    T(TEXT_ASL,        "ASL")                                      \
+    T(TEXT_ASLA,       "ASLA")                                     \
+    T(TEXT_ASLB,       "ASLB")                                     \
+    T(TEXT_ASR,        "ASR")                                      \
+    T(TEXT_ASRA,       "ASRA")                                     \
+    T(TEXT_ASRB,       "ASRB")                                     \
+    T(TEXT_BCC,        "BCC")                                      \
+    T(TEXT_BCS,        "BCS")                                      \
+    T(TEXT_BEQ,        "BEQ")                                      \
+    T(TEXT_BGE,        "BGE")                                      \
+    T(TEXT_BGT,        "BGT")                                      \
+    T(TEXT_BHI,        "BHI")                                      \
+    T(TEXT_BHS,        "BHS")                                      \
+    T(TEXT_BIT,        "BIT")                                      \
+    T(TEXT_BITA,       "BITA")                                     \
+    T(TEXT_BITB,       "BITB")                                     \
+    T(TEXT_BLE,        "BLE")                                      \
+    T(TEXT_BLO,        "BLO")                                      \
+    T(TEXT_BLS,        "BLS")                                      \
+    T(TEXT_BLT,        "BLT")                                      \
+    T(TEXT_BMI,        "BMI")                                      \
+    T(TEXT_BNE,        "BNE")                                      \
+    T(TEXT_BPL,        "BPL")                                      \
+    T(TEXT_BRA,        "BRA")                                      \
+    T(TEXT_BSR,        "BSR")                                      \
+    T(TEXT_BVC,        "BVC")                                      \
+    T(TEXT_BVS,        "BVS")                                      \
+    T(TEXT_CBA,        "CBA")                                      \
+    T(TEXT_CLC,        "CLC")                                      \
+    T(TEXT_CLI,        "CLI")                                      \
+    T(TEXT_CLR,        "CLR")                                      \
+    T(TEXT_CLRA,       "CLRA")                                     \
+    T(TEXT_CLRB,       "CLRB")                                     \
+    T(TEXT_CLV,        "CLV")                                      \
+    T(TEXT_CMP,        "CMP")                                      \
+    T(TEXT_CMPA,       "CMPA")                                     \
+    T(TEXT_CMPB,       "CMPB")                                     \
+    T(TEXT_COM,        "COM")                                      \
+    T(TEXT_COMA,       "COMA")                                     \
+    T(TEXT_COMB,       "COMB")                                     \
+    T(TEXT_CPX,        "CPX")                                      \
+    T(TEXT_DAA,        "DAA")                                      \
+    T(TEXT_DEC,        "DEC")                                      \
+    T(TEXT_DECA,       "DECA")                                     \
+    T(TEXT_DECB,       "DECB")                                     \
+    T(TEXT_DES,        "DES")                                      \
+    T(TEXT_DEX,        "DEX")                                      \
+    T(TEXT_EOR,        "EOR")                                      \
+    T(TEXT_EORA,       "EORA")                                     \
+    T(TEXT_EORB,       "EORB")                                     \
+    T(TEXT_INC,        "INC")                                      \
+    T(TEXT_INCA,       "INCA")                                     \
+    T(TEXT_INCB,       "INCB")                                     \
+    T(TEXT_INS,        "INS")                                      \
+    T(TEXT_INX,        "INX")                                      \
+    T(TEXT_JMP,        "JMP")                                      \
+    T(TEXT_JSR,        "JSR")                                      \
+    T(TEXT_LDA,        "LDA")                                      \
+    T(TEXT_LDAA,       "LDAA")                                     \
+    T(TEXT_LDAB,       "LDAB")                                     \
+    T(TEXT_LDS,        "LDS")                                      \
+    T(TEXT_LDX,        "LDX")                                      \
+    T(TEXT_LSL,        "LSL")                                      \
+    T(TEXT_LSLA,       "LSLA")                                     \
+    T(TEXT_LSLB,       "LSLB")                                     \
+    T(TEXT_LSR,        "LSR")                                      \
+    T(TEXT_LSRA,       "LSRA")                                     \
+    T(TEXT_LSRB,       "LSRB")                                     \
+    T(TEXT_NEG,        "NEG")                                      \
+    T(TEXT_NEGA,       "NEGA")                                     \
+    T(TEXT_NEGB,       "NEGB")                                     \
+    T(TEXT_NOP,        "NOP")                                      \
+    T(TEXT_ORA,        "ORA")                                      \
+    T(TEXT_ORAA,       "ORAA")                                     \
+    T(TEXT_ORAB,       "ORAB")                                     \
+    T(TEXT_PSH,        "PSH")                                      \
+    T(TEXT_PSHA,       "PSHA")                                     \
+    T(TEXT_PSHB,       "PSHB")                                     \
+    T(TEXT_PUL,        "PUL")                                      \
+    T(TEXT_PULA,       "PULA")                                     \
+    T(TEXT_PULB,       "PULB")                                     \
+    T(TEXT_ROL,        "ROL")                                      \
+    T(TEXT_ROLA,       "ROLA")                                     \
+    T(TEXT_ROLB,       "ROLB")                                     \
+    T(TEXT_ROR,        "ROR")                                      \
+    T(TEXT_RORA,       "RORA")                                     \
+    T(TEXT_RORB,       "RORB")                                     \
+    T(TEXT_RTI,        "RTI")                                      \
+    T(TEXT_RTS,        "RTS")                                      \
+    T(TEXT_SBA,        "SBA")                                      \
+    T(TEXT_SBC,        "SBC")                                      \
+    T(TEXT_SBCA,       "SBCA")                                     \
+    T(TEXT_SBCB,       "SBCB")                                     \
+    T(TEXT_SEC,        "SEC")                                      \
+    T(TEXT_SEI,        "SEI")                                      \
+    T(TEXT_SEV,        "SEV")                                      \
+    T(TEXT_STA,        "STA")                                      \
+    T(TEXT_STAA,       "STAA")                                     \
+    T(TEXT_STAB,       "STAB")                                     \
+    T(TEXT_STS,        "STS")                                      \
+    T(TEXT_STX,        "STX")                                      \
+    T(TEXT_SUB,        "SUB")                                      \
+    T(TEXT_SUBA,       "SUBA")                                     \
+    T(TEXT_SUBB,       "SUBB")                                     \
+    T(TEXT_SWI,        "SWI")                                      \
+    T(TEXT_TAB,        "TAB")                                      \
+    T(TEXT_TAP,        "TAP")                                      \
+    T(TEXT_TBA,        "TBA")                                      \
+    T(TEXT_TPA,        "TPA")                                      \
+    T(TEXT_TST,        "TST")                                      \
+    T(TEXT_TSTA,       "TSTA")                                     \
+    T(TEXT_TSTB,       "TSTB")                                     \
+    T(TEXT_TSX,        "TSX")                                      \
+    T(TEXT_TXS,        "TXS")                                      \
+    T(TEXT_WAI,        "WAI")                                      \
+    /* MB8861 */                                                   \
+    T(TEXT_ADX,        "ADX")                                      \
+    T(TEXT_NIM,        "NIM")                                      \
+    T(TEXT_TMM,        "TMM")                                      \
+    T(TEXT_XIM,        "XIM")                                      \
+    /* MC6801 */                                                   \
+    T(TEXT_ABX,        "ABX")                                      \
+    T(TEXT_ADDD,       "ADDD")                                     \
+    T(TEXT_ASLD,       "ASLD")                                     \
+    T(TEXT_BRN,        "BRN")                                      \
+    T(TEXT_LDD,        "LDD")                                      \
+    T(TEXT_LSLD,       "LSLD")                                     \
+    T(TEXT_LSRD,       "LSRD")                                     \
+    T(TEXT_MUL,        "MUL")                                      \
+    T(TEXT_STD,        "STD")                                      \
+    T(TEXT_SUBD,       "SUBD")                                     \
+    T(TEXT_PSHX,       "PSHX")                                     \
+    T(TEXT_PULX,       "PULX")                                     \
+    /* HD6301 */                                                   \
+    T(TEXT_AIM,        "AIM")                                      \
+    T(TEXT_BCLR,       "BCLR")                                     \
+    T(TEXT_BSET,       "BSET")                                     \
+    T(TEXT_BTGL,       "BTGL")                                     \
+    T(TEXT_BTST,       "BTST")                                     \
+    T(TEXT_EIM,        "EIM")                                      \
+    T(TEXT_OIM,        "OIM")                                      \
+    T(TEXT_SLP,        "SLP")                                      \
+    T(TEXT_TIM,        "TIM")                                      \
+    T(TEXT_XGDX,       "XGDX")                                     \
+    /* MC68HC11 */                                                 \
+    T(TEXT_ABY,        "ABY")                                      \
+    T(TEXT_BRCLR,      "BRCLR")                                    \
+    T(TEXT_BRSET,      "BRSET")                                    \
+    T(TEXT_CPD,        "CPD")                                      \
+    T(TEXT_CPY,        "CPY")                                      \
+    T(TEXT_DEY,        "DEY")                                      \
+    T(TEXT_FDIV,       "FDIV")                                     \
+    T(TEXT_IDIV,       "IDIV")                                     \
+    T(TEXT_INY,        "INY")                                      \
+    T(TEXT_LDY,        "LDY")                                      \
+    T(TEXT_PSHY,       "PSHY")                                     \
+    T(TEXT_PULY,       "PULY")                                     \
+    T(TEXT_STOP,       "STOP")                                     \
+    T(TEXT_STY,        "STY")                                      \
+    T(TEXT_TSY,        "TSY")                                      \
+    T(TEXT_TYS,        "TYS")                                      \
+    T(TEXT_XGDY,       "XGDY")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_MC6800_LIST);
+
 }  // namespace mc6800
 }  // namespace text
 }  // namespace libasm
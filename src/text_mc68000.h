@@ -18,164 +18,166 @@
 #define __TEXT_MC68000_H__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace mc68000 {
 
 // clang-format off
-extern const char TEXT_CPU_MC68000[] PROGMEM;
-extern const char TEXT_CPU_68000[]   PROGMEM;
-
-// MC68000 instructions
-extern const char TEXT_ABCD[]  PROGMEM;
-using common::TEXT_ADD;
-using common::TEXT_ADDA;
-using common::TEXT_ADDI;
-extern const char TEXT_ADDQ[]  PROGMEM;
-extern const char TEXT_ADDX[]  PROGMEM;
-using common::TEXT_AND;
-using common::TEXT_ANDI;
-using common::TEXT_ASL;
-using common::TEXT_ASR;
-using common::TEXT_BCC;
-extern const char TEXT_BCHG[]  PROGMEM;
-using common::TEXT_BCLR;
-using common::TEXT_BCS;
-using common::TEXT_BEQ;
-using common::TEXT_BGE;
-using common::TEXT_BGT;
-using common::TEXT_BHI;
-using common::TEXT_BHS;
-using common::TEXT_BLE;
-using common::TEXT_BLO;
-using common::TEXT_BLS;
-using common::TEXT_BLT;
-using common::TEXT_BMI;
-using common::TEXT_BNE;
-using common::TEXT_BPL;
-using common::TEXT_BRA;
-using common::TEXT_BSET;
-using common::TEXT_BSR;
-using common::TEXT_BT;
-using common::TEXT_BTST;
-using common::TEXT_BVC;
-using common::TEXT_BVS;
-extern const char TEXT_CHK[]   PROGMEM;
-using common::TEXT_CLR;
-using common::TEXT_CMP;
-using common::TEXT_CMPA;
-extern const char TEXT_CMPI[]  PROGMEM;
-extern const char TEXT_CMPM[]  PROGMEM;
-extern const char TEXT_DBCC[]  PROGMEM;
-extern const char TEXT_DBCS[]  PROGMEM;
-extern const char TEXT_DBEQ[]  PROGMEM;
-extern const char TEXT_DBF[]   PROGMEM;
-extern const char TEXT_DBGE[]  PROGMEM;
-extern const char TEXT_DBGT[]  PROGMEM;
-extern const char TEXT_DBHI[]  PROGMEM;
-extern const char TEXT_DBHS[]  PROGMEM;
-extern const char TEXT_DBLS[]  PROGMEM;
-extern const char TEXT_DBLE[]  PROGMEM;
-extern const char TEXT_DBLO[]  PROGMEM;
-extern const char TEXT_DBLT[]  PROGMEM;
-extern const char TEXT_DBMI[]  PROGMEM;
-extern const char TEXT_DBNE[]  PROGMEM;
-extern const char TEXT_DBPL[]  PROGMEM;
-extern const char TEXT_DBRA[]  PROGMEM;
-extern const char TEXT_DBT[]   PROGMEM;
-extern const char TEXT_DBVC[]  PROGMEM;
-extern const char TEXT_DBVS[]  PROGMEM;
-using common::TEXT_DIVS;
-using common::TEXT_DIVU;
-using common::TEXT_EOR;
-using common::TEXT_EORI;
-using common::TEXT_EXG;
-using common::TEXT_EXT;
-extern const char TEXT_ILLEG[] PROGMEM;
-using common::TEXT_JMP;
-using common::TEXT_JSR;
-using common::TEXT_LEA;
-extern const char TEXT_LINK[]  PROGMEM;
-using common::TEXT_LSL;
-using common::TEXT_LSR;
-extern const char TEXT_MOVE[]  PROGMEM;
-extern const char TEXT_MOVEA[] PROGMEM;
-extern const char TEXT_MOVEM[] PROGMEM;
-extern const char TEXT_MOVEP[] PROGMEM;
-extern const char TEXT_MOVEQ[] PROGMEM;
-extern const char TEXT_MULS[]  PROGMEM;
-using common::TEXT_MULU;
-extern const char TEXT_NBCD[]  PROGMEM;
-using common::TEXT_NEG;
-using common::TEXT_NEGX;
-using common::TEXT_NOP;
-using common::TEXT_NOT;
-using common::TEXT_OR;
-using common::TEXT_ORI;
-using common::TEXT_PEA;
-extern const char TEXT_RESET[] PROGMEM;
-using common::TEXT_ROL;
-using common::TEXT_ROR;
-extern const char TEXT_ROXL[]  PROGMEM;
-extern const char TEXT_ROXR[]  PROGMEM;
-extern const char TEXT_RTE[]   PROGMEM;
-extern const char TEXT_RTR[]   PROGMEM;
-using common::TEXT_RTS;
-using common::TEXT_SBCD;
-extern const char TEXT_SCC[]   PROGMEM;
-extern const char TEXT_SCS[]   PROGMEM;
-using common::TEXT_SEQ;
-extern const char TEXT_SF[]    PROGMEM;
-extern const char TEXT_SGE[]   PROGMEM;
-extern const char TEXT_SGT[]   PROGMEM;
-extern const char TEXT_SHI[]   PROGMEM;
-extern const char TEXT_SHS[]   PROGMEM;
-extern const char TEXT_SLE[]   PROGMEM;
-extern const char TEXT_SLO[]   PROGMEM;
-extern const char TEXT_SLS[]   PROGMEM;
-extern const char TEXT_SLT[]   PROGMEM;
-using common::TEXT_SMI;
-extern const char TEXT_SNE[]   PROGMEM;
-extern const char TEXT_SPL[]   PROGMEM;
-using common::TEXT_ST;
-using common::TEXT_STOP;
-using common::TEXT_SUB;
-using common::TEXT_SUBA;
-using common::TEXT_SUBI;
-extern const char TEXT_SUBQ[]  PROGMEM;
-extern const char TEXT_SUBX[]  PROGMEM;
-using common::TEXT_SVC;
-extern const char TEXT_SVS[]   PROGMEM;
-using common::TEXT_SWAP;
-extern const char TEXT_TAS[]   PROGMEM;
-using common::TEXT_TRAP;
-extern const char TEXT_TRAPV[] PROGMEM;
-using common::TEXT_TST;
-extern const char TEXT_UNLK[]  PROGMEM;
-
-extern const char TEXT_REG_D0[] PROGMEM;
-extern const char TEXT_REG_D1[] PROGMEM;
-extern const char TEXT_REG_D2[] PROGMEM;
-extern const char TEXT_REG_D3[] PROGMEM;
-extern const char TEXT_REG_D4[] PROGMEM;
-extern const char TEXT_REG_D5[] PROGMEM;
-extern const char TEXT_REG_D6[] PROGMEM;
-extern const char TEXT_REG_D7[] PROGMEM;
-extern const char TEXT_REG_A0[] PROGMEM;
-extern const char TEXT_REG_A1[] PROGMEM;
-extern const char TEXT_REG_A2[] PROGMEM;
-extern const char TEXT_REG_A3[] PROGMEM;
-extern const char TEXT_REG_A4[] PROGMEM;
-extern const char TEXT_REG_A5[] PROGMEM;
-extern const char TEXT_REG_A6[] PROGMEM;
-extern const char TEXT_REG_A7[] PROGMEM;
-using common::TEXT_REG_PC;
-extern const char TEXT_REG_SR[] PROGMEM;
-extern const char TEXT_REG_CCR[] PROGMEM;
-extern const char TEXT_REG_USP[] PROGMEM;
+#define TEXT_MC68000_LIST(T, A)    \
+    T(TEXT_CPU_MC68000, "MC68000") \
+    T(TEXT_CPU_68000,   "68000")   \
+    /* MC68000 instructions */     \
+    T(TEXT_ABCD,        "ABCD")    \
+    T(TEXT_ADD,         "ADD")     \
+    T(TEXT_ADDA,        "ADDA")    \
+    T(TEXT_ADDI,        "ADDI")    \
+    T(TEXT_ADDQ,        "ADDQ")    \
+    T(TEXT_ADDX,        "ADDX")    \
+    T(TEXT_AND,         "AND")     \
+    T(TEXT_ANDI,        "ANDI")    \
+    T(TEXT_ASL,         "ASL")     \
+    T(TEXT_ASR,         "ASR")     \
+    T(TEXT_BCC,         "BCC")     \
+    T(TEXT_BCHG,        "BCHG")    \
+    T(TEXT_BCLR,        "BCLR")    \
+    T(TEXT_BCS,         "BCS")     \
+    T(TEXT_BEQ,         "BEQ")     \
+    T(TEXT_BGE,         "BGE")     \
+    T(TEXT_BGT,         "BGT")     \
+    T(TEXT_BHI,         "BHI")     \
+    T(TEXT_BHS,         "BHS")     \
+    T(TEXT_BLE,         "BLE")     \
+    T(TEXT_BLO,         "BLO")     \
+    T(TEXT_BLS,         "BLS")     \
+    T(TEXT_BLT,         "BLT")     \
+    T(TEXT_BMI,         "BMI")     \
+    T(TEXT_BNE,         "BNE")     \
+    T(TEXT_BPL,         "BPL")     \
+    T(TEXT_BRA,         "BRA")     \
+    T(TEXT_BSET,        "BSET")    \
+    T(TEXT_BSR,         "BSR")     \
+    T(TEXT_BT,          "BT")      \
+    T(TEXT_BTST,        "BTST")    \
+    T(TEXT_BVC,         "BVC")     \
+    T(TEXT_BVS,         "BVS")     \
+    T(TEXT_CHK,         "CHK")     \
+    T(TEXT_CLR,         "CLR")     \
+    T(TEXT_CMP,         "CMP")     \
+    T(TEXT_CMPA,        "CMPA")    \
+    T(TEXT_CMPI,        "CMPI")    \
+    T(TEXT_CMPM,        "CMPM")    \
+    T(TEXT_DBCC,        "DBCC")    \
+    T(TEXT_DBCS,        "DBCS")    \
+    T(TEXT_DBEQ,        "DBEQ")    \
+    T(TEXT_DBF,         "DBF")     \
+    T(TEXT_DBGE,        "DBGE")    \
+    T(TEXT_DBGT,        "DBGT")    \
+    T(TEXT_DBHI,        "DBHI")    \
+    T(TEXT_DBHS,        "DBHS")    \
+    T(TEXT_DBLS,        "DBLS")    \
+    T(TEXT_DBLE,        "DBLE")    \
+    T(TEXT_DBLO,        "DBLO")    \
+    T(TEXT_DBLT,        "DBLT")    \
+    T(TEXT_DBMI,        "DBMI")    \
+    T(TEXT_DBNE,        "DBNE")    \
+    T(TEXT_DBPL,        "DBPL")    \
+    T(TEXT_DBRA,        "DBRA")    \
+    T(TEXT_DBT,         "DBT")     \
+    T(TEXT_DBVC,        "DBVC")    \
+    T(TEXT_DBVS,        "DBVS")    \
+    T(TEXT_DIVS,        "DIVS")    \
+    T(TEXT_DIVU,        "DIVU")    \
+    T(TEXT_EOR,         "EOR")     \
+    T(TEXT_EORI,        "EORI")    \
+    T(TEXT_EXG,         "EXG")     \
+    T(TEXT_EXT,         "EXT")     \
+    T(TEXT_ILLEG,       "ILLEGAL") \
+    T(TEXT_JMP,         "JMP")     \
+    T(TEXT_JSR,         "JSR")     \
+    T(TEXT_LEA,         "LEA")     \
+    T(TEXT_LINK,        "LINK")    \
+    T(TEXT_LSL,         "LSL")     \
+    T(TEXT_LSR,         "LSR")     \
+    T(TEXT_MOVE,        "MOVE")    \
+    T(TEXT_MOVEA,       "MOVEA")   \
+    T(TEXT_MOVEM,       "MOVEM")   \
+    T(TEXT_MOVEP,       "MOVEP")   \
+    T(TEXT_MOVEQ,       "MOVEQ")   \
+    T(TEXT_MULS,        "MULS")    \
+    T(TEXT_MULU,        "MULU")    \
+    T(TEXT_NBCD,        "NBCD")    \
+    T(TEXT_NEG,         "NEG")     \
+    T(TEXT_NEGX,        "NEGX")    \
+    T(TEXT_NOP,         "NOP")     \
+    T(TEXT_NOT,         "NOT")     \
+    T(TEXT_OR,          "OR")      \
+    T(TEXT_ORI,         "ORI")     \
+    T(TEXT_PEA,         "PEA")     \
+    T(TEXT_RESET,       "RESET")   \
+    T(TEXT_ROL,         "ROL")     \
+    T(TEXT_ROR,         "ROR")     \
+    T(TEXT_ROXL,        "ROXL")    \
+    T(TEXT_ROXR,        "ROXR")    \
+    T(TEXT_RTE,         "RTE")     \
+    T(TEXT_RTR,         "RTR")     \
+    T(TEXT_RTS,         "RTS")     \
+    T(TEXT_SBCD,        "SBCD")    \
+    T(TEXT_SCC,         "SCC")     \
+    T(TEXT_SCS,         "SCS")     \
+    T(TEXT_SEQ,         "SEQ")     \
+    T(TEXT_SF,          "SF")      \
+    T(TEXT_SGE,         "SGE")     \
+    T(TEXT_SGT,         "SGT")     \
+    T(TEXT_SHI,         "SHI")     \
+    T(TEXT_SHS,         "SHS")     \
+    T(TEXT_SLE,         "SLE")     \
+    T(TEXT_SLO,         "SLO")     \
+    T(TEXT_SLS,         "SLS")     \
+    T(TEXT_SLT,         "SLT")     \
+    T(TEXT_SMI,         "SMI")     \
+    T(TEXT_SNE,         "SNE")     \
+    T(TEXT_SPL,         "SPL")     \
+    T(TEXT_ST,          "ST")      \
+    T(TEXT_STOP,        "STOP")    \
+    T(TEXT_SUB,         "SUB")     \
+    T(TEXT_SUBA,        "SUBA")    \
+    T(TEXT_SUBI,        "SUBI")    \
+    T(TEXT_SUBQ,        "SUBQ")    \
+    T(TEXT_SUBX,        "SUBX")    \
+    T(TEXT_SVC,         "SVC")     \
+    T(TEXT_SVS,         "SVS")     \
+    T(TEXT_SWAP,        "SWAP")    \
+    T(TEXT_TAS,         "TAS")     \
+    T(TEXT_TRAP,        "TRAP")    \
+    T(TEXT_TRAPV,       "TRAPV")   \
+    T(TEXT_TST,         "TST")     \
+    T(TEXT_UNLK,        "UNLK")    \
+    T(TEXT_REG_D0,      "D0")      \
+    T(TEXT_REG_D1,      "D1")      \
+    T(TEXT_REG_D2,      "D2")      \
+    T(TEXT_REG_D3,      "D3")      \
+    T(TEXT_REG_D4,      "D4")      \
+    T(TEXT_REG_D5,      "D5")      \
+    T(TEXT_REG_D6,      "D6")      \
+    T(TEXT_REG_D7,      "D7")      \
+    T(TEXT_REG_A0,      "A0")      \
+    T(TEXT_REG_A1,      "A1")      \
+    T(TEXT_REG_A2,      "A2")      \
+    T(TEXT_REG_A3,      "A3")      \
+    T(TEXT_REG_A4,      "A4")      \
+    T(TEXT_REG_A5,      "A5")      \
+    T(TEXT_REG_A6,      "A6")      \
+    T(TEXT_REG_A7,      "A7")      \
+    T(TEXT_REG_PC,      "PC")      \
+    T(TEXT_REG_SR,      "SR")      \
+    T(TEXT_REG_CCR,     "CCR")     \
+    T(TEXT_REG_USP,     "USP")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_MC68000_LIST);
+
 }  // namespace mc68000
 }  // namespace text
 }  // namespace libasm
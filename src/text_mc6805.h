@@ -18,108 +18,111 @@
 #define __TEXT_MC6805__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace mc6805 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[] PROGMEM;
-extern const char TEXT_CPU_6805[] PROGMEM;
-extern const char TEXT_CPU_146805[] PROGMEM;
-extern const char TEXT_CPU_68HC05[] PROGMEM;
-
-using common::TEXT_ADC;
-using common::TEXT_ADD;
-using common::TEXT_AND;
-using common::TEXT_ASR;
-using common::TEXT_ASRA;
-extern const char TEXT_ASRX[] PROGMEM;
-using common::TEXT_ASL;
-using common::TEXT_ASLA;
-extern const char TEXT_ASLX[] PROGMEM;
-using common::TEXT_BCC;
-using common::TEXT_BCLR;
-using common::TEXT_BCS;
-using common::TEXT_BEQ;
-extern const char TEXT_BHCC[] PROGMEM;
-extern const char TEXT_BHCS[] PROGMEM;
-using common::TEXT_BHI;
-using common::TEXT_BHS;
-extern const char TEXT_BIH[]  PROGMEM;
-extern const char TEXT_BIL[]  PROGMEM;
-using common::TEXT_BIT;
-using common::TEXT_BLO;
-using common::TEXT_BLS;
-extern const char TEXT_BMC[]  PROGMEM;
-using common::TEXT_BMI;
-extern const char TEXT_BMS[]  PROGMEM;
-using common::TEXT_BNE;
-using common::TEXT_BPL;
-using common::TEXT_BRA;
-using common::TEXT_BRCLR;
-using common::TEXT_BRN;
-using common::TEXT_BRSET;
-using common::TEXT_BSET;
-using common::TEXT_BSR;
-using common::TEXT_CLC;
-using common::TEXT_CLI;
-using common::TEXT_CLR;
-using common::TEXT_CLRA;
-extern const char TEXT_CLRX[] PROGMEM;
-using common::TEXT_CMP;
-using common::TEXT_COM;
-using common::TEXT_COMA;
-extern const char TEXT_COMX[] PROGMEM;
-using common::TEXT_CPX;
-using common::TEXT_DEC;
-using common::TEXT_DECA;
-using common::TEXT_DECX;
-using common::TEXT_EOR;
-using common::TEXT_INC;
-using common::TEXT_INCA;
-using common::TEXT_INCX;
-using common::TEXT_JMP;
-using common::TEXT_JSR;
-using common::TEXT_LDA;
-using common::TEXT_LDX;
-using common::TEXT_LSL;
-using common::TEXT_LSLA;
-extern const char TEXT_LSLX[] PROGMEM;
-using common::TEXT_LSR;
-using common::TEXT_LSRA;
-extern const char TEXT_LSRX[] PROGMEM;
-using common::TEXT_MUL;
-using common::TEXT_NEG;
-using common::TEXT_NEGA;
-using common::TEXT_NEGX;
-using common::TEXT_NOP;
-using common::TEXT_ORA;
-using common::TEXT_ROL;
-using common::TEXT_ROLA;
-extern const char TEXT_ROLX[] PROGMEM;
-using common::TEXT_ROR;
-using common::TEXT_RORA;
-extern const char TEXT_RORX[] PROGMEM;
-extern const char TEXT_RSP[]  PROGMEM;
-using common::TEXT_RTI;
-using common::TEXT_RTS;
-using common::TEXT_SBC;
-using common::TEXT_SEC;
-using common::TEXT_SEI;
-using common::TEXT_STA;
-using common::TEXT_STOP;
-using common::TEXT_STX;
-using common::TEXT_SUB;
-using common::TEXT_SWI;
-using common::TEXT_TAX;
-using common::TEXT_TST;
-using common::TEXT_TSTA;
-extern const char TEXT_TSTX[] PROGMEM;
-using common::TEXT_TXA;
-using common::TEXT_WAIT;
+#define TEXT_MC6805_LIST(T, A)                       \
+    T(TEXT_CPU_LIST,   "MC6805, MC146805, MC68HC05") \
+    T(TEXT_CPU_6805,   "6805")                       \
+    T(TEXT_CPU_146805, "146805")                     \
+    T(TEXT_CPU_68HC05, "68HC05")                     \
+    T(TEXT_ADC,        "ADC")                        \
+    T(TEXT_ADD,        "ADD")                        \
+    T(TEXT_AND,        "AND")                        \
+    T(TEXT_ASR,        "ASR")                        \
+    T(TEXT_ASRA,       "ASRA")                       \
+    T(TEXT_ASRX,       "ASRX")                       \
+    T(TEXT_ASL,        "ASL")                        \
+    T(TEXT_ASLA,       "ASLA")                       \
+    T(TEXT_ASLX,       "ASLX")                       \
+    T(TEXT_BCC,        "BCC")                        \
+    T(TEXT_BCLR,       "BCLR")                       \
+    T(TEXT_BCS,        "BCS")                        \
+    T(TEXT_BEQ,        "BEQ")                        \
+    T(TEXT_BHCC,       "BHCC")                       \
+    T(TEXT_BHCS,       "BHCS")                       \
+    T(TEXT_BHI,        "BHI")                        \
+    T(TEXT_BHS,        "BHS")                        \
+    T(TEXT_BIH,        "BIH")                        \
+    T(TEXT_BIL,        "BIL")                        \
+    T(TEXT_BIT,        "BIT")                        \
+    T(TEXT_BLO,        "BLO")                        \
+    T(TEXT_BLS,        "BLS")                        \
+    T(TEXT_BMC,        "BMC")                        \
+    T(TEXT_BMI,        "BMI")                        \
+    T(TEXT_BMS,        "BMS")                        \
+    T(TEXT_BNE,        "BNE")                        \
+    T(TEXT_BPL,        "BPL")                        \
+    T(TEXT_BRA,        "BRA")                        \
+    T(TEXT_BRCLR,      "BRCLR")                      \
+    T(TEXT_BRN,        "BRN")                        \
+    T(TEXT_BRSET,      "BRSET")                      \
+    T(TEXT_BSET,       "BSET")                       \
+    T(TEXT_BSR,        "BSR")                        \
+    T(TEXT_CLC,        "CLC")                        \
+    T(TEXT_CLI,        "CLI")                        \
+    T(TEXT_CLR,        "CLR")                        \
+    T(TEXT_CLRA,       "CLRA")                       \
+    T(TEXT_CLRX,       "CLRX")                       \
+    T(TEXT_CMP,        "CMP")                        \
+    T(TEXT_COM,        "COM")                        \
+    T(TEXT_COMA,       "COMA")                       \
+    T(TEXT_COMX,       "COMX")                       \
+    T(TEXT_CPX,        "CPX")                        \
+    T(TEXT_DEC,        "DEC")                        \
+    T(TEXT_DECA,       "DECA")                       \
+    T(TEXT_DECX,       "DECX")                       \
+    T(TEXT_EOR,        "EOR")                        \
+    T(TEXT_INC,        "INC")                        \
+    T(TEXT_INCA,       "INCA")                       \
+    T(TEXT_INCX,       "INCX")                       \
+    T(TEXT_JMP,        "JMP")                        \
+    T(TEXT_JSR,        "JSR")                        \
+    T(TEXT_LDA,        "LDA")                        \
+    T(TEXT_LDX,        "LDX")                        \
+    T(TEXT_LSL,        "LSL")                        \
+    T(TEXT_LSLA,       "LSLA")                       \
+    T(TEXT_LSLX,       "LSLX")                       \
+    T(TEXT_LSR,        "LSR")                        \
+    T(TEXT_LSRA,       "LSRA")                       \
+    T(TEXT_LSRX,       "LSRX")                       \
+    T(TEXT_MUL,        "MUL")                        \
+    T(TEXT_NEG,        "NEG")                        \
+    T(TEXT_NEGA,       "NEGA")                       \
+    T(TEXT_NEGX,       "NEGX")                       \
+    T(TEXT_NOP,        "NOP")                        \
+    T(TEXT_ORA,        "ORA")                        \
+    T(TEXT_ROL,        "ROL")                        \
+    T(TEXT_ROLA,       "ROLA")                       \
+    T(TEXT_ROLX,       "ROLX")                       \
+    T(TEXT_ROR,        "ROR")                        \
+    T(TEXT_RORA,       "RORA")                       \
+    T(TEXT_RORX,       "RORX")                       \
+    T(TEXT_RSP,        "RSP")                        \
+    T(TEXT_RTI,        "RTI")                        \
+    T(TEXT_RTS,        "RTS")                        \
+    T(TEXT_SBC,        "SBC")                        \
+    T(TEXT_SEC,        "SEC")                        \
+    T(TEXT_SEI,        "SEI")                        \
+    T(TEXT_STA,        "STA")                        \
+    T(TEXT_STOP,       "STOP")                       \
+    T(TEXT_STX,        "STX")                        \
+    T(TEXT_SUB,        "SUB")                        \
+    T(TEXT_SWI,        "SWI")                        \
+    T(TEXT_TAX,        "TAX")                        \
+    T(TEXT_TST,        "TST")                        \
+    T(TEXT_TSTA,       "TSTA")                       \
+    T(TEXT_TSTX,       "TSTX")                       \
+    T(TEXT_TXA,        "TXA")                        \
+    T(TEXT_WAIT,       "WAIT")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_MC6805_LIST);
+
 }  // namespace mc6805
 }  // namespace text
 }  // namespace libasm
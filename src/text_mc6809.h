@@ -18,264 +18,264 @@
 #define __TEXT_MC6809_H__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace mc6809 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]   PROGMEM;
-extern const char TEXT_CPU_MC6809[] PROGMEM;
-extern const char TEXT_CPU_HD6309[] PROGMEM;
-extern const char TEXT_CPU_6809[]   PROGMEM;
-extern const char TEXT_CPU_6309[]   PROGMEM;
-
-using common::TEXT_ABX;
-using common::TEXT_ADCA;
-using common::TEXT_ADCB;
-using common::TEXT_ADDA;
-using common::TEXT_ADDB;
-using common::TEXT_ADDD;
-using common::TEXT_ANDA;
-using common::TEXT_ANDB;
-extern const char TEXT_ANDCC[] PROGMEM;
-using common::TEXT_ASLA;
-using common::TEXT_ASLB;
-using common::TEXT_ASL;
-using common::TEXT_ASRA;
-using common::TEXT_ASRB;
-using common::TEXT_ASR;
-using common::TEXT_BCC;
-using common::TEXT_BCS;
-using common::TEXT_BEQ;
-using common::TEXT_BGE;
-using common::TEXT_BGT;
-using common::TEXT_BHI;
-using common::TEXT_BHS;
-using common::TEXT_BITA;
-using common::TEXT_BITB;
-using common::TEXT_BLE;
-using common::TEXT_BLO;
-using common::TEXT_BLS;
-using common::TEXT_BLT;
-using common::TEXT_BMI;
-using common::TEXT_BNE;
-using common::TEXT_BPL;
-using common::TEXT_BRA;
-using common::TEXT_BRN;
-using common::TEXT_BSR;
-using common::TEXT_BVC;
-using common::TEXT_BVS;
-using common::TEXT_CLRA;
-using common::TEXT_CLRB;
-using common::TEXT_CLR;
-using common::TEXT_CMPA;
-using common::TEXT_CMPB;
-using common::TEXT_CMPD;
-using common::TEXT_CMPS;
-extern const char TEXT_CMPU[]  PROGMEM;
-extern const char TEXT_CMPX[]  PROGMEM;
-extern const char TEXT_CMPY[]  PROGMEM;
-using common::TEXT_COMA;
-using common::TEXT_COMB;
-using common::TEXT_COM;
-extern const char TEXT_CWAI[]  PROGMEM;
-using common::TEXT_DAA;
-using common::TEXT_DECA;
-using common::TEXT_DECB;
-using common::TEXT_DEC;
-using common::TEXT_EORA;
-using common::TEXT_EORB;
-using common::TEXT_EXG;
-using common::TEXT_INCA;
-using common::TEXT_INCB;
-using common::TEXT_INC;
-using common::TEXT_JMP;
-using common::TEXT_JSR;
-extern const char TEXT_LBCC[]  PROGMEM;
-extern const char TEXT_LBCS[]  PROGMEM;
-extern const char TEXT_LBEQ[]  PROGMEM;
-using common::TEXT_LBGE;
-extern const char TEXT_LBGT[]  PROGMEM;
-extern const char TEXT_LBHI[]  PROGMEM;
-extern const char TEXT_LBHS[]  PROGMEM;
-extern const char TEXT_LBLE[]  PROGMEM;
-extern const char TEXT_LBLO[]  PROGMEM;
-extern const char TEXT_LBLS[]  PROGMEM;
-extern const char TEXT_LBLT[]  PROGMEM;
-extern const char TEXT_LBMI[]  PROGMEM;
-extern const char TEXT_LBNE[]  PROGMEM;
-extern const char TEXT_LBPL[]  PROGMEM;
-extern const char TEXT_LBRA[]  PROGMEM;
-extern const char TEXT_LBRN[]  PROGMEM;
-extern const char TEXT_LBSR[]  PROGMEM;
-extern const char TEXT_LBVC[]  PROGMEM;
-extern const char TEXT_LBVS[]  PROGMEM;
-using common::TEXT_LDA;
-using common::TEXT_LDB;
-using common::TEXT_LDD;
-using common::TEXT_LDS;
-extern const char TEXT_LDU[]   PROGMEM;
-using common::TEXT_LDX;
-using common::TEXT_LDY;
-extern const char TEXT_LEAS[]  PROGMEM;
-extern const char TEXT_LEAU[]  PROGMEM;
-extern const char TEXT_LEAX[]  PROGMEM;
-extern const char TEXT_LEAY[]  PROGMEM;
-using common::TEXT_LSLA;
-using common::TEXT_LSLB;
-using common::TEXT_LSL;
-using common::TEXT_LSRA;
-using common::TEXT_LSRB;
-using common::TEXT_LSR;
-using common::TEXT_MUL;
-using common::TEXT_NEGA;
-using common::TEXT_NEGB;
-using common::TEXT_NEG;
-using common::TEXT_NOP;
-using common::TEXT_ORA;
-using common::TEXT_ORB;
-extern const char TEXT_ORCC[]  PROGMEM;
-extern const char TEXT_PSHS[]  PROGMEM;
-extern const char TEXT_PSHU[]  PROGMEM;
-extern const char TEXT_PULS[]  PROGMEM;
-extern const char TEXT_PULU[]  PROGMEM;
-using common::TEXT_ROLA;
-using common::TEXT_ROLB;
-using common::TEXT_ROL;
-using common::TEXT_RORA;
-using common::TEXT_RORB;
-using common::TEXT_ROR;
-using common::TEXT_RTI;
-using common::TEXT_RTS;
-using common::TEXT_SBCA;
-using common::TEXT_SBCB;
-using common::TEXT_SEX;
-using common::TEXT_STA;
-using common::TEXT_STB;
-using common::TEXT_STD;
-using common::TEXT_STS;
-extern const char TEXT_STU[]   PROGMEM;
-using common::TEXT_STX;
-using common::TEXT_STY;
-using common::TEXT_SUBA;
-using common::TEXT_SUBB;
-using common::TEXT_SUBD;
-extern const char TEXT_SWI2[]  PROGMEM;
-extern const char TEXT_SWI3[]  PROGMEM;
-using common::TEXT_SWI;
-extern const char TEXT_SYNC[]  PROGMEM;
-extern const char TEXT_TFR[]   PROGMEM;
-using common::TEXT_TSTA;
-using common::TEXT_TSTB;
-using common::TEXT_TST;
-
-// HD6309
-
-extern const char TEXT_ADCD[]  PROGMEM;
-extern const char TEXT_ADCR[]  PROGMEM;
-extern const char TEXT_ADDE[]  PROGMEM;
-using common::TEXT_ADDF;
-using common::TEXT_ADDR;
-using common::TEXT_ADDW;
-using common::TEXT_AIM;
-using common::TEXT_ANDD;
-using common::TEXT_ANDR;
-using common::TEXT_ASLD;
-extern const char TEXT_ASRD[]  PROGMEM;
-using common::TEXT_BAND;
-extern const char TEXT_BEOR[]  PROGMEM;
-extern const char TEXT_BIAND[] PROGMEM;
-extern const char TEXT_BIEOR[] PROGMEM;
-extern const char TEXT_BIOR[]  PROGMEM;
-extern const char TEXT_BITD[]  PROGMEM;
-extern const char TEXT_BITMD[] PROGMEM;
-using common::TEXT_BOR;
-extern const char TEXT_CLRD[]  PROGMEM;
-extern const char TEXT_CLRE[]  PROGMEM;
-extern const char TEXT_CLRF[]  PROGMEM;
-extern const char TEXT_CLRW[]  PROGMEM;
-extern const char TEXT_CMPE[]  PROGMEM;
-using common::TEXT_CMPF;
-extern const char TEXT_CMPR[]  PROGMEM;
-using common::TEXT_CMPW;
-using common::TEXT_COMD;
-extern const char TEXT_COME[]  PROGMEM;
-extern const char TEXT_COMF[]  PROGMEM;
-using common::TEXT_COMW;
-extern const char TEXT_DECD[]  PROGMEM;
-extern const char TEXT_DECE[]  PROGMEM;
-extern const char TEXT_DECF[]  PROGMEM;
-using common::TEXT_DECW;
-using common::TEXT_DIVD;
-extern const char TEXT_DIVQ[]  PROGMEM;
-using common::TEXT_EIM;
-extern const char TEXT_EORD[]  PROGMEM;
-using common::TEXT_EORR;
-extern const char TEXT_INCD[]  PROGMEM;
-extern const char TEXT_INCE[]  PROGMEM;
-extern const char TEXT_INCF[]  PROGMEM;
-using common::TEXT_INCW;
-extern const char TEXT_LDBT[]  PROGMEM;
-using common::TEXT_LDE;
-extern const char TEXT_LDF[]   PROGMEM;
-extern const char TEXT_LDMD[]  PROGMEM;
-extern const char TEXT_LDQ[]   PROGMEM;
-using common::TEXT_LDW;
-using common::TEXT_LSLD;
-using common::TEXT_LSRD;
-extern const char TEXT_LSRW[]  PROGMEM;
-using common::TEXT_MULD;
-using common::TEXT_NEGD;
-using common::TEXT_OIM;
-using common::TEXT_ORD;
-using common::TEXT_ORR;
-extern const char TEXT_PSHSW[] PROGMEM;
-extern const char TEXT_PSHUW[] PROGMEM;
-extern const char TEXT_PULSW[] PROGMEM;
-extern const char TEXT_PULUW[] PROGMEM;
-extern const char TEXT_ROLD[]  PROGMEM;
-extern const char TEXT_ROLW[]  PROGMEM;
-extern const char TEXT_RORD[]  PROGMEM;
-extern const char TEXT_RORW[]  PROGMEM;
-using common::TEXT_SBCD;
-extern const char TEXT_SBCR[]  PROGMEM;
-extern const char TEXT_SEXW[]  PROGMEM;
-extern const char TEXT_STBT[]  PROGMEM;
-extern const char TEXT_STE[]   PROGMEM;
-extern const char TEXT_STF[]   PROGMEM;
-extern const char TEXT_STQ[]   PROGMEM;
-extern const char TEXT_STW[]   PROGMEM;
-extern const char TEXT_SUBE[]  PROGMEM;
-using common::TEXT_SUBF;
-using common::TEXT_SUBR;
-using common::TEXT_SUBW;
-extern const char TEXT_TFM[]   PROGMEM;
-using common::TEXT_TIM;
-extern const char TEXT_TSTD[]  PROGMEM;
-extern const char TEXT_TSTE[]  PROGMEM;
-extern const char TEXT_TSTF[]  PROGMEM;
-extern const char TEXT_TSTW[]  PROGMEM;
-
-using common::TEXT_REG_A;
-using common::TEXT_REG_B;
-using common::TEXT_REG_D;
-extern const char TEXT_REG_X[] PROGMEM;
-extern const char TEXT_REG_Y[] PROGMEM;
-extern const char TEXT_REG_U[] PROGMEM;
-using common::TEXT_REG_S;
-using common::TEXT_REG_PC;
-extern const char TEXT_REG_CC[] PROGMEM;
-extern const char TEXT_REG_DP[] PROGMEM;
-extern const char TEXT_REG_PCR[] PROGMEM;
-using common::TEXT_REG_W;
-using common::TEXT_REG_E;
-extern const char TEXT_REG_F[] PROGMEM;
-extern const char TEXT_REG_V[] PROGMEM;
-extern const char TEXT_REG_Z[] PROGMEM;
-extern const char TEXT_REG_0[] PROGMEM;
+#define TEXT_MC6809_LIST(T, A)           \
+    T(TEXT_CPU_LIST,   "MC6809, HD6309") \
+    T(TEXT_CPU_MC6809, "MC6809")         \
+    T(TEXT_CPU_HD6309, "HD6309")         \
+    T(TEXT_CPU_6809,   "6809")           \
+    T(TEXT_CPU_6309,   "6309")           \
+    T(TEXT_ABX,        "ABX")            \
+    T(TEXT_ADCA,       "ADCA")           \
+    T(TEXT_ADCB,       "ADCB")           \
+    T(TEXT_ADDA,       "ADDA")           \
+    T(TEXT_ADDB,       "ADDB")           \
+    T(TEXT_ADDD,       "ADDD")           \
+    T(TEXT_ANDA,       "ANDA")           \
+    T(TEXT_ANDB,       "ANDB")           \
+    T(TEXT_ANDCC,      "ANDCC")          \
+    T(TEXT_ASLA,       "ASLA")           \
+    T(TEXT_ASLB,       "ASLB")           \
+    T(TEXT_ASL,        "ASL")            \
+    T(TEXT_ASRA,       "ASRA")           \
+    T(TEXT_ASRB,       "ASRB")           \
+    T(TEXT_ASR,        "ASR")            \
+    T(TEXT_BCC,        "BCC")            \
+    T(TEXT_BCS,        "BCS")            \
+    T(TEXT_BEQ,        "BEQ")            \
+    T(TEXT_BGE,        "BGE")            \
+    T(TEXT_BGT,        "BGT")            \
+    T(TEXT_BHI,        "BHI")            \
+    T(TEXT_BHS,        "BHS")            \
+    T(TEXT_BITA,       "BITA")           \
+    T(TEXT_BITB,       "BITB")           \
+    T(TEXT_BLE,        "BLE")            \
+    T(TEXT_BLO,        "BLO")            \
+    T(TEXT_BLS,        "BLS")            \
+    T(TEXT_BLT,        "BLT")            \
+    T(TEXT_BMI,        "BMI")            \
+    T(TEXT_BNE,        "BNE")            \
+    T(TEXT_BPL,        "BPL")            \
+    T(TEXT_BRA,        "BRA")            \
+    T(TEXT_BRN,        "BRN")            \
+    T(TEXT_BSR,        "BSR")            \
+    T(TEXT_BVC,        "BVC")            \
+    T(TEXT_BVS,        "BVS")            \
+    T(TEXT_CLRA,       "CLRA")           \
+    T(TEXT_CLRB,       "CLRB")           \
+    T(TEXT_CLR,        "CLR")            \
+    T(TEXT_CMPA,       "CMPA")           \
+    T(TEXT_CMPB,       "CMPB")           \
+    T(TEXT_CMPD,       "CMPD")           \
+    T(TEXT_CMPS,       "CMPS")           \
+    T(TEXT_CMPU,       "CMPU")           \
+    T(TEXT_CMPX,       "CMPX")           \
+    T(TEXT_CMPY,       "CMPY")           \
+    T(TEXT_COMA,       "COMA")           \
+    T(TEXT_COMB,       "COMB")           \
+    T(TEXT_COM,        "COM")            \
+    T(TEXT_CWAI,       "CWAI")           \
+    T(TEXT_DAA,        "DAA")            \
+    T(TEXT_DECA,       "DECA")           \
+    T(TEXT_DECB,       "DECB")           \
+    T(TEXT_DEC,        "DEC")            \
+    T(TEXT_EORA,       "EORA")           \
+    T(TEXT_EORB,       "EORB")           \
+    T(TEXT_EXG,        "EXG")            \
+    T(TEXT_INCA,       "INCA")           \
+    T(TEXT_INCB,       "INCB")           \
+    T(TEXT_INC,        "INC")            \
+    T(TEXT_JMP,        "JMP")            \
+    T(TEXT_JSR,        "JSR")            \
+    T(TEXT_LBCC,       "LBCC")           \
+    T(TEXT_LBCS,       "LBCS")           \
+    T(TEXT_LBEQ,       "LBEQ")           \
+    T(TEXT_LBGE,       "LBGE")           \
+    T(TEXT_LBGT,       "LBGT")           \
+    T(TEXT_LBHI,       "LBHI")           \
+    T(TEXT_LBHS,       "LBHS")           \
+    T(TEXT_LBLE,       "LBLE")           \
+    T(TEXT_LBLO,       "LBLO")           \
+    T(TEXT_LBLS,       "LBLS")           \
+    T(TEXT_LBLT,       "LBLT")           \
+    T(TEXT_LBMI,       "LBMI")           \
+    T(TEXT_LBNE,       "LBNE")           \
+    T(TEXT_LBPL,       "LBPL")           \
+    T(TEXT_LBRA,       "LBRA")           \
+    T(TEXT_LBRN,       "LBRN")           \
+    T(TEXT_LBSR,       "LBSR")           \
+    T(TEXT_LBVC,       "LBVC")           \
+    T(TEXT_LBVS,       "LBVS")           \
+    T(TEXT_LDA,        "LDA")            \
+    T(TEXT_LDB,        "LDB")            \
+    T(TEXT_LDD,        "LDD")            \
+    T(TEXT_LDS,        "LDS")            \
+    T(TEXT_LDU,        "LDU")            \
+    T(TEXT_LDX,        "LDX")            \
+    T(TEXT_LDY,        "LDY")            \
+    T(TEXT_LEAS,       "LEAS")           \
+    T(TEXT_LEAU,       "LEAU")           \
+    T(TEXT_LEAX,       "LEAX")           \
+    T(TEXT_LEAY,       "LEAY")           \
+    T(TEXT_LSLA,       "LSLA")           \
+    T(TEXT_LSLB,       "LSLB")           \
+    T(TEXT_LSL,        "LSL")            \
+    T(TEXT_LSRA,       "LSRA")           \
+    T(TEXT_LSRB,       "LSRB")           \
+    T(TEXT_LSR,        "LSR")            \
+    T(TEXT_MUL,        "MUL")            \
+    T(TEXT_NEGA,       "NEGA")           \
+    T(TEXT_NEGB,       "NEGB")           \
+    T(TEXT_NEG,        "NEG")            \
+    T(TEXT_NOP,        "NOP")            \
+    T(TEXT_ORA,        "ORA")            \
+    T(TEXT_ORB,        "ORB")            \
+    T(TEXT_ORCC,       "ORCC")           \
+    T(TEXT_PSHS,       "PSHS")           \
+    T(TEXT_PSHU,       "PSHU")           \
+    T(TEXT_PULS,       "PULS")           \
+    T(TEXT_PULU,       "PULU")           \
+    T(TEXT_ROLA,       "ROLA")           \
+    T(TEXT_ROLB,       "ROLB")           \
+    T(TEXT_ROL,        "ROL")            \
+    T(TEXT_RORA,       "RORA")           \
+    T(TEXT_RORB,       "RORB")           \
+    T(TEXT_ROR,        "ROR")            \
+    T(TEXT_RTI,        "RTI")            \
+    T(TEXT_RTS,        "RTS")            \
+    T(TEXT_SBCA,       "SBCA")           \
+    T(TEXT_SBCB,       "SBCB")           \
+    T(TEXT_SEX,        "SEX")            \
+    T(TEXT_STA,        "STA")            \
+    T(TEXT_STB,        "STB")            \
+    T(TEXT_STD,        "STD")            \
+    T(TEXT_STS,        "STS")            \
+    T(TEXT_STU,        "STU")            \
+    T(TEXT_STX,        "STX")            \
+    T(TEXT_STY,        "STY")            \
+    T(TEXT_SUBA,       "SUBA")           \
+    T(TEXT_SUBB,       "SUBB")           \
+    T(TEXT_SUBD,       "SUBD")           \
+    T(TEXT_SWI2,       "SWI2")           \
+    T(TEXT_SWI3,       "SWI3")           \
+    T(TEXT_SWI,        "SWI")            \
+    T(TEXT_SYNC,       "SYNC")           \
+    T(TEXT_TFR,        "TFR")            \
+    T(TEXT_TSTA,       "TSTA")           \
+    T(TEXT_TSTB,       "TSTB")           \
+    T(TEXT_TST,        "TST")            \
+    /* HD6309 */                         \
+    T(TEXT_ADCD,       "ADCD")           \
+    T(TEXT_ADCR,       "ADCR")           \
+    T(TEXT_ADDE,       "ADDE")           \
+    T(TEXT_ADDF,       "ADDF")           \
+    T(TEXT_ADDR,       "ADDR")           \
+    T(TEXT_ADDW,       "ADDW")           \
+    T(TEXT_AIM,        "AIM")            \
+    T(TEXT_ANDD,       "ANDD")           \
+    T(TEXT_ANDR,       "ANDR")           \
+    T(TEXT_ASLD,       "ASLD")           \
+    T(TEXT_ASRD,       "ASRD")           \
+    T(TEXT_BAND,       "BAND")           \
+    T(TEXT_BEOR,       "BEOR")           \
+    T(TEXT_BIAND,      "BIAND")          \
+    T(TEXT_BIEOR,      "BIEOR")          \
+    T(TEXT_BIOR,       "BIOR")           \
+    T(TEXT_BITD,       "BITD")           \
+    T(TEXT_BITMD,      "BITMD")          \
+    T(TEXT_BOR,        "BOR")            \
+    T(TEXT_CLRD,       "CLRD")           \
+    T(TEXT_CLRE,       "CLRE")           \
+    T(TEXT_CLRF,       "CLRF")           \
+    T(TEXT_CLRW,       "CLRW")           \
+    T(TEXT_CMPE,       "CMPE")           \
+    T(TEXT_CMPF,       "CMPF")           \
+    T(TEXT_CMPR,       "CMPR")           \
+    T(TEXT_CMPW,       "CMPW")           \
+    T(TEXT_COMD,       "COMD")           \
+    T(TEXT_COME,       "COME")           \
+    T(TEXT_COMF,       "COMF")           \
+    T(TEXT_COMW,       "COMW")           \
+    T(TEXT_DECD,       "DECD")           \
+    T(TEXT_DECE,       "DECE")           \
+    T(TEXT_DECF,       "DECF")           \
+    T(TEXT_DECW,       "DECW")           \
+    T(TEXT_DIVD,       "DIVD")           \
+    T(TEXT_DIVQ,       "DIVQ")           \
+    T(TEXT_EIM,        "EIM")            \
+    T(TEXT_EORD,       "EORD")           \
+    T(TEXT_EORR,       "EORR")           \
+    T(TEXT_INCD,       "INCD")           \
+    T(TEXT_INCE,       "INCE")           \
+    T(TEXT_INCF,       "INCF")           \
+    T(TEXT_INCW,       "INCW")           \
+    T(TEXT_LDBT,       "LDBT")           \
+    T(TEXT_LDE,        "LDE")            \
+    T(TEXT_LDF,        "LDF")            \
+    T(TEXT_LDMD,       "LDMD")           \
+    T(TEXT_LDQ,        "LDQ")            \
+    T(TEXT_LDW,        "LDW")            \
+    T(TEXT_LSLD,       "LSLD")           \
+    T(TEXT_LSRD,       "LSRD")           \
+    T(TEXT_LSRW,       "LSRW")           \
+    T(TEXT_MULD,       "MULD")           \
+    T(TEXT_NEGD,       "NEGD")           \
+    T(TEXT_OIM,        "OIM")            \
+    T(TEXT_ORD,        "ORD")            \
+    T(TEXT_ORR,        "ORR")            \
+    T(TEXT_PSHSW,      "PSHSW")          \
+    T(TEXT_PSHUW,      "PSHUW")          \
+    T(TEXT_PULSW,      "PULSW")          \
+    T(TEXT_PULUW,      "PULUW")          \
+    T(TEXT_ROLD,       "ROLD")           \
+    T(TEXT_ROLW,       "ROLW")           \
+    T(TEXT_RORD,       "RORD")           \
+    T(TEXT_RORW,       "RORW")           \
+    T(TEXT_SBCD,       "SBCD")           \
+    T(TEXT_SBCR,       "SBCR")           \
+    T(TEXT_SEXW,       "SEXW")           \
+    T(TEXT_STBT,       "STBT")           \
+    T(TEXT_STE,        "STE")            \
+    T(TEXT_STF,        "STF")            \
+    T(TEXT_STQ,        "STQ")            \
+    T(TEXT_STW,        "STW")            \
+    T(TEXT_SUBE,       "SUBE")           \
+    T(TEXT_SUBF,       "SUBF")           \
+    T(TEXT_SUBR,       "SUBR")           \
+    T(TEXT_SUBW,       "SUBW")           \
+    T(TEXT_TFM,        "TFM")            \
+    T(TEXT_TIM,        "TIM")            \
+    T(TEXT_TSTD,       "TSTD")           \
+    T(TEXT_TSTE,       "TSTE")           \
+    T(TEXT_TSTF,       "TSTF")           \
+    T(TEXT_TSTW,       "TSTW")           \
+    T(TEXT_REG_A,      "A")              \
+    T(TEXT_REG_B,      "B")              \
+    T(TEXT_REG_D,      "D")              \
+    T(TEXT_REG_X,      "X")              \
+    T(TEXT_REG_Y,      "Y")              \
+    T(TEXT_REG_U,      "U")              \
+    T(TEXT_REG_S,      "S")              \
+    T(TEXT_REG_PC,     "PC")             \
+    T(TEXT_REG_CC,     "CC")             \
+    T(TEXT_REG_DP,     "DP")             \
+    T(TEXT_REG_PCR,    "PCR")            \
+    T(TEXT_REG_W,      "W")              \
+    T(TEXT_REG_E,      "E")              \
+    T(TEXT_REG_F,      "F")              \
+    T(TEXT_REG_V,      "V")              \
+    T(TEXT_REG_Z,      "Z")              \
+    T(TEXT_REG_0,      "0")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_MC6809_LIST);
+
 }  // namespace mc6809
 }  // namespace text
 }  // namespace libasm
@@ -18,173 +18,173 @@
 #define __TEXT_MN1610__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace mn1610 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]    PROGMEM;
-extern const char TEXT_CPU_MN1610[]  PROGMEM;
-extern const char TEXT_CPU_MN1613[]  PROGMEM;
-extern const char TEXT_CPU_MN1613A[] PROGMEM;
-
-// MN1610
-using common::TEXT_AI;
-using common::TEXT_AND;
-using common::TEXT_A;
-extern const char TEXT_BAL[]  PROGMEM;
-using common::TEXT_B;
-extern const char TEXT_BSWP[] PROGMEM;
-using common::TEXT_CB;
-using common::TEXT_C;
-extern const char TEXT_DMS[]  PROGMEM;
-extern const char TEXT_DSWP[] PROGMEM;
-using common::TEXT_EOR;
-extern const char TEXT_H[]    PROGMEM;
-extern const char TEXT_IMS[]  PROGMEM;
-extern const char TEXT_LAD[]  PROGMEM;
-extern const char TEXT_L[]    PROGMEM;
-extern const char TEXT_LPSW[] PROGMEM;
-extern const char TEXT_MVB[]  PROGMEM;
-using common::TEXT_MVI;
-extern const char TEXT_MV[]   PROGMEM;
-using common::TEXT_OR;
-using common::TEXT_POP;
-using common::TEXT_PUSH;
-extern const char TEXT_RBIT[] PROGMEM;
-extern const char TEXT_RD[]   PROGMEM;
-using common::TEXT_RET;
-extern const char TEXT_SBIT[] PROGMEM;
-extern const char TEXT_SI[]   PROGMEM;
-using common::TEXT_SL;
-using common::TEXT_S;
-using common::TEXT_SR;
-using common::TEXT_ST;
-extern const char TEXT_TBIT[] PROGMEM;
-extern const char TEXT_WT[]   PROGMEM;
-
-// MN1613
-extern const char TEXT_LB[]   PROGMEM;
-using common::TEXT_SETB;
-extern const char TEXT_LS[]   PROGMEM;
-extern const char TEXT_SETS[] PROGMEM;
-using common::TEXT_STB;
-extern const char TEXT_CPYB[] PROGMEM;
-using common::TEXT_STS;
-extern const char TEXT_CPYS[] PROGMEM;
-extern const char TEXT_POPM[] PROGMEM;
-extern const char TEXT_PSHM[] PROGMEM;
-extern const char TEXT_TRST[] PROGMEM;
-using common::TEXT_TSET;
-using common::TEXT_FLT;
-extern const char TEXT_FIX[]  PROGMEM;
-using common::TEXT_NEG;
-extern const char TEXT_BD[]   PROGMEM;
-extern const char TEXT_BALD[] PROGMEM;
-using common::TEXT_BR;
-using common::TEXT_BL;
-extern const char TEXT_BALR[] PROGMEM;
-extern const char TEXT_BALL[] PROGMEM;
-using common::TEXT_LD;
-using common::TEXT_STD;
-extern const char TEXT_RDR[]  PROGMEM;
-using common::TEXT_LR;
-extern const char TEXT_WTR[]  PROGMEM;
-using common::TEXT_STR;
-extern const char TEXT_RETL[] PROGMEM;
-extern const char TEXT_BLK[]  PROGMEM;
-extern const char TEXT_SRBT[] PROGMEM;
-extern const char TEXT_SETH[] PROGMEM;
-extern const char TEXT_DEBP[] PROGMEM;
-extern const char TEXT_CPYH[] PROGMEM;
-using common::TEXT_SD;
-extern const char TEXT_AD[]   PROGMEM;
-extern const char TEXT_CBR[]  PROGMEM;
-extern const char TEXT_CWR[]  PROGMEM;
-using common::TEXT_DAS;
-extern const char TEXT_CBI[]  PROGMEM;
-extern const char TEXT_CWI[]  PROGMEM;
-extern const char TEXT_SWR[]  PROGMEM;
-extern const char TEXT_AWR[]  PROGMEM;
-using common::TEXT_DAA;
-using common::TEXT_SWI;
-extern const char TEXT_AWI[]  PROGMEM;
-extern const char TEXT_FD[]   PROGMEM;
-extern const char TEXT_FM[]   PROGMEM;
-using common::TEXT_EORR;
-using common::TEXT_EORI;
-using common::TEXT_ORR;
-using common::TEXT_ORI;
-extern const char TEXT_LADR[] PROGMEM;
-extern const char TEXT_FS[]   PROGMEM;
-extern const char TEXT_FA[]   PROGMEM;
-extern const char TEXT_LADI[] PROGMEM;
-using common::TEXT_ANDR;
-using common::TEXT_ANDI;
-extern const char TEXT_DSWR[] PROGMEM;
-extern const char TEXT_BSWR[] PROGMEM;
-extern const char TEXT_D[]    PROGMEM;
-extern const char TEXT_MVBR[] PROGMEM;
-extern const char TEXT_MVWR[] PROGMEM;
-extern const char TEXT_M[]    PROGMEM;
-extern const char TEXT_MVWI[] PROGMEM;
-
-using common::TEXT_REG_R0;
-using common::TEXT_REG_R1;
-using common::TEXT_REG_R2;
-using common::TEXT_REG_R3;
-using common::TEXT_REG_R4;
-using common::TEXT_REG_SP;
-extern const char TEXT_REG_STR[]  PROGMEM;
-extern const char TEXT_REG_IC[]   PROGMEM;
-extern const char TEXT_REG_DR0[]  PROGMEM;
-extern const char TEXT_REG_X0[]   PROGMEM;
-extern const char TEXT_REG_X1[]   PROGMEM;
-extern const char TEXT_REG_CSBR[] PROGMEM;
-extern const char TEXT_REG_SSBR[] PROGMEM;
-extern const char TEXT_REG_TSR0[] PROGMEM;
-extern const char TEXT_REG_TSR1[] PROGMEM;
-extern const char TEXT_REG_OSR0[] PROGMEM;
-extern const char TEXT_REG_OSR1[] PROGMEM;
-extern const char TEXT_REG_OSR2[] PROGMEM;
-extern const char TEXT_REG_OSR3[] PROGMEM;
-extern const char TEXT_REG_TCR[]  PROGMEM;
-extern const char TEXT_REG_TIR[]  PROGMEM;
-extern const char TEXT_REG_TSR[]  PROGMEM;
-extern const char TEXT_REG_SCR[]  PROGMEM;
-extern const char TEXT_REG_SSR[]  PROGMEM;
-extern const char TEXT_REG_SIR[]  PROGMEM;
-extern const char TEXT_REG_SOR[]  PROGMEM;
-extern const char TEXT_REG_IISR[] PROGMEM;
-extern const char TEXT_REG_SBRB[] PROGMEM;
-extern const char TEXT_REG_ICB[]  PROGMEM;
-extern const char TEXT_REG_NPP[]  PROGMEM;
-
-extern const char TEXT_CC_SKP[] PROGMEM;
-using common::TEXT_CC_M;
-extern const char TEXT_CC_PZ[]  PROGMEM;
-using common::TEXT_CC_Z;
-using common::TEXT_CC_NZ;
-extern const char TEXT_CC_MZ[]  PROGMEM;
-using common::TEXT_CC_P;
-extern const char TEXT_CC_EZ[]  PROGMEM;
-extern const char TEXT_CC_ENZ[] PROGMEM;
-extern const char TEXT_CC_OZ[]  PROGMEM;
-extern const char TEXT_CC_ONZ[] PROGMEM;
-extern const char TEXT_CC_LMZ[] PROGMEM;
-extern const char TEXT_CC_LP[]  PROGMEM;
-extern const char TEXT_CC_LPZ[] PROGMEM;
-extern const char TEXT_CC_LM[]  PROGMEM;
-extern const char TEXT_CC_E[]   PROGMEM;
-using common::TEXT_CC_NE;
-using common::TEXT_CC_C;
-extern const char TEXT_CC_RE[]  PROGMEM;
-extern const char TEXT_CC_SE[]  PROGMEM;
-extern const char TEXT_CC_CE[]  PROGMEM;
-extern const char TEXT_CC_NONE[] PROGMEM;
+#define TEXT_MN1610_LIST(T, A)                     \
+    T(TEXT_CPU_LIST,    "MN1610, MN1613, MN1613A") \
+    T(TEXT_CPU_MN1610,  "MN1610")                  \
+    T(TEXT_CPU_MN1613,  "MN1613")                  \
+    T(TEXT_CPU_MN1613A, "MN1613A")                 \
+    /* MN1610 */                                   \
+    T(TEXT_AI,          "AI")                      \
+    T(TEXT_AND,         "AND")                     \
+    T(TEXT_A,           "A")                       \
+    T(TEXT_BAL,         "BAL")                     \
+    T(TEXT_B,           "B")                       \
+    T(TEXT_BSWP,        "BSWP")                    \
+    T(TEXT_CB,          "CB")                      \
+    T(TEXT_C,           "C")                       \
+    T(TEXT_DMS,         "DMS")                     \
+    T(TEXT_DSWP,        "DSWP")                    \
+    T(TEXT_EOR,         "EOR")                     \
+    T(TEXT_H,           "H")                       \
+    T(TEXT_IMS,         "IMS")                     \
+    T(TEXT_LAD,         "LAD")                     \
+    T(TEXT_L,           "L")                       \
+    T(TEXT_LPSW,        "LPSW")                    \
+    T(TEXT_MVB,         "MVB")                     \
+    T(TEXT_MVI,         "MVI")                     \
+    T(TEXT_MV,          "MV")                      \
+    T(TEXT_OR,          "OR")                      \
+    T(TEXT_POP,         "POP")                     \
+    T(TEXT_PUSH,        "PUSH")                    \
+    T(TEXT_RBIT,        "RBIT")                    \
+    T(TEXT_RD,          "RD")                      \
+    T(TEXT_RET,         "RET")                     \
+    T(TEXT_SBIT,        "SBIT")                    \
+    T(TEXT_SI,          "SI")                      \
+    T(TEXT_SL,          "SL")                      \
+    T(TEXT_S,           "S")                       \
+    T(TEXT_SR,          "SR")                      \
+    T(TEXT_ST,          "ST")                      \
+    T(TEXT_TBIT,        "TBIT")                    \
+    T(TEXT_WT,          "WT")                      \
+    /* MN1613 */                                   \
+    T(TEXT_LB,          "LB")                      \
+    T(TEXT_SETB,        "SETB")                    \
+    T(TEXT_LS,          "LS")                      \
+    T(TEXT_SETS,        "SETS")                    \
+    T(TEXT_STB,         "STB")                     \
+    T(TEXT_CPYB,        "CPYB")                    \
+    T(TEXT_STS,         "STS")                     \
+    T(TEXT_CPYS,        "CPYS")                    \
+    T(TEXT_POPM,        "POPM")                    \
+    T(TEXT_PSHM,        "PSHM")                    \
+    T(TEXT_TRST,        "TRST")                    \
+    T(TEXT_TSET,        "TSET")                    \
+    T(TEXT_FLT,         "FLT")                     \
+    T(TEXT_FIX,         "FIX")                     \
+    T(TEXT_NEG,         "NEG")                     \
+    T(TEXT_BD,          "BD")                      \
+    T(TEXT_BALD,        "BALD")                    \
+    T(TEXT_BR,          "BR")                      \
+    T(TEXT_BL,          "BL")                      \
+    T(TEXT_BALR,        "BALR")                    \
+    T(TEXT_BALL,        "BALL")                    \
+    T(TEXT_LD,          "LD")                      \
+    T(TEXT_STD,         "STD")                     \
+    T(TEXT_RDR,         "RDR")                     \
+    T(TEXT_LR,          "LR")                      \
+    T(TEXT_WTR,         "WTR")                     \
+    T(TEXT_STR,         "STR")                     \
+    T(TEXT_RETL,        "RETL")                    \
+    T(TEXT_BLK,         "BLK")                     \
+    T(TEXT_SRBT,        "SRBT")                    \
+    T(TEXT_SETH,        "SETH")                    \
+    T(TEXT_DEBP,        "DEBP")                    \
+    T(TEXT_CPYH,        "CPYH")                    \
+    T(TEXT_SD,          "SD")                      \
+    T(TEXT_AD,          "AD")                      \
+    T(TEXT_CBR,         "CBR")                     \
+    T(TEXT_CWR,         "CWR")                     \
+    T(TEXT_DAS,         "DAS")                     \
+    T(TEXT_CBI,         "CBI")                     \
+    T(TEXT_CWI,         "CWI")                     \
+    T(TEXT_SWR,         "SWR")                     \
+    T(TEXT_AWR,         "AWR")                     \
+    T(TEXT_DAA,         "DAA")                     \
+    T(TEXT_SWI,         "SWI")                     \
+    T(TEXT_AWI,         "AWI")                     \
+    T(TEXT_FD,          "FD")                      \
+    T(TEXT_FM,          "FM")                      \
+    T(TEXT_EORR,        "EORR")                    \
+    T(TEXT_EORI,        "EORI")                    \
+    T(TEXT_ORR,         "ORR")                     \
+    T(TEXT_ORI,         "ORI")                     \
+    T(TEXT_LADR,        "LADR")                    \
+    T(TEXT_FS,          "FS")                      \
+    T(TEXT_FA,          "FA")                      \
+    T(TEXT_LADI,        "LADI")                    \
+    T(TEXT_ANDR,        "ANDR")                    \
+    T(TEXT_ANDI,        "ANDI")                    \
+    T(TEXT_DSWR,        "DSWR")                    \
+    T(TEXT_BSWR,        "BSWR")                    \
+    T(TEXT_D,           "D")                       \
+    T(TEXT_MVBR,        "MVBR")                    \
+    T(TEXT_MVWR,        "MVWR")                    \
+    T(TEXT_M,           "M")                       \
+    T(TEXT_MVWI,        "MVWI")                    \
+    T(TEXT_REG_R0,      "R0")                      \
+    T(TEXT_REG_R1,      "R1")                      \
+    T(TEXT_REG_R2,      "R2")                      \
+    T(TEXT_REG_R3,      "R3")                      \
+    T(TEXT_REG_R4,      "R4")                      \
+    T(TEXT_REG_SP,      "SP")                      \
+    A(TEXT_REG_STR,     TEXT_STR)                  \
+    T(TEXT_REG_IC,      "IC")                      \
+    T(TEXT_REG_DR0,     "DR0")                     \
+    T(TEXT_REG_X0,      "X0")                      \
+    T(TEXT_REG_X1,      "X1")                      \
+    T(TEXT_REG_CSBR,    "CSBR")                    \
+    T(TEXT_REG_SSBR,    "SSBR")                    \
+    T(TEXT_REG_TSR0,    "TSR0")                    \
+    T(TEXT_REG_TSR1,    "TSR1")                    \
+    T(TEXT_REG_OSR0,    "OSR0")                    \
+    T(TEXT_REG_OSR1,    "OSR1")                    \
+    T(TEXT_REG_OSR2,    "OSR2")                    \
+    T(TEXT_REG_OSR3,    "OSR3")                    \
+    T(TEXT_REG_TCR,     "TCR")                     \
+    T(TEXT_REG_TIR,     "TIR")                     \
+    T(TEXT_REG_TSR,     "TSR")                     \
+    T(TEXT_REG_SCR,     "SCR")                     \
+    T(TEXT_REG_SSR,     "SSR")                     \
+    T(TEXT_REG_SIR,     "SIR")                     \
+    T(TEXT_REG_SOR,     "SOR")                     \
+    T(TEXT_REG_IISR,    "IISR")                    \
+    T(TEXT_REG_SBRB,    "SBRB")                    \
+    T(TEXT_REG_ICB,     "ICB")                     \
+    T(TEXT_REG_NPP,     "NPP")                     \
+    T(TEXT_CC_SKP,      "SKP")                     \
+    A(TEXT_CC_M,        TEXT_M)                    \
+    T(TEXT_CC_PZ,       "PZ")                      \
+    T(TEXT_CC_Z,        "Z")                       \
+    T(TEXT_CC_NZ,       "NZ")                      \
+    T(TEXT_CC_MZ,       "MZ")                      \
+    T(TEXT_CC_P,        "P")                       \
+    T(TEXT_CC_EZ,       "EZ")                      \
+    T(TEXT_CC_ENZ,      "ENZ")                     \
+    T(TEXT_CC_OZ,       "OZ")                      \
+    T(TEXT_CC_ONZ,      "ONZ")                     \
+    T(TEXT_CC_LMZ,      "LMZ")                     \
+    T(TEXT_CC_LP,       "LP")                      \
+    T(TEXT_CC_LPZ,      "LPZ")                     \
+    T(TEXT_CC_LM,       "LM")                      \
+    T(TEXT_CC_E,        "E")                       \
+    T(TEXT_CC_NE,       "NE")                      \
+    A(TEXT_CC_C,        TEXT_C)                    \
+    T(TEXT_CC_RE,       "RE")                      \
+    T(TEXT_CC_SE,       "SE")                      \
+    T(TEXT_CC_CE,       "CE")                      \
+    T(TEXT_CC_NONE,     "")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_MN1610_LIST);
+
 }  // namespace mn1610
 }  // namespace text
 }  // namespace libasm
@@ -18,173 +18,169 @@
 #define __TEXT_MOS6502_H__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace mos6502 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]    PROGMEM;
-extern const char TEXT_CPU_6502[]    PROGMEM;
-extern const char TEXT_CPU_65SC02[]  PROGMEM;
-extern const char TEXT_CPU_65C02[]   PROGMEM;
-extern const char TEXT_CPU_W65C02S[] PROGMEM;
-extern const char TEXT_CPU_65816[]   PROGMEM;
-extern const char TEXT_CPU_MOS6502[] PROGMEM;
-extern const char TEXT_CPU_R65C02[]  PROGMEM;
-extern const char TEXT_CPU_G65SC02[] PROGMEM;
-extern const char TEXT_CPU_65C816[]  PROGMEM;
-extern const char TEXT_CPU_65C816S[] PROGMEM;
-
-// MOS6502 instructions
-using common::TEXT_ADC;
-using common::TEXT_AND;
-using common::TEXT_ASL;
-using common::TEXT_BCC;
-using common::TEXT_BCS;
-using common::TEXT_BEQ;
-using common::TEXT_BIT;
-using common::TEXT_BMI;
-using common::TEXT_BNE;
-using common::TEXT_BPL;
-extern const char TEXT_BRK[] PROGMEM;
-using common::TEXT_BVC;
-using common::TEXT_BVS;
-using common::TEXT_CLC;
-using common::TEXT_CLD;
-using common::TEXT_CLI;
-using common::TEXT_CLV;
-using common::TEXT_CMP;
-using common::TEXT_CPX;
-using common::TEXT_CPY;
-using common::TEXT_DEC;
-using common::TEXT_DEX;
-using common::TEXT_DEY;
-using common::TEXT_EOR;
-using common::TEXT_INC;
-using common::TEXT_INX;
-using common::TEXT_INY;
-using common::TEXT_JMP;
-using common::TEXT_JSR;
-using common::TEXT_LDA;
-using common::TEXT_LDX;
-using common::TEXT_LDY;
-using common::TEXT_LSR;
-using common::TEXT_NOP;
-using common::TEXT_ORA;
-extern const char TEXT_PHA[] PROGMEM;
-extern const char TEXT_PHP[] PROGMEM;
-extern const char TEXT_PLA[] PROGMEM;
-extern const char TEXT_PLP[] PROGMEM;
-using common::TEXT_ROL;
-using common::TEXT_ROR;
-using common::TEXT_RTI;
-using common::TEXT_RTS;
-using common::TEXT_SBC;
-using common::TEXT_SEC;
-extern const char TEXT_SED[] PROGMEM;
-using common::TEXT_SEI;
-using common::TEXT_STA;
-using common::TEXT_STX;
-using common::TEXT_STY;
-using common::TEXT_TAX;
-extern const char TEXT_TAY[] PROGMEM;
-using common::TEXT_TSX;
-using common::TEXT_TXA;
-using common::TEXT_TXS;
-extern const char TEXT_TYA[] PROGMEM;
-
-// G65SC02 instructions
-
-using common::TEXT_BRA;
-extern const char TEXT_PHX[] PROGMEM;
-extern const char TEXT_PHY[] PROGMEM;
-extern const char TEXT_PLX[] PROGMEM;
-extern const char TEXT_PLY[] PROGMEM;
-extern const char TEXT_STZ[] PROGMEM;
-extern const char TEXT_TRB[] PROGMEM;
-extern const char TEXT_TSB[] PROGMEM;
-
-// R65C02 instructions
-
-extern const char TEXT_BBR0[] PROGMEM;
-extern const char TEXT_BBR1[] PROGMEM;
-extern const char TEXT_BBR2[] PROGMEM;
-extern const char TEXT_BBR3[] PROGMEM;
-extern const char TEXT_BBR4[] PROGMEM;
-extern const char TEXT_BBR5[] PROGMEM;
-extern const char TEXT_BBR6[] PROGMEM;
-extern const char TEXT_BBR7[] PROGMEM;
-extern const char TEXT_BBS0[] PROGMEM;
-extern const char TEXT_BBS1[] PROGMEM;
-extern const char TEXT_BBS2[] PROGMEM;
-extern const char TEXT_BBS3[] PROGMEM;
-extern const char TEXT_BBS4[] PROGMEM;
-extern const char TEXT_BBS5[] PROGMEM;
-extern const char TEXT_BBS6[] PROGMEM;
-extern const char TEXT_BBS7[] PROGMEM;
-extern const char TEXT_RMB0[] PROGMEM;
-extern const char TEXT_RMB1[] PROGMEM;
-extern const char TEXT_RMB2[] PROGMEM;
-extern const char TEXT_RMB3[] PROGMEM;
-extern const char TEXT_RMB4[] PROGMEM;
-extern const char TEXT_RMB5[] PROGMEM;
-extern const char TEXT_RMB6[] PROGMEM;
-extern const char TEXT_RMB7[] PROGMEM;
-extern const char TEXT_SMB0[] PROGMEM;
-extern const char TEXT_SMB1[] PROGMEM;
-extern const char TEXT_SMB2[] PROGMEM;
-extern const char TEXT_SMB3[] PROGMEM;
-extern const char TEXT_SMB4[] PROGMEM;
-extern const char TEXT_SMB5[] PROGMEM;
-extern const char TEXT_SMB6[] PROGMEM;
-extern const char TEXT_SMB7[] PROGMEM;
-
-// W65C02 instructions
-
-extern const char TEXT_STP[] PROGMEM;
-using common::TEXT_WAI;
-
-// W65C816 instructions
-
-extern const char TEXT_BRL[] PROGMEM;
-extern const char TEXT_COP[] PROGMEM;
-extern const char TEXT_JML[] PROGMEM;
-extern const char TEXT_JSL[] PROGMEM;
-extern const char TEXT_MVN[] PROGMEM;
-extern const char TEXT_MVP[] PROGMEM;
-using common::TEXT_PEA;
-extern const char TEXT_PEI[] PROGMEM;
-extern const char TEXT_PER[] PROGMEM;
-extern const char TEXT_PHB[] PROGMEM;
-extern const char TEXT_PHD[] PROGMEM;
-extern const char TEXT_PHK[] PROGMEM;
-extern const char TEXT_PLB[] PROGMEM;
-extern const char TEXT_PLD[] PROGMEM;
-extern const char TEXT_PSD[] PROGMEM;
-using common::TEXT_REP;
-extern const char TEXT_RTL[] PROGMEM;
-using common::TEXT_SEP;
-extern const char TEXT_TCD[] PROGMEM;
-extern const char TEXT_TCS[] PROGMEM;
-extern const char TEXT_TDC[] PROGMEM;
-extern const char TEXT_TSC[] PROGMEM;
-extern const char TEXT_TXY[] PROGMEM;
-extern const char TEXT_TYX[] PROGMEM;
-extern const char TEXT_WDM[] PROGMEM;
-extern const char TEXT_XBA[] PROGMEM;
-extern const char TEXT_XCE[] PROGMEM;
+#define TEXT_MOS6502_LIST(T, A)                                        \
+    T(TEXT_CPU_LIST,    "MOS6502, R65C02, G65SC02, W65C02S, W65C816S") \
+    T(TEXT_CPU_6502,    "6502")                                        \
+    T(TEXT_CPU_65SC02,  "65SC02")                                      \
+    T(TEXT_CPU_65C02,   "65C02")                                       \
+    T(TEXT_CPU_W65C02S, "W65C02S")                                     \
+    T(TEXT_CPU_65816,   "65816")                                       \
+    T(TEXT_CPU_MOS6502, "MOS6502")                                     \
+    T(TEXT_CPU_R65C02,  "R65C02")                                      \
+    T(TEXT_CPU_G65SC02, "G65SC02")                                     \
+    T(TEXT_CPU_65C816,  "65C816")                                      \
+    T(TEXT_CPU_65C816S, "65C816S")                                     \
+    /* MOS6502 instructions */                                         \
+    T(TEXT_ADC,         "ADC")                                         \
+    T(TEXT_AND,         "AND")                                         \
+    T(TEXT_ASL,         "ASL")                                         \
+    T(TEXT_BCC,         "BCC")                                         \
+    T(TEXT_BCS,         "BCS")                                         \
+    T(TEXT_BEQ,         "BEQ")                                         \
+    T(TEXT_BIT,         "BIT")                                         \
+    T(TEXT_BMI,         "BMI")                                         \
+    T(TEXT_BNE,         "BNE")                                         \
+    T(TEXT_BPL,         "BPL")                                         \
+    T(TEXT_BRK,         "BRK")                                         \
+    T(TEXT_BVC,         "BVC")                                         \
+    T(TEXT_BVS,         "BVS")                                         \
+    T(TEXT_CLC,         "CLC")                                         \
+    T(TEXT_CLD,         "CLD")                                         \
+    T(TEXT_CLI,         "CLI")                                         \
+    T(TEXT_CLV,         "CLV")                                         \
+    T(TEXT_CMP,         "CMP")                                         \
+    T(TEXT_CPX,         "CPX")                                         \
+    T(TEXT_CPY,         "CPY")                                         \
+    T(TEXT_DEC,         "DEC")                                         \
+    T(TEXT_DEX,         "DEX")                                         \
+    T(TEXT_DEY,         "DEY")                                         \
+    T(TEXT_EOR,         "EOR")                                         \
+    T(TEXT_INC,         "INC")                                         \
+    T(TEXT_INX,         "INX")                                         \
+    T(TEXT_INY,         "INY")                                         \
+    T(TEXT_JMP,         "JMP")                                         \
+    T(TEXT_JSR,         "JSR")                                         \
+    T(TEXT_LDA,         "LDA")                                         \
+    T(TEXT_LDX,         "LDX")                                         \
+    T(TEXT_LDY,         "LDY")                                         \
+    T(TEXT_LSR,         "LSR")                                         \
+    T(TEXT_NOP,         "NOP")                                         \
+    T(TEXT_ORA,         "ORA")                                         \
+    T(TEXT_PHA,         "PHA")                                         \
+    T(TEXT_PHP,         "PHP")                                         \
+    T(TEXT_PLA,         "PLA")                                         \
+    T(TEXT_PLP,         "PLP")                                         \
+    T(TEXT_ROL,         "ROL")                                         \
+    T(TEXT_ROR,         "ROR")                                         \
+    T(TEXT_RTI,         "RTI")                                         \
+    T(TEXT_RTS,         "RTS")                                         \
+    T(TEXT_SBC,         "SBC")                                         \
+    T(TEXT_SEC,         "SEC")                                         \
+    T(TEXT_SED,         "SED")                                         \
+    T(TEXT_SEI,         "SEI")                                         \
+    T(TEXT_STA,         "STA")                                         \
+    T(TEXT_STX,         "STX")                                         \
+    T(TEXT_STY,         "STY")                                         \
+    T(TEXT_TAX,         "TAX")                                         \
+    T(TEXT_TAY,         "TAY")                                         \
+    T(TEXT_TSX,         "TSX")                                         \
+    T(TEXT_TXA,         "TXA")                                         \
+    T(TEXT_TXS,         "TXS")                                         \
+    T(TEXT_TYA,         "TYA")                                         \
+    /* G65SC02 instructions */                                         \
+    T(TEXT_BRA,         "BRA")                                         \
+    T(TEXT_PHX,         "PHX")                                         \
+    T(TEXT_PHY,         "PHY")                                         \
+    T(TEXT_PLX,         "PLX")                                         \
+    T(TEXT_PLY,         "PLY")                                         \
+    T(TEXT_STZ,         "STZ")                                         \
+    T(TEXT_TRB,         "TRB")                                         \
+    T(TEXT_TSB,         "TSB")                                         \
+    /* R65C02 instructions */                                          \
+    T(TEXT_BBR0,        "BBR0")                                        \
+    T(TEXT_BBR1,        "BBR1")                                        \
+    T(TEXT_BBR2,        "BBR2")                                        \
+    T(TEXT_BBR3,        "BBR3")                                        \
+    T(TEXT_BBR4,        "BBR4")                                        \
+    T(TEXT_BBR5,        "BBR5")                                        \
+    T(TEXT_BBR6,        "BBR6")                                        \
+    T(TEXT_BBR7,        "BBR7")                                        \
+    T(TEXT_BBS0,        "BBS0")                                        \
+    T(TEXT_BBS1,        "BBS1")                                        \
+    T(TEXT_BBS2,        "BBS2")                                        \
+    T(TEXT_BBS3,        "BBS3")                                        \
+    T(TEXT_BBS4,        "BBS4")                                        \
+    T(TEXT_BBS5,        "BBS5")                                        \
+    T(TEXT_BBS6,        "BBS6")                                        \
+    T(TEXT_BBS7,        "BBS7")                                        \
+    T(TEXT_RMB0,        "RMB0")                                        \
+    T(TEXT_RMB1,        "RMB1")                                        \
+    T(TEXT_RMB2,        "RMB2")                                        \
+    T(TEXT_RMB3,        "RMB3")                                        \
+    T(TEXT_RMB4,        "RMB4")                                        \
+    T(TEXT_RMB5,        "RMB5")                                        \
+    T(TEXT_RMB6,        "RMB6")                                        \
+    T(TEXT_RMB7,        "RMB7")                                        \
+    T(TEXT_SMB0,        "SMB0")                                        \
+    T(TEXT_SMB1,        "SMB1")                                        \
+    T(TEXT_SMB2,        "SMB2")                                        \
+    T(TEXT_SMB3,        "SMB3")                                        \
+    T(TEXT_SMB4,        "SMB4")                                        \
+    T(TEXT_SMB5,        "SMB5")                                        \
+    T(TEXT_SMB6,        "SMB6")                                        \
+    T(TEXT_SMB7,        "SMB7")                                        \
+    /* W65C02 instructions */                                          \
+    T(TEXT_STP,         "STP")                                         \
+    T(TEXT_WAI,         "WAI")                                         \
+    /* W65C816 instructions */                                         \
+    T(TEXT_BRL,         "BRL")                                         \
+    T(TEXT_COP,         "COP")                                         \
+    T(TEXT_JML,         "JML")                                         \
+    T(TEXT_JSL,         "JSL")                                         \
+    T(TEXT_MVN,         "MVN")                                         \
+    T(TEXT_MVP,         "MVP")                                         \
+    T(TEXT_PEA,         "PEA")                                         \
+    T(TEXT_PEI,         "PEI")                                         \
+    T(TEXT_PER,         "PER")                                         \
+    T(TEXT_PHB,         "PHB")                                         \
+    T(TEXT_PHD,         "PHD")                                         \
+    T(TEXT_PHK,         "PHK")                                         \
+    T(TEXT_PLB,         "PLB")                                         \
+    T(TEXT_PLD,         "PLD")                                         \
+    T(TEXT_PSD,         "PSD")                                         \
+    T(TEXT_REP,         "REP")                                         \
+    T(TEXT_RTL,         "RTL")                                         \
+    T(TEXT_SEP,         "SEP")                                         \
+    T(TEXT_TCD,         "TCD")                                         \
+    T(TEXT_TCS,         "TCS")                                         \
+    T(TEXT_TDC,         "TDC")                                         \
+    T(TEXT_TSC,         "TSC")                                         \
+    T(TEXT_TXY,         "TXY")                                         \
+    T(TEXT_TYX,         "TYX")                                         \
+    T(TEXT_WDM,         "WDM")                                         \
+    T(TEXT_XBA,         "XBA")                                         \
+    T(TEXT_XCE,         "XCE")                                         \
+    T(TEXT_JMPL,        "JMPL")                                        \
+    T(TEXT_ADCL,        "ADCL")                                        \
+    T(TEXT_ANDL,        "ANDL")                                        \
+    T(TEXT_CMPL,        "CMPL")                                        \
+    T(TEXT_EORL,        "EORL")                                        \
+    T(TEXT_LDAL,        "LDAL")                                        \
+    T(TEXT_ORAL,        "ORAL")                                        \
+    T(TEXT_SBCL,        "SBCL")                                        \
+    T(TEXT_STAL,        "STAL")
+// clang-format on
 
-extern const char TEXT_JMPL[] PROGMEM;
-extern const char TEXT_ADCL[] PROGMEM;
-extern const char TEXT_ANDL[] PROGMEM;
-using common::TEXT_CMPL;
-extern const char TEXT_EORL[] PROGMEM;
-extern const char TEXT_LDAL[] PROGMEM;
-extern const char TEXT_ORAL[] PROGMEM;
-extern const char TEXT_SBCL[] PROGMEM;
-extern const char TEXT_STAL[] PROGMEM;
+DECLARE_TEXT_POOL(TEXT_MOS6502_LIST);
 
+// clang-format off
 extern const char OPT_BOOL_LONGA[] PROGMEM;
 extern const char OPT_DESC_LONGA[] PROGMEM;
 extern const char OPT_BOOL_LONGI[] PROGMEM;
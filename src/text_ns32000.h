@@ -18,379 +18,374 @@
 #define __TEXT_NS32000__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace ns32000 {
 
 // clang-format off
-extern const char TEXT_CPU_NS32032[] PROGMEM;
-extern const char TEXT_FPU_NS32081[] PROGMEM;
-extern const char TEXT_MMU_NS32082[] PROGMEM;
-extern const char TEXT_CPU_32032[]   PROGMEM;
-extern const char TEXT_none[] PROGMEM;
-
-extern const char TEXT_FPU[]  PROGMEM;
-extern const char TEXT_PMMU[] PROGMEM;
-
-// Standard instructions
-extern const char TEXT_ABSB[]    PROGMEM;
-extern const char TEXT_ABSD[]    PROGMEM;
-extern const char TEXT_ABSW[]    PROGMEM;
-extern const char TEXT_ACBB[]    PROGMEM;
-extern const char TEXT_ACBD[]    PROGMEM;
-extern const char TEXT_ACBW[]    PROGMEM;
-using common::TEXT_ADDB;
-using common::TEXT_ADDCB;
-extern const char TEXT_ADDCD[]   PROGMEM;
-extern const char TEXT_ADDCW[]   PROGMEM;
-using common::TEXT_ADDD;
-extern const char TEXT_ADDPB[]   PROGMEM;
-extern const char TEXT_ADDPD[]   PROGMEM;
-extern const char TEXT_ADDPW[]   PROGMEM;
-extern const char TEXT_ADDQB[]   PROGMEM;
-extern const char TEXT_ADDQD[]   PROGMEM;
-extern const char TEXT_ADDQW[]   PROGMEM;
-using common::TEXT_ADDR;
-using common::TEXT_ADDW;
-extern const char TEXT_ADJSPB[]  PROGMEM;
-extern const char TEXT_ADJSPD[]  PROGMEM;
-extern const char TEXT_ADJSPW[]  PROGMEM;
-using common::TEXT_ANDB;
-using common::TEXT_ANDD;
-extern const char TEXT_ANDW[]    PROGMEM;
-extern const char TEXT_ASHB[]    PROGMEM;
-extern const char TEXT_ASHD[]    PROGMEM;
-extern const char TEXT_ASHW[]    PROGMEM;
-using common::TEXT_BCC;
-using common::TEXT_BCS;
-using common::TEXT_BEQ;
-extern const char TEXT_BFC[]     PROGMEM;
-extern const char TEXT_BFS[]     PROGMEM;
-using common::TEXT_BGE;
-using common::TEXT_BGT;
-using common::TEXT_BHI;
-using common::TEXT_BHS;
-extern const char TEXT_BICB[]    PROGMEM;
-extern const char TEXT_BICD[]    PROGMEM;
-extern const char TEXT_BICPSRB[] PROGMEM;
-extern const char TEXT_BICPSRW[] PROGMEM;
-extern const char TEXT_BICW[]    PROGMEM;
-extern const char TEXT_BISPSRB[] PROGMEM;
-extern const char TEXT_BISPSRW[] PROGMEM;
-using common::TEXT_BLE;
-using common::TEXT_BLO;
-using common::TEXT_BLS;
-using common::TEXT_BLT;
-using common::TEXT_BNE;
-extern const char TEXT_BPT[]     PROGMEM;
-using common::TEXT_BR;
-using common::TEXT_BSR;
-extern const char TEXT_CASEB[]   PROGMEM;
-extern const char TEXT_CASED[]   PROGMEM;
-extern const char TEXT_CASEW[]   PROGMEM;
-extern const char TEXT_CBITB[]   PROGMEM;
-extern const char TEXT_CBITD[]   PROGMEM;
-extern const char TEXT_CBITIB[]  PROGMEM;
-extern const char TEXT_CBITID[]  PROGMEM;
-extern const char TEXT_CBITIW[]  PROGMEM;
-extern const char TEXT_CBITW[]   PROGMEM;
-extern const char TEXT_CHECKB[]  PROGMEM;
-extern const char TEXT_CHECKD[]  PROGMEM;
-extern const char TEXT_CHECKW[]  PROGMEM;
-extern const char TEXT_CINV[]    PROGMEM;
-using common::TEXT_CMPB;
-using common::TEXT_CMPD;
-extern const char TEXT_CMPMB[]   PROGMEM;
-extern const char TEXT_CMPMD[]   PROGMEM;
-extern const char TEXT_CMPMW[]   PROGMEM;
-extern const char TEXT_CMPQB[]   PROGMEM;
-extern const char TEXT_CMPQD[]   PROGMEM;
-extern const char TEXT_CMPQW[]   PROGMEM;
-using common::TEXT_CMPSB;
-extern const char TEXT_CMPSD[]   PROGMEM;
-extern const char TEXT_CMPST[]   PROGMEM;
-using common::TEXT_CMPSW;
-using common::TEXT_CMPW;
-using common::TEXT_COMB;
-using common::TEXT_COMD;
-using common::TEXT_COMW;
-extern const char TEXT_CVTP[]    PROGMEM;
-extern const char TEXT_CXP[]     PROGMEM;
-extern const char TEXT_CXPD[]    PROGMEM;
-extern const char TEXT_DEIB[]    PROGMEM;
-extern const char TEXT_DEID[]    PROGMEM;
-extern const char TEXT_DEIW[]    PROGMEM;
-extern const char TEXT_DIA[]     PROGMEM;
-using common::TEXT_DIVB;
-using common::TEXT_DIVD;
-extern const char TEXT_DIVW[]    PROGMEM;
-using common::TEXT_ENTER;
-using common::TEXT_EXIT;
-using common::TEXT_EXTB;
-extern const char TEXT_EXTD[]    PROGMEM;
-using common::TEXT_EXTSB;
-extern const char TEXT_EXTSD[]   PROGMEM;
-extern const char TEXT_EXTSW[]   PROGMEM;
-extern const char TEXT_EXTW[]    PROGMEM;
-extern const char TEXT_FFSB[]    PROGMEM;
-extern const char TEXT_FFSD[]    PROGMEM;
-extern const char TEXT_FFSW[]    PROGMEM;
-extern const char TEXT_FLAG[]    PROGMEM;
-extern const char TEXT_IBITB[]   PROGMEM;
-extern const char TEXT_IBITD[]   PROGMEM;
-extern const char TEXT_IBITW[]   PROGMEM;
-extern const char TEXT_INDEXB[]  PROGMEM;
-extern const char TEXT_INDEXD[]  PROGMEM;
-extern const char TEXT_INDEXW[]  PROGMEM;
-using common::TEXT_INSB;
-extern const char TEXT_INSD[]    PROGMEM;
-extern const char TEXT_INSSB[]   PROGMEM;
-extern const char TEXT_INSSD[]   PROGMEM;
-extern const char TEXT_INSSW[]   PROGMEM;
-using common::TEXT_INSW;
-using common::TEXT_JSR;
-extern const char TEXT_JUMP[]    PROGMEM;
-extern const char TEXT_LPRB[]    PROGMEM;
-extern const char TEXT_LPRD[]    PROGMEM;
-extern const char TEXT_LPRW[]    PROGMEM;
-extern const char TEXT_LFSR[]    PROGMEM;
-extern const char TEXT_LSHB[]    PROGMEM;
-extern const char TEXT_LSHD[]    PROGMEM;
-extern const char TEXT_LSHW[]    PROGMEM;
-extern const char TEXT_MEIB[]    PROGMEM;
-extern const char TEXT_MEID[]    PROGMEM;
-extern const char TEXT_MEIW[]    PROGMEM;
-extern const char TEXT_MODB[]    PROGMEM;
-extern const char TEXT_MODD[]    PROGMEM;
-extern const char TEXT_MODW[]    PROGMEM;
-using common::TEXT_MOVB;
-using common::TEXT_MOVD;
-extern const char TEXT_MOVMB[]   PROGMEM;
-extern const char TEXT_MOVMD[]   PROGMEM;
-extern const char TEXT_MOVMW[]   PROGMEM;
-extern const char TEXT_MOVQB[]   PROGMEM;
-extern const char TEXT_MOVQD[]   PROGMEM;
-extern const char TEXT_MOVQW[]   PROGMEM;
-using common::TEXT_MOVSB;
-extern const char TEXT_MOVSD[]   PROGMEM;
-extern const char TEXT_MOVST[]   PROGMEM;
-using common::TEXT_MOVSW;
-extern const char TEXT_MOVW[]    PROGMEM;
-extern const char TEXT_MOVXBD[]  PROGMEM;
-extern const char TEXT_MOVXBW[]  PROGMEM;
-extern const char TEXT_MOVXWD[]  PROGMEM;
-extern const char TEXT_MOVZBD[]  PROGMEM;
-extern const char TEXT_MOVZBW[]  PROGMEM;
-extern const char TEXT_MOVZWD[]  PROGMEM;
-using common::TEXT_MULB;
-using common::TEXT_MULD;
-extern const char TEXT_MULW[]    PROGMEM;
-using common::TEXT_NEGB;
-using common::TEXT_NEGD;
-extern const char TEXT_NEGW[]    PROGMEM;
-using common::TEXT_NOP;
-using common::TEXT_NOTB;
-extern const char TEXT_NOTD[]    PROGMEM;
-extern const char TEXT_NOTW[]    PROGMEM;
-using common::TEXT_ORB;
-using common::TEXT_ORD;
-extern const char TEXT_ORW[]     PROGMEM;
-extern const char TEXT_QUOB[]    PROGMEM;
-extern const char TEXT_QUOD[]    PROGMEM;
-extern const char TEXT_QUOW[]    PROGMEM;
-extern const char TEXT_REMB[]    PROGMEM;
-extern const char TEXT_REMD[]    PROGMEM;
-extern const char TEXT_REMW[]    PROGMEM;
-extern const char TEXT_RESTORE[] PROGMEM;
-using common::TEXT_RET;
-using common::TEXT_RETI;
-extern const char TEXT_RETT[]    PROGMEM;
-extern const char TEXT_ROTB[]    PROGMEM;
-extern const char TEXT_ROTD[]    PROGMEM;
-extern const char TEXT_ROTW[]    PROGMEM;
-extern const char TEXT_RXP[]     PROGMEM;
-extern const char TEXT_SAVE[]    PROGMEM;
-extern const char TEXT_SBITB[]   PROGMEM;
-extern const char TEXT_SBITD[]   PROGMEM;
-extern const char TEXT_SBITIB[]  PROGMEM;
-extern const char TEXT_SBITID[]  PROGMEM;
-extern const char TEXT_SBITIW[]  PROGMEM;
-extern const char TEXT_SBITW[]   PROGMEM;
-extern const char TEXT_SCCB[]    PROGMEM;
-extern const char TEXT_SCCD[]    PROGMEM;
-extern const char TEXT_SCCW[]    PROGMEM;
-extern const char TEXT_SCSB[]    PROGMEM;
-extern const char TEXT_SCSD[]    PROGMEM;
-extern const char TEXT_SCSW[]    PROGMEM;
-extern const char TEXT_SEQB[]    PROGMEM;
-extern const char TEXT_SEQD[]    PROGMEM;
-extern const char TEXT_SEQW[]    PROGMEM;
-extern const char TEXT_SETCFG[]  PROGMEM;
-extern const char TEXT_SFCB[]    PROGMEM;
-extern const char TEXT_SFCD[]    PROGMEM;
-extern const char TEXT_SFCW[]    PROGMEM;
-extern const char TEXT_SFSB[]    PROGMEM;
-extern const char TEXT_SFSD[]    PROGMEM;
-extern const char TEXT_SFSR[]    PROGMEM;
-extern const char TEXT_SFSW[]    PROGMEM;
-extern const char TEXT_SGEB[]    PROGMEM;
-extern const char TEXT_SGED[]    PROGMEM;
-extern const char TEXT_SGEW[]    PROGMEM;
-extern const char TEXT_SGTB[]    PROGMEM;
-extern const char TEXT_SGTD[]    PROGMEM;
-extern const char TEXT_SGTW[]    PROGMEM;
-extern const char TEXT_SHIB[]    PROGMEM;
-extern const char TEXT_SHID[]    PROGMEM;
-extern const char TEXT_SHIW[]    PROGMEM;
-extern const char TEXT_SHSB[]    PROGMEM;
-extern const char TEXT_SHSD[]    PROGMEM;
-extern const char TEXT_SHSW[]    PROGMEM;
-extern const char TEXT_SKPSB[]   PROGMEM;
-extern const char TEXT_SKPSD[]   PROGMEM;
-extern const char TEXT_SKPST[]   PROGMEM;
-extern const char TEXT_SKPSW[]   PROGMEM;
-extern const char TEXT_SLEB[]    PROGMEM;
-extern const char TEXT_SLED[]    PROGMEM;
-extern const char TEXT_SLEW[]    PROGMEM;
-extern const char TEXT_SLOB[]    PROGMEM;
-extern const char TEXT_SLOD[]    PROGMEM;
-extern const char TEXT_SLOW[]    PROGMEM;
-extern const char TEXT_SLSB[]    PROGMEM;
-extern const char TEXT_SLSD[]    PROGMEM;
-extern const char TEXT_SLSW[]    PROGMEM;
-extern const char TEXT_SLTB[]    PROGMEM;
-extern const char TEXT_SLTD[]    PROGMEM;
-extern const char TEXT_SLTW[]    PROGMEM;
-extern const char TEXT_SNEB[]    PROGMEM;
-extern const char TEXT_SNED[]    PROGMEM;
-extern const char TEXT_SNEW[]    PROGMEM;
-extern const char TEXT_SPRB[]    PROGMEM;
-extern const char TEXT_SPRD[]    PROGMEM;
-extern const char TEXT_SPRW[]    PROGMEM;
-using common::TEXT_SUBB;
-using common::TEXT_SUBCB;
-extern const char TEXT_SUBCD[]   PROGMEM;
-extern const char TEXT_SUBCW[]   PROGMEM;
-using common::TEXT_SUBD;
-extern const char TEXT_SUBPB[]   PROGMEM;
-extern const char TEXT_SUBPD[]   PROGMEM;
-extern const char TEXT_SUBPW[]   PROGMEM;
-using common::TEXT_SUBW;
-using common::TEXT_SVC;
-extern const char TEXT_TBITB[]   PROGMEM;
-extern const char TEXT_TBITD[]   PROGMEM;
-extern const char TEXT_TBITW[]   PROGMEM;
-using common::TEXT_WAIT;
-using common::TEXT_XORB;
-extern const char TEXT_XORD[]    PROGMEM;
-extern const char TEXT_XORW[]    PROGMEM;
-// Floating point instructions
-extern const char TEXT_ABSF[]    PROGMEM;
-extern const char TEXT_ABSL[]    PROGMEM;
-using common::TEXT_ADDF;
-using common::TEXT_ADDL;
-using common::TEXT_CMPF;
-using common::TEXT_CMPL;
-extern const char TEXT_DIVF[]    PROGMEM;
-using common::TEXT_DIVL;
-extern const char TEXT_FLOORFB[] PROGMEM;
-extern const char TEXT_FLOORFD[] PROGMEM;
-extern const char TEXT_FLOORFW[] PROGMEM;
-extern const char TEXT_FLOORLB[] PROGMEM;
-extern const char TEXT_FLOORLD[] PROGMEM;
-extern const char TEXT_FLOORLW[] PROGMEM;
-extern const char TEXT_MOVBF[]   PROGMEM;
-extern const char TEXT_MOVBL[]   PROGMEM;
-extern const char TEXT_MOVDF[]   PROGMEM;
-extern const char TEXT_MOVDL[]   PROGMEM;
-extern const char TEXT_MOVF[]    PROGMEM;
-extern const char TEXT_MOVFL[]   PROGMEM;
-extern const char TEXT_MOVL[]    PROGMEM;
-extern const char TEXT_MOVLF[]   PROGMEM;
-extern const char TEXT_MOVWF[]   PROGMEM;
-extern const char TEXT_MOVWL[]   PROGMEM;
-extern const char TEXT_MULF[]    PROGMEM;
-extern const char TEXT_MULL[]    PROGMEM;
-extern const char TEXT_NEGF[]    PROGMEM;
-extern const char TEXT_NEGL[]    PROGMEM;
-extern const char TEXT_ROUNDFB[] PROGMEM;
-extern const char TEXT_ROUNDFD[] PROGMEM;
-extern const char TEXT_ROUNDFW[] PROGMEM;
-extern const char TEXT_ROUNDLB[] PROGMEM;
-extern const char TEXT_ROUNDLD[] PROGMEM;
-extern const char TEXT_ROUNDLW[] PROGMEM;
-using common::TEXT_SUBF;
-using common::TEXT_SUBL;
-extern const char TEXT_TRUNCFB[] PROGMEM;
-extern const char TEXT_TRUNCFD[] PROGMEM;
-extern const char TEXT_TRUNCFW[] PROGMEM;
-extern const char TEXT_TRUNCLB[] PROGMEM;
-extern const char TEXT_TRUNCLD[] PROGMEM;
-extern const char TEXT_TRUNCLW[] PROGMEM;
-// Memory management instructions
-extern const char TEXT_LMR[]     PROGMEM;
-extern const char TEXT_MOVSUB[]  PROGMEM;
-extern const char TEXT_MOVSUD[]  PROGMEM;
-extern const char TEXT_MOVSUW[]  PROGMEM;
-extern const char TEXT_MOVUSB[]  PROGMEM;
-extern const char TEXT_MOVUSD[]  PROGMEM;
-extern const char TEXT_MOVUSW[]  PROGMEM;
-extern const char TEXT_RDVAL[]   PROGMEM;
-extern const char TEXT_SMR[]     PROGMEM;
-extern const char TEXT_WRVAL[]   PROGMEM;
-
-using common::TEXT_REG_R0;
-using common::TEXT_REG_R1;
-using common::TEXT_REG_R2;
-using common::TEXT_REG_R3;
-using common::TEXT_REG_R4;
-using common::TEXT_REG_R5;
-using common::TEXT_REG_R6;
-using common::TEXT_REG_R7;
-
-extern const char TEXT_REG_FP[]  PROGMEM;
-using common::TEXT_REG_SP;
-extern const char TEXT_REG_SB[]  PROGMEM;
-using common::TEXT_REG_PC;
-extern const char TEXT_REG_TOS[] PROGMEM;
-extern const char TEXT_REG_EXT[] PROGMEM;
-
-// NS32081/FPU Registers
-using common::TEXT_REG_F0;
-using common::TEXT_REG_F1;
-extern const char TEXT_REG_F2[] PROGMEM;
-extern const char TEXT_REG_F3[] PROGMEM;
-extern const char TEXT_REG_F4[] PROGMEM;
-extern const char TEXT_REG_F5[] PROGMEM;
-extern const char TEXT_REG_F6[] PROGMEM;
-extern const char TEXT_REG_F7[] PROGMEM;
-
-extern const char TEXT_PREG_UPSR[]    PROGMEM;
-extern const char TEXT_PREG_US[]      PROGMEM;
-extern const char TEXT_PREG_PSR[]     PROGMEM;
-extern const char TEXT_PREG_INTBASE[] PROGMEM;
-extern const char TEXT_PREG_MOD[]     PROGMEM;
-
-// NS32082/MMU registers.
-extern const char TEXT_MREG_BPR0[] PROGMEM;
-extern const char TEXT_MREG_BPR1[] PROGMEM;
-extern const char TEXT_MREG_MSR[]  PROGMEM;
-extern const char TEXT_MREG_BCNT[] PROGMEM;
-extern const char TEXT_MREG_PTB0[] PROGMEM;
-extern const char TEXT_MREG_PTB1[] PROGMEM;
-extern const char TEXT_MREG_EIA[]  PROGMEM;
-
-extern const char TEXT_CONFIG_I[] PROGMEM;
-extern const char TEXT_CONFIG_F[] PROGMEM;
-extern const char TEXT_CONFIG_M[] PROGMEM;
-extern const char TEXT_CONFIG_C[] PROGMEM;
-
-extern const char TEXT_STROPT_B[] PROGMEM;
-extern const char TEXT_STROPT_W[] PROGMEM;
-extern const char TEXT_STROPT_U[] PROGMEM;
+#define TEXT_NS32000_LIST(T, A)          \
+    T(TEXT_CPU_NS32032,  "NS32032")      \
+    T(TEXT_FPU_NS32081,  "NS32081")      \
+    T(TEXT_MMU_NS32082,  "NS32082")      \
+    T(TEXT_CPU_32032,    "32032")        \
+    T(TEXT_none,         "none")         \
+    T(TEXT_FPU,          "FPU")          \
+    T(TEXT_PMMU,         "PMMU")         \
+    /* Standard instructions */          \
+    T(TEXT_ABSB,         "ABSB")         \
+    T(TEXT_ABSD,         "ABSD")         \
+    T(TEXT_ABSW,         "ABSW")         \
+    T(TEXT_ACBB,         "ACBB")         \
+    T(TEXT_ACBD,         "ACBD")         \
+    T(TEXT_ACBW,         "ACBW")         \
+    T(TEXT_ADDB,         "ADDB")         \
+    T(TEXT_ADDCB,        "ADDCB")        \
+    T(TEXT_ADDCD,        "ADDCD")        \
+    T(TEXT_ADDCW,        "ADDCW")        \
+    T(TEXT_ADDD,         "ADDD")         \
+    T(TEXT_ADDPB,        "ADDPB")        \
+    T(TEXT_ADDPD,        "ADDPD")        \
+    T(TEXT_ADDPW,        "ADDPW")        \
+    T(TEXT_ADDQB,        "ADDQB")        \
+    T(TEXT_ADDQD,        "ADDQD")        \
+    T(TEXT_ADDQW,        "ADDQW")        \
+    T(TEXT_ADDR,         "ADDR")         \
+    T(TEXT_ADDW,         "ADDW")         \
+    T(TEXT_ADJSPB,       "ADJSPB")       \
+    T(TEXT_ADJSPD,       "ADJSPD")       \
+    T(TEXT_ADJSPW,       "ADJSPW")       \
+    T(TEXT_ANDB,         "ANDB")         \
+    T(TEXT_ANDD,         "ANDD")         \
+    T(TEXT_ANDW,         "ANDW")         \
+    T(TEXT_ASHB,         "ASHB")         \
+    T(TEXT_ASHD,         "ASHD")         \
+    T(TEXT_ASHW,         "ASHW")         \
+    T(TEXT_BCC,          "BCC")          \
+    T(TEXT_BCS,          "BCS")          \
+    T(TEXT_BEQ,          "BEQ")          \
+    T(TEXT_BFC,          "BFC")          \
+    T(TEXT_BFS,          "BFS")          \
+    T(TEXT_BGE,          "BGE")          \
+    T(TEXT_BGT,          "BGT")          \
+    T(TEXT_BHI,          "BHI")          \
+    T(TEXT_BHS,          "BHS")          \
+    T(TEXT_BICB,         "BICB")         \
+    T(TEXT_BICD,         "BICD")         \
+    T(TEXT_BICPSRB,      "BICPSRB")      \
+    T(TEXT_BICPSRW,      "BICPSRW")      \
+    T(TEXT_BICW,         "BICW")         \
+    T(TEXT_BISPSRB,      "BISPSRB")      \
+    T(TEXT_BISPSRW,      "BISPSRW")      \
+    T(TEXT_BLE,          "BLE")          \
+    T(TEXT_BLO,          "BLO")          \
+    T(TEXT_BLS,          "BLS")          \
+    T(TEXT_BLT,          "BLT")          \
+    T(TEXT_BNE,          "BNE")          \
+    T(TEXT_BPT,          "BPT")          \
+    T(TEXT_BR,           "BR")           \
+    T(TEXT_BSR,          "BSR")          \
+    T(TEXT_CASEB,        "CASEB")        \
+    T(TEXT_CASED,        "CASED")        \
+    T(TEXT_CASEW,        "CASEW")        \
+    T(TEXT_CBITB,        "CBITB")        \
+    T(TEXT_CBITD,        "CBITD")        \
+    T(TEXT_CBITIB,       "CBITIB")       \
+    T(TEXT_CBITID,       "CBITID")       \
+    T(TEXT_CBITIW,       "CBITIW")       \
+    T(TEXT_CBITW,        "CBITW")        \
+    T(TEXT_CHECKB,       "CHECKB")       \
+    T(TEXT_CHECKD,       "CHECKD")       \
+    T(TEXT_CHECKW,       "CHECKW")       \
+    T(TEXT_CINV,         "CINV")         \
+    T(TEXT_CMPB,         "CMPB")         \
+    T(TEXT_CMPD,         "CMPD")         \
+    T(TEXT_CMPMB,        "CMPMB")        \
+    T(TEXT_CMPMD,        "CMPMD")        \
+    T(TEXT_CMPMW,        "CMPMW")        \
+    T(TEXT_CMPQB,        "CMPQB")        \
+    T(TEXT_CMPQD,        "CMPQD")        \
+    T(TEXT_CMPQW,        "CMPQW")        \
+    T(TEXT_CMPSB,        "CMPSB")        \
+    T(TEXT_CMPSD,        "CMPSD")        \
+    T(TEXT_CMPST,        "CMPST")        \
+    T(TEXT_CMPSW,        "CMPSW")        \
+    T(TEXT_CMPW,         "CMPW")         \
+    T(TEXT_COMB,         "COMB")         \
+    T(TEXT_COMD,         "COMD")         \
+    T(TEXT_COMW,         "COMW")         \
+    T(TEXT_CVTP,         "CVTP")         \
+    T(TEXT_CXP,          "CXP")          \
+    T(TEXT_CXPD,         "CXPD")         \
+    T(TEXT_DEIB,         "DEIB")         \
+    T(TEXT_DEID,         "DEID")         \
+    T(TEXT_DEIW,         "DEIW")         \
+    T(TEXT_DIA,          "DIA")          \
+    T(TEXT_DIVB,         "DIVB")         \
+    T(TEXT_DIVD,         "DIVD")         \
+    T(TEXT_DIVW,         "DIVW")         \
+    T(TEXT_ENTER,        "ENTER")        \
+    T(TEXT_EXIT,         "EXIT")         \
+    T(TEXT_EXTB,         "EXTB")         \
+    T(TEXT_EXTD,         "EXTD")         \
+    T(TEXT_EXTSB,        "EXTSB")        \
+    T(TEXT_EXTSD,        "EXTSD")        \
+    T(TEXT_EXTSW,        "EXTSW")        \
+    T(TEXT_EXTW,         "EXTW")         \
+    T(TEXT_FFSB,         "FFSB")         \
+    T(TEXT_FFSD,         "FFSD")         \
+    T(TEXT_FFSW,         "FFSW")         \
+    T(TEXT_FLAG,         "FLAG")         \
+    T(TEXT_IBITB,        "IBITB")        \
+    T(TEXT_IBITD,        "IBITD")        \
+    T(TEXT_IBITW,        "IBITW")        \
+    T(TEXT_INDEXB,       "INDEXB")       \
+    T(TEXT_INDEXD,       "INDEXD")       \
+    T(TEXT_INDEXW,       "INDEXW")       \
+    T(TEXT_INSB,         "INSB")         \
+    T(TEXT_INSD,         "INSD")         \
+    T(TEXT_INSSB,        "INSSB")        \
+    T(TEXT_INSSD,        "INSSD")        \
+    T(TEXT_INSSW,        "INSSW")        \
+    T(TEXT_INSW,         "INSW")         \
+    T(TEXT_JSR,          "JSR")          \
+    T(TEXT_JUMP,         "JUMP")         \
+    T(TEXT_LPRB,         "LPRB")         \
+    T(TEXT_LPRD,         "LPRD")         \
+    T(TEXT_LPRW,         "LPRW")         \
+    T(TEXT_LFSR,         "LFSR")         \
+    T(TEXT_LSHB,         "LSHB")         \
+    T(TEXT_LSHD,         "LSHD")         \
+    T(TEXT_LSHW,         "LSHW")         \
+    T(TEXT_MEIB,         "MEIB")         \
+    T(TEXT_MEID,         "MEID")         \
+    T(TEXT_MEIW,         "MEIW")         \
+    T(TEXT_MODB,         "MODB")         \
+    T(TEXT_MODD,         "MODD")         \
+    T(TEXT_MODW,         "MODW")         \
+    T(TEXT_MOVB,         "MOVB")         \
+    T(TEXT_MOVD,         "MOVD")         \
+    T(TEXT_MOVMB,        "MOVMB")        \
+    T(TEXT_MOVMD,        "MOVMD")        \
+    T(TEXT_MOVMW,        "MOVMW")        \
+    T(TEXT_MOVQB,        "MOVQB")        \
+    T(TEXT_MOVQD,        "MOVQD")        \
+    T(TEXT_MOVQW,        "MOVQW")        \
+    T(TEXT_MOVSB,        "MOVSB")        \
+    T(TEXT_MOVSD,        "MOVSD")        \
+    T(TEXT_MOVST,        "MOVST")        \
+    T(TEXT_MOVSW,        "MOVSW")        \
+    T(TEXT_MOVW,         "MOVW")         \
+    T(TEXT_MOVXBD,       "MOVXBD")       \
+    T(TEXT_MOVXBW,       "MOVXBW")       \
+    T(TEXT_MOVXWD,       "MOVXWD")       \
+    T(TEXT_MOVZBD,       "MOVZBD")       \
+    T(TEXT_MOVZBW,       "MOVZBW")       \
+    T(TEXT_MOVZWD,       "MOVZWD")       \
+    T(TEXT_MULB,         "MULB")         \
+    T(TEXT_MULD,         "MULD")         \
+    T(TEXT_MULW,         "MULW")         \
+    T(TEXT_NEGB,         "NEGB")         \
+    T(TEXT_NEGD,         "NEGD")         \
+    T(TEXT_NEGW,         "NEGW")         \
+    T(TEXT_NOP,          "NOP")          \
+    T(TEXT_NOTB,         "NOTB")         \
+    T(TEXT_NOTD,         "NOTD")         \
+    T(TEXT_NOTW,         "NOTW")         \
+    T(TEXT_ORB,          "ORB")          \
+    T(TEXT_ORD,          "ORD")          \
+    T(TEXT_ORW,          "ORW")          \
+    T(TEXT_QUOB,         "QUOB")         \
+    T(TEXT_QUOD,         "QUOD")         \
+    T(TEXT_QUOW,         "QUOW")         \
+    T(TEXT_REMB,         "REMB")         \
+    T(TEXT_REMD,         "REMD")         \
+    T(TEXT_REMW,         "REMW")         \
+    T(TEXT_RESTORE,      "RESTORE")      \
+    T(TEXT_RET,          "RET")          \
+    T(TEXT_RETI,         "RETI")         \
+    T(TEXT_RETT,         "RETT")         \
+    T(TEXT_ROTB,         "ROTB")         \
+    T(TEXT_ROTD,         "ROTD")         \
+    T(TEXT_ROTW,         "ROTW")         \
+    T(TEXT_RXP,          "RXP")          \
+    T(TEXT_SAVE,         "SAVE")         \
+    T(TEXT_SBITB,        "SBITB")        \
+    T(TEXT_SBITD,        "SBITD")        \
+    T(TEXT_SBITIB,       "SBITIB")       \
+    T(TEXT_SBITID,       "SBITID")       \
+    T(TEXT_SBITIW,       "SBITIW")       \
+    T(TEXT_SBITW,        "SBITW")        \
+    T(TEXT_SCCB,         "SCCB")         \
+    T(TEXT_SCCD,         "SCCD")         \
+    T(TEXT_SCCW,         "SCCW")         \
+    T(TEXT_SCSB,         "SCSB")         \
+    T(TEXT_SCSD,         "SCSD")         \
+    T(TEXT_SCSW,         "SCSW")         \
+    T(TEXT_SEQB,         "SEQB")         \
+    T(TEXT_SEQD,         "SEQD")         \
+    T(TEXT_SEQW,         "SEQW")         \
+    T(TEXT_SETCFG,       "SETCFG")       \
+    T(TEXT_SFCB,         "SFCB")         \
+    T(TEXT_SFCD,         "SFCD")         \
+    T(TEXT_SFCW,         "SFCW")         \
+    T(TEXT_SFSB,         "SFSB")         \
+    T(TEXT_SFSD,         "SFSD")         \
+    T(TEXT_SFSR,         "SFSR")         \
+    T(TEXT_SFSW,         "SFSW")         \
+    T(TEXT_SGEB,         "SGEB")         \
+    T(TEXT_SGED,         "SGED")         \
+    T(TEXT_SGEW,         "SGEW")         \
+    T(TEXT_SGTB,         "SGTB")         \
+    T(TEXT_SGTD,         "SGTD")         \
+    T(TEXT_SGTW,         "SGTW")         \
+    T(TEXT_SHIB,         "SHIB")         \
+    T(TEXT_SHID,         "SHID")         \
+    T(TEXT_SHIW,         "SHIW")         \
+    T(TEXT_SHSB,         "SHSB")         \
+    T(TEXT_SHSD,         "SHSD")         \
+    T(TEXT_SHSW,         "SHSW")         \
+    T(TEXT_SKPSB,        "SKPSB")        \
+    T(TEXT_SKPSD,        "SKPSD")        \
+    T(TEXT_SKPST,        "SKPST")        \
+    T(TEXT_SKPSW,        "SKPSW")        \
+    T(TEXT_SLEB,         "SLEB")         \
+    T(TEXT_SLED,         "SLED")         \
+    T(TEXT_SLEW,         "SLEW")         \
+    T(TEXT_SLOB,         "SLOB")         \
+    T(TEXT_SLOD,         "SLOD")         \
+    T(TEXT_SLOW,         "SLOW")         \
+    T(TEXT_SLSB,         "SLSB")         \
+    T(TEXT_SLSD,         "SLSD")         \
+    T(TEXT_SLSW,         "SLSW")         \
+    T(TEXT_SLTB,         "SLTB")         \
+    T(TEXT_SLTD,         "SLTD")         \
+    T(TEXT_SLTW,         "SLTW")         \
+    T(TEXT_SNEB,         "SNEB")         \
+    T(TEXT_SNED,         "SNED")         \
+    T(TEXT_SNEW,         "SNEW")         \
+    T(TEXT_SPRB,         "SPRB")         \
+    T(TEXT_SPRD,         "SPRD")         \
+    T(TEXT_SPRW,         "SPRW")         \
+    T(TEXT_SUBB,         "SUBB")         \
+    T(TEXT_SUBCB,        "SUBCB")        \
+    T(TEXT_SUBCD,        "SUBCD")        \
+    T(TEXT_SUBCW,        "SUBCW")        \
+    T(TEXT_SUBD,         "SUBD")         \
+    T(TEXT_SUBPB,        "SUBPB")        \
+    T(TEXT_SUBPD,        "SUBPD")        \
+    T(TEXT_SUBPW,        "SUBPW")        \
+    T(TEXT_SUBW,         "SUBW")         \
+    T(TEXT_SVC,          "SVC")          \
+    T(TEXT_TBITB,        "TBITB")        \
+    T(TEXT_TBITD,        "TBITD")        \
+    T(TEXT_TBITW,        "TBITW")        \
+    T(TEXT_WAIT,         "WAIT")         \
+    T(TEXT_XORB,         "XORB")         \
+    T(TEXT_XORD,         "XORD")         \
+    T(TEXT_XORW,         "XORW")         \
+    /* Floating point instructions */    \
+    T(TEXT_ABSF,         "ABSF")         \
+    T(TEXT_ABSL,         "ABSL")         \
+    T(TEXT_ADDF,         "ADDF")         \
+    T(TEXT_ADDL,         "ADDL")         \
+    T(TEXT_CMPF,         "CMPF")         \
+    T(TEXT_CMPL,         "CMPL")         \
+    T(TEXT_DIVF,         "DIVF")         \
+    T(TEXT_DIVL,         "DIVL")         \
+    T(TEXT_FLOORFB,      "FLOORFB")      \
+    T(TEXT_FLOORFD,      "FLOORFD")      \
+    T(TEXT_FLOORFW,      "FLOORFW")      \
+    T(TEXT_FLOORLB,      "FLOORLB")      \
+    T(TEXT_FLOORLD,      "FLOORLD")      \
+    T(TEXT_FLOORLW,      "FLOORLW")      \
+    T(TEXT_MOVBF,        "MOVBF")        \
+    T(TEXT_MOVBL,        "MOVBL")        \
+    T(TEXT_MOVDF,        "MOVDF")        \
+    T(TEXT_MOVDL,        "MOVDL")        \
+    T(TEXT_MOVF,         "MOVF")         \
+    T(TEXT_MOVFL,        "MOVFL")        \
+    T(TEXT_MOVL,         "MOVL")         \
+    T(TEXT_MOVLF,        "MOVLF")        \
+    T(TEXT_MOVWF,        "MOVWF")        \
+    T(TEXT_MOVWL,        "MOVWL")        \
+    T(TEXT_MULF,         "MULF")         \
+    T(TEXT_MULL,         "MULL")         \
+    T(TEXT_NEGF,         "NEGF")         \
+    T(TEXT_NEGL,         "NEGL")         \
+    T(TEXT_ROUNDFB,      "ROUNDFB")      \
+    T(TEXT_ROUNDFD,      "ROUNDFD")      \
+    T(TEXT_ROUNDFW,      "ROUNDFW")      \
+    T(TEXT_ROUNDLB,      "ROUNDLB")      \
+    T(TEXT_ROUNDLD,      "ROUNDLD")      \
+    T(TEXT_ROUNDLW,      "ROUNDLW")      \
+    T(TEXT_SUBF,         "SUBF")         \
+    T(TEXT_SUBL,         "SUBL")         \
+    T(TEXT_TRUNCFB,      "TRUNCFB")      \
+    T(TEXT_TRUNCFD,      "TRUNCFD")      \
+    T(TEXT_TRUNCFW,      "TRUNCFW")      \
+    T(TEXT_TRUNCLB,      "TRUNCLB")      \
+    T(TEXT_TRUNCLD,      "TRUNCLD")      \
+    T(TEXT_TRUNCLW,      "TRUNCLW")      \
+    /* Memory management instructions */ \
+    T(TEXT_LMR,          "LMR")          \
+    T(TEXT_MOVSUB,       "MOVSUB")       \
+    T(TEXT_MOVSUD,       "MOVSUD")       \
+    T(TEXT_MOVSUW,       "MOVSUW")       \
+    T(TEXT_MOVUSB,       "MOVUSB")       \
+    T(TEXT_MOVUSD,       "MOVUSD")       \
+    T(TEXT_MOVUSW,       "MOVUSW")       \
+    T(TEXT_RDVAL,        "RDVAL")        \
+    T(TEXT_SMR,          "SMR")          \
+    T(TEXT_WRVAL,        "WRVAL")        \
+    T(TEXT_REG_R0,       "R0")           \
+    T(TEXT_REG_R1,       "R1")           \
+    T(TEXT_REG_R2,       "R2")           \
+    T(TEXT_REG_R3,       "R3")           \
+    T(TEXT_REG_R4,       "R4")           \
+    T(TEXT_REG_R5,       "R5")           \
+    T(TEXT_REG_R6,       "R6")           \
+    T(TEXT_REG_R7,       "R7")           \
+    T(TEXT_REG_FP,       "FP")           \
+    T(TEXT_REG_SP,       "SP")           \
+    T(TEXT_REG_SB,       "SB")           \
+    T(TEXT_REG_PC,       "PC")           \
+    T(TEXT_REG_TOS,      "TOS")          \
+    T(TEXT_REG_EXT,      "EXT")          \
+    /* NS32081/FPU Registers */          \
+    T(TEXT_REG_F0,       "F0")           \
+    T(TEXT_REG_F1,       "F1")           \
+    T(TEXT_REG_F2,       "F2")           \
+    T(TEXT_REG_F3,       "F3")           \
+    T(TEXT_REG_F4,       "F4")           \
+    T(TEXT_REG_F5,       "F5")           \
+    T(TEXT_REG_F6,       "F6")           \
+    T(TEXT_REG_F7,       "F7")           \
+    T(TEXT_PREG_UPSR,    "UPSR")         \
+    T(TEXT_PREG_US,      "US")           \
+    T(TEXT_PREG_PSR,     "PSR")          \
+    T(TEXT_PREG_INTBASE, "INTBASE")      \
+    T(TEXT_PREG_MOD,     "MOD")          \
+    /* NS32082/MMU registers. */         \
+    T(TEXT_MREG_BPR0,    "BPR0")         \
+    T(TEXT_MREG_BPR1,    "BPR1")         \
+    T(TEXT_MREG_MSR,     "MSR")          \
+    T(TEXT_MREG_BCNT,    "BCNT")         \
+    T(TEXT_MREG_PTB0,    "PTB0")         \
+    T(TEXT_MREG_PTB1,    "PTB1")         \
+    T(TEXT_MREG_EIA,     "EIA")          \
+    T(TEXT_CONFIG_I,     "I")            \
+    T(TEXT_CONFIG_F,     "F")            \
+    T(TEXT_CONFIG_M,     "M")            \
+    T(TEXT_CONFIG_C,     "C")            \
+    T(TEXT_STROPT_B,     "B")            \
+    T(TEXT_STROPT_W,     "W")            \
+    T(TEXT_STROPT_U,     "U")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_NS32000_LIST);
+
 }  // namespace ns32000
 }  // namespace text
 }  // namespace libasm
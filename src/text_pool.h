@@ -0,0 +1,81 @@
+/*
+ * Copyright 2022 Tadashi G. Takaoka
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TEXT_POOL_H__
+#define __TEXT_POOL_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config_host.h"
+
+namespace libasm {
+namespace text {
+
+/**
+ * A text in a string pool |POOL| in PROGMEM, which is referenced by a 16-bit offset so that
+ * instruction and register tables don't have to hold full pointers. It can be used where a
+ * PROGMEM string is expected.
+ */
+template <const /*PROGMEM*/ char *POOL>
+struct Text {
+    constexpr Text(uint16_t offset) : _offset(offset) {}
+    constexpr operator const /*PROGMEM*/ char *() const { return POOL + _offset; }
+    constexpr uint16_t offset() const { return _offset; }
+
+    static const /*PROGMEM*/ char *at(uint16_t offset) { return POOL + offset; }
+
+private:
+    uint16_t _offset;
+};
+
+}  // namespace text
+}  // namespace libasm
+
+/**
+ * A string pool is defined by a list macro |LIST(T, A)|; |T(TEXT_name, "text")| adds a text to
+ * the pool and |A(TEXT_alias, TEXT_name)| makes an alias of the text which is already added.
+ *
+ * DECLARE_TEXT_POOL(LIST) declares the pool |TEXT_POOL| and |Text| constants of all texts in the
+ * current namespace, and DEFINE_TEXT_POOL(LIST) defines the pool, which is a concatenation of
+ * all texts with terminating NULs.
+ */
+#define TEXT_POOL_MEMBER_(name, str) char name[sizeof(str)];
+#define TEXT_POOL_IGNORE_(name, other)
+#define TEXT_POOL_TEXT_(name, str) \
+    constexpr ::libasm::text::Text<TEXT_POOL> name{offsetof(TextLayout, name)};
+#define TEXT_POOL_ALIAS_(name, other) constexpr ::libasm::text::Text<TEXT_POOL> name = other;
+#define TEXT_POOL_STRING_(name, str) str "\0"
+
+#define DECLARE_TEXT_POOL(LIST)                                                          \
+    struct TextLayout {                                                                  \
+        LIST(TEXT_POOL_MEMBER_, TEXT_POOL_IGNORE_)                                       \
+    };                                                                                   \
+    static_assert(sizeof(TextLayout) <= UINT16_MAX, "text pool exceeds 16-bit offset"); \
+    extern const char TEXT_POOL[sizeof(TextLayout) + 1] PROGMEM;                         \
+    LIST(TEXT_POOL_TEXT_, TEXT_POOL_ALIAS_)
+
+#define DEFINE_TEXT_POOL(LIST) \
+    const char TEXT_POOL[sizeof(TextLayout) + 1] PROGMEM = LIST(TEXT_POOL_STRING_, TEXT_POOL_IGNORE_)
+
+#endif  // __TEXT_POOL_H__
+
+// Local Variables:
+// mode: c++
+// c-basic-offset: 4
+// tab-width: 4
+// End:
+// vim: set ft=cpp et ts=4 sw=4:
@@ -18,101 +18,102 @@
 #define __TEXT_SCN2650__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace scn2650 {
 
 // clang-format off
-extern const char TEXT_CPU_SCN2650[] PROGMEM;
-extern const char TEXT_CPU_2650[]    PROGMEM;
-
-using common::TEXT_null;
-
-// SCN2650
-using common::TEXT_ADDA;
-using common::TEXT_ADDI;
-using common::TEXT_ADDR;
-extern const char TEXT_ADDZ[] PROGMEM;
-using common::TEXT_ANDA;
-using common::TEXT_ANDI;
-using common::TEXT_ANDR;
-extern const char TEXT_ANDZ[] PROGMEM;
-extern const char TEXT_BCFA[] PROGMEM;
-extern const char TEXT_BCFR[] PROGMEM;
-extern const char TEXT_BCTA[] PROGMEM;
-extern const char TEXT_BCTR[] PROGMEM;
-extern const char TEXT_BDRA[] PROGMEM;
-extern const char TEXT_BDRR[] PROGMEM;
-extern const char TEXT_BIRA[] PROGMEM;
-extern const char TEXT_BIRR[] PROGMEM;
-extern const char TEXT_BRNA[] PROGMEM;
-extern const char TEXT_BRNR[] PROGMEM;
-extern const char TEXT_BSFA[] PROGMEM;
-extern const char TEXT_BSFR[] PROGMEM;
-extern const char TEXT_BSNA[] PROGMEM;
-extern const char TEXT_BSNR[] PROGMEM;
-extern const char TEXT_BSTA[] PROGMEM;
-extern const char TEXT_BSTR[] PROGMEM;
-extern const char TEXT_BSXA[] PROGMEM;
-extern const char TEXT_BXA[]  PROGMEM;
-using common::TEXT_COMA;
-extern const char TEXT_COMI[] PROGMEM;
-extern const char TEXT_COMR[] PROGMEM;
-extern const char TEXT_COMZ[] PROGMEM;
-extern const char TEXT_CPSL[] PROGMEM;
-extern const char TEXT_CPSU[] PROGMEM;
-extern const char TEXT_DAR[]  PROGMEM;
-using common::TEXT_EORA;
-using common::TEXT_EORI;
-using common::TEXT_EORR;
-extern const char TEXT_EORZ[] PROGMEM;
-using common::TEXT_HALT;
-extern const char TEXT_IORA[] PROGMEM;
-extern const char TEXT_IORI[] PROGMEM;
-extern const char TEXT_IORR[] PROGMEM;
-extern const char TEXT_IORZ[] PROGMEM;
-extern const char TEXT_LODA[] PROGMEM;
-extern const char TEXT_LODI[] PROGMEM;
-extern const char TEXT_LODR[] PROGMEM;
-extern const char TEXT_LODZ[] PROGMEM;
-extern const char TEXT_LPSL[] PROGMEM;
-extern const char TEXT_LPSU[] PROGMEM;
-using common::TEXT_NOP;
-extern const char TEXT_PPSL[] PROGMEM;
-extern const char TEXT_PPSU[] PROGMEM;
-extern const char TEXT_REDC[] PROGMEM;
-extern const char TEXT_REDD[] PROGMEM;
-extern const char TEXT_REDE[] PROGMEM;
-extern const char TEXT_RETC[] PROGMEM;
-extern const char TEXT_RETE[] PROGMEM;
-using common::TEXT_RRL;
-extern const char TEXT_RRR[]  PROGMEM;
-extern const char TEXT_SPSL[] PROGMEM;
-extern const char TEXT_SPSU[] PROGMEM;
-extern const char TEXT_STRA[] PROGMEM;
-extern const char TEXT_STRI[] PROGMEM;
-extern const char TEXT_STRR[] PROGMEM;
-extern const char TEXT_STRZ[] PROGMEM;
-using common::TEXT_SUBA;
-using common::TEXT_SUBI;
-using common::TEXT_SUBR;
-extern const char TEXT_SUBZ[] PROGMEM;
-extern const char TEXT_TMI[]  PROGMEM;
-extern const char TEXT_TPSL[] PROGMEM;
-extern const char TEXT_TPSU[] PROGMEM;
-extern const char TEXT_WRTC[] PROGMEM;
-extern const char TEXT_WRTD[] PROGMEM;
-extern const char TEXT_WRTE[] PROGMEM;
-extern const char TEXT_ZBRR[] PROGMEM;
-extern const char TEXT_ZBSR[] PROGMEM;
-
-using common::TEXT_CC_EQ;
-using common::TEXT_CC_GT;
-using common::TEXT_CC_LT;
-extern const char TEXT_CC_UN[] PROGMEM;
+#define TEXT_SCN2650_LIST(T, A)    \
+    T(TEXT_CPU_SCN2650, "SCN2650") \
+    T(TEXT_CPU_2650,    "2650")    \
+    T(TEXT_null,        "")        \
+    /* SCN2650 */                  \
+    T(TEXT_ADDA,        "ADDA")    \
+    T(TEXT_ADDI,        "ADDI")    \
+    T(TEXT_ADDR,        "ADDR")    \
+    T(TEXT_ADDZ,        "ADDZ")    \
+    T(TEXT_ANDA,        "ANDA")    \
+    T(TEXT_ANDI,        "ANDI")    \
+    T(TEXT_ANDR,        "ANDR")    \
+    T(TEXT_ANDZ,        "ANDZ")    \
+    T(TEXT_BCFA,        "BCFA")    \
+    T(TEXT_BCFR,        "BCFR")    \
+    T(TEXT_BCTA,        "BCTA")    \
+    T(TEXT_BCTR,        "BCTR")    \
+    T(TEXT_BDRA,        "BDRA")    \
+    T(TEXT_BDRR,        "BDRR")    \
+    T(TEXT_BIRA,        "BIRA")    \
+    T(TEXT_BIRR,        "BIRR")    \
+    T(TEXT_BRNA,        "BRNA")    \
+    T(TEXT_BRNR,        "BRNR")    \
+    T(TEXT_BSFA,        "BSFA")    \
+    T(TEXT_BSFR,        "BSFR")    \
+    T(TEXT_BSNA,        "BSNA")    \
+    T(TEXT_BSNR,        "BSNR")    \
+    T(TEXT_BSTA,        "BSTA")    \
+    T(TEXT_BSTR,        "BSTR")    \
+    T(TEXT_BSXA,        "BSXA")    \
+    T(TEXT_BXA,         "BXA")     \
+    T(TEXT_COMA,        "COMA")    \
+    T(TEXT_COMI,        "COMI")    \
+    T(TEXT_COMR,        "COMR")    \
+    T(TEXT_COMZ,        "COMZ")    \
+    T(TEXT_CPSL,        "CPSL")    \
+    T(TEXT_CPSU,        "CPSU")    \
+    T(TEXT_DAR,         "DAR")     \
+    T(TEXT_EORA,        "EORA")    \
+    T(TEXT_EORI,        "EORI")    \
+    T(TEXT_EORR,        "EORR")    \
+    T(TEXT_EORZ,        "EORZ")    \
+    T(TEXT_HALT,        "HALT")    \
+    T(TEXT_IORA,        "IORA")    \
+    T(TEXT_IORI,        "IORI")    \
+    T(TEXT_IORR,        "IORR")    \
+    T(TEXT_IORZ,        "IORZ")    \
+    T(TEXT_LODA,        "LODA")    \
+    T(TEXT_LODI,        "LODI")    \
+    T(TEXT_LODR,        "LODR")    \
+    T(TEXT_LODZ,        "LODZ")    \
+    T(TEXT_LPSL,        "LPSL")    \
+    T(TEXT_LPSU,        "LPSU")    \
+    T(TEXT_NOP,         "NOP")     \
+    T(TEXT_PPSL,        "PPSL")    \
+    T(TEXT_PPSU,        "PPSU")    \
+    T(TEXT_REDC,        "REDC")    \
+    T(TEXT_REDD,        "REDD")    \
+    T(TEXT_REDE,        "REDE")    \
+    T(TEXT_RETC,        "RETC")    \
+    T(TEXT_RETE,        "RETE")    \
+    T(TEXT_RRL,         "RRL")     \
+    T(TEXT_RRR,         "RRR")     \
+    T(TEXT_SPSL,        "SPSL")    \
+    T(TEXT_SPSU,        "SPSU")    \
+    T(TEXT_STRA,        "STRA")    \
+    T(TEXT_STRI,        "STRI")    \
+    T(TEXT_STRR,        "STRR")    \
+    T(TEXT_STRZ,        "STRZ")    \
+    T(TEXT_SUBA,        "SUBA")    \
+    T(TEXT_SUBI,        "SUBI")    \
+    T(TEXT_SUBR,        "SUBR")    \
+    T(TEXT_SUBZ,        "SUBZ")    \
+    T(TEXT_TMI,         "TMI")     \
+    T(TEXT_TPSL,        "TPSL")    \
+    T(TEXT_TPSU,        "TPSU")    \
+    T(TEXT_WRTC,        "WRTC")    \
+    T(TEXT_WRTD,        "WRTD")    \
+    T(TEXT_WRTE,        "WRTE")    \
+    T(TEXT_ZBRR,        "ZBRR")    \
+    T(TEXT_ZBSR,        "ZBSR")    \
+    T(TEXT_CC_EQ,       "EQ")      \
+    T(TEXT_CC_GT,       "GT")      \
+    T(TEXT_CC_LT,       "LT")      \
+    T(TEXT_CC_UN,       "UN")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_SCN2650_LIST);
+
 }  // namespace scn2650
 }  // namespace text
 }  // namespace libasm
@@ -18,131 +18,132 @@
 #define __TEXT_TLCS90__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace tlcs90 {
 
-extern const char TEXT_CPU_TLCS90[] PROGMEM;
-constexpr const char *TEXT_CPU_LIST = TEXT_CPU_TLCS90;
-
 // clang-format off
-using common::TEXT_ADC;
-using common::TEXT_ADD;
-using common::TEXT_AND;
-using common::TEXT_BIT;
-using common::TEXT_CALL;
-using common::TEXT_CALR;
-using common::TEXT_CCF;
-using common::TEXT_CP;
-using common::TEXT_CPD;
-using common::TEXT_CPDR;
-using common::TEXT_CPI;
-using common::TEXT_CPIR;
-using common::TEXT_CPL;
-using common::TEXT_DAA;
-using common::TEXT_DEC;
-using common::TEXT_DECW;
-using common::TEXT_DECX;
-using common::TEXT_DI;
-using common::TEXT_DIV;
-using common::TEXT_DJNZ;
-using common::TEXT_EI;
-using common::TEXT_EX;
-using common::TEXT_EXX;
-using common::TEXT_HALT;
-using common::TEXT_INC;
-using common::TEXT_INCW;
-using common::TEXT_INCX;
-using common::TEXT_JP;
-using common::TEXT_JR;
-extern const char TEXT_JRL[]  PROGMEM;
-using common::TEXT_LD;
-using common::TEXT_LDA;
-using common::TEXT_LDAR;
-using common::TEXT_LDD;
-using common::TEXT_LDDR;
-using common::TEXT_LDI;
-using common::TEXT_LDIR;
-using common::TEXT_LDW;
-using common::TEXT_MUL;
-using common::TEXT_NEG;
-using common::TEXT_NOP;
-using common::TEXT_OR;
-using common::TEXT_POP;
-using common::TEXT_PUSH;
-using common::TEXT_RCF;
-using common::TEXT_RES;
-using common::TEXT_RET;
-using common::TEXT_RETI;
-using common::TEXT_RL;
-using common::TEXT_RLA;
-using common::TEXT_RLC;
-using common::TEXT_RLCA;
-using common::TEXT_RLD;
-using common::TEXT_RR;
-using common::TEXT_RRA;
-using common::TEXT_RRC;
-using common::TEXT_RRCA;
-using common::TEXT_RRD;
-using common::TEXT_SBC;
-using common::TEXT_SCF;
-using common::TEXT_SET;
-using common::TEXT_SLA;
-extern const char TEXT_SLAA[] PROGMEM;
-using common::TEXT_SLL;
-extern const char TEXT_SLLA[] PROGMEM;
-using common::TEXT_SRA;
-extern const char TEXT_SRAA[] PROGMEM;
-using common::TEXT_SRL;
-extern const char TEXT_SRLA[] PROGMEM;
-using common::TEXT_SUB;
-using common::TEXT_SWI;
-using common::TEXT_TSET;
-using common::TEXT_XOR;
-
-using common::TEXT_REG_BC;
-using common::TEXT_REG_DE;
-using common::TEXT_REG_HL;
-using common::TEXT_REG_IX;
-using common::TEXT_REG_IY;
-using common::TEXT_REG_SP;
-using common::TEXT_REG_AFP;
-using common::TEXT_REG_AF;
-using common::TEXT_REG_A;
-using common::TEXT_REG_B;
-using common::TEXT_REG_C;
-using common::TEXT_REG_D;
-using common::TEXT_REG_E;
-using common::TEXT_REG_H;
-using common::TEXT_REG_L;
-
-using common::TEXT_CC_F;
-using common::TEXT_CC_LT;
-using common::TEXT_CC_LE;
-using common::TEXT_CC_ULE;
-using common::TEXT_CC_OV;
-using common::TEXT_CC_MI;
-using common::TEXT_CC_Z;
-using common::TEXT_CC_C;
-using common::TEXT_CC_T;
-using common::TEXT_CC_GE;
-using common::TEXT_CC_GT;
-using common::TEXT_CC_UGT;
-using common::TEXT_CC_NOV;
-using common::TEXT_CC_PL;
-using common::TEXT_CC_NZ;
-using common::TEXT_CC_NC;
-using common::TEXT_CC_PE;
-using common::TEXT_CC_M;
-using common::TEXT_CC_EQ;
-using common::TEXT_CC_ULT;
-using common::TEXT_CC_PO;
-using common::TEXT_CC_P;
-using common::TEXT_CC_NE;
-using common::TEXT_CC_UGE;
+#define TEXT_TLCS90_LIST(T, A)          \
+    T(TEXT_CPU_TLCS90, "TLCS90")        \
+    A(TEXT_CPU_LIST,   TEXT_CPU_TLCS90) \
+    T(TEXT_ADC,        "ADC")           \
+    T(TEXT_ADD,        "ADD")           \
+    T(TEXT_AND,        "AND")           \
+    T(TEXT_BIT,        "BIT")           \
+    T(TEXT_CALL,       "CALL")          \
+    T(TEXT_CALR,       "CALR")          \
+    T(TEXT_CCF,        "CCF")           \
+    T(TEXT_CP,         "CP")            \
+    T(TEXT_CPD,        "CPD")           \
+    T(TEXT_CPDR,       "CPDR")          \
+    T(TEXT_CPI,        "CPI")           \
+    T(TEXT_CPIR,       "CPIR")          \
+    T(TEXT_CPL,        "CPL")           \
+    T(TEXT_DAA,        "DAA")           \
+    T(TEXT_DEC,        "DEC")           \
+    T(TEXT_DECW,       "DECW")          \
+    T(TEXT_DECX,       "DECX")          \
+    T(TEXT_DI,         "DI")            \
+    T(TEXT_DIV,        "DIV")           \
+    T(TEXT_DJNZ,       "DJNZ")          \
+    T(TEXT_EI,         "EI")            \
+    T(TEXT_EX,         "EX")            \
+    T(TEXT_EXX,        "EXX")           \
+    T(TEXT_HALT,       "HALT")          \
+    T(TEXT_INC,        "INC")           \
+    T(TEXT_INCW,       "INCW")          \
+    T(TEXT_INCX,       "INCX")          \
+    T(TEXT_JP,         "JP")            \
+    T(TEXT_JR,         "JR")            \
+    T(TEXT_JRL,        "JRL")           \
+    T(TEXT_LD,         "LD")            \
+    T(TEXT_LDA,        "LDA")           \
+    T(TEXT_LDAR,       "LDAR")          \
+    T(TEXT_LDD,        "LDD")           \
+    T(TEXT_LDDR,       "LDDR")          \
+    T(TEXT_LDI,        "LDI")           \
+    T(TEXT_LDIR,       "LDIR")          \
+    T(TEXT_LDW,        "LDW")           \
+    T(TEXT_MUL,        "MUL")           \
+    T(TEXT_NEG,        "NEG")           \
+    T(TEXT_NOP,        "NOP")           \
+    T(TEXT_OR,         "OR")            \
+    T(TEXT_POP,        "POP")           \
+    T(TEXT_PUSH,       "PUSH")          \
+    T(TEXT_RCF,        "RCF")           \
+    T(TEXT_RES,        "RES")           \
+    T(TEXT_RET,        "RET")           \
+    T(TEXT_RETI,       "RETI")          \
+    T(TEXT_RL,         "RL")            \
+    T(TEXT_RLA,        "RLA")           \
+    T(TEXT_RLC,        "RLC")           \
+    T(TEXT_RLCA,       "RLCA")          \
+    T(TEXT_RLD,        "RLD")           \
+    T(TEXT_RR,         "RR")            \
+    T(TEXT_RRA,        "RRA")           \
+    T(TEXT_RRC,        "RRC")           \
+    T(TEXT_RRCA,       "RRCA")          \
+    T(TEXT_RRD,        "RRD")           \
+    T(TEXT_SBC,        "SBC")           \
+    T(TEXT_SCF,        "SCF")           \
+    T(TEXT_SET,        "SET")           \
+    T(TEXT_SLA,        "SLA")           \
+    T(TEXT_SLAA,       "SLAA")          \
+    T(TEXT_SLL,        "SLL")           \
+    T(TEXT_SLLA,       "SLLA")          \
+    T(TEXT_SRA,        "SRA")           \
+    T(TEXT_SRAA,       "SRAA")          \
+    T(TEXT_SRL,        "SRL")           \
+    T(TEXT_SRLA,       "SRLA")          \
+    T(TEXT_SUB,        "SUB")           \
+    T(TEXT_SWI,        "SWI")           \
+    T(TEXT_TSET,       "TSET")          \
+    T(TEXT_XOR,        "XOR")           \
+    T(TEXT_REG_BC,     "BC")            \
+    T(TEXT_REG_DE,     "DE")            \
+    T(TEXT_REG_HL,     "HL")            \
+    T(TEXT_REG_IX,     "IX")            \
+    T(TEXT_REG_IY,     "IY")            \
+    T(TEXT_REG_SP,     "SP")            \
+    T(TEXT_REG_AFP,    "AF'")           \
+    T(TEXT_REG_AF,     "AF")            \
+    T(TEXT_REG_A,      "A")             \
+    T(TEXT_REG_B,      "B")             \
+    T(TEXT_REG_C,      "C")             \
+    T(TEXT_REG_D,      "D")             \
+    T(TEXT_REG_E,      "E")             \
+    T(TEXT_REG_H,      "H")             \
+    T(TEXT_REG_L,      "L")             \
+    T(TEXT_CC_F,       "F")             \
+    T(TEXT_CC_LT,      "LT")            \
+    T(TEXT_CC_LE,      "LE")            \
+    T(TEXT_CC_ULE,     "ULE")           \
+    T(TEXT_CC_OV,      "OV")            \
+    T(TEXT_CC_MI,      "MI")            \
+    T(TEXT_CC_Z,       "Z")             \
+    A(TEXT_CC_C,       TEXT_REG_C)      \
+    T(TEXT_CC_T,       "")              \
+    T(TEXT_CC_GE,      "GE")            \
+    T(TEXT_CC_GT,      "GT")            \
+    T(TEXT_CC_UGT,     "UGT")           \
+    T(TEXT_CC_NOV,     "NOV")           \
+    T(TEXT_CC_PL,      "PL")            \
+    T(TEXT_CC_NZ,      "NZ")            \
+    T(TEXT_CC_NC,      "NC")            \
+    T(TEXT_CC_PE,      "PE")            \
+    T(TEXT_CC_M,       "M")             \
+    T(TEXT_CC_EQ,      "EQ")            \
+    T(TEXT_CC_ULT,     "ULT")           \
+    T(TEXT_CC_PO,      "PO")            \
+    T(TEXT_CC_P,       "P")             \
+    T(TEXT_CC_NE,      "NE")            \
+    T(TEXT_CC_UGE,     "UGE")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_TLCS90_LIST);
+
 }  // namespace tlcs90
 }  // namespace text
 }  // namespace libasm
@@ -18,79 +18,82 @@
 #define __TEXT_TMS32010__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace tms32010 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]  PROGMEM;
-extern const char TEXT_CPU_32010[] PROGMEM;
-extern const char TEXT_CPU_32015[] PROGMEM;
-
-// TMS32010
-using common::TEXT_ABS;
-using common::TEXT_ADD;
-extern const char TEXT_ADDH[] PROGMEM;
-extern const char TEXT_ADDS[] PROGMEM;
-using common::TEXT_AND;
-extern const char TEXT_APAC[] PROGMEM;
-using common::TEXT_B;
-extern const char TEXT_BANZ[] PROGMEM;
-extern const char TEXT_BGEZ[] PROGMEM;
-extern const char TEXT_BGZ[]  PROGMEM;
-extern const char TEXT_BIOZ[] PROGMEM;
-extern const char TEXT_BLEZ[] PROGMEM;
-extern const char TEXT_BLZ[]  PROGMEM;
-using common::TEXT_BNZ;
-extern const char TEXT_BV[]   PROGMEM;
-using common::TEXT_BZ;
-extern const char TEXT_CALA[] PROGMEM;
-using common::TEXT_CALL;
-using common::TEXT_DINT;
-extern const char TEXT_DMOV[] PROGMEM;
-extern const char TEXT_EINT[] PROGMEM;
-using common::TEXT_IN;
-extern const char TEXT_LAC[]  PROGMEM;
-extern const char TEXT_LACK[] PROGMEM;
-extern const char TEXT_LAR[]  PROGMEM;
-extern const char TEXT_LARK[] PROGMEM;
-extern const char TEXT_LARP[] PROGMEM;
-extern const char TEXT_LDP[]  PROGMEM;
-extern const char TEXT_LDPK[] PROGMEM;
-using common::TEXT_LST;
-extern const char TEXT_LT[]   PROGMEM;
-extern const char TEXT_LTA[]  PROGMEM;
-extern const char TEXT_LTD[]  PROGMEM;
-extern const char TEXT_MAR[]  PROGMEM;
-using common::TEXT_MPY;
-extern const char TEXT_MPYK[] PROGMEM;
-using common::TEXT_NOP;
-using common::TEXT_OR;
-using common::TEXT_OUT;
-extern const char TEXT_PAC[]  PROGMEM;
-using common::TEXT_POP;
-using common::TEXT_PUSH;
-using common::TEXT_RET;
-extern const char TEXT_ROVM[] PROGMEM;
-extern const char TEXT_SACH[] PROGMEM;
-extern const char TEXT_SACL[] PROGMEM;
-using common::TEXT_SAR;
-extern const char TEXT_SOVM[] PROGMEM;
-extern const char TEXT_SPAC[] PROGMEM;
-extern const char TEXT_SST[]  PROGMEM;
-using common::TEXT_SUB;
-using common::TEXT_SUBC;
-extern const char TEXT_SUBH[] PROGMEM;
-extern const char TEXT_SUBS[] PROGMEM;
-extern const char TEXT_TBLR[] PROGMEM;
-extern const char TEXT_TBLW[] PROGMEM;
-using common::TEXT_XOR;
-extern const char TEXT_ZAC[]  PROGMEM;
-extern const char TEXT_ZALH[] PROGMEM;
-extern const char TEXT_ZALS[] PROGMEM;
+#define TEXT_TMS32010_LIST(T, A)            \
+    T(TEXT_CPU_LIST,  "TMS32010, TMS32015") \
+    T(TEXT_CPU_32010, "32010")              \
+    T(TEXT_CPU_32015, "32015")              \
+    /* TMS32010 */                          \
+    T(TEXT_ABS,       "ABS")                \
+    T(TEXT_ADD,       "ADD")                \
+    T(TEXT_ADDH,      "ADDH")               \
+    T(TEXT_ADDS,      "ADDS")               \
+    T(TEXT_AND,       "AND")                \
+    T(TEXT_APAC,      "APAC")               \
+    T(TEXT_B,         "B")                  \
+    T(TEXT_BANZ,      "BANZ")               \
+    T(TEXT_BGEZ,      "BGEZ")               \
+    T(TEXT_BGZ,       "BGZ")                \
+    T(TEXT_BIOZ,      "BIOZ")               \
+    T(TEXT_BLEZ,      "BLEZ")               \
+    T(TEXT_BLZ,       "BLZ")                \
+    T(TEXT_BNZ,       "BNZ")                \
+    T(TEXT_BV,        "BV")                 \
+    T(TEXT_BZ,        "BZ")                 \
+    T(TEXT_CALA,      "CALA")               \
+    T(TEXT_CALL,      "CALL")               \
+    T(TEXT_DINT,      "DINT")               \
+    T(TEXT_DMOV,      "DMOV")               \
+    T(TEXT_EINT,      "EINT")               \
+    T(TEXT_IN,        "IN")                 \
+    T(TEXT_LAC,       "LAC")                \
+    T(TEXT_LACK,      "LACK")               \
+    T(TEXT_LAR,       "LAR")                \
+    T(TEXT_LARK,      "LARK")               \
+    T(TEXT_LARP,      "LARP")               \
+    T(TEXT_LDP,       "LDP")                \
+    T(TEXT_LDPK,      "LDPK")               \
+    T(TEXT_LST,       "LST")                \
+    T(TEXT_LT,        "LT")                 \
+    T(TEXT_LTA,       "LTA")                \
+    T(TEXT_LTD,       "LTD")                \
+    T(TEXT_MAR,       "MAR")                \
+    T(TEXT_MPY,       "MPY")                \
+    T(TEXT_MPYK,      "MPYK")               \
+    T(TEXT_NOP,       "NOP")                \
+    T(TEXT_OR,        "OR")                 \
+    T(TEXT_OUT,       "OUT")                \
+    T(TEXT_PAC,       "PAC")                \
+    T(TEXT_POP,       "POP")                \
+    T(TEXT_PUSH,      "PUSH")               \
+    T(TEXT_RET,       "RET")                \
+    T(TEXT_ROVM,      "ROVM")               \
+    T(TEXT_SACH,      "SACH")               \
+    T(TEXT_SACL,      "SACL")               \
+    T(TEXT_SAR,       "SAR")                \
+    T(TEXT_SOVM,      "SOVM")               \
+    T(TEXT_SPAC,      "SPAC")               \
+    T(TEXT_SST,       "SST")                \
+    T(TEXT_SUB,       "SUB")                \
+    T(TEXT_SUBC,      "SUBC")               \
+    T(TEXT_SUBH,      "SUBH")               \
+    T(TEXT_SUBS,      "SUBS")               \
+    T(TEXT_TBLR,      "TBLR")               \
+    T(TEXT_TBLW,      "TBLW")               \
+    T(TEXT_XOR,       "XOR")                \
+    T(TEXT_ZAC,       "ZAC")                \
+    T(TEXT_ZALH,      "ZALH")               \
+    T(TEXT_ZALS,      "ZALS")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_TMS32010_LIST);
+
 }  // namespace tms32010
 }  // namespace text
 }  // namespace libasm
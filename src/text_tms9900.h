@@ -18,108 +18,109 @@
 #define __TEXT_TMS9900__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace tms9900 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]  PROGMEM;
-extern const char TEXT_CPU_9900[]  PROGMEM;
-extern const char TEXT_CPU_9995[]  PROGMEM;
-extern const char TEXT_CPU_99105[] PROGMEM;
-
-// TMS9900
-using common::TEXT_A;
-extern const char TEXT_AB[]   PROGMEM;
-using common::TEXT_ABS;
-using common::TEXT_AI;
-using common::TEXT_ANDI;
-using common::TEXT_B;
-using common::TEXT_BL;
-extern const char TEXT_BLWP[] PROGMEM;
-using common::TEXT_C;
-using common::TEXT_CB;
-using common::TEXT_CI;
-extern const char TEXT_CKOF[] PROGMEM;
-extern const char TEXT_CKON[] PROGMEM;
-using common::TEXT_CLR;
-extern const char TEXT_COC[]  PROGMEM;
-extern const char TEXT_CZC[]  PROGMEM;
-using common::TEXT_DEC;
-extern const char TEXT_DECT[] PROGMEM;
-using common::TEXT_DIV;
-extern const char TEXT_IDLE[] PROGMEM;
-using common::TEXT_INC;
-extern const char TEXT_INCT[] PROGMEM;
-extern const char TEXT_INV[]  PROGMEM;
-extern const char TEXT_JEQ[]  PROGMEM;
-using common::TEXT_JGT;
-using common::TEXT_JH;
-extern const char TEXT_JHE[]  PROGMEM;
-using common::TEXT_JL;
-using common::TEXT_JLE;
-using common::TEXT_JLT;
-using common::TEXT_JMP;
-using common::TEXT_JNC;
-using common::TEXT_JNE;
-using common::TEXT_JNO;
-extern const char TEXT_JOC[]  PROGMEM;
-extern const char TEXT_JOP[]  PROGMEM;
-extern const char TEXT_LDCR[] PROGMEM;
-using common::TEXT_LI;
-extern const char TEXT_LIMI[] PROGMEM;
-extern const char TEXT_LREX[] PROGMEM;
-extern const char TEXT_LWPI[] PROGMEM;
-using common::TEXT_MOV;
-using common::TEXT_MOVB;
-extern const char TEXT_MID[]  PROGMEM;
-using common::TEXT_MPY;
-using common::TEXT_NEG;
-using common::TEXT_ORI;
-extern const char TEXT_RSET[] PROGMEM;
-extern const char TEXT_RTWP[] PROGMEM;
-using common::TEXT_S;
-extern const char TEXT_SB[]   PROGMEM;
-extern const char TEXT_SBO[]  PROGMEM;
-extern const char TEXT_SBZ[]  PROGMEM;
-extern const char TEXT_SETO[] PROGMEM;
-using common::TEXT_SLA;
-using common::TEXT_SRA;
-extern const char TEXT_SRC[]  PROGMEM;
-using common::TEXT_SRL;
-extern const char TEXT_SOC[]  PROGMEM;
-extern const char TEXT_SOCB[] PROGMEM;
-extern const char TEXT_STCR[] PROGMEM;
-extern const char TEXT_STST[] PROGMEM;
-extern const char TEXT_STWP[] PROGMEM;
-extern const char TEXT_SWPB[] PROGMEM;
-extern const char TEXT_SZC[]  PROGMEM;
-extern const char TEXT_SZCB[] PROGMEM;
-extern const char TEXT_TB[]   PROGMEM;
-extern const char TEXT_X[]    PROGMEM;
-extern const char TEXT_XOP[]  PROGMEM;
-using common::TEXT_XOR;
-
-// TMS9995
-extern const char TEXT_MPYS[] PROGMEM;
-using common::TEXT_DIVS;
-using common::TEXT_LST;
-extern const char TEXT_LWP[]  PROGMEM;
-
-// TMS999105
-using common::TEXT_AM;
-extern const char TEXT_BIND[] PROGMEM;
-extern const char TEXT_BLSK[] PROGMEM;
-extern const char TEXT_EVAD[] PROGMEM;
-extern const char TEXT_SLAM[] PROGMEM;
-using common::TEXT_SM;
-extern const char TEXT_SRAM[] PROGMEM;
-extern const char TEXT_TCMB[] PROGMEM;
-extern const char TEXT_TMB[]  PROGMEM;
-extern const char TEXT_TSMB[] PROGMEM;
+#define TEXT_TMS9900_LIST(T, A)                     \
+    T(TEXT_CPU_LIST,  "TMS9900, TMS9995, TMS99105") \
+    T(TEXT_CPU_9900,  "9900")                       \
+    T(TEXT_CPU_9995,  "9995")                       \
+    T(TEXT_CPU_99105, "99105")                      \
+    /* TMS9900 */                                   \
+    T(TEXT_A,         "A")                          \
+    T(TEXT_AB,        "AB")                         \
+    T(TEXT_ABS,       "ABS")                        \
+    T(TEXT_AI,        "AI")                         \
+    T(TEXT_ANDI,      "ANDI")                       \
+    T(TEXT_B,         "B")                          \
+    T(TEXT_BL,        "BL")                         \
+    T(TEXT_BLWP,      "BLWP")                       \
+    T(TEXT_C,         "C")                          \
+    T(TEXT_CB,        "CB")                         \
+    T(TEXT_CI,        "CI")                         \
+    T(TEXT_CKOF,      "CKOF")                       \
+    T(TEXT_CKON,      "CKON")                       \
+    T(TEXT_CLR,       "CLR")                        \
+    T(TEXT_COC,       "COC")                        \
+    T(TEXT_CZC,       "CZC")                        \
+    T(TEXT_DEC,       "DEC")                        \
+    T(TEXT_DECT,      "DECT")                       \
+    T(TEXT_DIV,       "DIV")                        \
+    T(TEXT_IDLE,      "IDLE")                       \
+    T(TEXT_INC,       "INC")                        \
+    T(TEXT_INCT,      "INCT")                       \
+    T(TEXT_INV,       "INV")                        \
+    T(TEXT_JEQ,       "JEQ")                        \
+    T(TEXT_JGT,       "JGT")                        \
+    T(TEXT_JH,        "JH")                         \
+    T(TEXT_JHE,       "JHE")                        \
+    T(TEXT_JL,        "JL")                         \
+    T(TEXT_JLE,       "JLE")                        \
+    T(TEXT_JLT,       "JLT")                        \
+    T(TEXT_JMP,       "JMP")                        \
+    T(TEXT_JNC,       "JNC")                        \
+    T(TEXT_JNE,       "JNE")                        \
+    T(TEXT_JNO,       "JNO")                        \
+    T(TEXT_JOC,       "JOC")                        \
+    T(TEXT_JOP,       "JOP")                        \
+    T(TEXT_LDCR,      "LDCR")                       \
+    T(TEXT_LI,        "LI")                         \
+    T(TEXT_LIMI,      "LIMI")                       \
+    T(TEXT_LREX,      "LREX")                       \
+    T(TEXT_LWPI,      "LWPI")                       \
+    T(TEXT_MOV,       "MOV")                        \
+    T(TEXT_MOVB,      "MOVB")                       \
+    T(TEXT_MID,       "MID")                        \
+    T(TEXT_MPY,       "MPY")                        \
+    T(TEXT_NEG,       "NEG")                        \
+    T(TEXT_ORI,       "ORI")                        \
+    T(TEXT_RSET,      "RSET")                       \
+    T(TEXT_RTWP,      "RTWP")                       \
+    T(TEXT_S,         "S")                          \
+    T(TEXT_SB,        "SB")                         \
+    T(TEXT_SBO,       "SBO")                        \
+    T(TEXT_SBZ,       "SBZ")                        \
+    T(TEXT_SETO,      "SETO")                       \
+    T(TEXT_SLA,       "SLA")                        \
+    T(TEXT_SRA,       "SRA")                        \
+    T(TEXT_SRC,       "SRC")                        \
+    T(TEXT_SRL,       "SRL")                        \
+    T(TEXT_SOC,       "SOC")                        \
+    T(TEXT_SOCB,      "SOCB")                       \
+    T(TEXT_STCR,      "STCR")                       \
+    T(TEXT_STST,      "STST")                       \
+    T(TEXT_STWP,      "STWP")                       \
+    T(TEXT_SWPB,      "SWPB")                       \
+    T(TEXT_SZC,       "SZC")                        \
+    T(TEXT_SZCB,      "SZCB")                       \
+    T(TEXT_TB,        "TB")                         \
+    T(TEXT_X,         "X")                          \
+    T(TEXT_XOP,       "XOP")                        \
+    T(TEXT_XOR,       "XOR")                        \
+    /* TMS9995 */                                   \
+    T(TEXT_MPYS,      "MPYS")                       \
+    T(TEXT_DIVS,      "DIVS")                       \
+    T(TEXT_LST,       "LST")                        \
+    T(TEXT_LWP,       "LWP")                        \
+    /* TMS999105 */                                 \
+    T(TEXT_AM,        "AM")                         \
+    T(TEXT_BIND,      "BIND")                       \
+    T(TEXT_BLSK,      "BLSK")                       \
+    T(TEXT_EVAD,      "EVAD")                       \
+    T(TEXT_SLAM,      "SLAM")                       \
+    T(TEXT_SM,        "SM")                         \
+    T(TEXT_SRAM,      "SRAM")                       \
+    T(TEXT_TCMB,      "TCMB")                       \
+    T(TEXT_TMB,       "TMB")                        \
+    T(TEXT_TSMB,      "TSMB")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_TMS9900_LIST);
+
 }  // namespace tms9900
 }  // namespace text
 }  // namespace libasm
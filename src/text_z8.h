@@ -18,125 +18,125 @@
 #define __TEXT_Z8__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace z8 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]   PROGMEM;
-extern const char TEXT_CPU_Z8[]     PROGMEM;
-extern const char TEXT_CPU_Z86[]    PROGMEM;
-extern const char TEXT_CPU_Z86C[]   PROGMEM;
-extern const char TEXT_CPU_Z88[]    PROGMEM;
-extern const char TEXT_CPU_SUPER8[] PROGMEM;
-
-// Z8
-using common::TEXT_ADC;
-using common::TEXT_ADD;
-using common::TEXT_AND;
-using common::TEXT_CALL;
-using common::TEXT_CCF;
-using common::TEXT_CLR;
-using common::TEXT_COM;
-using common::TEXT_CP;
-using common::TEXT_DA;
-using common::TEXT_DEC;
-using common::TEXT_DECW;
-using common::TEXT_DI;
-using common::TEXT_DJNZ;
-using common::TEXT_EI;
-using common::TEXT_INC;
-using common::TEXT_INCW;
-using common::TEXT_IRET;
-using common::TEXT_JP;
-using common::TEXT_JR;
-using common::TEXT_LD;
-using common::TEXT_LDC;
-extern const char TEXT_LDCI[] PROGMEM;
-using common::TEXT_LDE;
-extern const char TEXT_LDEI[] PROGMEM;
-using common::TEXT_NOP;
-using common::TEXT_OR;
-using common::TEXT_POP;
-using common::TEXT_PUSH;
-using common::TEXT_RCF;
-using common::TEXT_RET;
-using common::TEXT_RL;
-using common::TEXT_RLC;
-using common::TEXT_RR;
-using common::TEXT_RRC;
-using common::TEXT_SBC;
-using common::TEXT_SCF;
-using common::TEXT_SRA;
-extern const char TEXT_SRP[]  PROGMEM;
-using common::TEXT_SUB;
-using common::TEXT_SWAP;
-extern const char TEXT_TCM[]  PROGMEM;
-extern const char TEXT_TM[]   PROGMEM;
-using common::TEXT_XOR;
-
-// Z86C
-using common::TEXT_HALT;
-using common::TEXT_STOP;
-
-// SUPER8
-using common::TEXT_BAND;
-extern const char TEXT_BCP[]    PROGMEM;
-extern const char TEXT_BITC[]   PROGMEM;
-extern const char TEXT_BITR[]   PROGMEM;
-extern const char TEXT_BITS[]   PROGMEM;
-using common::TEXT_BOR;
-extern const char TEXT_BTJRF[]  PROGMEM;
-extern const char TEXT_BTJRT[]  PROGMEM;
-extern const char TEXT_BXOR[]   PROGMEM;
-extern const char TEXT_CPIJE[]  PROGMEM;
-extern const char TEXT_CPIJNE[] PROGMEM;
-using common::TEXT_DIV;
-using common::TEXT_ENTER;
-using common::TEXT_EXIT;
-using common::TEXT_LDB;
-extern const char TEXT_LDCD[]   PROGMEM;
-extern const char TEXT_LDCPD[]  PROGMEM;
-extern const char TEXT_LDCPI[]  PROGMEM;
-extern const char TEXT_LDED[]   PROGMEM;
-extern const char TEXT_LDEPD[]  PROGMEM;
-extern const char TEXT_LDEPI[]  PROGMEM;
-using common::TEXT_LDW;
-using common::TEXT_MULT;
-extern const char TEXT_NEXT[]   PROGMEM;
-extern const char TEXT_POPUD[]  PROGMEM;
-extern const char TEXT_POPUI[]  PROGMEM;
-extern const char TEXT_PUSHUD[] PROGMEM;
-extern const char TEXT_PUSHUI[] PROGMEM;
-extern const char TEXT_SB0[]    PROGMEM;
-extern const char TEXT_SB1[]    PROGMEM;
-extern const char TEXT_SRP0[]   PROGMEM;
-extern const char TEXT_SRP1[]   PROGMEM;
-extern const char TEXT_WFI[]    PROGMEM;
-
-using common::TEXT_CC_F;
-using common::TEXT_CC_LT;
-using common::TEXT_CC_LE;
-using common::TEXT_CC_ULE;
-using common::TEXT_CC_OV;
-using common::TEXT_CC_MI;
-using common::TEXT_CC_Z;
-using common::TEXT_CC_C;
-using common::TEXT_CC_T;
-using common::TEXT_CC_GE;
-using common::TEXT_CC_GT;
-using common::TEXT_CC_UGT;
-using common::TEXT_CC_NOV;
-using common::TEXT_CC_PL;
-using common::TEXT_CC_NZ;
-using common::TEXT_CC_NC;
-using common::TEXT_CC_EQ;
-using common::TEXT_CC_ULT;
-using common::TEXT_CC_NE;
-using common::TEXT_CC_UGE;
+#define TEXT_Z8_LIST(T, A)              \
+    T(TEXT_CPU_LIST,   "Z8, Z86C, Z88") \
+    T(TEXT_CPU_Z8,     "Z8")            \
+    T(TEXT_CPU_Z86,    "Z86")           \
+    T(TEXT_CPU_Z86C,   "Z86C")          \
+    T(TEXT_CPU_Z88,    "Z88")           \
+    T(TEXT_CPU_SUPER8, "Super8")        \
+    /* Z8 */                            \
+    T(TEXT_ADC,        "ADC")           \
+    T(TEXT_ADD,        "ADD")           \
+    T(TEXT_AND,        "AND")           \
+    T(TEXT_CALL,       "CALL")          \
+    T(TEXT_CCF,        "CCF")           \
+    T(TEXT_CLR,        "CLR")           \
+    T(TEXT_COM,        "COM")           \
+    T(TEXT_CP,         "CP")            \
+    T(TEXT_DA,         "DA")            \
+    T(TEXT_DEC,        "DEC")           \
+    T(TEXT_DECW,       "DECW")          \
+    T(TEXT_DI,         "DI")            \
+    T(TEXT_DJNZ,       "DJNZ")          \
+    T(TEXT_EI,         "EI")            \
+    T(TEXT_INC,        "INC")           \
+    T(TEXT_INCW,       "INCW")          \
+    T(TEXT_IRET,       "IRET")          \
+    T(TEXT_JP,         "JP")            \
+    T(TEXT_JR,         "JR")            \
+    T(TEXT_LD,         "LD")            \
+    T(TEXT_LDC,        "LDC")           \
+    T(TEXT_LDCI,       "LDCI")          \
+    T(TEXT_LDE,        "LDE")           \
+    T(TEXT_LDEI,       "LDEI")          \
+    T(TEXT_NOP,        "NOP")           \
+    T(TEXT_OR,         "OR")            \
+    T(TEXT_POP,        "POP")           \
+    T(TEXT_PUSH,       "PUSH")          \
+    T(TEXT_RCF,        "RCF")           \
+    T(TEXT_RET,        "RET")           \
+    T(TEXT_RL,         "RL")            \
+    T(TEXT_RLC,        "RLC")           \
+    T(TEXT_RR,         "RR")            \
+    T(TEXT_RRC,        "RRC")           \
+    T(TEXT_SBC,        "SBC")           \
+    T(TEXT_SCF,        "SCF")           \
+    T(TEXT_SRA,        "SRA")           \
+    T(TEXT_SRP,        "SRP")           \
+    T(TEXT_SUB,        "SUB")           \
+    T(TEXT_SWAP,       "SWAP")          \
+    T(TEXT_TCM,        "TCM")           \
+    T(TEXT_TM,         "TM")            \
+    T(TEXT_XOR,        "XOR")           \
+    /* Z86C */                          \
+    T(TEXT_HALT,       "HALT")          \
+    T(TEXT_STOP,       "STOP")          \
+    /* SUPER8 */                        \
+    T(TEXT_BAND,       "BAND")          \
+    T(TEXT_BCP,        "BCP")           \
+    T(TEXT_BITC,       "BITC")          \
+    T(TEXT_BITR,       "BITR")          \
+    T(TEXT_BITS,       "BITS")          \
+    T(TEXT_BOR,        "BOR")           \
+    T(TEXT_BTJRF,      "BTJRF")         \
+    T(TEXT_BTJRT,      "BTJRT")         \
+    T(TEXT_BXOR,       "BXOR")          \
+    T(TEXT_CPIJE,      "CPIJE")         \
+    T(TEXT_CPIJNE,     "CPIJNE")        \
+    T(TEXT_DIV,        "DIV")           \
+    T(TEXT_ENTER,      "ENTER")         \
+    T(TEXT_EXIT,       "EXIT")          \
+    T(TEXT_LDB,        "LDB")           \
+    T(TEXT_LDCD,       "LDCD")          \
+    T(TEXT_LDCPD,      "LDCPD")         \
+    T(TEXT_LDCPI,      "LDCPI")         \
+    T(TEXT_LDED,       "LDED")          \
+    T(TEXT_LDEPD,      "LDEPD")         \
+    T(TEXT_LDEPI,      "LDEPI")         \
+    T(TEXT_LDW,        "LDW")           \
+    T(TEXT_MULT,       "MULT")          \
+    T(TEXT_NEXT,       "NEXT")          \
+    T(TEXT_POPUD,      "POPUD")         \
+    T(TEXT_POPUI,      "POPUI")         \
+    T(TEXT_PUSHUD,     "PUSHUD")        \
+    T(TEXT_PUSHUI,     "PUSHUI")        \
+    T(TEXT_SB0,        "SB0")           \
+    T(TEXT_SB1,        "SB1")           \
+    T(TEXT_SRP0,       "SRP0")          \
+    T(TEXT_SRP1,       "SRP1")          \
+    T(TEXT_WFI,        "WFI")           \
+    T(TEXT_CC_F,       "F")             \
+    T(TEXT_CC_LT,      "LT")            \
+    T(TEXT_CC_LE,      "LE")            \
+    T(TEXT_CC_ULE,     "ULE")           \
+    T(TEXT_CC_OV,      "OV")            \
+    T(TEXT_CC_MI,      "MI")            \
+    T(TEXT_CC_Z,       "Z")             \
+    T(TEXT_CC_C,       "C")             \
+    T(TEXT_CC_T,       "")              \
+    T(TEXT_CC_GE,      "GE")            \
+    T(TEXT_CC_GT,      "GT")            \
+    T(TEXT_CC_UGT,     "UGT")           \
+    T(TEXT_CC_NOV,     "NOV")           \
+    T(TEXT_CC_PL,      "PL")            \
+    T(TEXT_CC_NZ,      "NZ")            \
+    T(TEXT_CC_NC,      "NC")            \
+    T(TEXT_CC_EQ,      "EQ")            \
+    T(TEXT_CC_ULT,     "ULT")           \
+    T(TEXT_CC_NE,      "NE")            \
+    T(TEXT_CC_UGE,     "UGE")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_Z8_LIST);
+
 }  // namespace z8
 }  // namespace text
 }  // namespace libasm
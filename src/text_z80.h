@@ -18,121 +18,120 @@
 #define __TEXT_Z80__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace z80 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]   PROGMEM;
-extern const char TEXT_CPU_Z80[]    PROGMEM;
-using common::TEXT_CPU_8080;
-using common::TEXT_CPU_8085;
-using common::TEXT_CPU_V30EMU;
-
-using common::TEXT_ADC;
-using common::TEXT_ADD;
-using common::TEXT_AND;
-using common::TEXT_BIT;
-using common::TEXT_CALL;
-using common::TEXT_CCF;
-using common::TEXT_CP;
-using common::TEXT_CPD;
-using common::TEXT_CPDR;
-using common::TEXT_CPI;
-using common::TEXT_CPIR;
-using common::TEXT_CPL;
-using common::TEXT_DAA;
-using common::TEXT_DEC;
-using common::TEXT_DI;
-using common::TEXT_DJNZ;
-using common::TEXT_EI;
-using common::TEXT_EX;
-using common::TEXT_EXX;
-using common::TEXT_HALT;
-using common::TEXT_HLT;
-extern const char TEXT_IM[]   PROGMEM;
-using common::TEXT_IN;
-using common::TEXT_INC;
-using common::TEXT_IND;
-using common::TEXT_INDR;
-using common::TEXT_INI;
-using common::TEXT_INIR;
-using common::TEXT_JP;
-using common::TEXT_JR;
-using common::TEXT_LD;
-using common::TEXT_LDD;
-using common::TEXT_LDDR;
-using common::TEXT_LDI;
-using common::TEXT_LDIR;
-using common::TEXT_NEG;
-using common::TEXT_NOP;
-using common::TEXT_OR;
-using common::TEXT_OTDR;
-using common::TEXT_OTIR;
-using common::TEXT_OUT;
-using common::TEXT_OUTD;
-using common::TEXT_OUTI;
-using common::TEXT_POP;
-using common::TEXT_PUSH;
-extern const char TEXT_RER[]  PROGMEM;
-using common::TEXT_RES;
-using common::TEXT_RET;
-using common::TEXT_RETI;
-extern const char TEXT_RETN[] PROGMEM;
-using common::TEXT_RL;
-using common::TEXT_RLA;
-using common::TEXT_RLC;
-using common::TEXT_RLCA;
-using common::TEXT_RLD;
-using common::TEXT_RR;
-using common::TEXT_RRA;
-using common::TEXT_RRC;
-using common::TEXT_RRCA;
-using common::TEXT_RRD;
-using common::TEXT_RST;
-using common::TEXT_SBC;
-using common::TEXT_SCF;
-using common::TEXT_SET;
-using common::TEXT_SLA;
-using common::TEXT_SRA;
-using common::TEXT_SRL;
-using common::TEXT_SUB;
-using common::TEXT_XOR;
-
-// V30EMU
-using common::TEXT_CALLN;
-using common::TEXT_RETEM;
-
-using common::TEXT_REG_BC;
-using common::TEXT_REG_DE;
-using common::TEXT_REG_HL;
-using common::TEXT_REG_IX;
-using common::TEXT_REG_IY;
-using common::TEXT_REG_SP;
-using common::TEXT_REG_AFP;
-using common::TEXT_REG_AF;
-using common::TEXT_REG_A;
-using common::TEXT_REG_B;
-using common::TEXT_REG_C;
-using common::TEXT_REG_D;
-using common::TEXT_REG_E;
-using common::TEXT_REG_H;
-using common::TEXT_REG_L;
-extern const char TEXT_REG_IM[]  PROGMEM;
-extern const char TEXT_REG_R[]   PROGMEM;
-using common::TEXT_REG_I;
-
-using common::TEXT_CC_NZ;
-using common::TEXT_CC_Z;
-using common::TEXT_CC_NC;
-using common::TEXT_CC_C;
-using common::TEXT_CC_PO;
-using common::TEXT_CC_PE;
-using common::TEXT_CC_P;
-using common::TEXT_CC_M;
+#define TEXT_Z80_LIST(T, A)                         \
+    T(TEXT_CPU_LIST,   "Z80, i8080, i8085, V30EMU") \
+    T(TEXT_CPU_Z80,    "Z80")                       \
+    T(TEXT_CPU_8080,   "8080")                      \
+    T(TEXT_CPU_8085,   "8085")                      \
+    T(TEXT_CPU_V30EMU, "V30EMU")                    \
+    T(TEXT_ADC,        "ADC")                       \
+    T(TEXT_ADD,        "ADD")                       \
+    T(TEXT_AND,        "AND")                       \
+    T(TEXT_BIT,        "BIT")                       \
+    T(TEXT_CALL,       "CALL")                      \
+    T(TEXT_CCF,        "CCF")                       \
+    T(TEXT_CP,         "CP")                        \
+    T(TEXT_CPD,        "CPD")                       \
+    T(TEXT_CPDR,       "CPDR")                      \
+    T(TEXT_CPI,        "CPI")                       \
+    T(TEXT_CPIR,       "CPIR")                      \
+    T(TEXT_CPL,        "CPL")                       \
+    T(TEXT_DAA,        "DAA")                       \
+    T(TEXT_DEC,        "DEC")                       \
+    T(TEXT_DI,         "DI")                        \
+    T(TEXT_DJNZ,       "DJNZ")                      \
+    T(TEXT_EI,         "EI")                        \
+    T(TEXT_EX,         "EX")                        \
+    T(TEXT_EXX,        "EXX")                       \
+    T(TEXT_HALT,       "HALT")                      \
+    T(TEXT_HLT,        "HLT")                       \
+    T(TEXT_IM,         "IM")                        \
+    T(TEXT_IN,         "IN")                        \
+    T(TEXT_INC,        "INC")                       \
+    T(TEXT_IND,        "IND")                       \
+    T(TEXT_INDR,       "INDR")                      \
+    T(TEXT_INI,        "INI")                       \
+    T(TEXT_INIR,       "INIR")                      \
+    T(TEXT_JP,         "JP")                        \
+    T(TEXT_JR,         "JR")                        \
+    T(TEXT_LD,         "LD")                        \
+    T(TEXT_LDD,        "LDD")                       \
+    T(TEXT_LDDR,       "LDDR")                      \
+    T(TEXT_LDI,        "LDI")                       \
+    T(TEXT_LDIR,       "LDIR")                      \
+    T(TEXT_NEG,        "NEG")                       \
+    T(TEXT_NOP,        "NOP")                       \
+    T(TEXT_OR,         "OR")                        \
+    T(TEXT_OTDR,       "OTDR")                      \
+    T(TEXT_OTIR,       "OTIR")                      \
+    T(TEXT_OUT,        "OUT")                       \
+    T(TEXT_OUTD,       "OUTD")                      \
+    T(TEXT_OUTI,       "OUTI")                      \
+    T(TEXT_POP,        "POP")                       \
+    T(TEXT_PUSH,       "PUSH")                      \
+    T(TEXT_RES,        "RES")                       \
+    T(TEXT_RET,        "RET")                       \
+    T(TEXT_RETI,       "RETI")                      \
+    T(TEXT_RETN,       "RETN")                      \
+    T(TEXT_RL,         "RL")                        \
+    T(TEXT_RLA,        "RLA")                       \
+    T(TEXT_RLC,        "RLC")                       \
+    T(TEXT_RLCA,       "RLCA")                      \
+    T(TEXT_RLD,        "RLD")                       \
+    T(TEXT_RR,         "RR")                        \
+    T(TEXT_RRA,        "RRA")                       \
+    T(TEXT_RRC,        "RRC")                       \
+    T(TEXT_RRCA,       "RRCA")                      \
+    T(TEXT_RRD,        "RRD")                       \
+    T(TEXT_RST,        "RST")                       \
+    T(TEXT_SBC,        "SBC")                       \
+    T(TEXT_SCF,        "SCF")                       \
+    T(TEXT_SET,        "SET")                       \
+    T(TEXT_SLA,        "SLA")                       \
+    T(TEXT_SRA,        "SRA")                       \
+    T(TEXT_SRL,        "SRL")                       \
+    T(TEXT_SUB,        "SUB")                       \
+    T(TEXT_XOR,        "XOR")                       \
+    /* V30EMU */                                    \
+    T(TEXT_CALLN,      "CALLN")                     \
+    T(TEXT_RETEM,      "RETEM")                     \
+    T(TEXT_REG_BC,     "BC")                        \
+    T(TEXT_REG_DE,     "DE")                        \
+    T(TEXT_REG_HL,     "HL")                        \
+    T(TEXT_REG_IX,     "IX")                        \
+    T(TEXT_REG_IY,     "IY")                        \
+    T(TEXT_REG_SP,     "SP")                        \
+    T(TEXT_REG_AFP,    "AF'")                       \
+    T(TEXT_REG_AF,     "AF")                        \
+    T(TEXT_REG_A,      "A")                         \
+    T(TEXT_REG_B,      "B")                         \
+    T(TEXT_REG_C,      "C")                         \
+    T(TEXT_REG_D,      "D")                         \
+    T(TEXT_REG_E,      "E")                         \
+    T(TEXT_REG_H,      "H")                         \
+    T(TEXT_REG_L,      "L")                         \
+    A(TEXT_REG_IM,     TEXT_IM)                     \
+    T(TEXT_REG_R,      "R")                         \
+    T(TEXT_REG_I,      "I")                         \
+    T(TEXT_CC_NZ,      "NZ")                        \
+    T(TEXT_CC_Z,       "Z")                         \
+    T(TEXT_CC_NC,      "NC")                        \
+    A(TEXT_CC_C,       TEXT_REG_C)                  \
+    T(TEXT_CC_PO,      "PO")                        \
+    T(TEXT_CC_PE,      "PE")                        \
+    T(TEXT_CC_P,       "P")                         \
+    T(TEXT_CC_M,       "M")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_Z80_LIST);
+
 }  // namespace z80
 }  // namespace text
 }  // namespace libasm
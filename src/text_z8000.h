@@ -18,244 +18,246 @@
 #define __TEXT_Z8000__
 
 #include "text_common.h"
+#include "text_pool.h"
 
 namespace libasm {
 namespace text {
 namespace z8000 {
 
 // clang-format off
-extern const char TEXT_CPU_LIST[]  PROGMEM;
-extern const char TEXT_CPU_Z8001[] PROGMEM;
-extern const char TEXT_CPU_Z8002[] PROGMEM;
-
-using common::TEXT_ADC;
-using common::TEXT_ADCB;
-using common::TEXT_ADD;
-using common::TEXT_ADDB;
-using common::TEXT_ADDL;
-using common::TEXT_AND;
-using common::TEXT_ANDB;
-using common::TEXT_BIT;
-using common::TEXT_BITB;
-using common::TEXT_CALL;
-using common::TEXT_CALR;
-using common::TEXT_CLR;
-using common::TEXT_CLRB;
-using common::TEXT_COM;
-using common::TEXT_COMB;
-extern const char TEXT_COMFLG[] PROGMEM;
-using common::TEXT_CP;
-extern const char TEXT_CPB[]    PROGMEM;
-using common::TEXT_CPD;
-extern const char TEXT_CPDB[]   PROGMEM;
-using common::TEXT_CPDR;
-extern const char TEXT_CPDRB[]  PROGMEM;
-using common::TEXT_CPI;
-extern const char TEXT_CPIB[]   PROGMEM;
-using common::TEXT_CPIR;
-extern const char TEXT_CPIRB[]  PROGMEM;
-using common::TEXT_CPL;
-extern const char TEXT_CPSD[]   PROGMEM;
-extern const char TEXT_CPSDB[]  PROGMEM;
-extern const char TEXT_CPSDR[]  PROGMEM;
-extern const char TEXT_CPSDRB[] PROGMEM;
-extern const char TEXT_CPSI[]   PROGMEM;
-extern const char TEXT_CPSIB[]  PROGMEM;
-extern const char TEXT_CPSIR[]  PROGMEM;
-extern const char TEXT_CPSIRB[] PROGMEM;
-extern const char TEXT_DAB[]    PROGMEM;
-extern const char TEXT_DBJNZ[]  PROGMEM;
-using common::TEXT_DEC;
-using common::TEXT_DECB;
-using common::TEXT_DI;
-using common::TEXT_DIV;
-using common::TEXT_DIVL;
-using common::TEXT_DJNZ;
-using common::TEXT_EI;
-using common::TEXT_EX;
-extern const char TEXT_EXB[]    PROGMEM;
-extern const char TEXT_EXTS[]   PROGMEM;
-using common::TEXT_EXTSB;
-extern const char TEXT_EXTSL[]  PROGMEM;
-using common::TEXT_HALT;
-using common::TEXT_IN;
-extern const char TEXT_INB[]    PROGMEM;
-using common::TEXT_INC;
-using common::TEXT_INCB;
-using common::TEXT_IND;
-extern const char TEXT_INDB[]   PROGMEM;
-using common::TEXT_INDR;
-extern const char TEXT_INDRB[]  PROGMEM;
-using common::TEXT_INI;
-extern const char TEXT_INIB[]   PROGMEM;
-using common::TEXT_INIR;
-extern const char TEXT_INIRB[]  PROGMEM;
-using common::TEXT_IRET;
-using common::TEXT_JP;
-using common::TEXT_JR;
-using common::TEXT_LD;
-using common::TEXT_LDA;
-using common::TEXT_LDAR;
-using common::TEXT_LDB;
-extern const char TEXT_LDCTL[]  PROGMEM;
-extern const char TEXT_LDCTLB[] PROGMEM;
-using common::TEXT_LDD;
-extern const char TEXT_LDDB[]   PROGMEM;
-using common::TEXT_LDDR;
-extern const char TEXT_LDDRB[]  PROGMEM;
-using common::TEXT_LDI;
-extern const char TEXT_LDIB[]   PROGMEM;
-using common::TEXT_LDIR;
-extern const char TEXT_LDIRB[]  PROGMEM;
-extern const char TEXT_LDK[]    PROGMEM;
-extern const char TEXT_LDL[]    PROGMEM;
-extern const char TEXT_LDM[]    PROGMEM;
-extern const char TEXT_LDPS[]   PROGMEM;
-extern const char TEXT_LDR[]    PROGMEM;
-extern const char TEXT_LDRB[]   PROGMEM;
-extern const char TEXT_LDRL[]   PROGMEM;
-extern const char TEXT_MBIT[]   PROGMEM;
-extern const char TEXT_MREQ[]   PROGMEM;
-extern const char TEXT_MRES[]   PROGMEM;
-extern const char TEXT_MSET[]   PROGMEM;
-using common::TEXT_MULT;
-extern const char TEXT_MULTL[]  PROGMEM;
-using common::TEXT_NEG;
-using common::TEXT_NEGB;
-using common::TEXT_NOP;
-using common::TEXT_OR;
-using common::TEXT_ORB;
-using common::TEXT_OTDR;
-extern const char TEXT_OTDRB[]  PROGMEM;
-using common::TEXT_OTIR;
-extern const char TEXT_OTIRB[]  PROGMEM;
-using common::TEXT_OUT;
-extern const char TEXT_OUTB[]   PROGMEM;
-using common::TEXT_OUTD;
-extern const char TEXT_OUTDB[]  PROGMEM;
-using common::TEXT_OUTI;
-extern const char TEXT_OUTIB[]  PROGMEM;
-using common::TEXT_POP;
-extern const char TEXT_POPL[]   PROGMEM;
-using common::TEXT_PUSH;
-extern const char TEXT_PUSHL[]  PROGMEM;
-using common::TEXT_RES;
-extern const char TEXT_RESB[]   PROGMEM;
-extern const char TEXT_RESFLG[] PROGMEM;
-using common::TEXT_RET;
-using common::TEXT_RL;
-extern const char TEXT_RLB[]    PROGMEM;
-using common::TEXT_RLC;
-extern const char TEXT_RLCB[]   PROGMEM;
-extern const char TEXT_RLDB[]   PROGMEM;
-using common::TEXT_RR;
-extern const char TEXT_RRB[]    PROGMEM;
-using common::TEXT_RRC;
-extern const char TEXT_RRCB[]   PROGMEM;
-extern const char TEXT_RRDB[]   PROGMEM;
-using common::TEXT_SBC;
-using common::TEXT_SBCB;
-extern const char TEXT_SC[]     PROGMEM;
-extern const char TEXT_SDA[]    PROGMEM;
-extern const char TEXT_SDAB[]   PROGMEM;
-extern const char TEXT_SDAL[]   PROGMEM;
-extern const char TEXT_SDL[]    PROGMEM;
-extern const char TEXT_SDLB[]   PROGMEM;
-extern const char TEXT_SDLL[]   PROGMEM;
-using common::TEXT_SET;
-using common::TEXT_SETB;
-extern const char TEXT_SETFLG[] PROGMEM;
-extern const char TEXT_SIN[]    PROGMEM;
-extern const char TEXT_SINB[]   PROGMEM;
-extern const char TEXT_SIND[]   PROGMEM;
-extern const char TEXT_SINDB[]  PROGMEM;
-extern const char TEXT_SINDR[]  PROGMEM;
-extern const char TEXT_SINDRB[] PROGMEM;
-extern const char TEXT_SINI[]   PROGMEM;
-extern const char TEXT_SINIB[]  PROGMEM;
-extern const char TEXT_SINIR[]  PROGMEM;
-extern const char TEXT_SINIRB[] PROGMEM;
-using common::TEXT_SLA;
-extern const char TEXT_SLAB[]   PROGMEM;
-extern const char TEXT_SLAL[]   PROGMEM;
-using common::TEXT_SLL;
-extern const char TEXT_SLLB[]   PROGMEM;
-extern const char TEXT_SLLL[]   PROGMEM;
-extern const char TEXT_SOTDR[]  PROGMEM;
-extern const char TEXT_SOTDRB[] PROGMEM;
-extern const char TEXT_SOTIR[]  PROGMEM;
-extern const char TEXT_SOTIRB[] PROGMEM;
-extern const char TEXT_SOUT[]   PROGMEM;
-extern const char TEXT_SOUTB[]  PROGMEM;
-extern const char TEXT_SOUTD[]  PROGMEM;
-extern const char TEXT_SOUTDB[] PROGMEM;
-extern const char TEXT_SOUTI[]  PROGMEM;
-extern const char TEXT_SOUTIB[] PROGMEM;
-using common::TEXT_SRA;
-extern const char TEXT_SRAB[]   PROGMEM;
-extern const char TEXT_SRAL[]   PROGMEM;
-using common::TEXT_SRL;
-extern const char TEXT_SRLB[]   PROGMEM;
-extern const char TEXT_SRLL[]   PROGMEM;
-using common::TEXT_SUB;
-using common::TEXT_SUBB;
-using common::TEXT_SUBL;
-extern const char TEXT_TCC[]    PROGMEM;
-extern const char TEXT_TCCB[]   PROGMEM;
-using common::TEXT_TEST;
-extern const char TEXT_TESTB[]  PROGMEM;
-extern const char TEXT_TESTL[]  PROGMEM;
-extern const char TEXT_TRDB[]   PROGMEM;
-extern const char TEXT_TRDRB[]  PROGMEM;
-extern const char TEXT_TRIB[]   PROGMEM;
-extern const char TEXT_TRIRB[]  PROGMEM;
-extern const char TEXT_TRTDB[]  PROGMEM;
-extern const char TEXT_TRTDRB[] PROGMEM;
-extern const char TEXT_TRTIB[]  PROGMEM;
-extern const char TEXT_TRTIRB[] PROGMEM;
-using common::TEXT_TSET;
-extern const char TEXT_TSETB[]  PROGMEM;
-using common::TEXT_XOR;
-using common::TEXT_XORB;
-
-extern const char TEXT_REG_FLAGS[]   PROGMEM;
-extern const char TEXT_REG_FCW[]     PROGMEM;
-extern const char TEXT_REG_REFRESH[] PROGMEM;
-extern const char TEXT_REG_PSAPSEG[] PROGMEM;
-extern const char TEXT_REG_PSAPOFF[] PROGMEM;
-extern const char TEXT_REG_PSAP[]    PROGMEM;
-extern const char TEXT_REG_NSPSEG[]  PROGMEM;
-extern const char TEXT_REG_NSPOFF[]  PROGMEM;
-extern const char TEXT_REG_NSP[]     PROGMEM;
-
-using common::TEXT_CC_F;
-using common::TEXT_CC_LT;
-using common::TEXT_CC_LE;
-using common::TEXT_CC_ULE;
-using common::TEXT_CC_OV;
-using common::TEXT_CC_MI;
-using common::TEXT_CC_Z;
-using common::TEXT_CC_C;
-using common::TEXT_CC_T;
-using common::TEXT_CC_GE;
-using common::TEXT_CC_GT;
-using common::TEXT_CC_UGT;
-using common::TEXT_CC_NOV;
-using common::TEXT_CC_PL;
-using common::TEXT_CC_NZ;
-using common::TEXT_CC_NC;
-using common::TEXT_CC_EQ;
-using common::TEXT_CC_ULT;
-using common::TEXT_CC_NE;
-using common::TEXT_CC_UGE;
-
-extern const char TEXT_FLAG_C[] PROGMEM;
-extern const char TEXT_FLAG_Z[] PROGMEM;
-extern const char TEXT_FLAG_S[] PROGMEM;
-extern const char TEXT_FLAG_P[] PROGMEM;
-extern const char TEXT_FLAG_V[] PROGMEM;
+#define TEXT_Z8000_LIST(T, A)           \
+    T(TEXT_CPU_LIST,    "Z8001, Z8002") \
+    T(TEXT_CPU_Z8001,   "Z8001")        \
+    T(TEXT_CPU_Z8002,   "Z8002")        \
+    T(TEXT_ADC,         "ADC")          \
+    T(TEXT_ADCB,        "ADCB")         \
+    T(TEXT_ADD,         "ADD")          \
+    T(TEXT_ADDB,        "ADDB")         \
+    T(TEXT_ADDL,        "ADDL")         \
+    T(TEXT_AND,         "AND")          \
+    T(TEXT_ANDB,        "ANDB")         \
+    T(TEXT_BIT,         "BIT")          \
+    T(TEXT_BITB,        "BITB")         \
+    T(TEXT_CALL,        "CALL")         \
+    T(TEXT_CALR,        "CALR")         \
+    T(TEXT_CLR,         "CLR")          \
+    T(TEXT_CLRB,        "CLRB")         \
+    T(TEXT_COM,         "COM")          \
+    T(TEXT_COMB,        "COMB")         \
+    T(TEXT_COMFLG,      "COMFLG")       \
+    T(TEXT_CP,          "CP")           \
+    T(TEXT_CPB,         "CPB")          \
+    T(TEXT_CPD,         "CPD")          \
+    T(TEXT_CPDB,        "CPDB")         \
+    T(TEXT_CPDR,        "CPDR")         \
+    T(TEXT_CPDRB,       "CPDRB")        \
+    T(TEXT_CPI,         "CPI")          \
+    T(TEXT_CPIB,        "CPIB")         \
+    T(TEXT_CPIR,        "CPIR")         \
+    T(TEXT_CPIRB,       "CPIRB")        \
+    T(TEXT_CPL,         "CPL")          \
+    T(TEXT_CPSD,        "CPSD")         \
+    T(TEXT_CPSDB,       "CPSDB")        \
+    T(TEXT_CPSDR,       "CPSDR")        \
+    T(TEXT_CPSDRB,      "CPSDRB")       \
+    T(TEXT_CPSI,        "CPSI")         \
+    T(TEXT_CPSIB,       "CPSIB")        \
+    T(TEXT_CPSIR,       "CPSIR")        \
+    T(TEXT_CPSIRB,      "CPSIRB")       \
+    T(TEXT_DAB,         "DAB")          \
+    T(TEXT_DBJNZ,       "DBJNZ")        \
+    T(TEXT_DEC,         "DEC")          \
+    T(TEXT_DECB,        "DECB")         \
+    T(TEXT_DI,          "DI")           \
+    T(TEXT_DIV,         "DIV")          \
+    T(TEXT_DIVL,        "DIVL")         \
+    T(TEXT_DJNZ,        "DJNZ")         \
+    T(TEXT_EI,          "EI")           \
+    T(TEXT_EX,          "EX")           \
+    T(TEXT_EXB,         "EXB")          \
+    T(TEXT_EXTS,        "EXTS")         \
+    T(TEXT_EXTSB,       "EXTSB")        \
+    T(TEXT_EXTSL,       "EXTSL")        \
+    T(TEXT_HALT,        "HALT")         \
+    T(TEXT_IN,          "IN")           \
+    T(TEXT_INB,         "INB")          \
+    T(TEXT_INC,         "INC")          \
+    T(TEXT_INCB,        "INCB")         \
+    T(TEXT_IND,         "IND")          \
+    T(TEXT_INDB,        "INDB")         \
+    T(TEXT_INDR,        "INDR")         \
+    T(TEXT_INDRB,       "INDRB")        \
+    T(TEXT_INI,         "INI")          \
+    T(TEXT_INIB,        "INIB")         \
+    T(TEXT_INIR,        "INIR")         \
+    T(TEXT_INIRB,       "INIRB")        \
+    T(TEXT_IRET,        "IRET")         \
+    T(TEXT_JP,          "JP")           \
+    T(TEXT_JR,          "JR")           \
+    T(TEXT_LD,          "LD")           \
+    T(TEXT_LDA,         "LDA")          \
+    T(TEXT_LDAR,        "LDAR")         \
+    T(TEXT_LDB,         "LDB")          \
+    T(TEXT_LDCTL,       "LDCTL")        \
+    T(TEXT_LDCTLB,      "LDCTLB")       \
+    T(TEXT_LDD,         "LDD")          \
+    T(TEXT_LDDB,        "LDDB")         \
+    T(TEXT_LDDR,        "LDDR")         \
+    T(TEXT_LDDRB,       "LDDRB")        \
+    T(TEXT_LDI,         "LDI")          \
+    T(TEXT_LDIB,        "LDIB")         \
+    T(TEXT_LDIR,        "LDIR")         \
+    T(TEXT_LDIRB,       "LDIRB")        \
+    T(TEXT_LDK,         "LDK")          \
+    T(TEXT_LDL,         "LDL")          \
+    T(TEXT_LDM,         "LDM")          \
+    T(TEXT_LDPS,        "LDPS")         \
+    T(TEXT_LDR,         "LDR")          \
+    T(TEXT_LDRB,        "LDRB")         \
+    T(TEXT_LDRL,        "LDRL")         \
+    T(TEXT_MBIT,        "MBIT")         \
+    T(TEXT_MREQ,        "MREQ")         \
+    T(TEXT_MRES,        "MRES")         \
+    T(TEXT_MSET,        "MSET")         \
+    T(TEXT_MULT,        "MULT")         \
+    T(TEXT_MULTL,       "MULTL")        \
+    T(TEXT_NEG,         "NEG")          \
+    T(TEXT_NEGB,        "NEGB")         \
+    T(TEXT_NOP,         "NOP")          \
+    T(TEXT_OR,          "OR")           \
+    T(TEXT_ORB,         "ORB")          \
+    T(TEXT_OTDR,        "OTDR")         \
+    T(TEXT_OTDRB,       "OTDRB")        \
+    T(TEXT_OTIR,        "OTIR")         \
+    T(TEXT_OTIRB,       "OTIRB")        \
+    T(TEXT_OUT,         "OUT")          \
+    T(TEXT_OUTB,        "OUTB")         \
+    T(TEXT_OUTD,        "OUTD")         \
+    T(TEXT_OUTDB,       "OUTDB")        \
+    T(TEXT_OUTI,        "OUTI")         \
+    T(TEXT_OUTIB,       "OUTIB")        \
+    T(TEXT_POP,         "POP")          \
+    T(TEXT_POPL,        "POPL")         \
+    T(TEXT_PUSH,        "PUSH")         \
+    T(TEXT_PUSHL,       "PUSHL")        \
+    T(TEXT_RES,         "RES")          \
+    T(TEXT_RESB,        "RESB")         \
+    T(TEXT_RESFLG,      "RESFLG")       \
+    T(TEXT_RET,         "RET")          \
+    T(TEXT_RL,          "RL")           \
+    T(TEXT_RLB,         "RLB")          \
+    T(TEXT_RLC,         "RLC")          \
+    T(TEXT_RLCB,        "RLCB")         \
+    T(TEXT_RLDB,        "RLDB")         \
+    T(TEXT_RR,          "RR")           \
+    T(TEXT_RRB,         "RRB")          \
+    T(TEXT_RRC,         "RRC")          \
+    T(TEXT_RRCB,        "RRCB")         \
+    T(TEXT_RRDB,        "RRDB")         \
+    T(TEXT_SBC,         "SBC")          \
+    T(TEXT_SBCB,        "SBCB")         \
+    T(TEXT_SC,          "SC")           \
+    T(TEXT_SDA,         "SDA")          \
+    T(TEXT_SDAB,        "SDAB")         \
+    T(TEXT_SDAL,        "SDAL")         \
+    T(TEXT_SDL,         "SDL")          \
+    T(TEXT_SDLB,        "SDLB")         \
+    T(TEXT_SDLL,        "SDLL")         \
+    T(TEXT_SET,         "SET")          \
+    T(TEXT_SETB,        "SETB")         \
+    T(TEXT_SETFLG,      "SETFLG")       \
+    T(TEXT_SIN,         "SIN")          \
+    T(TEXT_SINB,        "SINB")         \
+    T(TEXT_SIND,        "SIND")         \
+    T(TEXT_SINDB,       "SINDB")        \
+    T(TEXT_SINDR,       "SINDR")        \
+    T(TEXT_SINDRB,      "SINDRB")       \
+    T(TEXT_SINI,        "SINI")         \
+    T(TEXT_SINIB,       "SINIB")        \
+    T(TEXT_SINIR,       "SINIR")        \
+    T(TEXT_SINIRB,      "SINIRB")       \
+    T(TEXT_SLA,         "SLA")          \
+    T(TEXT_SLAB,        "SLAB")         \
+    T(TEXT_SLAL,        "SLAL")         \
+    T(TEXT_SLL,         "SLL")          \
+    T(TEXT_SLLB,        "SLLB")         \
+    T(TEXT_SLLL,        "SLLL")         \
+    T(TEXT_SOTDR,       "SOTDR")        \
+    T(TEXT_SOTDRB,      "SOTDRB")       \
+    T(TEXT_SOTIR,       "SOTIR")        \
+    T(TEXT_SOTIRB,      "SOTIRB")       \
+    T(TEXT_SOUT,        "SOUT")         \
+    T(TEXT_SOUTB,       "SOUTB")        \
+    T(TEXT_SOUTD,       "SOUTD")        \
+    T(TEXT_SOUTDB,      "SOUTDB")       \
+    T(TEXT_SOUTI,       "SOUTI")        \
+    T(TEXT_SOUTIB,      "SOUTIB")       \
+    T(TEXT_SRA,         "SRA")          \
+    T(TEXT_SRAB,        "SRAB")         \
+    T(TEXT_SRAL,        "SRAL")         \
+    T(TEXT_SRL,         "SRL")          \
+    T(TEXT_SRLB,        "SRLB")         \
+    T(TEXT_SRLL,        "SRLL")         \
+    T(TEXT_SUB,         "SUB")          \
+    T(TEXT_SUBB,        "SUBB")         \
+    T(TEXT_SUBL,        "SUBL")         \
+    T(TEXT_TCC,         "TCC")          \
+    T(TEXT_TCCB,        "TCCB")         \
+    T(TEXT_TEST,        "TEST")         \
+    T(TEXT_TESTB,       "TESTB")        \
+    T(TEXT_TESTL,       "TESTL")        \
+    T(TEXT_TRDB,        "TRDB")         \
+    T(TEXT_TRDRB,       "TRDRB")        \
+    T(TEXT_TRIB,        "TRIB")         \
+    T(TEXT_TRIRB,       "TRIRB")        \
+    T(TEXT_TRTDB,       "TRTDB")        \
+    T(TEXT_TRTDRB,      "TRTDRB")       \
+    T(TEXT_TRTIB,       "TRTIB")        \
+    T(TEXT_TRTIRB,      "TRTIRB")       \
+    T(TEXT_TSET,        "TSET")         \
+    T(TEXT_TSETB,       "TSETB")        \
+    T(TEXT_XOR,         "XOR")          \
+    T(TEXT_XORB,        "XORB")         \
+    T(TEXT_REG_FLAGS,   "FLAGS")        \
+    T(TEXT_REG_FCW,     "FCW")          \
+    T(TEXT_REG_REFRESH, "REFRESH")      \
+    T(TEXT_REG_PSAPSEG, "PSAPSEG")      \
+    T(TEXT_REG_PSAPOFF, "PSAPOFF")      \
+    T(TEXT_REG_PSAP,    "PSAP")         \
+    T(TEXT_REG_NSPSEG,  "NSPSEG")       \
+    T(TEXT_REG_NSPOFF,  "NSPOFF")       \
+    T(TEXT_REG_NSP,     "NSP")          \
+    T(TEXT_CC_F,        "F")            \
+    T(TEXT_CC_LT,       "LT")           \
+    T(TEXT_CC_LE,       "LE")           \
+    T(TEXT_CC_ULE,      "ULE")          \
+    T(TEXT_CC_OV,       "OV")           \
+    T(TEXT_CC_MI,       "MI")           \
+    T(TEXT_CC_Z,        "Z")            \
+    T(TEXT_CC_C,        "C")            \
+    T(TEXT_CC_T,        "")             \
+    T(TEXT_CC_GE,       "GE")           \
+    T(TEXT_CC_GT,       "GT")           \
+    T(TEXT_CC_UGT,      "UGT")          \
+    T(TEXT_CC_NOV,      "NOV")          \
+    T(TEXT_CC_PL,       "PL")           \
+    T(TEXT_CC_NZ,       "NZ")           \
+    T(TEXT_CC_NC,       "NC")           \
+    T(TEXT_CC_EQ,       "EQ")           \
+    T(TEXT_CC_ULT,      "ULT")          \
+    T(TEXT_CC_NE,       "NE")           \
+    T(TEXT_CC_UGE,      "UGE")          \
+    A(TEXT_FLAG_C,      TEXT_CC_C)      \
+    A(TEXT_FLAG_Z,      TEXT_CC_Z)      \
+    T(TEXT_FLAG_S,      "S")            \
+    T(TEXT_FLAG_P,      "P")            \
+    T(TEXT_FLAG_V,      "V")            \
+    T(TEXT_INTR_VI,     "VI")           \
+    T(TEXT_INTR_NVI,    "NVI")
 // clang-format on
 
+DECLARE_TEXT_POOL(TEXT_Z8000_LIST);
+
 }  // namespace z8000
 }  // namespace text
 }  // namespace libasm
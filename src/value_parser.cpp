@@ -19,6 +19,7 @@
 #include <ctype.h>
 
 #include "config_base.h"
+#include "phase_stats.h"
 #include "stack.h"
 
 namespace libasm {
@@ -67,6 +68,7 @@ struct OperatorStack : Stack<Operator, 8> {
 
 Value ValueParser::eval(
         StrScanner &scan, ErrorAt &error, const SymbolTable *symtab, char delim) const {
+    LIBASM_STATS_SCOPE(EVALUATION);
     ValueStack vstack;
     OperatorStack ostack;
     char end_of_expr = delim;
@@ -16,14 +16,26 @@
 
 #include "gen_driver.h"
 
+#include <unistd.h>
+
 #include <cstdarg>
+#include <cstdlib>
 #include <cstring>
+#include <memory>
 
 namespace libasm {
 namespace gen {
 
-GenDriver::GenDriver(Disassembler &disassembler)
-    : _disassembler(disassembler), _listing(disassembler) {}
+GenDriver::GenDriver(Disassembler &disassembler, std::function<Disassembler *()> factory)
+    : _disassembler(disassembler), _factory(factory), _listing(disassembler) {}
+
+Error GenDriver::setOption(const char *name, const char *text) {
+    _options.emplace_back(name, text);
+    return _disassembler.setOption(name, text);
+}
+
+static constexpr auto CHECKPOINT_INTERVAL = std::chrono::seconds(60);
+static constexpr char CHECKPOINT_MAGIC[8] = {'G', 'E', 'N', 'C', 'K', 'P', 'T', '1'};
 
 static const char *basename(const char *str, char sep_char = '/') {
     const char *sep = strrchr(str, sep_char);
@@ -40,31 +52,42 @@ int GenDriver::main(int argc, const char **argv) {
     _listing.setUppercase(_uppercase);
     if (_generateGas) {
         commentStr = ";###";
-        _disassembler.setOption("c-style", "on");
+        setOption("c-style", "on");
         _listing.setUpperHex(false);
     }
+    _command = _progname;
+    for (int i = 1; i < argc; i++) {
+        _command += ' ';
+        _command += argv[i];
+    }
+    uint64_t output_offset = 0, list_offset = 0;
+    if (_checkpoint_name && loadCheckpoint(output_offset, list_offset))
+        return 1;
     _output = nullptr;
     if (_output_name) {
-        _output = fopen(_output_name, "w");
+        _output = openFile(_output_name, output_offset);
         if (_output == nullptr) {
             fprintf(stderr, "Can't open output file %s\n", _output_name);
             return 1;
         }
-        printCommandLine(_output, commentStr, _progname, argc, argv);
+        if (!_resume)
+            printCommandLine(_output, commentStr, _progname, argc, argv);
     }
     _list = nullptr;
     if (_list_name) {
-        _list = fopen(_list_name, "w");
+        _list = openFile(_list_name, list_offset);
         if (_list == nullptr) {
             fprintf(stderr, "Can't open list file %s\n", _list_name);
             return 1;
         }
-        printCommandLine(_list, commentStr, _progname, argc, argv);
+        if (!_resume)
+            printCommandLine(_list, commentStr, _progname, argc, argv);
     }
     _listing.setCpu(_cpu.c_str());
-    if (!_includeTarget && !_generateGas) {
+    if (!_includeTarget && !_generateGas && !_resume) {
         printList();
     }
+    _checkpoint_time = std::chrono::steady_clock::now() + CHECKPOINT_INTERVAL;
     return 0;
 }
 
@@ -73,6 +96,8 @@ int GenDriver::close() {
         fclose(_output);
     if (_list)
         fclose(_list);
+    if (_checkpoint_name)
+        remove(_checkpoint_name);
     return 0;
 }
 
@@ -92,11 +117,113 @@ void GenDriver::printList() {
 
 void GenDriver::setOrigin(uint32_t addr) {
     _listing.setOrigin(addr);
-    if (!_includeTarget && !_generateGas) {
+    if (!_includeTarget && !_generateGas && !_resume) {
         printList();
     }
 }
 
+namespace {
+struct GenWorker : TestGenerator::Worker {
+    GenWorker(Disassembler *disassembler) : _disassembler(disassembler), _listing(*disassembler) {}
+    GenFormatter &listing() override { return _listing; }
+
+private:
+    std::unique_ptr<Disassembler> _disassembler;
+    GenFormatter _listing;
+};
+}  // namespace
+
+// TestGenerator::Formatter
+TestGenerator::Worker *GenDriver::newWorker() {
+    auto disassembler = _factory();
+    auto worker = new GenWorker(disassembler);
+    auto &listing = worker->listing();
+    disassembler->setCpu(_cpu.c_str());
+    listing.setUpperHex(_upper_hex && !_generateGas);
+    listing.setUppercase(_uppercase);
+    listing.setCpu(_cpu.c_str());
+    for (const auto &option : _options)
+        disassembler->setOption(option.first.c_str(), option.second.c_str());
+    return worker;
+}
+
+static bool putValue(FILE *file, uint64_t value) {
+    return fwrite(&value, sizeof(value), 1, file) == 1;
+}
+
+static bool getValue(FILE *file, uint64_t &value) {
+    return fread(&value, sizeof(value), 1, file) == 1;
+}
+
+bool GenDriver::checkpointDue() {
+    return _checkpoint_name && std::chrono::steady_clock::now() >= _checkpoint_time;
+}
+
+void GenDriver::saveCheckpoint(const TestGenerator::Checkpoint &checkpoint) {
+    if (_output)
+        fflush(_output);
+    if (_list)
+        fflush(_list);
+    // Write to a temporary file so that a checkpoint is never half written.
+    const auto tmp_name = std::string(_checkpoint_name) + ".tmp";
+    auto file = fopen(tmp_name.c_str(), "wb");
+    auto ok = file != nullptr;
+    if (ok) {
+        ok = fwrite(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC), 1, file) == 1 &&
+             putValue(file, _command.size()) &&
+             fwrite(_command.data(), 1, _command.size(), file) == _command.size() &&
+             putValue(file, _output ? ftell(_output) : 0) &&
+             putValue(file, _list ? ftell(_list) : 0) && putValue(file, checkpoint.calls) &&
+             putValue(file, checkpoint.count) && putValue(file, checkpoint.addr) &&
+             checkpoint.variants.write(file);
+        ok = fclose(file) == 0 && ok;
+    }
+    if (!ok || rename(tmp_name.c_str(), _checkpoint_name) != 0)
+        fprintf(stderr, "Can't write checkpoint file %s\n", _checkpoint_name);
+    _checkpoint_time = std::chrono::steady_clock::now() + CHECKPOINT_INTERVAL;
+}
+
+int GenDriver::loadCheckpoint(uint64_t &output_offset, uint64_t &list_offset) {
+    auto file = fopen(_checkpoint_name, "rb");
+    if (file == nullptr)
+        return 0;  // start from scratch
+    std::unique_ptr<TestGenerator::Checkpoint> checkpoint(new TestGenerator::Checkpoint());
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    uint64_t size, calls, count, addr;
+    auto ok = fread(magic, sizeof(magic), 1, file) == 1 &&
+              memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) == 0 && getValue(file, size);
+    std::string command(ok ? size : 0, 0);
+    ok = ok && fread(&command[0], 1, size, file) == size && getValue(file, output_offset) &&
+         getValue(file, list_offset) && getValue(file, calls) && getValue(file, count) &&
+         getValue(file, addr) && checkpoint->variants.read(file);
+    fclose(file);
+    if (!ok) {
+        fprintf(stderr, "Broken checkpoint file %s\n", _checkpoint_name);
+        return 1;
+    }
+    if (command != _command) {
+        fprintf(stderr, "Checkpoint file %s is for: %s\n", _checkpoint_name, command.c_str());
+        return 1;
+    }
+    checkpoint->calls = calls;
+    checkpoint->count = count;
+    checkpoint->addr = addr;
+    _resume = std::move(checkpoint);
+    return 0;
+}
+
+FILE *GenDriver::openFile(const char *name, uint64_t offset) const {
+    if (!_resume)
+        return fopen(name, "w");
+    // Discard output after the checkpoint.
+    auto file = fopen(name, "r+");
+    if (file && (ftruncate(fileno(file), offset) != 0 || fseek(file, 0, SEEK_END) != 0)) {
+        fclose(file);
+        file = nullptr;
+    }
+    return file;
+}
+
 void GenDriver::info(const char *fmt, ...) {
 #if DEBUG_TRACE
     if (_list) {
@@ -115,6 +242,8 @@ int GenDriver::parseOption(int argc, const char **argv) {
     _includeTarget = false;
     _generateGas = false;
     _dump = false;
+    _threads = 1;
+    _checkpoint_name = nullptr;
     for (int i = 1; i < argc; i++) {
         const char *opt = argv[i];
         if (*opt == '-') {
@@ -159,6 +288,24 @@ int GenDriver::parseOption(int argc, const char **argv) {
             case 'd':
                 _dump = true;
                 break;
+            case 'j':
+                if (++i >= argc) {
+                    fprintf(stderr, "-j requires number of threads\n");
+                    return 1;
+                }
+                _threads = atoi(argv[i]);
+                if (_threads < 1) {
+                    fprintf(stderr, "invalid number of threads: %s\n", argv[i]);
+                    return 1;
+                }
+                break;
+            case 'c':
+                if (++i >= argc) {
+                    fprintf(stderr, "-c requires checkpoint file name\n");
+                    return 1;
+                }
+                _checkpoint_name = argv[i];
+                break;
             default:
                 fprintf(stderr, "unknown option: %s\n", opt);
                 return 1;
@@ -188,7 +335,9 @@ int GenDriver::usage() const {
             "  -g          : output GNU as compatible\n"
             "  -h          : use lower case letter for hexadecimal\n"
             "  -u          : use upper case letter for output\n"
-            "  -d          : dump debug info\n",
+            "  -d          : dump debug info\n"
+            "  -j <threads>: disassemble test data with threads\n"
+            "  -c <file>   : save checkpoints to <file> and resume from it\n",
             _progname, listCpu);
     return 2;
 }
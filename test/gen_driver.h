@@ -21,24 +21,36 @@
 #include "gen_formatter.h"
 #include "test_generator.h"
 
+#include <chrono>
 #include <cstdio>
+#include <functional>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace libasm {
 namespace gen {
 
 class GenDriver : public TestGenerator::Formatter {
 public:
-    GenDriver(Disassembler &disassembler);
+    template <typename DIS>
+    GenDriver(DIS &disassembler)
+        : GenDriver(disassembler, []() -> Disassembler * { return new DIS(); }) {}
+    GenDriver(Disassembler &disassembler, std::function<Disassembler *()> factory);
 
     int main(int argc, const char **argv);
+    /** set option of the disassembler and disassemblers of workers */
+    Error setOption(const char *name, const char *text);
     void pseudo(const char *name, const char *operands);
     int close();
     bool generateGas() const { return _generateGas; }
 
 private:
     Disassembler &_disassembler;
+    const std::function<Disassembler *()> _factory;
     GenFormatter _listing;
+    std::vector<std::pair<std::string, std::string>> _options;
     const char *_progname;
     const char *_output_name;
     const char *_list_name;
@@ -48,6 +60,11 @@ private:
     bool _includeTarget;
     bool _generateGas;
     bool _dump;
+    int _threads;
+    const char *_checkpoint_name;
+    std::string _command;
+    std::unique_ptr<TestGenerator::Checkpoint> _resume;
+    std::chrono::steady_clock::time_point _checkpoint_time;
     FILE *_output;
     FILE *_list;
 
@@ -55,10 +72,18 @@ private:
     GenFormatter &listing() override final { return _listing; }
     void printList() override final;
     void setOrigin(uint32_t addr) override final;
+    int threads() const override final { return _threads; }
+    TestGenerator::Worker *newWorker() override final;
+    const TestGenerator::Checkpoint *resumeFrom() override final { return _resume.get(); }
+    void resumed() override final { _resume.reset(); }
+    bool checkpointDue() override final;
+    void saveCheckpoint(const TestGenerator::Checkpoint &checkpoint) override final;
 
     void info(const char *fmt, ...) override final;
 
     int parseOption(int argc, const char **argv);
+    int loadCheckpoint(uint64_t &output_offset, uint64_t &list_offset);
+    FILE *openFile(const char *name, uint64_t offset) const;
     int usage() const;
 
     void printCommandLine(FILE *out, const char *commentStr, const char *progname, int argc,
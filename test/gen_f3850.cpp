@@ -26,9 +26,9 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis3850.setOption("c-style", "enable");
-    dis3850.setOption("relative", "enable");
-    dis3850.setOption("use-scratchpad", "on");
+    driver.setOption("c-style", "enable");
+    driver.setOption("relative", "enable");
+    driver.setOption("use-scratchpad", "on");
 
     TestGenerator generator(driver, dis3850, 0x0100);
     generator.generate();
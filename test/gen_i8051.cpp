@@ -16,6 +16,7 @@
 
 #include "dis_i8051.h"
 #include "gen_driver.h"
+#include "length_i8051.h"
 
 using namespace libasm::i8051;
 using namespace libasm::gen;
@@ -26,12 +27,12 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis8051.setOption("relative", "enable");
+    driver.setOption("relative", "enable");
 
     TestGenerator generator(driver, dis8051, 0x0100);
-    generator.generate();
+    generator.checkLength(LENGTH).generate();
 
-    return driver.close();
+    return driver.close() || generator.lengthErrors();
 }
 
 // Local Variables:
@@ -16,6 +16,7 @@
 
 #include "dis_i8086.h"
 #include "gen_driver.h"
+#include "length_i8086.h"
 
 using namespace libasm::i8086;
 using namespace libasm::gen;
@@ -26,13 +27,14 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis8086.setOption("relative", "enable");
-    dis8086.setOption("string-insn", "enable");
+    driver.setOption("relative", "enable");
+    driver.setOption("string-insn", "enable");
 
+    const LengthI8086 length(/*repeatHasStringInsn*/ true);
     TestGenerator generator(driver, dis8086, 0x1000);
-    generator.generate();
+    generator.checkLength(length).generate();
 
-    return driver.close();
+    return driver.close() || generator.lengthErrors();
 }
 
 // Local Variables:
@@ -26,7 +26,7 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis8096.setOption("relative", "enable");
+    driver.setOption("relative", "enable");
 
     TestGenerator generator(driver, dis8096, 0x2000);
     generator.generate();
@@ -26,8 +26,8 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis8060.setOption("relative", "enable");
-    dis8060.setOption("c-style", "enable");
+    driver.setOption("relative", "enable");
+    driver.setOption("c-style", "enable");
 
     TestGenerator generator(driver, dis8060, 0x0100);
     generator.generate();
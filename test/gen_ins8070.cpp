@@ -26,9 +26,9 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis8070.setOption("relative", "enable");
-    dis8070.setOption("use-sharp", "enable");
-    dis8070.setOption("c-style", "enable");
+    driver.setOption("relative", "enable");
+    driver.setOption("use-sharp", "enable");
+    driver.setOption("c-style", "enable");
 
     TestGenerator generator(driver, dis8070, 0x0100);
     generator.generate();
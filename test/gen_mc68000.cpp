@@ -16,6 +16,7 @@
 
 #include "dis_mc68000.h"
 #include "gen_driver.h"
+#include "length_mc68000.h"
 
 using namespace libasm::mc68000;
 using namespace libasm::gen;
@@ -26,12 +27,12 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis68000.setOption("relative", "enable");
+    driver.setOption("relative", "enable");
 
     TestGenerator generator(driver, dis68000, 0x10000);
-    generator.generate();
+    generator.checkLength(LENGTH).generate();
 
-    return driver.close();
+    return driver.close() || generator.lengthErrors();
 }
 
 // Local Variables:
@@ -26,7 +26,7 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis6805.setOption("relative", "enable");
+    driver.setOption("relative", "enable");
 
     TestGenerator generator(driver, dis6805, 0x0100);
     generator.generate();
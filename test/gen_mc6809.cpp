@@ -16,6 +16,7 @@
 
 #include "dis_mc6809.h"
 #include "gen_driver.h"
+#include "length_mc6809.h"
 
 using namespace libasm::mc6809;
 using namespace libasm::gen;
@@ -26,12 +27,12 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis6809.setOption("relative", "enable");
+    driver.setOption("relative", "enable");
 
     TestGenerator generator(driver, dis6809, 0x0100);
-    generator.generate();
+    generator.checkLength(LENGTH).generate();
 
-    return driver.close();
+    return driver.close() || generator.lengthErrors();
 }
 
 // Local Variables:
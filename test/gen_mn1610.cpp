@@ -26,8 +26,8 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis1610.setOption("relative", "enable");
-    dis1610.setOption("c-style", "enable");
+    driver.setOption("relative", "enable");
+    driver.setOption("c-style", "enable");
 
     TestGenerator generator(driver, dis1610, 0x0100);
     generator.generate();
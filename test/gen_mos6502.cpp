@@ -16,6 +16,7 @@
 
 #include "dis_mos6502.h"
 #include "gen_driver.h"
+#include "length_mos6502.h"
 
 using namespace libasm::mos6502;
 using namespace libasm::gen;
@@ -26,15 +27,15 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis6502.setOption("relative", "enable");
-    dis6502.setOption("indirect-long", "disable");
+    driver.setOption("relative", "enable");
+    driver.setOption("indirect-long", "disable");
 
     const Config::uintptr_t origin =
             dis6502.addressWidth() == libasm::ADDRESS_24BIT ? 0x100200 : 0x0200;
     TestGenerator generator(driver, dis6502, origin);
-    generator.generate();
+    generator.checkLength(LENGTH).generate();
 
-    return driver.close();
+    return driver.close() || generator.lengthErrors();
 }
 
 // Local Variables:
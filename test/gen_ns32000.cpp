@@ -26,13 +26,13 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis32000.setOption("relative", "enable");
-    dis32000.setOption("c-style", "enable");
+    driver.setOption("relative", "enable");
+    driver.setOption("c-style", "enable");
     if (driver.generateGas()) {
-        dis32000.setOption("stropt-bracket", "enable");
-        dis32000.setOption("origin-char", ".");
-        dis32000.setOption("pcrel-paren", "enable");
-        dis32000.setOption("float-prefix", "enable");
+        driver.setOption("stropt-bracket", "enable");
+        driver.setOption("origin-char", ".");
+        driver.setOption("pcrel-paren", "enable");
+        driver.setOption("float-prefix", "enable");
     }
     TestGenerator generator(driver, dis32000, 0x10000);
     generator.generate();
@@ -26,7 +26,7 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis2650.setOption("relative", "disable");
+    driver.setOption("relative", "disable");
 
     TestGenerator generator(driver, dis2650, 0x0100);
     generator.generate();
@@ -26,8 +26,8 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    disz8.setOption("relative", "enable");
-    disz8.setOption("work-register", "disable");
+    driver.setOption("relative", "enable");
+    driver.setOption("work-register", "disable");
 
     TestGenerator generator(driver, disz8, 0x0100);
     generator.generate();
@@ -16,6 +16,7 @@
 
 #include "dis_z80.h"
 #include "gen_driver.h"
+#include "length_z80.h"
 
 using namespace libasm::z80;
 using namespace libasm::gen;
@@ -26,12 +27,12 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    disz80.setOption("relative", "enable");
+    driver.setOption("relative", "enable");
 
     TestGenerator generator(driver, disz80, 0x0100);
-    generator.generate().generate(0xDD, 0xCB, 0x7F).generate(0xFD, 0xCB, 0x80);
+    generator.checkLength(LENGTH).generate().generate(0xDD, 0xCB, 0x7F).generate(0xFD, 0xCB, 0x80);
 
-    return driver.close();
+    return driver.close() || generator.lengthErrors();
 }
 
 // Local Variables:
@@ -26,11 +26,11 @@ int main(int argc, const char **argv) {
     if (driver.main(argc, argv))
         return 1;
 
-    dis8000.setOption("relative", "enable");
+    driver.setOption("relative", "enable");
     if (driver.generateGas()) {
-        dis8000.setOption("ioaddr-prefix", "enable");
-        dis8000.setOption("origin-char", ".");
-        dis8000.setOption("short-direct", "disable");
+        driver.setOption("ioaddr-prefix", "enable");
+        driver.setOption("origin-char", ".");
+        driver.setOption("short-direct", "disable");
     }
 
     const Config::uintptr_t org =
@@ -17,13 +17,19 @@
 #include "test_generator.h"
 
 #include "array_memory.h"
+#include "config_host.h"
 #include "dis_base.h"
 #include "tokenized_text.h"
 
+#include <atomic>
 #include <cctype>
+#include <condition_variable>
 #include <cstdio>
-#include <unordered_map>
-#include <unordered_set>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace libasm {
 namespace gen {
@@ -139,6 +145,251 @@ private:
     }
 };
 
+/** A result of disassembling a test data. */
+struct TestGenerator::Decoded {
+    bool ok;
+    int length;
+    std::string name;
+    std::string operand;
+    TokenizedText tokens;
+
+    void decode(GenFormatter &listing, const uint8_t *memory, int size, uint32_t addr,
+            uint8_t addr_unit) {
+        const ArrayMemory array(addr, memory, size);
+        auto it = array.iterator();
+        listing.disassemble(it, addr / addr_unit);
+        ok = !listing.isError();
+        if (ok) {
+            length = listing.length();
+            name = listing.name();
+            operand = listing.operand();
+            tokens.tokenize(listing.operand());
+        }
+    }
+};
+
+/**
+ * Disassembles test data ahead on worker threads. Each batch has test
+ * data of a generator which are disassembled at the same address. Since
+ * the address advances only when a test is printed, most of the results
+ * are used as is. Worker threads pick test data from the newest batch,
+ * which is the innermost generator.
+ */
+class TestGenerator::Prefetcher {
+public:
+    Prefetcher(TestGenerator &generator, int threads);
+    ~Prefetcher();
+
+    struct Batch;
+    /** disassemble |images| from |index|-th at |addr| */
+    std::shared_ptr<Batch> submit(
+            const std::shared_ptr<std::vector<uint8_t>> &images, size_t index, uint32_t addr);
+    /** abandon test data which have not been disassembled yet */
+    void cancel(const std::shared_ptr<Batch> &batch);
+    /** returns disassembled |index|-th test data, or nullptr if not yet */
+    static const Decoded *take(Batch &batch, size_t index);
+
+private:
+    enum State : int { FREE, BUSY, DONE };
+    struct Slot {
+        std::atomic<int> state{FREE};
+        Decoded decoded;
+    };
+
+    const int _memorySize;
+    const uint8_t _addr_unit;
+    std::mutex _mutex;
+    std::condition_variable _ready;
+    std::vector<std::shared_ptr<Batch>> _batches;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::vector<std::thread> _threads;
+    bool _stop;
+
+    void run(Worker &worker);
+};
+
+struct TestGenerator::Prefetcher::Batch {
+    Batch(const std::shared_ptr<std::vector<uint8_t>> &images, int memorySize, size_t index,
+            uint32_t addr)
+        : images(images),
+          memorySize(memorySize),
+          base(index),
+          size(images->size() / memorySize - index),
+          addr(addr),
+          next(0),
+          slots(new Slot[size]) {}
+
+    const uint8_t *image(size_t index) const { return images->data() + (base + index) * memorySize; }
+
+    const std::shared_ptr<std::vector<uint8_t>> images;
+    const int memorySize;
+    const size_t base;
+    const size_t size;
+    const uint32_t addr;
+    std::atomic<size_t> next;
+    std::unique_ptr<Slot[]> slots;
+};
+
+TestGenerator::Prefetcher::Prefetcher(TestGenerator &generator, int threads)
+    : _memorySize(generator._memorySize), _addr_unit(generator._addr_unit), _stop(false) {
+    for (auto i = 0; i < threads; i++) {
+        auto worker = generator._formatter.newWorker();
+        if (worker == nullptr)
+            break;
+        _workers.emplace_back(worker);
+    }
+    for (auto &worker : _workers)
+        _threads.emplace_back(&Prefetcher::run, this, std::ref(*worker));
+}
+
+TestGenerator::Prefetcher::~Prefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _ready.notify_all();
+    for (auto &thread : _threads)
+        thread.join();
+}
+
+std::shared_ptr<TestGenerator::Prefetcher::Batch> TestGenerator::Prefetcher::submit(
+        const std::shared_ptr<std::vector<uint8_t>> &images, size_t index, uint32_t addr) {
+    auto batch = std::make_shared<Batch>(images, _memorySize, index, addr);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _batches.push_back(batch);
+    }
+    _ready.notify_all();
+    return batch;
+}
+
+void TestGenerator::Prefetcher::cancel(const std::shared_ptr<Batch> &batch) {
+    batch->next = batch->size;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = _batches.begin(); it != _batches.end(); ++it) {
+        if (*it == batch) {
+            _batches.erase(it);
+            break;
+        }
+    }
+}
+
+const TestGenerator::Decoded *TestGenerator::Prefetcher::take(Batch &batch, size_t index) {
+    auto &slot = batch.slots[index - batch.base];
+    int state = FREE;
+    if (slot.state.compare_exchange_strong(state, BUSY))
+        return nullptr;  // not picked by worker threads, no need to
+    if (state == DONE)
+        return &slot.decoded;
+    return nullptr;  // being disassembled
+}
+
+void TestGenerator::Prefetcher::run(Worker &worker) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _ready.wait(lock, [this] { return _stop || !_batches.empty(); });
+        if (_stop)
+            return;
+        const auto batch = _batches.back();
+        const auto index = batch->next++;
+        if (index >= batch->size) {
+            _batches.pop_back();
+            continue;
+        }
+        lock.unlock();
+        auto &slot = batch->slots[index];
+        int state = FREE;
+        if (slot.state.compare_exchange_strong(state, BUSY)) {
+            slot.decoded.decode(
+                    worker.listing(), batch->image(index), _memorySize, batch->addr, _addr_unit);
+            slot.state.store(DONE, std::memory_order_release);
+        }
+        lock.lock();
+    }
+}
+
+/**
+ * Test data generated by |DataGenerator|. When prefetching, all test
+ * data are generated in advance so that worker threads can disassemble
+ * them ahead. Since |DataGenerator::fill| overwrites the rest of memory,
+ * a memory image is the same as the one generated in turn.
+ */
+class TestGenerator::Candidates {
+public:
+    Candidates(TestGenerator &generator, DataGenerator &gen)
+        : _generator(generator), _gen(gen), _index(0), _live(false) {
+        auto prefetcher = _generator._prefetcher.get();
+        if (prefetcher == nullptr)
+            return;
+        const auto size = _generator._memorySize;
+        _images = std::make_shared<std::vector<uint8_t>>();
+        do {
+            _gen.next();
+            _images->insert(_images->end(), _generator._memory, _generator._memory + size);
+        } while (_gen.hasNext());
+        _batch = prefetcher->submit(_images, 0, _generator._mem_addr);
+    }
+
+    ~Candidates() {
+        if (_batch)
+            _generator._prefetcher->cancel(_batch);
+    }
+
+    bool next() {
+        const auto size = _generator._memorySize;
+        if (_images) {
+            if (_index * size >= _images->size())
+                return false;
+            memcpy(_generator._memory, _images->data() + _index * size, size);
+        } else {
+            if (_index > 0 && !_gen.hasNext())
+                return false;
+            _gen.next();
+        }
+        _index++;
+        return true;
+    }
+
+    const Decoded &decode() {
+        if (_batch) {
+            const auto index = _index - 1;
+            const auto addr = _generator._mem_addr;
+            if (_batch->addr != addr) {
+                _generator._prefetcher->cancel(_batch);
+                _batch = _generator._prefetcher->submit(_images, index, addr);
+            }
+            const auto decoded = Prefetcher::take(*_batch, index);
+            if (decoded) {
+                _live = false;
+                return *decoded;
+            }
+        }
+        decodeLive();
+        return _decoded;
+    }
+
+    /** make |Formatter::listing()| have the last decoded test data */
+    void list() {
+        if (!_live)
+            decodeLive();
+    }
+
+private:
+    TestGenerator &_generator;
+    DataGenerator &_gen;
+    size_t _index;
+    bool _live;
+    Decoded _decoded;
+    std::shared_ptr<std::vector<uint8_t>> _images;
+    std::shared_ptr<Prefetcher::Batch> _batch;
+
+    void decodeLive() {
+        _live = true;
+        _decoded.decode(_generator._listing, _generator._memory, _generator._memorySize,
+                _generator._mem_addr, _generator._addr_unit);
+    }
+};
+
 TestGenerator::TestGenerator(Formatter &formatter, Disassembler &disassembler, uint32_t addr)
     : _formatter(formatter),
       _disassembler(disassembler),
@@ -148,9 +399,13 @@ TestGenerator::TestGenerator(Formatter &formatter, Disassembler &disassembler, u
       _endian(disassembler.config().endian()),
       _addr_unit(disassembler.config().addressUnit()),
       _mem_addr(addr * _addr_unit),
-      _memory(new uint8_t[_memorySize]) {}
+      _memory(new uint8_t[_memorySize]),
+      _calls(0),
+      _lengthDecoder(nullptr),
+      _lengthErrors(0) {}
 
 TestGenerator::~TestGenerator() {
+    _prefetcher.reset();
     delete[] _memory;
 }
 
@@ -187,59 +442,90 @@ TestGenerator &TestGenerator::generate(uint8_t opc1, uint8_t opc2, uint8_t opc3)
 }
 
 TestGenerator &TestGenerator::generate(DataGenerator &gen) {
-    do {
+    const auto threads = _formatter.threads();
+    if (threads > 1 && !_prefetcher)
+        _prefetcher.reset(new Prefetcher(*this, threads - 1));
+    uint32_t count = 0;
+    const auto resume = _formatter.resumeFrom();
+    if (resume) {
+        if (resume->calls > _calls) {
+            _calls++;
+            return *this;  // already generated
+        }
+        // Fast forward; |DataGenerator::next| overwrites the rest of memory.
+        while (count < resume->count) {
+            gen.next();
+            count++;
+        }
+        _mem_addr = resume->addr;
+        _variants = resume->variants;
+        _formatter.resumed();
+    }
+    while (count == 0 || gen.hasNext()) {
         gen.next();
         ByteGenerator child(gen);
         generateTests(child);
-    } while (gen.hasNext());
+        count++;
+        if (_formatter.checkpointDue())
+            _formatter.saveCheckpoint(Checkpoint{_calls, count, _mem_addr, _variants});
+    }
+    _calls++;
 
     return *this;
 }
 
-int TestGenerator::meaningfulTestData() {
-    std::string name(_listing.name());
-    const size_t size = _listing.length();
-    name += ':';
-    name += size + '0';
-    auto seen = _map.find(name);
-    if (seen == _map.end()) {
-        _map.emplace(
-                name, std::unordered_set<TokenizedText, TokenizedText::hash, TokenizedText::eq>());
-        seen = _map.find(name);
-    }
-    auto &variants = seen->second;
-    const TokenizedText a(_listing.operand());
-    auto found = variants.find(a);
-    if (found != variants.end()) {
-        if (found->count() >= 0x4000)
-            return -1;
-        return 0;
+int TestGenerator::meaningfulTestData(const Decoded &decoded) {
+    const auto count = _variants.insert(decoded.name.c_str(), decoded.length, decoded.tokens);
+    if (count == 0)
+        return 1;
+    if (count >= 0x4000)
+        return -1;
+    return 0;
+}
+
+TestGenerator &TestGenerator::checkLength(const LengthDecoder &decoder) {
+    // A generator may run for variants of CPU which |decoder| doesn't know.
+    if (strcmp_P(_disassembler.cpu_P(), decoder.cpu_P()) == 0)
+        _lengthDecoder = &decoder;
+    return *this;
+}
+
+void TestGenerator::checkLength(const Decoded &decoded) {
+    if (_lengthDecoder == nullptr)
+        return;
+    const auto insn = _lengthDecoder->decode(_memory, _memorySize);
+    if (insn.length == decoded.length)
+        return;
+    if (_lengthErrors++ < 100) {
+        fprintf(stderr, "length mismatch %d <- %d:", insn.length, decoded.length);
+        for (auto i = 0; i < decoded.length; i++)
+            fprintf(stderr, " %02X", _memory[i]);
+        fprintf(stderr, "  %s %s\n", decoded.name.c_str(), decoded.operand.c_str());
     }
-    variants.insert(a);
-    return 1;
 }
 
 void TestGenerator::generateTests(DataGenerator &gen) {
     gen.debug("@@ enter");
-    do {
-        gen.next();
+    Candidates candidates(*this, gen);
+    while (candidates.next()) {
         gen.debug("@@  loop");
-        const ArrayMemory memory(_mem_addr, _memory, _memorySize);
-        auto it = memory.iterator();
-        _listing.disassemble(it, _mem_addr / _addr_unit);
-        if (_disassembler.isOK()) {
+        const auto &decoded = candidates.decode();
+        if (decoded.ok) {
+            checkLength(decoded);
             const int len = gen.length();
-            const int newLen = _listing.length();
+            const int newLen = decoded.length;
             const int delta = newLen - len;
             if (delta) {
                 _formatter.info("@@  delta: %d (%d <- %d)\n", delta, newLen, len);
                 gen.dump("@@   ", len, delta);
-                _formatter.info("@@       : %s %s\n", _listing.name(), _listing.operand());
+                _formatter.info(
+                        "@@       : %s %s\n", decoded.name.c_str(), decoded.operand.c_str());
             }
-            const int level = meaningfulTestData();
+            const int level = meaningfulTestData(decoded);
             if (level < 0 && gen.start() > 0)
                 return;
             if (level > 0) {
+                candidates.list();
                 _formatter.printList();
                 _mem_addr += newLen;
             }
@@ -252,7 +538,7 @@ void TestGenerator::generateTests(DataGenerator &gen) {
                 return;
             }
         }
-    } while (gen.hasNext());
+    }
     gen.debug("@@ leave");
 }
 
@@ -19,11 +19,10 @@
 
 #include "dis_base.h"
 #include "gen_formatter.h"
+#include "length_base.h"
 #include "tokenized_text.h"
 
-#include <string>
-#include <unordered_map>
-#include <unordered_set>
+#include <memory>
 
 namespace libasm {
 namespace gen {
@@ -59,10 +58,35 @@ protected:
 
 class TestGenerator {
 public:
+    /** A disassembler and its listing owned by a worker thread. */
+    struct Worker {
+        virtual ~Worker() {}
+        virtual GenFormatter &listing() = 0;
+    };
+
+    /** A state of TestGenerator to resume generation from. */
+    struct Checkpoint {
+        int calls;       // number of |generate| finished
+        uint32_t count;  // number of top level test data generated
+        uint32_t addr;   // address of next test
+        TokenizedTextSet variants;
+    };
+
     struct Formatter : public GenDebugger {
         virtual GenFormatter &listing() = 0;
         virtual void printList() = 0;
         virtual void setOrigin(uint32_t addr) = 0;
+        /** number of threads to disassemble test data, 1 to run serially */
+        virtual int threads() const { return 1; }
+        /** returns a new worker which disassembles the same as |listing()| */
+        virtual Worker *newWorker() { return nullptr; }
+        /** returns a checkpoint to resume from, or nullptr to start from scratch */
+        virtual const Checkpoint *resumeFrom() { return nullptr; }
+        /** notify that generation resumed from |resumeFrom()| */
+        virtual void resumed() {}
+        /** returns true if a checkpoint should be saved */
+        virtual bool checkpointDue() { return false; }
+        virtual void saveCheckpoint(const Checkpoint &checkpoint) {}
     };
 
     TestGenerator(Formatter &formatter, Disassembler &disassembler, uint32_t addr = 0);
@@ -71,6 +95,10 @@ public:
     TestGenerator &generate();
     TestGenerator &generate(uint8_t opc1);
     TestGenerator &generate(uint8_t opc1, uint8_t opc2, uint8_t opc3);
+    /** cross check lengths decoded by |decoder| against disassembled ones */
+    TestGenerator &checkLength(const LengthDecoder &decoder);
+    /** number of instructions which |checkLength| found mismatched */
+    int lengthErrors() const { return _lengthErrors; }
 
 private:
     Formatter &_formatter;
@@ -82,14 +110,21 @@ private:
     const uint8_t _addr_unit;
     uint32_t _mem_addr;
     uint8_t *_memory;
-    std::unordered_map<std::string,
-            std::unordered_set<TokenizedText, TokenizedText::hash, TokenizedText::eq> >
-            _map;
+    int _calls;
+    TokenizedTextSet _variants;
+    const LengthDecoder *_lengthDecoder;
+    int _lengthErrors;
+
+    struct Decoded;
+    class Prefetcher;
+    class Candidates;
+    std::unique_ptr<Prefetcher> _prefetcher;
 
     TestGenerator &generate(DataGenerator &gen);
     void printInsn(const libasm::driver::DisFormatter &data);
-    int meaningfulTestData();
+    int meaningfulTestData(const Decoded &decoded);
     void generateTests(DataGenerator &gen);
+    void checkLength(const Decoded &decoded);
 };
 
 }  // namespace gen
@@ -64,29 +64,137 @@ static bool isNumber(const char *p, const char *&r) {
 
 static constexpr uint8_t TOKEN_DIGITS = 0x80;
 
-TokenizedText::TokenizedText(const char *text) : _tokens(tokenize(text)), _count(0) {}
-
-std::vector<uint8_t> TokenizedText::tokenize(const char *text) {
-    std::vector<uint8_t> t;
+void TokenizedText::tokenize(const char *text) {
+    _tokens.clear();
     const char *b = text;
     while (*b) {
         const char *tmp;
         if (isNumber(b, tmp)) {
-            t.push_back(TOKEN_DIGITS);
+            _tokens.push_back(TOKEN_DIGITS);
             b = tmp;
         } else {
-            t.push_back(*b++);
+            _tokens.push_back(*b++);
+        }
+    }
+}
+
+static uint64_t fingerprint(const std::vector<uint8_t> &key) {
+    // FNV-1a
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    for (const auto b : key) {
+        hash ^= b;
+        hash *= UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+static constexpr std::size_t INITIAL_ENTRIES = 1024;
+
+TokenizedTextSet::TokenizedTextSet() : _arena(1) {
+    _names.entries.resize(INITIAL_ENTRIES);
+    _names.size = 0;
+    _variants.entries.resize(INITIAL_ENTRIES);
+    _variants.size = 0;
+}
+
+int TokenizedTextSet::insert(const char *name, int length, const TokenizedText &text) {
+    bool found;
+    _key.assign(name, name + strlen(name) + 1);
+    _key.push_back(length);
+    auto &named = find(_names, fingerprint(_key), _key, found);
+    if (!found)
+        named.value = _names.size - 1;
+    const auto id = named.value;
+
+    _key.clear();
+    for (auto i = 0; i < 4; i++)
+        _key.push_back(id >> (i * 8));
+    _key.insert(_key.end(), text.tokens(), text.tokens() + text.length());
+    auto &variant = find(_variants, fingerprint(_key), _key, found);
+    if (!found) {
+        variant.value = 0;
+        return 0;
+    }
+    return ++variant.value;
+}
+
+template <typename T>
+static bool writeVector(FILE *file, const std::vector<T> &v) {
+    const uint64_t size = v.size();
+    return fwrite(&size, sizeof(size), 1, file) == 1 &&
+           fwrite(v.data(), sizeof(T), v.size(), file) == v.size();
+}
+
+template <typename T>
+static bool readVector(FILE *file, std::vector<T> &v) {
+    uint64_t size;
+    if (fread(&size, sizeof(size), 1, file) != 1)
+        return false;
+    v.resize(size);
+    return fread(v.data(), sizeof(T), v.size(), file) == v.size();
+}
+
+bool TokenizedTextSet::write(FILE *file) const {
+    return writeVector(file, _arena) && write(file, _names) && write(file, _variants);
+}
+
+bool TokenizedTextSet::write(FILE *file, const Table &table) {
+    const uint64_t size = table.size;
+    return fwrite(&size, sizeof(size), 1, file) == 1 && writeVector(file, table.entries);
+}
+
+bool TokenizedTextSet::read(FILE *file) {
+    return readVector(file, _arena) && read(file, _names) && read(file, _variants);
+}
+
+bool TokenizedTextSet::read(FILE *file, Table &table) {
+    uint64_t size;
+    if (fread(&size, sizeof(size), 1, file) != 1)
+        return false;
+    table.size = size;
+    return readVector(file, table.entries);
+}
+
+TokenizedTextSet::Entry &TokenizedTextSet::find(
+        Table &table, uint64_t fingerprint, const std::vector<uint8_t> &key, bool &found) {
+    if ((table.size + 1) * 2 > table.entries.size())
+        grow(table);
+    const auto mask = table.entries.size() - 1;
+    const auto size = key.size();
+    for (auto i = fingerprint & mask;; i = (i + 1) & mask) {
+        auto &entry = table.entries[i];
+        if (entry.offset == 0) {
+            found = false;
+            entry.fingerprint = fingerprint;
+            entry.offset = _arena.size();
+            _arena.push_back(size);
+            _arena.push_back(size >> 8);
+            _arena.insert(_arena.end(), key.begin(), key.end());
+            table.size++;
+            return entry;
+        }
+        if (entry.fingerprint == fingerprint) {
+            const auto p = _arena.data() + entry.offset;
+            if ((p[0] | (p[1] << 8)) == int(size) && memcmp(p + 2, key.data(), size) == 0) {
+                found = true;
+                return entry;
+            }
         }
     }
-    return t;
 }
 
-std::size_t TokenizedText::hash::operator()(const TokenizedText &it) const {
-    std::size_t seed = it.length();
-    for (auto t : it._tokens) {
-        seed ^= t + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+void TokenizedTextSet::grow(Table &table) {
+    std::vector<Entry> entries(table.entries.size() * 2);
+    const auto mask = entries.size() - 1;
+    for (const auto &entry : table.entries) {
+        if (entry.offset == 0)
+            continue;
+        auto i = entry.fingerprint & mask;
+        while (entries[i].offset)
+            i = (i + 1) & mask;
+        entries[i] = entry;
     }
-    return seed;
+    table.entries.swap(entries);
 }
 
 }  // namespace test
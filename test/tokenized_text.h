@@ -17,8 +17,9 @@
 #ifndef __TOKENIZED_TEXT_H__
 #define __TOKENIZED_TEXT_H__
 
+#include <cstddef>
 #include <cstdint>
-#include <string>
+#include <cstdio>
 #include <vector>
 
 namespace libasm {
@@ -26,25 +27,60 @@ namespace gen {
 
 class TokenizedText {
 public:
-    TokenizedText(const char *text);
+    TokenizedText() {}
+    TokenizedText(const char *text) { tokenize(text); }
 
+    void tokenize(const char *text);
     std::size_t length() const { return _tokens.size(); }
-    int count() const { return ++_count; }
+    const uint8_t *tokens() const { return _tokens.data(); }
 
-    struct hash {
-        std::size_t operator()(const TokenizedText &it) const;
+private:
+    std::vector<uint8_t> _tokens;
+};
+
+/**
+ * Set of tokenized operands of each instruction, which counts how many
+ * times each variant is seen. Instruction names are interned into ids,
+ * and token sequences are packed into an arena. Both are looked up by
+ * open addressing tables of fingerprints.
+ */
+class TokenizedTextSet {
+public:
+    TokenizedTextSet();
+
+    /**
+     * Returns zero if |text| is a new variant of instruction |name| of
+     * |length| bytes and inserts it. Otherwise returns how many times it
+     * has been seen, including this one.
+     */
+    int insert(const char *name, int length, const TokenizedText &text);
+
+    /** write the set to |file|, returns false on error */
+    bool write(FILE *file) const;
+    /** read the set written by |write|, returns false on error */
+    bool read(FILE *file);
+
+private:
+    struct Entry {
+        uint64_t fingerprint;
+        uint32_t offset;  // in |_arena|, zero for an empty entry
+        uint32_t value;   // id of a name, count of a variant
     };
-    struct eq {
-        bool operator()(const TokenizedText &a, const TokenizedText &b) const {
-            return a._tokens == b._tokens;
-        }
+
+    struct Table {
+        std::vector<Entry> entries;
+        std::size_t size;
     };
 
-private:
-    const std::vector<uint8_t> _tokens;
-    mutable int _count;
+    std::vector<uint8_t> _arena;
+    Table _names;
+    Table _variants;
+    std::vector<uint8_t> _key;
 
-    static std::vector<uint8_t> tokenize(const char *text);
+    static bool write(FILE *file, const Table &table);
+    static bool read(FILE *file, Table &table);
+    Entry &find(Table &table, uint64_t fingerprint, const std::vector<uint8_t> &key, bool &found);
+    void grow(Table &table);
 };
 
 }  // namespace gen